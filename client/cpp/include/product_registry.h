@@ -65,6 +65,22 @@ inline const std::map<ProductType, ProductSchema>& GetProductSchemas() {
         {ProductType::SampleVolSurfaces, {
             "sample_vol_surfaces_request.fbs",
             "sample_vol_surfaces_response.fbs"
+        }},
+        {ProductType::ComputeCurveRisk, {
+            "curve_risk_request.fbs",
+            "curve_risk_response.fbs"
+        }},
+        {ProductType::BondYieldAnalytics, {
+            "bond_yield_analytics_request.fbs",
+            "bond_yield_analytics_response.fbs"
+        }},
+        {ProductType::UpsertTrades, {
+            "upsert_trades_request.fbs",
+            "upsert_trades_response.fbs"
+        }},
+        {ProductType::DeleteTrades, {
+            "delete_trades_request.fbs",
+            "delete_trades_response.fbs"
         }}
         // ADD NEW PRODUCTS HERE:
         // {ProductType::ExoticOption, {
@@ -90,6 +106,10 @@ inline const char* ProductTypeToString(ProductType type) {
         case ProductType::CDS:              return "CDS";
         case ProductType::BootstrapCurves:  return "BootstrapCurves";
         case ProductType::SampleVolSurfaces:return "SampleVolSurfaces";
+        case ProductType::ComputeCurveRisk: return "ComputeCurveRisk";
+        case ProductType::BondYieldAnalytics: return "BondYieldAnalytics";
+        case ProductType::UpsertTrades:     return "UpsertTrades";
+        case ProductType::DeleteTrades:     return "DeleteTrades";
         // ADD NEW PRODUCTS HERE:
         // case ProductType::ExoticOption:  return "ExoticOption";
         default:                            return "Unknown";
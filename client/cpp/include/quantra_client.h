@@ -20,6 +20,7 @@
 #ifndef QUANTRA_CLIENT_H
 #define QUANTRA_CLIENT_H
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <sstream>
@@ -41,6 +42,10 @@
 #include "cds_response_generated.h"
 #include "bootstrap_curves_response_generated.h"
 #include "sample_vol_surfaces_response_generated.h"
+#include "curve_risk_response_generated.h"
+#include "bond_yield_analytics_response_generated.h"
+#include "upsert_trades_response_generated.h"
+#include "delete_trades_response_generated.h"
 
 namespace quantra {
 
@@ -66,7 +71,11 @@ enum class ProductType {
     Swaption,
     CDS,
     BootstrapCurves,
-    SampleVolSurfaces
+    SampleVolSurfaces,
+    ComputeCurveRisk,
+    BondYieldAnalytics,
+    UpsertTrades,
+    DeleteTrades
 };
 
 const char* ProductTypeToString(ProductType type);
@@ -129,6 +138,10 @@ public:
     JsonResponse PriceCDSJSON(const std::string& json);
     JsonResponse BootstrapCurvesJSON(const std::string& json);
     JsonResponse SampleVolSurfacesJSON(const std::string& json);
+    JsonResponse ComputeCurveRiskJSON(const std::string& json);
+    JsonResponse BondYieldAnalyticsJSON(const std::string& json);
+    JsonResponse UpsertTradesJSON(const std::string& json);
+    JsonResponse DeleteTradesJSON(const std::string& json);
     
     // -------------------------------------------------------------------------
     // Native FlatBuffers API - Maximum performance
@@ -172,6 +185,35 @@ public:
     grpc::Status SampleVolSurfaces(
         const Message<SampleVolSurfacesRequest>& request,
         Message<SampleVolSurfacesResponse>* response);
+
+    grpc::Status ComputeCurveRisk(
+        const Message<ComputeCurveRiskRequest>& request,
+        Message<ComputeCurveRiskResponse>* response);
+
+    grpc::Status BondYieldAnalytics(
+        const Message<BondYieldAnalyticsRequest>& request,
+        Message<BondYieldAnalyticsResponse>* response);
+
+    grpc::Status UpsertTrades(
+        const Message<UpsertTradesRequest>& request,
+        Message<UpsertTradesResponse>* response);
+
+    grpc::Status DeleteTrades(
+        const Message<DeleteTradesRequest>& request,
+        Message<DeleteTradesResponse>* response);
+
+    // Server-streaming variants: `onMessage` is called once per query, in
+    // query order, with a response holding that query's result only.
+    template<typename T>
+    using MessageCallback = std::function<void(const Message<T>&)>;
+
+    grpc::Status BootstrapCurvesStream(
+        const Message<BootstrapCurvesRequest>& request,
+        const MessageCallback<BootstrapCurvesResponse>& onMessage);
+
+    grpc::Status SampleVolSurfacesStream(
+        const Message<SampleVolSurfacesRequest>& request,
+        const MessageCallback<SampleVolSurfacesResponse>& onMessage);
     
     // -------------------------------------------------------------------------
     // Accessors
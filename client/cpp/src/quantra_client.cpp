@@ -186,6 +186,30 @@ JsonResponse QuantraClient::SampleVolSurfacesJSON(const std::string& json) {
     );
 }
 
+JsonResponse QuantraClient::ComputeCurveRiskJSON(const std::string& json) {
+    return impl_->CallJSON<ComputeCurveRiskRequest, ComputeCurveRiskResponse>(
+        ProductType::ComputeCurveRisk, json, &QuantraServer::Stub::ComputeCurveRisk
+    );
+}
+
+JsonResponse QuantraClient::BondYieldAnalyticsJSON(const std::string& json) {
+    return impl_->CallJSON<BondYieldAnalyticsRequest, BondYieldAnalyticsResponse>(
+        ProductType::BondYieldAnalytics, json, &QuantraServer::Stub::BondYieldAnalytics
+    );
+}
+
+JsonResponse QuantraClient::UpsertTradesJSON(const std::string& json) {
+    return impl_->CallJSON<UpsertTradesRequest, UpsertTradesResponse>(
+        ProductType::UpsertTrades, json, &QuantraServer::Stub::UpsertTrades
+    );
+}
+
+JsonResponse QuantraClient::DeleteTradesJSON(const std::string& json) {
+    return impl_->CallJSON<DeleteTradesRequest, DeleteTradesResponse>(
+        ProductType::DeleteTrades, json, &QuantraServer::Stub::DeleteTrades
+    );
+}
+
 // =============================================================================
 // Native FlatBuffers API Implementation
 // =============================================================================
@@ -262,4 +286,62 @@ grpc::Status QuantraClient::SampleVolSurfaces(
     return impl_->GetStub()->SampleVolSurfaces(&context, request, response);
 }
 
+grpc::Status QuantraClient::ComputeCurveRisk(
+    const Message<ComputeCurveRiskRequest>& request,
+    Message<ComputeCurveRiskResponse>* response
+) {
+    grpc::ClientContext context;
+    return impl_->GetStub()->ComputeCurveRisk(&context, request, response);
+}
+
+grpc::Status QuantraClient::BondYieldAnalytics(
+    const Message<BondYieldAnalyticsRequest>& request,
+    Message<BondYieldAnalyticsResponse>* response
+) {
+    grpc::ClientContext context;
+    return impl_->GetStub()->BondYieldAnalytics(&context, request, response);
+}
+
+grpc::Status QuantraClient::UpsertTrades(
+    const Message<UpsertTradesRequest>& request,
+    Message<UpsertTradesResponse>* response
+) {
+    grpc::ClientContext context;
+    return impl_->GetStub()->UpsertTrades(&context, request, response);
+}
+
+grpc::Status QuantraClient::DeleteTrades(
+    const Message<DeleteTradesRequest>& request,
+    Message<DeleteTradesResponse>* response
+) {
+    grpc::ClientContext context;
+    return impl_->GetStub()->DeleteTrades(&context, request, response);
+}
+
+grpc::Status QuantraClient::BootstrapCurvesStream(
+    const Message<BootstrapCurvesRequest>& request,
+    const MessageCallback<BootstrapCurvesResponse>& onMessage
+) {
+    grpc::ClientContext context;
+    auto reader = impl_->GetStub()->BootstrapCurvesStream(&context, request);
+    Message<BootstrapCurvesResponse> response;
+    while (reader->Read(&response)) {
+        onMessage(response);
+    }
+    return reader->Finish();
+}
+
+grpc::Status QuantraClient::SampleVolSurfacesStream(
+    const Message<SampleVolSurfacesRequest>& request,
+    const MessageCallback<SampleVolSurfacesResponse>& onMessage
+) {
+    grpc::ClientContext context;
+    auto reader = impl_->GetStub()->SampleVolSurfacesStream(&context, request);
+    Message<SampleVolSurfacesResponse> response;
+    while (reader->Read(&response)) {
+        onMessage(response);
+    }
+    return reader->Finish();
+}
+
 } // namespace quantra
\ No newline at end of file
@@ -0,0 +1,416 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BONDYIELDANALYTICSREQUEST_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_BONDYIELDANALYTICSREQUEST_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+#include "common_generated.h"
+#include "fixed_rate_bond_generated.h"
+
+namespace quantra {
+
+struct BondYieldQuote;
+struct BondYieldQuoteBuilder;
+struct BondYieldQuoteT;
+
+struct BondYieldAnalyticsRequest;
+struct BondYieldAnalyticsRequestBuilder;
+struct BondYieldAnalyticsRequestT;
+
+enum BondQuoteType : int8_t {
+  BondQuoteType_CleanPrice = 0,
+  BondQuoteType_Yield = 1,
+  BondQuoteType_MIN = BondQuoteType_CleanPrice,
+  BondQuoteType_MAX = BondQuoteType_Yield
+};
+
+inline const BondQuoteType (&EnumValuesBondQuoteType())[2] {
+  static const BondQuoteType values[] = {
+    BondQuoteType_CleanPrice,
+    BondQuoteType_Yield
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesBondQuoteType() {
+  static const char * const names[3] = {
+    "CleanPrice",
+    "Yield",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameBondQuoteType(BondQuoteType e) {
+  if (::flatbuffers::IsOutRange(e, BondQuoteType_CleanPrice, BondQuoteType_Yield)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesBondQuoteType()[index];
+}
+
+struct BondYieldQuoteT : public ::flatbuffers::NativeTable {
+  typedef BondYieldQuote TableType;
+  std::unique_ptr<quantra::FixedRateBondT> fixed_rate_bond{};
+  std::unique_ptr<quantra::YieldT> yield{};
+  quantra::BondQuoteType quote_type = quantra::BondQuoteType_CleanPrice;
+  double clean_price = 0.0;
+  double yield_rate = 0.0;
+  BondYieldQuoteT() = default;
+  BondYieldQuoteT(const BondYieldQuoteT &o);
+  BondYieldQuoteT(BondYieldQuoteT&&) FLATBUFFERS_NOEXCEPT = default;
+  BondYieldQuoteT &operator=(BondYieldQuoteT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// A bond and the quote to convert under its yield convention.
+struct BondYieldQuote FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BondYieldQuoteT NativeTableType;
+  typedef BondYieldQuoteBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_FIXED_RATE_BOND = 4,
+    VT_YIELD = 6,
+    VT_QUOTE_TYPE = 8,
+    VT_CLEAN_PRICE = 10,
+    VT_YIELD_RATE = 12
+  };
+  const quantra::FixedRateBond *fixed_rate_bond() const {
+    return GetPointer<const quantra::FixedRateBond *>(VT_FIXED_RATE_BOND);
+  }
+  const quantra::Yield *yield() const {
+    return GetPointer<const quantra::Yield *>(VT_YIELD);
+  }
+  quantra::BondQuoteType quote_type() const {
+    return static_cast<quantra::BondQuoteType>(GetField<int8_t>(VT_QUOTE_TYPE, 0));
+  }
+  /// Per 100 notional; read when quote_type is CleanPrice.
+  double clean_price() const {
+    return GetField<double>(VT_CLEAN_PRICE, 0.0);
+  }
+  /// Read when quote_type is Yield.
+  double yield_rate() const {
+    return GetField<double>(VT_YIELD_RATE, 0.0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_FIXED_RATE_BOND) &&
+           verifier.VerifyTable(fixed_rate_bond()) &&
+           VerifyOffsetRequired(verifier, VT_YIELD) &&
+           verifier.VerifyTable(yield()) &&
+           VerifyField<int8_t>(verifier, VT_QUOTE_TYPE, 1) &&
+           VerifyField<double>(verifier, VT_CLEAN_PRICE, 8) &&
+           VerifyField<double>(verifier, VT_YIELD_RATE, 8) &&
+           verifier.EndTable();
+  }
+  BondYieldQuoteT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BondYieldQuoteT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<BondYieldQuote> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldQuoteT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct BondYieldQuoteBuilder {
+  typedef BondYieldQuote Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_fixed_rate_bond(::flatbuffers::Offset<quantra::FixedRateBond> fixed_rate_bond) {
+    fbb_.AddOffset(BondYieldQuote::VT_FIXED_RATE_BOND, fixed_rate_bond);
+  }
+  void add_yield(::flatbuffers::Offset<quantra::Yield> yield) {
+    fbb_.AddOffset(BondYieldQuote::VT_YIELD, yield);
+  }
+  void add_quote_type(quantra::BondQuoteType quote_type) {
+    fbb_.AddElement<int8_t>(BondYieldQuote::VT_QUOTE_TYPE, static_cast<int8_t>(quote_type), 0);
+  }
+  void add_clean_price(double clean_price) {
+    fbb_.AddElement<double>(BondYieldQuote::VT_CLEAN_PRICE, clean_price, 0.0);
+  }
+  void add_yield_rate(double yield_rate) {
+    fbb_.AddElement<double>(BondYieldQuote::VT_YIELD_RATE, yield_rate, 0.0);
+  }
+  explicit BondYieldQuoteBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<BondYieldQuote> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<BondYieldQuote>(end);
+    fbb_.Required(o, BondYieldQuote::VT_FIXED_RATE_BOND);
+    fbb_.Required(o, BondYieldQuote::VT_YIELD);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<BondYieldQuote> CreateBondYieldQuote(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<quantra::FixedRateBond> fixed_rate_bond = 0,
+    ::flatbuffers::Offset<quantra::Yield> yield = 0,
+    quantra::BondQuoteType quote_type = quantra::BondQuoteType_CleanPrice,
+    double clean_price = 0.0,
+    double yield_rate = 0.0) {
+  BondYieldQuoteBuilder builder_(_fbb);
+  builder_.add_yield_rate(yield_rate);
+  builder_.add_clean_price(clean_price);
+  builder_.add_yield(yield);
+  builder_.add_fixed_rate_bond(fixed_rate_bond);
+  builder_.add_quote_type(quote_type);
+  return builder_.Finish();
+}
+
+::flatbuffers::Offset<BondYieldQuote> CreateBondYieldQuote(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldQuoteT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct BondYieldAnalyticsRequestT : public ::flatbuffers::NativeTable {
+  typedef BondYieldAnalyticsRequest TableType;
+  std::string as_of_date{};
+  std::string settlement_date{};
+  std::vector<std::unique_ptr<quantra::BondYieldQuoteT>> bonds{};
+  BondYieldAnalyticsRequestT() = default;
+  BondYieldAnalyticsRequestT(const BondYieldAnalyticsRequestT &o);
+  BondYieldAnalyticsRequestT(BondYieldAnalyticsRequestT&&) FLATBUFFERS_NOEXCEPT = default;
+  BondYieldAnalyticsRequestT &operator=(BondYieldAnalyticsRequestT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// Price/yield conversion and yield-based risk for a set of bonds.
+///
+/// No curves are involved: only the bonds' cash flows and the quotes, so
+/// nothing is bootstrapped.
+struct BondYieldAnalyticsRequest FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BondYieldAnalyticsRequestT NativeTableType;
+  typedef BondYieldAnalyticsRequestBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_AS_OF_DATE = 4,
+    VT_SETTLEMENT_DATE = 6,
+    VT_BONDS = 8
+  };
+  const ::flatbuffers::String *as_of_date() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_AS_OF_DATE);
+  }
+  /// Date for duration and convexity; each bond's own settlement date
+  /// when absent. Yields and prices are always at the bond's settlement.
+  const ::flatbuffers::String *settlement_date() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_SETTLEMENT_DATE);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::BondYieldQuote>> *bonds() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::BondYieldQuote>> *>(VT_BONDS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_AS_OF_DATE) &&
+           verifier.VerifyString(as_of_date()) &&
+           VerifyOffset(verifier, VT_SETTLEMENT_DATE) &&
+           verifier.VerifyString(settlement_date()) &&
+           VerifyOffsetRequired(verifier, VT_BONDS) &&
+           verifier.VerifyVector(bonds()) &&
+           verifier.VerifyVectorOfTables(bonds()) &&
+           verifier.EndTable();
+  }
+  BondYieldAnalyticsRequestT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BondYieldAnalyticsRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<BondYieldAnalyticsRequest> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct BondYieldAnalyticsRequestBuilder {
+  typedef BondYieldAnalyticsRequest Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_as_of_date(::flatbuffers::Offset<::flatbuffers::String> as_of_date) {
+    fbb_.AddOffset(BondYieldAnalyticsRequest::VT_AS_OF_DATE, as_of_date);
+  }
+  void add_settlement_date(::flatbuffers::Offset<::flatbuffers::String> settlement_date) {
+    fbb_.AddOffset(BondYieldAnalyticsRequest::VT_SETTLEMENT_DATE, settlement_date);
+  }
+  void add_bonds(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::BondYieldQuote>>> bonds) {
+    fbb_.AddOffset(BondYieldAnalyticsRequest::VT_BONDS, bonds);
+  }
+  explicit BondYieldAnalyticsRequestBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<BondYieldAnalyticsRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<BondYieldAnalyticsRequest>(end);
+    fbb_.Required(o, BondYieldAnalyticsRequest::VT_AS_OF_DATE);
+    fbb_.Required(o, BondYieldAnalyticsRequest::VT_BONDS);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsRequest> CreateBondYieldAnalyticsRequest(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> as_of_date = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> settlement_date = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::BondYieldQuote>>> bonds = 0) {
+  BondYieldAnalyticsRequestBuilder builder_(_fbb);
+  builder_.add_bonds(bonds);
+  builder_.add_settlement_date(settlement_date);
+  builder_.add_as_of_date(as_of_date);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsRequest> CreateBondYieldAnalyticsRequestDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *as_of_date = nullptr,
+    const char *settlement_date = nullptr,
+    const std::vector<::flatbuffers::Offset<quantra::BondYieldQuote>> *bonds = nullptr) {
+  auto as_of_date__ = as_of_date ? _fbb.CreateString(as_of_date) : 0;
+  auto settlement_date__ = settlement_date ? _fbb.CreateString(settlement_date) : 0;
+  auto bonds__ = bonds ? _fbb.CreateVector<::flatbuffers::Offset<quantra::BondYieldQuote>>(*bonds) : 0;
+  return quantra::CreateBondYieldAnalyticsRequest(
+      _fbb,
+      as_of_date__,
+      settlement_date__,
+      bonds__);
+}
+
+::flatbuffers::Offset<BondYieldAnalyticsRequest> CreateBondYieldAnalyticsRequest(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline BondYieldQuoteT::BondYieldQuoteT(const BondYieldQuoteT &o)
+      : fixed_rate_bond((o.fixed_rate_bond) ? new quantra::FixedRateBondT(*o.fixed_rate_bond) : nullptr),
+        yield((o.yield) ? new quantra::YieldT(*o.yield) : nullptr),
+        quote_type(o.quote_type),
+        clean_price(o.clean_price),
+        yield_rate(o.yield_rate) {
+}
+
+inline BondYieldQuoteT &BondYieldQuoteT::operator=(BondYieldQuoteT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(fixed_rate_bond, o.fixed_rate_bond);
+  std::swap(yield, o.yield);
+  std::swap(quote_type, o.quote_type);
+  std::swap(clean_price, o.clean_price);
+  std::swap(yield_rate, o.yield_rate);
+  return *this;
+}
+
+inline BondYieldQuoteT *BondYieldQuote::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<BondYieldQuoteT>(new BondYieldQuoteT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void BondYieldQuote::UnPackTo(BondYieldQuoteT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = fixed_rate_bond(); if (_e) { if(_o->fixed_rate_bond) { _e->UnPackTo(_o->fixed_rate_bond.get(), _resolver); } else { _o->fixed_rate_bond = std::unique_ptr<quantra::FixedRateBondT>(_e->UnPack(_resolver)); } } else if (_o->fixed_rate_bond) { _o->fixed_rate_bond.reset(); } }
+  { auto _e = yield(); if (_e) { if(_o->yield) { _e->UnPackTo(_o->yield.get(), _resolver); } else { _o->yield = std::unique_ptr<quantra::YieldT>(_e->UnPack(_resolver)); } } else if (_o->yield) { _o->yield.reset(); } }
+  { auto _e = quote_type(); _o->quote_type = _e; }
+  { auto _e = clean_price(); _o->clean_price = _e; }
+  { auto _e = yield_rate(); _o->yield_rate = _e; }
+}
+
+inline ::flatbuffers::Offset<BondYieldQuote> BondYieldQuote::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldQuoteT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBondYieldQuote(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<BondYieldQuote> CreateBondYieldQuote(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldQuoteT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const BondYieldQuoteT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _fixed_rate_bond = _o->fixed_rate_bond ? CreateFixedRateBond(_fbb, _o->fixed_rate_bond.get(), _rehasher) : 0;
+  auto _yield = _o->yield ? CreateYield(_fbb, _o->yield.get(), _rehasher) : 0;
+  auto _quote_type = _o->quote_type;
+  auto _clean_price = _o->clean_price;
+  auto _yield_rate = _o->yield_rate;
+  return quantra::CreateBondYieldQuote(
+      _fbb,
+      _fixed_rate_bond,
+      _yield,
+      _quote_type,
+      _clean_price,
+      _yield_rate);
+}
+
+inline BondYieldAnalyticsRequestT::BondYieldAnalyticsRequestT(const BondYieldAnalyticsRequestT &o)
+      : as_of_date(o.as_of_date),
+        settlement_date(o.settlement_date) {
+  bonds.reserve(o.bonds.size());
+  for (const auto &bonds_ : o.bonds) { bonds.emplace_back((bonds_) ? new quantra::BondYieldQuoteT(*bonds_) : nullptr); }
+}
+
+inline BondYieldAnalyticsRequestT &BondYieldAnalyticsRequestT::operator=(BondYieldAnalyticsRequestT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(as_of_date, o.as_of_date);
+  std::swap(settlement_date, o.settlement_date);
+  std::swap(bonds, o.bonds);
+  return *this;
+}
+
+inline BondYieldAnalyticsRequestT *BondYieldAnalyticsRequest::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<BondYieldAnalyticsRequestT>(new BondYieldAnalyticsRequestT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void BondYieldAnalyticsRequest::UnPackTo(BondYieldAnalyticsRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = as_of_date(); if (_e) _o->as_of_date = _e->str(); }
+  { auto _e = settlement_date(); if (_e) _o->settlement_date = _e->str(); }
+  { auto _e = bonds(); if (_e) { _o->bonds.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->bonds[_i]) { _e->Get(_i)->UnPackTo(_o->bonds[_i].get(), _resolver); } else { _o->bonds[_i] = std::unique_ptr<quantra::BondYieldQuoteT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->bonds.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsRequest> BondYieldAnalyticsRequest::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBondYieldAnalyticsRequest(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsRequest> CreateBondYieldAnalyticsRequest(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const BondYieldAnalyticsRequestT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _as_of_date = _fbb.CreateString(_o->as_of_date);
+  auto _settlement_date = _o->settlement_date.empty() ? 0 : _fbb.CreateString(_o->settlement_date);
+  auto _bonds = _fbb.CreateVector<::flatbuffers::Offset<quantra::BondYieldQuote>> (_o->bonds.size(), [](size_t i, _VectorArgs *__va) { return CreateBondYieldQuote(*__va->__fbb, __va->__o->bonds[i].get(), __va->__rehasher); }, &_va );
+  return quantra::CreateBondYieldAnalyticsRequest(
+      _fbb,
+      _as_of_date,
+      _settlement_date,
+      _bonds);
+}
+
+inline const quantra::BondYieldAnalyticsRequest *GetBondYieldAnalyticsRequest(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::BondYieldAnalyticsRequest>(buf);
+}
+
+inline const quantra::BondYieldAnalyticsRequest *GetSizePrefixedBondYieldAnalyticsRequest(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::BondYieldAnalyticsRequest>(buf);
+}
+
+inline bool VerifyBondYieldAnalyticsRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::BondYieldAnalyticsRequest>(nullptr);
+}
+
+inline bool VerifySizePrefixedBondYieldAnalyticsRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::BondYieldAnalyticsRequest>(nullptr);
+}
+
+inline void FinishBondYieldAnalyticsRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::BondYieldAnalyticsRequest> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedBondYieldAnalyticsRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::BondYieldAnalyticsRequest> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::BondYieldAnalyticsRequestT> UnPackBondYieldAnalyticsRequest(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::BondYieldAnalyticsRequestT>(GetBondYieldAnalyticsRequest(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::BondYieldAnalyticsRequestT> UnPackSizePrefixedBondYieldAnalyticsRequest(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::BondYieldAnalyticsRequestT>(GetSizePrefixedBondYieldAnalyticsRequest(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_BONDYIELDANALYTICSREQUEST_QUANTRA_H_
@@ -0,0 +1,441 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_BONDYIELDANALYTICSRESPONSE_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_BONDYIELDANALYTICSRESPONSE_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+#include "common_generated.h"
+
+namespace quantra {
+
+struct BondYieldAnalyticsResult;
+struct BondYieldAnalyticsResultBuilder;
+struct BondYieldAnalyticsResultT;
+
+struct BondYieldAnalyticsResponse;
+struct BondYieldAnalyticsResponseBuilder;
+struct BondYieldAnalyticsResponseT;
+
+struct BondYieldAnalyticsResultT : public ::flatbuffers::NativeTable {
+  typedef BondYieldAnalyticsResult TableType;
+  double clean_price = 0.0;
+  double dirty_price = 0.0;
+  double accrued_amount = 0.0;
+  double yield = 0.0;
+  double accrued_days = 0.0;
+  double macaulay_duration = 0.0;
+  double modified_duration = 0.0;
+  double convexity = 0.0;
+  std::string settlement_date{};
+  std::unique_ptr<quantra::ErrorT> error{};
+  BondYieldAnalyticsResultT() = default;
+  BondYieldAnalyticsResultT(const BondYieldAnalyticsResultT &o);
+  BondYieldAnalyticsResultT(BondYieldAnalyticsResultT&&) FLATBUFFERS_NOEXCEPT = default;
+  BondYieldAnalyticsResultT &operator=(BondYieldAnalyticsResultT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// Analytics of one bond, in request order.
+struct BondYieldAnalyticsResult FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BondYieldAnalyticsResultT NativeTableType;
+  typedef BondYieldAnalyticsResultBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CLEAN_PRICE = 4,
+    VT_DIRTY_PRICE = 6,
+    VT_ACCRUED_AMOUNT = 8,
+    VT_YIELD = 10,
+    VT_ACCRUED_DAYS = 12,
+    VT_MACAULAY_DURATION = 14,
+    VT_MODIFIED_DURATION = 16,
+    VT_CONVEXITY = 18,
+    VT_SETTLEMENT_DATE = 20,
+    VT_ERROR = 22
+  };
+  double clean_price() const {
+    return GetField<double>(VT_CLEAN_PRICE, 0.0);
+  }
+  double dirty_price() const {
+    return GetField<double>(VT_DIRTY_PRICE, 0.0);
+  }
+  double accrued_amount() const {
+    return GetField<double>(VT_ACCRUED_AMOUNT, 0.0);
+  }
+  double yield() const {
+    return GetField<double>(VT_YIELD, 0.0);
+  }
+  double accrued_days() const {
+    return GetField<double>(VT_ACCRUED_DAYS, 0.0);
+  }
+  double macaulay_duration() const {
+    return GetField<double>(VT_MACAULAY_DURATION, 0.0);
+  }
+  double modified_duration() const {
+    return GetField<double>(VT_MODIFIED_DURATION, 0.0);
+  }
+  double convexity() const {
+    return GetField<double>(VT_CONVEXITY, 0.0);
+  }
+  const ::flatbuffers::String *settlement_date() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_SETTLEMENT_DATE);
+  }
+  const quantra::Error *error() const {
+    return GetPointer<const quantra::Error *>(VT_ERROR);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<double>(verifier, VT_CLEAN_PRICE, 8) &&
+           VerifyField<double>(verifier, VT_DIRTY_PRICE, 8) &&
+           VerifyField<double>(verifier, VT_ACCRUED_AMOUNT, 8) &&
+           VerifyField<double>(verifier, VT_YIELD, 8) &&
+           VerifyField<double>(verifier, VT_ACCRUED_DAYS, 8) &&
+           VerifyField<double>(verifier, VT_MACAULAY_DURATION, 8) &&
+           VerifyField<double>(verifier, VT_MODIFIED_DURATION, 8) &&
+           VerifyField<double>(verifier, VT_CONVEXITY, 8) &&
+           VerifyOffset(verifier, VT_SETTLEMENT_DATE) &&
+           verifier.VerifyString(settlement_date()) &&
+           VerifyOffset(verifier, VT_ERROR) &&
+           verifier.VerifyTable(error()) &&
+           verifier.EndTable();
+  }
+  BondYieldAnalyticsResultT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BondYieldAnalyticsResultT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<BondYieldAnalyticsResult> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsResultT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct BondYieldAnalyticsResultBuilder {
+  typedef BondYieldAnalyticsResult Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_clean_price(double clean_price) {
+    fbb_.AddElement<double>(BondYieldAnalyticsResult::VT_CLEAN_PRICE, clean_price, 0.0);
+  }
+  void add_dirty_price(double dirty_price) {
+    fbb_.AddElement<double>(BondYieldAnalyticsResult::VT_DIRTY_PRICE, dirty_price, 0.0);
+  }
+  void add_accrued_amount(double accrued_amount) {
+    fbb_.AddElement<double>(BondYieldAnalyticsResult::VT_ACCRUED_AMOUNT, accrued_amount, 0.0);
+  }
+  void add_yield(double yield) {
+    fbb_.AddElement<double>(BondYieldAnalyticsResult::VT_YIELD, yield, 0.0);
+  }
+  void add_accrued_days(double accrued_days) {
+    fbb_.AddElement<double>(BondYieldAnalyticsResult::VT_ACCRUED_DAYS, accrued_days, 0.0);
+  }
+  void add_macaulay_duration(double macaulay_duration) {
+    fbb_.AddElement<double>(BondYieldAnalyticsResult::VT_MACAULAY_DURATION, macaulay_duration, 0.0);
+  }
+  void add_modified_duration(double modified_duration) {
+    fbb_.AddElement<double>(BondYieldAnalyticsResult::VT_MODIFIED_DURATION, modified_duration, 0.0);
+  }
+  void add_convexity(double convexity) {
+    fbb_.AddElement<double>(BondYieldAnalyticsResult::VT_CONVEXITY, convexity, 0.0);
+  }
+  void add_settlement_date(::flatbuffers::Offset<::flatbuffers::String> settlement_date) {
+    fbb_.AddOffset(BondYieldAnalyticsResult::VT_SETTLEMENT_DATE, settlement_date);
+  }
+  void add_error(::flatbuffers::Offset<quantra::Error> error) {
+    fbb_.AddOffset(BondYieldAnalyticsResult::VT_ERROR, error);
+  }
+  explicit BondYieldAnalyticsResultBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<BondYieldAnalyticsResult> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<BondYieldAnalyticsResult>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsResult> CreateBondYieldAnalyticsResult(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    double clean_price = 0.0,
+    double dirty_price = 0.0,
+    double accrued_amount = 0.0,
+    double yield = 0.0,
+    double accrued_days = 0.0,
+    double macaulay_duration = 0.0,
+    double modified_duration = 0.0,
+    double convexity = 0.0,
+    ::flatbuffers::Offset<::flatbuffers::String> settlement_date = 0,
+    ::flatbuffers::Offset<quantra::Error> error = 0) {
+  BondYieldAnalyticsResultBuilder builder_(_fbb);
+  builder_.add_convexity(convexity);
+  builder_.add_modified_duration(modified_duration);
+  builder_.add_macaulay_duration(macaulay_duration);
+  builder_.add_accrued_days(accrued_days);
+  builder_.add_yield(yield);
+  builder_.add_accrued_amount(accrued_amount);
+  builder_.add_dirty_price(dirty_price);
+  builder_.add_clean_price(clean_price);
+  builder_.add_error(error);
+  builder_.add_settlement_date(settlement_date);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsResult> CreateBondYieldAnalyticsResultDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    double clean_price = 0.0,
+    double dirty_price = 0.0,
+    double accrued_amount = 0.0,
+    double yield = 0.0,
+    double accrued_days = 0.0,
+    double macaulay_duration = 0.0,
+    double modified_duration = 0.0,
+    double convexity = 0.0,
+    const char *settlement_date = nullptr,
+    ::flatbuffers::Offset<quantra::Error> error = 0) {
+  auto settlement_date__ = settlement_date ? _fbb.CreateString(settlement_date) : 0;
+  return quantra::CreateBondYieldAnalyticsResult(
+      _fbb,
+      clean_price,
+      dirty_price,
+      accrued_amount,
+      yield,
+      accrued_days,
+      macaulay_duration,
+      modified_duration,
+      convexity,
+      settlement_date__,
+      error);
+}
+
+::flatbuffers::Offset<BondYieldAnalyticsResult> CreateBondYieldAnalyticsResult(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsResultT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct BondYieldAnalyticsResponseT : public ::flatbuffers::NativeTable {
+  typedef BondYieldAnalyticsResponse TableType;
+  std::vector<std::unique_ptr<quantra::BondYieldAnalyticsResultT>> results{};
+  BondYieldAnalyticsResponseT() = default;
+  BondYieldAnalyticsResponseT(const BondYieldAnalyticsResponseT &o);
+  BondYieldAnalyticsResponseT(BondYieldAnalyticsResponseT&&) FLATBUFFERS_NOEXCEPT = default;
+  BondYieldAnalyticsResponseT &operator=(BondYieldAnalyticsResponseT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct BondYieldAnalyticsResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef BondYieldAnalyticsResponseT NativeTableType;
+  typedef BondYieldAnalyticsResponseBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_RESULTS = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::BondYieldAnalyticsResult>> *results() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::BondYieldAnalyticsResult>> *>(VT_RESULTS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_RESULTS) &&
+           verifier.VerifyVector(results()) &&
+           verifier.VerifyVectorOfTables(results()) &&
+           verifier.EndTable();
+  }
+  BondYieldAnalyticsResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(BondYieldAnalyticsResponseT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<BondYieldAnalyticsResponse> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct BondYieldAnalyticsResponseBuilder {
+  typedef BondYieldAnalyticsResponse Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_results(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::BondYieldAnalyticsResult>>> results) {
+    fbb_.AddOffset(BondYieldAnalyticsResponse::VT_RESULTS, results);
+  }
+  explicit BondYieldAnalyticsResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<BondYieldAnalyticsResponse> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<BondYieldAnalyticsResponse>(end);
+    fbb_.Required(o, BondYieldAnalyticsResponse::VT_RESULTS);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsResponse> CreateBondYieldAnalyticsResponse(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::BondYieldAnalyticsResult>>> results = 0) {
+  BondYieldAnalyticsResponseBuilder builder_(_fbb);
+  builder_.add_results(results);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsResponse> CreateBondYieldAnalyticsResponseDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<quantra::BondYieldAnalyticsResult>> *results = nullptr) {
+  auto results__ = results ? _fbb.CreateVector<::flatbuffers::Offset<quantra::BondYieldAnalyticsResult>>(*results) : 0;
+  return quantra::CreateBondYieldAnalyticsResponse(
+      _fbb,
+      results__);
+}
+
+::flatbuffers::Offset<BondYieldAnalyticsResponse> CreateBondYieldAnalyticsResponse(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline BondYieldAnalyticsResultT::BondYieldAnalyticsResultT(const BondYieldAnalyticsResultT &o)
+      : clean_price(o.clean_price),
+        dirty_price(o.dirty_price),
+        accrued_amount(o.accrued_amount),
+        yield(o.yield),
+        accrued_days(o.accrued_days),
+        macaulay_duration(o.macaulay_duration),
+        modified_duration(o.modified_duration),
+        convexity(o.convexity),
+        settlement_date(o.settlement_date),
+        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr) {
+}
+
+inline BondYieldAnalyticsResultT &BondYieldAnalyticsResultT::operator=(BondYieldAnalyticsResultT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(clean_price, o.clean_price);
+  std::swap(dirty_price, o.dirty_price);
+  std::swap(accrued_amount, o.accrued_amount);
+  std::swap(yield, o.yield);
+  std::swap(accrued_days, o.accrued_days);
+  std::swap(macaulay_duration, o.macaulay_duration);
+  std::swap(modified_duration, o.modified_duration);
+  std::swap(convexity, o.convexity);
+  std::swap(settlement_date, o.settlement_date);
+  std::swap(error, o.error);
+  return *this;
+}
+
+inline BondYieldAnalyticsResultT *BondYieldAnalyticsResult::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<BondYieldAnalyticsResultT>(new BondYieldAnalyticsResultT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void BondYieldAnalyticsResult::UnPackTo(BondYieldAnalyticsResultT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = clean_price(); _o->clean_price = _e; }
+  { auto _e = dirty_price(); _o->dirty_price = _e; }
+  { auto _e = accrued_amount(); _o->accrued_amount = _e; }
+  { auto _e = yield(); _o->yield = _e; }
+  { auto _e = accrued_days(); _o->accrued_days = _e; }
+  { auto _e = macaulay_duration(); _o->macaulay_duration = _e; }
+  { auto _e = modified_duration(); _o->modified_duration = _e; }
+  { auto _e = convexity(); _o->convexity = _e; }
+  { auto _e = settlement_date(); if (_e) _o->settlement_date = _e->str(); }
+  { auto _e = error(); if (_e) { if(_o->error) { _e->UnPackTo(_o->error.get(), _resolver); } else { _o->error = std::unique_ptr<quantra::ErrorT>(_e->UnPack(_resolver)); } } else if (_o->error) { _o->error.reset(); } }
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsResult> BondYieldAnalyticsResult::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsResultT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBondYieldAnalyticsResult(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsResult> CreateBondYieldAnalyticsResult(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsResultT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const BondYieldAnalyticsResultT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _clean_price = _o->clean_price;
+  auto _dirty_price = _o->dirty_price;
+  auto _accrued_amount = _o->accrued_amount;
+  auto _yield = _o->yield;
+  auto _accrued_days = _o->accrued_days;
+  auto _macaulay_duration = _o->macaulay_duration;
+  auto _modified_duration = _o->modified_duration;
+  auto _convexity = _o->convexity;
+  auto _settlement_date = _o->settlement_date.empty() ? 0 : _fbb.CreateString(_o->settlement_date);
+  auto _error = _o->error ? CreateError(_fbb, _o->error.get(), _rehasher) : 0;
+  return quantra::CreateBondYieldAnalyticsResult(
+      _fbb,
+      _clean_price,
+      _dirty_price,
+      _accrued_amount,
+      _yield,
+      _accrued_days,
+      _macaulay_duration,
+      _modified_duration,
+      _convexity,
+      _settlement_date,
+      _error);
+}
+
+inline BondYieldAnalyticsResponseT::BondYieldAnalyticsResponseT(const BondYieldAnalyticsResponseT &o) {
+  results.reserve(o.results.size());
+  for (const auto &results_ : o.results) { results.emplace_back((results_) ? new quantra::BondYieldAnalyticsResultT(*results_) : nullptr); }
+}
+
+inline BondYieldAnalyticsResponseT &BondYieldAnalyticsResponseT::operator=(BondYieldAnalyticsResponseT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(results, o.results);
+  return *this;
+}
+
+inline BondYieldAnalyticsResponseT *BondYieldAnalyticsResponse::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<BondYieldAnalyticsResponseT>(new BondYieldAnalyticsResponseT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void BondYieldAnalyticsResponse::UnPackTo(BondYieldAnalyticsResponseT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = results(); if (_e) { _o->results.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->results[_i]) { _e->Get(_i)->UnPackTo(_o->results[_i].get(), _resolver); } else { _o->results[_i] = std::unique_ptr<quantra::BondYieldAnalyticsResultT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->results.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsResponse> BondYieldAnalyticsResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateBondYieldAnalyticsResponse(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<BondYieldAnalyticsResponse> CreateBondYieldAnalyticsResponse(::flatbuffers::FlatBufferBuilder &_fbb, const BondYieldAnalyticsResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const BondYieldAnalyticsResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _results = _fbb.CreateVector<::flatbuffers::Offset<quantra::BondYieldAnalyticsResult>> (_o->results.size(), [](size_t i, _VectorArgs *__va) { return CreateBondYieldAnalyticsResult(*__va->__fbb, __va->__o->results[i].get(), __va->__rehasher); }, &_va );
+  return quantra::CreateBondYieldAnalyticsResponse(
+      _fbb,
+      _results);
+}
+
+inline const quantra::BondYieldAnalyticsResponse *GetBondYieldAnalyticsResponse(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::BondYieldAnalyticsResponse>(buf);
+}
+
+inline const quantra::BondYieldAnalyticsResponse *GetSizePrefixedBondYieldAnalyticsResponse(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::BondYieldAnalyticsResponse>(buf);
+}
+
+inline bool VerifyBondYieldAnalyticsResponseBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::BondYieldAnalyticsResponse>(nullptr);
+}
+
+inline bool VerifySizePrefixedBondYieldAnalyticsResponseBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::BondYieldAnalyticsResponse>(nullptr);
+}
+
+inline void FinishBondYieldAnalyticsResponseBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::BondYieldAnalyticsResponse> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedBondYieldAnalyticsResponseBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::BondYieldAnalyticsResponse> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::BondYieldAnalyticsResponseT> UnPackBondYieldAnalyticsResponse(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::BondYieldAnalyticsResponseT>(GetBondYieldAnalyticsResponse(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::BondYieldAnalyticsResponseT> UnPackSizePrefixedBondYieldAnalyticsResponse(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::BondYieldAnalyticsResponseT>(GetSizePrefixedBondYieldAnalyticsResponse(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_BONDYIELDANALYTICSRESPONSE_QUANTRA_H_
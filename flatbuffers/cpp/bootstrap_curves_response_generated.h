@@ -34,6 +34,11 @@ struct CurveSeriesT : public ::flatbuffers::NativeTable {
   typedef CurveSeries TableType;
   quantra::CurveMeasure measure = quantra::CurveMeasure_DF;
   std::vector<double> values{};
+  std::unique_ptr<quantra::EncodedValuesT> encoded_values{};
+  CurveSeriesT() = default;
+  CurveSeriesT(const CurveSeriesT &o);
+  CurveSeriesT(CurveSeriesT&&) FLATBUFFERS_NOEXCEPT = default;
+  CurveSeriesT &operator=(CurveSeriesT o) FLATBUFFERS_NOEXCEPT;
 };
 
 /// One sampled series aligned to grid_dates.
@@ -42,7 +47,8 @@ struct CurveSeries FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef CurveSeriesBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_MEASURE = 4,
-    VT_VALUES = 6
+    VT_VALUES = 6,
+    VT_ENCODED_VALUES = 8
   };
   quantra::CurveMeasure measure() const {
     return static_cast<quantra::CurveMeasure>(GetField<int8_t>(VT_MEASURE, 0));
@@ -50,11 +56,17 @@ struct CurveSeries FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<double> *values() const {
     return GetPointer<const ::flatbuffers::Vector<double> *>(VT_VALUES);
   }
+  /// Set instead of values (left empty) for a compact value_encoding.
+  const quantra::EncodedValues *encoded_values() const {
+    return GetPointer<const quantra::EncodedValues *>(VT_ENCODED_VALUES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_MEASURE, 1) &&
            VerifyOffsetRequired(verifier, VT_VALUES) &&
            verifier.VerifyVector(values()) &&
+           VerifyOffset(verifier, VT_ENCODED_VALUES) &&
+           verifier.VerifyTable(encoded_values()) &&
            verifier.EndTable();
   }
   CurveSeriesT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -72,6 +84,9 @@ struct CurveSeriesBuilder {
   void add_values(::flatbuffers::Offset<::flatbuffers::Vector<double>> values) {
     fbb_.AddOffset(CurveSeries::VT_VALUES, values);
   }
+  void add_encoded_values(::flatbuffers::Offset<quantra::EncodedValues> encoded_values) {
+    fbb_.AddOffset(CurveSeries::VT_ENCODED_VALUES, encoded_values);
+  }
   explicit CurveSeriesBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -87,8 +102,10 @@ struct CurveSeriesBuilder {
 inline ::flatbuffers::Offset<CurveSeries> CreateCurveSeries(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     quantra::CurveMeasure measure = quantra::CurveMeasure_DF,
-    ::flatbuffers::Offset<::flatbuffers::Vector<double>> values = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<double>> values = 0,
+    ::flatbuffers::Offset<quantra::EncodedValues> encoded_values = 0) {
   CurveSeriesBuilder builder_(_fbb);
+  builder_.add_encoded_values(encoded_values);
   builder_.add_values(values);
   builder_.add_measure(measure);
   return builder_.Finish();
@@ -97,12 +114,14 @@ inline ::flatbuffers::Offset<CurveSeries> CreateCurveSeries(
 inline ::flatbuffers::Offset<CurveSeries> CreateCurveSeriesDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     quantra::CurveMeasure measure = quantra::CurveMeasure_DF,
-    const std::vector<double> *values = nullptr) {
+    const std::vector<double> *values = nullptr,
+    ::flatbuffers::Offset<quantra::EncodedValues> encoded_values = 0) {
   auto values__ = values ? _fbb.CreateVector<double>(*values) : 0;
   return quantra::CreateCurveSeries(
       _fbb,
       measure,
-      values__);
+      values__,
+      encoded_values);
 }
 
 ::flatbuffers::Offset<CurveSeries> CreateCurveSeries(::flatbuffers::FlatBufferBuilder &_fbb, const CurveSeriesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -115,6 +134,7 @@ struct BootstrapCurveResultT : public ::flatbuffers::NativeTable {
   std::vector<std::unique_ptr<quantra::CurveSeriesT>> series{};
   std::vector<std::string> pillar_dates{};
   std::unique_ptr<quantra::ErrorT> error{};
+  std::unique_ptr<quantra::EncodedDatesT> encoded_grid_dates{};
   BootstrapCurveResultT() = default;
   BootstrapCurveResultT(const BootstrapCurveResultT &o);
   BootstrapCurveResultT(BootstrapCurveResultT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -131,7 +151,8 @@ struct BootstrapCurveResult FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Tab
     VT_GRID_DATES = 8,
     VT_SERIES = 10,
     VT_PILLAR_DATES = 12,
-    VT_ERROR = 14
+    VT_ERROR = 14,
+    VT_ENCODED_GRID_DATES = 16
   };
   const ::flatbuffers::String *id() const {
     return GetPointer<const ::flatbuffers::String *>(VT_ID);
@@ -151,6 +172,10 @@ struct BootstrapCurveResult FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Tab
   const quantra::Error *error() const {
     return GetPointer<const quantra::Error *>(VT_ERROR);
   }
+  /// Set instead of grid_dates (left empty) for a compact date_encoding.
+  const quantra::EncodedDates *encoded_grid_dates() const {
+    return GetPointer<const quantra::EncodedDates *>(VT_ENCODED_GRID_DATES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_ID) &&
@@ -168,6 +193,8 @@ struct BootstrapCurveResult FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Tab
            verifier.VerifyVectorOfStrings(pillar_dates()) &&
            VerifyOffset(verifier, VT_ERROR) &&
            verifier.VerifyTable(error()) &&
+           VerifyOffset(verifier, VT_ENCODED_GRID_DATES) &&
+           verifier.VerifyTable(encoded_grid_dates()) &&
            verifier.EndTable();
   }
   BootstrapCurveResultT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -197,6 +224,9 @@ struct BootstrapCurveResultBuilder {
   void add_error(::flatbuffers::Offset<quantra::Error> error) {
     fbb_.AddOffset(BootstrapCurveResult::VT_ERROR, error);
   }
+  void add_encoded_grid_dates(::flatbuffers::Offset<quantra::EncodedDates> encoded_grid_dates) {
+    fbb_.AddOffset(BootstrapCurveResult::VT_ENCODED_GRID_DATES, encoded_grid_dates);
+  }
   explicit BootstrapCurveResultBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -215,8 +245,10 @@ inline ::flatbuffers::Offset<BootstrapCurveResult> CreateBootstrapCurveResult(
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> grid_dates = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CurveSeries>>> series = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> pillar_dates = 0,
-    ::flatbuffers::Offset<quantra::Error> error = 0) {
+    ::flatbuffers::Offset<quantra::Error> error = 0,
+    ::flatbuffers::Offset<quantra::EncodedDates> encoded_grid_dates = 0) {
   BootstrapCurveResultBuilder builder_(_fbb);
+  builder_.add_encoded_grid_dates(encoded_grid_dates);
   builder_.add_error(error);
   builder_.add_pillar_dates(pillar_dates);
   builder_.add_series(series);
@@ -233,7 +265,8 @@ inline ::flatbuffers::Offset<BootstrapCurveResult> CreateBootstrapCurveResultDir
     const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *grid_dates = nullptr,
     const std::vector<::flatbuffers::Offset<quantra::CurveSeries>> *series = nullptr,
     const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *pillar_dates = nullptr,
-    ::flatbuffers::Offset<quantra::Error> error = 0) {
+    ::flatbuffers::Offset<quantra::Error> error = 0,
+    ::flatbuffers::Offset<quantra::EncodedDates> encoded_grid_dates = 0) {
   auto id__ = id ? _fbb.CreateString(id) : 0;
   auto reference_date__ = reference_date ? _fbb.CreateString(reference_date) : 0;
   auto grid_dates__ = grid_dates ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*grid_dates) : 0;
@@ -246,7 +279,8 @@ inline ::flatbuffers::Offset<BootstrapCurveResult> CreateBootstrapCurveResultDir
       grid_dates__,
       series__,
       pillar_dates__,
-      error);
+      error,
+      encoded_grid_dates);
 }
 
 ::flatbuffers::Offset<BootstrapCurveResult> CreateBootstrapCurveResult(::flatbuffers::FlatBufferBuilder &_fbb, const BootstrapCurveResultT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -254,6 +288,7 @@ inline ::flatbuffers::Offset<BootstrapCurveResult> CreateBootstrapCurveResultDir
 struct BootstrapCurvesResponseT : public ::flatbuffers::NativeTable {
   typedef BootstrapCurvesResponse TableType;
   std::vector<std::unique_ptr<quantra::BootstrapCurveResultT>> results{};
+  std::vector<std::string> stale_curves{};
   BootstrapCurvesResponseT() = default;
   BootstrapCurvesResponseT(const BootstrapCurvesResponseT &o);
   BootstrapCurvesResponseT(BootstrapCurvesResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -265,16 +300,25 @@ struct BootstrapCurvesResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::
   typedef BootstrapCurvesResponseT NativeTableType;
   typedef BootstrapCurvesResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_RESULTS = 4
+    VT_RESULTS = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::BootstrapCurveResult>> *results() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::BootstrapCurveResult>> *>(VT_RESULTS);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_RESULTS) &&
            verifier.VerifyVector(results()) &&
            verifier.VerifyVectorOfTables(results()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   BootstrapCurvesResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -289,6 +333,9 @@ struct BootstrapCurvesResponseBuilder {
   void add_results(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::BootstrapCurveResult>>> results) {
     fbb_.AddOffset(BootstrapCurvesResponse::VT_RESULTS, results);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(BootstrapCurvesResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit BootstrapCurvesResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -303,23 +350,41 @@ struct BootstrapCurvesResponseBuilder {
 
 inline ::flatbuffers::Offset<BootstrapCurvesResponse> CreateBootstrapCurvesResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::BootstrapCurveResult>>> results = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::BootstrapCurveResult>>> results = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   BootstrapCurvesResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_results(results);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<BootstrapCurvesResponse> CreateBootstrapCurvesResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::BootstrapCurveResult>> *results = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::BootstrapCurveResult>> *results = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto results__ = results ? _fbb.CreateVector<::flatbuffers::Offset<quantra::BootstrapCurveResult>>(*results) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreateBootstrapCurvesResponse(
       _fbb,
-      results__);
+      results__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<BootstrapCurvesResponse> CreateBootstrapCurvesResponse(::flatbuffers::FlatBufferBuilder &_fbb, const BootstrapCurvesResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
+inline CurveSeriesT::CurveSeriesT(const CurveSeriesT &o)
+      : measure(o.measure),
+        values(o.values),
+        encoded_values((o.encoded_values) ? new quantra::EncodedValuesT(*o.encoded_values) : nullptr) {
+}
+
+inline CurveSeriesT &CurveSeriesT::operator=(CurveSeriesT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(measure, o.measure);
+  std::swap(values, o.values);
+  std::swap(encoded_values, o.encoded_values);
+  return *this;
+}
+
 inline CurveSeriesT *CurveSeries::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
   auto _o = std::unique_ptr<CurveSeriesT>(new CurveSeriesT());
   UnPackTo(_o.get(), _resolver);
@@ -331,6 +396,7 @@ inline void CurveSeries::UnPackTo(CurveSeriesT *_o, const ::flatbuffers::resolve
   (void)_resolver;
   { auto _e = measure(); _o->measure = _e; }
   { auto _e = values(); if (_e) { _o->values.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->values[_i] = _e->Get(_i); } } else { _o->values.resize(0); } }
+  { auto _e = encoded_values(); if (_e) { if(_o->encoded_values) { _e->UnPackTo(_o->encoded_values.get(), _resolver); } else { _o->encoded_values = std::unique_ptr<quantra::EncodedValuesT>(_e->UnPack(_resolver)); } } else if (_o->encoded_values) { _o->encoded_values.reset(); } }
 }
 
 inline ::flatbuffers::Offset<CurveSeries> CurveSeries::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CurveSeriesT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -343,10 +409,12 @@ inline ::flatbuffers::Offset<CurveSeries> CreateCurveSeries(::flatbuffers::FlatB
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const CurveSeriesT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _measure = _o->measure;
   auto _values = _fbb.CreateVector(_o->values);
+  auto _encoded_values = _o->encoded_values ? CreateEncodedValues(_fbb, _o->encoded_values.get(), _rehasher) : 0;
   return quantra::CreateCurveSeries(
       _fbb,
       _measure,
-      _values);
+      _values,
+      _encoded_values);
 }
 
 inline BootstrapCurveResultT::BootstrapCurveResultT(const BootstrapCurveResultT &o)
@@ -354,7 +422,8 @@ inline BootstrapCurveResultT::BootstrapCurveResultT(const BootstrapCurveResultT
         reference_date(o.reference_date),
         grid_dates(o.grid_dates),
         pillar_dates(o.pillar_dates),
-        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr) {
+        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr),
+        encoded_grid_dates((o.encoded_grid_dates) ? new quantra::EncodedDatesT(*o.encoded_grid_dates) : nullptr) {
   series.reserve(o.series.size());
   for (const auto &series_ : o.series) { series.emplace_back((series_) ? new quantra::CurveSeriesT(*series_) : nullptr); }
 }
@@ -366,6 +435,7 @@ inline BootstrapCurveResultT &BootstrapCurveResultT::operator=(BootstrapCurveRes
   std::swap(series, o.series);
   std::swap(pillar_dates, o.pillar_dates);
   std::swap(error, o.error);
+  std::swap(encoded_grid_dates, o.encoded_grid_dates);
   return *this;
 }
 
@@ -384,6 +454,7 @@ inline void BootstrapCurveResult::UnPackTo(BootstrapCurveResultT *_o, const ::fl
   { auto _e = series(); if (_e) { _o->series.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->series[_i]) { _e->Get(_i)->UnPackTo(_o->series[_i].get(), _resolver); } else { _o->series[_i] = std::unique_ptr<quantra::CurveSeriesT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->series.resize(0); } }
   { auto _e = pillar_dates(); if (_e) { _o->pillar_dates.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->pillar_dates[_i] = _e->Get(_i)->str(); } } else { _o->pillar_dates.resize(0); } }
   { auto _e = error(); if (_e) { if(_o->error) { _e->UnPackTo(_o->error.get(), _resolver); } else { _o->error = std::unique_ptr<quantra::ErrorT>(_e->UnPack(_resolver)); } } else if (_o->error) { _o->error.reset(); } }
+  { auto _e = encoded_grid_dates(); if (_e) { if(_o->encoded_grid_dates) { _e->UnPackTo(_o->encoded_grid_dates.get(), _resolver); } else { _o->encoded_grid_dates = std::unique_ptr<quantra::EncodedDatesT>(_e->UnPack(_resolver)); } } else if (_o->encoded_grid_dates) { _o->encoded_grid_dates.reset(); } }
 }
 
 inline ::flatbuffers::Offset<BootstrapCurveResult> BootstrapCurveResult::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BootstrapCurveResultT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -400,6 +471,7 @@ inline ::flatbuffers::Offset<BootstrapCurveResult> CreateBootstrapCurveResult(::
   auto _series = _o->series.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::CurveSeries>> (_o->series.size(), [](size_t i, _VectorArgs *__va) { return CreateCurveSeries(*__va->__fbb, __va->__o->series[i].get(), __va->__rehasher); }, &_va ) : 0;
   auto _pillar_dates = _o->pillar_dates.size() ? _fbb.CreateVectorOfStrings(_o->pillar_dates) : 0;
   auto _error = _o->error ? CreateError(_fbb, _o->error.get(), _rehasher) : 0;
+  auto _encoded_grid_dates = _o->encoded_grid_dates ? CreateEncodedDates(_fbb, _o->encoded_grid_dates.get(), _rehasher) : 0;
   return quantra::CreateBootstrapCurveResult(
       _fbb,
       _id,
@@ -407,16 +479,19 @@ inline ::flatbuffers::Offset<BootstrapCurveResult> CreateBootstrapCurveResult(::
       _grid_dates,
       _series,
       _pillar_dates,
-      _error);
+      _error,
+      _encoded_grid_dates);
 }
 
-inline BootstrapCurvesResponseT::BootstrapCurvesResponseT(const BootstrapCurvesResponseT &o) {
+inline BootstrapCurvesResponseT::BootstrapCurvesResponseT(const BootstrapCurvesResponseT &o)
+      : stale_curves(o.stale_curves) {
   results.reserve(o.results.size());
   for (const auto &results_ : o.results) { results.emplace_back((results_) ? new quantra::BootstrapCurveResultT(*results_) : nullptr); }
 }
 
 inline BootstrapCurvesResponseT &BootstrapCurvesResponseT::operator=(BootstrapCurvesResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(results, o.results);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -430,6 +505,7 @@ inline void BootstrapCurvesResponse::UnPackTo(BootstrapCurvesResponseT *_o, cons
   (void)_o;
   (void)_resolver;
   { auto _e = results(); if (_e) { _o->results.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->results[_i]) { _e->Get(_i)->UnPackTo(_o->results[_i].get(), _resolver); } else { _o->results[_i] = std::unique_ptr<quantra::BootstrapCurveResultT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->results.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<BootstrapCurvesResponse> BootstrapCurvesResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const BootstrapCurvesResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -441,9 +517,11 @@ inline ::flatbuffers::Offset<BootstrapCurvesResponse> CreateBootstrapCurvesRespo
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const BootstrapCurvesResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _results = _fbb.CreateVector<::flatbuffers::Offset<quantra::BootstrapCurveResult>> (_o->results.size(), [](size_t i, _VectorArgs *__va) { return CreateBootstrapCurveResult(*__va->__fbb, __va->__o->results[i].get(), __va->__rehasher); }, &_va );
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreateBootstrapCurvesResponse(
       _fbb,
-      _results);
+      _results,
+      _stale_curves);
 }
 
 inline const quantra::BootstrapCurvesResponse *GetBootstrapCurvesResponse(const void *buf) {
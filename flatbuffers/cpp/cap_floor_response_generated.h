@@ -192,6 +192,7 @@ struct CapFloorResponseT : public ::flatbuffers::NativeTable {
   double atm_rate = 0.0;
   double implied_volatility = 0.0;
   std::vector<std::unique_ptr<quantra::CapFloorLetT>> cap_floor_lets{};
+  std::string trade_id{};
   CapFloorResponseT() = default;
   CapFloorResponseT(const CapFloorResponseT &o);
   CapFloorResponseT(CapFloorResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -205,7 +206,8 @@ struct CapFloorResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_NPV = 4,
     VT_ATM_RATE = 6,
     VT_IMPLIED_VOLATILITY = 8,
-    VT_CAP_FLOOR_LETS = 10
+    VT_CAP_FLOOR_LETS = 10,
+    VT_TRADE_ID = 12
   };
   double npv() const {
     return GetField<double>(VT_NPV, 0.0);
@@ -219,6 +221,10 @@ struct CapFloorResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorLet>> *cap_floor_lets() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorLet>> *>(VT_CAP_FLOOR_LETS);
   }
+  /// Id of the stored trade priced, when the entry referenced one.
+  const ::flatbuffers::String *trade_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TRADE_ID);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_NPV, 8) &&
@@ -227,6 +233,8 @@ struct CapFloorResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_CAP_FLOOR_LETS) &&
            verifier.VerifyVector(cap_floor_lets()) &&
            verifier.VerifyVectorOfTables(cap_floor_lets()) &&
+           VerifyOffset(verifier, VT_TRADE_ID) &&
+           verifier.VerifyString(trade_id()) &&
            verifier.EndTable();
   }
   CapFloorResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -250,6 +258,9 @@ struct CapFloorResponseBuilder {
   void add_cap_floor_lets(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorLet>>> cap_floor_lets) {
     fbb_.AddOffset(CapFloorResponse::VT_CAP_FLOOR_LETS, cap_floor_lets);
   }
+  void add_trade_id(::flatbuffers::Offset<::flatbuffers::String> trade_id) {
+    fbb_.AddOffset(CapFloorResponse::VT_TRADE_ID, trade_id);
+  }
   explicit CapFloorResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -266,11 +277,13 @@ inline ::flatbuffers::Offset<CapFloorResponse> CreateCapFloorResponse(
     double npv = 0.0,
     double atm_rate = 0.0,
     double implied_volatility = 0.0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorLet>>> cap_floor_lets = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorLet>>> cap_floor_lets = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> trade_id = 0) {
   CapFloorResponseBuilder builder_(_fbb);
   builder_.add_implied_volatility(implied_volatility);
   builder_.add_atm_rate(atm_rate);
   builder_.add_npv(npv);
+  builder_.add_trade_id(trade_id);
   builder_.add_cap_floor_lets(cap_floor_lets);
   return builder_.Finish();
 }
@@ -280,14 +293,17 @@ inline ::flatbuffers::Offset<CapFloorResponse> CreateCapFloorResponseDirect(
     double npv = 0.0,
     double atm_rate = 0.0,
     double implied_volatility = 0.0,
-    const std::vector<::flatbuffers::Offset<quantra::CapFloorLet>> *cap_floor_lets = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::CapFloorLet>> *cap_floor_lets = nullptr,
+    const char *trade_id = nullptr) {
   auto cap_floor_lets__ = cap_floor_lets ? _fbb.CreateVector<::flatbuffers::Offset<quantra::CapFloorLet>>(*cap_floor_lets) : 0;
+  auto trade_id__ = trade_id ? _fbb.CreateString(trade_id) : 0;
   return quantra::CreateCapFloorResponse(
       _fbb,
       npv,
       atm_rate,
       implied_volatility,
-      cap_floor_lets__);
+      cap_floor_lets__,
+      trade_id__);
 }
 
 ::flatbuffers::Offset<CapFloorResponse> CreateCapFloorResponse(::flatbuffers::FlatBufferBuilder &_fbb, const CapFloorResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -295,6 +311,7 @@ inline ::flatbuffers::Offset<CapFloorResponse> CreateCapFloorResponseDirect(
 struct PriceCapFloorResponseT : public ::flatbuffers::NativeTable {
   typedef PriceCapFloorResponse TableType;
   std::vector<std::unique_ptr<quantra::CapFloorResponseT>> cap_floors{};
+  std::vector<std::string> stale_curves{};
   PriceCapFloorResponseT() = default;
   PriceCapFloorResponseT(const PriceCapFloorResponseT &o);
   PriceCapFloorResponseT(PriceCapFloorResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -305,16 +322,25 @@ struct PriceCapFloorResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Ta
   typedef PriceCapFloorResponseT NativeTableType;
   typedef PriceCapFloorResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_CAP_FLOORS = 4
+    VT_CAP_FLOORS = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorResponse>> *cap_floors() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorResponse>> *>(VT_CAP_FLOORS);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_CAP_FLOORS) &&
            verifier.VerifyVector(cap_floors()) &&
            verifier.VerifyVectorOfTables(cap_floors()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   PriceCapFloorResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -329,6 +355,9 @@ struct PriceCapFloorResponseBuilder {
   void add_cap_floors(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorResponse>>> cap_floors) {
     fbb_.AddOffset(PriceCapFloorResponse::VT_CAP_FLOORS, cap_floors);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(PriceCapFloorResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit PriceCapFloorResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -342,19 +371,24 @@ struct PriceCapFloorResponseBuilder {
 
 inline ::flatbuffers::Offset<PriceCapFloorResponse> CreatePriceCapFloorResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorResponse>>> cap_floors = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CapFloorResponse>>> cap_floors = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   PriceCapFloorResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_cap_floors(cap_floors);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<PriceCapFloorResponse> CreatePriceCapFloorResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::CapFloorResponse>> *cap_floors = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::CapFloorResponse>> *cap_floors = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto cap_floors__ = cap_floors ? _fbb.CreateVector<::flatbuffers::Offset<quantra::CapFloorResponse>>(*cap_floors) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreatePriceCapFloorResponse(
       _fbb,
-      cap_floors__);
+      cap_floors__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<PriceCapFloorResponse> CreatePriceCapFloorResponse(::flatbuffers::FlatBufferBuilder &_fbb, const PriceCapFloorResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -409,7 +443,8 @@ inline ::flatbuffers::Offset<CapFloorLet> CreateCapFloorLet(::flatbuffers::FlatB
 inline CapFloorResponseT::CapFloorResponseT(const CapFloorResponseT &o)
       : npv(o.npv),
         atm_rate(o.atm_rate),
-        implied_volatility(o.implied_volatility) {
+        implied_volatility(o.implied_volatility),
+        trade_id(o.trade_id) {
   cap_floor_lets.reserve(o.cap_floor_lets.size());
   for (const auto &cap_floor_lets_ : o.cap_floor_lets) { cap_floor_lets.emplace_back((cap_floor_lets_) ? new quantra::CapFloorLetT(*cap_floor_lets_) : nullptr); }
 }
@@ -419,6 +454,7 @@ inline CapFloorResponseT &CapFloorResponseT::operator=(CapFloorResponseT o) FLAT
   std::swap(atm_rate, o.atm_rate);
   std::swap(implied_volatility, o.implied_volatility);
   std::swap(cap_floor_lets, o.cap_floor_lets);
+  std::swap(trade_id, o.trade_id);
   return *this;
 }
 
@@ -435,6 +471,7 @@ inline void CapFloorResponse::UnPackTo(CapFloorResponseT *_o, const ::flatbuffer
   { auto _e = atm_rate(); _o->atm_rate = _e; }
   { auto _e = implied_volatility(); _o->implied_volatility = _e; }
   { auto _e = cap_floor_lets(); if (_e) { _o->cap_floor_lets.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->cap_floor_lets[_i]) { _e->Get(_i)->UnPackTo(_o->cap_floor_lets[_i].get(), _resolver); } else { _o->cap_floor_lets[_i] = std::unique_ptr<quantra::CapFloorLetT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->cap_floor_lets.resize(0); } }
+  { auto _e = trade_id(); if (_e) _o->trade_id = _e->str(); }
 }
 
 inline ::flatbuffers::Offset<CapFloorResponse> CapFloorResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CapFloorResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -449,21 +486,25 @@ inline ::flatbuffers::Offset<CapFloorResponse> CreateCapFloorResponse(::flatbuff
   auto _atm_rate = _o->atm_rate;
   auto _implied_volatility = _o->implied_volatility;
   auto _cap_floor_lets = _o->cap_floor_lets.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::CapFloorLet>> (_o->cap_floor_lets.size(), [](size_t i, _VectorArgs *__va) { return CreateCapFloorLet(*__va->__fbb, __va->__o->cap_floor_lets[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _trade_id = _o->trade_id.empty() ? 0 : _fbb.CreateString(_o->trade_id);
   return quantra::CreateCapFloorResponse(
       _fbb,
       _npv,
       _atm_rate,
       _implied_volatility,
-      _cap_floor_lets);
+      _cap_floor_lets,
+      _trade_id);
 }
 
-inline PriceCapFloorResponseT::PriceCapFloorResponseT(const PriceCapFloorResponseT &o) {
+inline PriceCapFloorResponseT::PriceCapFloorResponseT(const PriceCapFloorResponseT &o)
+      : stale_curves(o.stale_curves) {
   cap_floors.reserve(o.cap_floors.size());
   for (const auto &cap_floors_ : o.cap_floors) { cap_floors.emplace_back((cap_floors_) ? new quantra::CapFloorResponseT(*cap_floors_) : nullptr); }
 }
 
 inline PriceCapFloorResponseT &PriceCapFloorResponseT::operator=(PriceCapFloorResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(cap_floors, o.cap_floors);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -477,6 +518,7 @@ inline void PriceCapFloorResponse::UnPackTo(PriceCapFloorResponseT *_o, const ::
   (void)_o;
   (void)_resolver;
   { auto _e = cap_floors(); if (_e) { _o->cap_floors.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->cap_floors[_i]) { _e->Get(_i)->UnPackTo(_o->cap_floors[_i].get(), _resolver); } else { _o->cap_floors[_i] = std::unique_ptr<quantra::CapFloorResponseT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->cap_floors.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<PriceCapFloorResponse> PriceCapFloorResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceCapFloorResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -488,9 +530,11 @@ inline ::flatbuffers::Offset<PriceCapFloorResponse> CreatePriceCapFloorResponse(
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const PriceCapFloorResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _cap_floors = _o->cap_floors.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::CapFloorResponse>> (_o->cap_floors.size(), [](size_t i, _VectorArgs *__va) { return CreateCapFloorResponse(*__va->__fbb, __va->__o->cap_floors[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreatePriceCapFloorResponse(
       _fbb,
-      _cap_floors);
+      _cap_floors,
+      _stale_curves);
 }
 
 inline const quantra::PriceCapFloorResponse *GetPriceCapFloorResponse(const void *buf) {
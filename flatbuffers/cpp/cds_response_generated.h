@@ -33,6 +33,7 @@ struct CDSValuesT : public ::flatbuffers::NativeTable {
   double default_leg_npv = 0.0;
   double premium_leg_npv = 0.0;
   std::unique_ptr<quantra::ErrorT> error{};
+  std::string trade_id{};
   CDSValuesT() = default;
   CDSValuesT(const CDSValuesT &o);
   CDSValuesT(CDSValuesT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -48,7 +49,8 @@ struct CDSValues FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_FAIR_UPFRONT = 8,
     VT_DEFAULT_LEG_NPV = 10,
     VT_PREMIUM_LEG_NPV = 12,
-    VT_ERROR = 14
+    VT_ERROR = 14,
+    VT_TRADE_ID = 16
   };
   double npv() const {
     return GetField<double>(VT_NPV, 0.0);
@@ -68,6 +70,10 @@ struct CDSValues FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const quantra::Error *error() const {
     return GetPointer<const quantra::Error *>(VT_ERROR);
   }
+  /// Id of the stored trade priced, when the entry referenced one.
+  const ::flatbuffers::String *trade_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TRADE_ID);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_NPV, 8) &&
@@ -77,6 +83,8 @@ struct CDSValues FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyField<double>(verifier, VT_PREMIUM_LEG_NPV, 8) &&
            VerifyOffset(verifier, VT_ERROR) &&
            verifier.VerifyTable(error()) &&
+           VerifyOffset(verifier, VT_TRADE_ID) &&
+           verifier.VerifyString(trade_id()) &&
            verifier.EndTable();
   }
   CDSValuesT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -106,6 +114,9 @@ struct CDSValuesBuilder {
   void add_error(::flatbuffers::Offset<quantra::Error> error) {
     fbb_.AddOffset(CDSValues::VT_ERROR, error);
   }
+  void add_trade_id(::flatbuffers::Offset<::flatbuffers::String> trade_id) {
+    fbb_.AddOffset(CDSValues::VT_TRADE_ID, trade_id);
+  }
   explicit CDSValuesBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -124,22 +135,46 @@ inline ::flatbuffers::Offset<CDSValues> CreateCDSValues(
     double fair_upfront = 0.0,
     double default_leg_npv = 0.0,
     double premium_leg_npv = 0.0,
-    ::flatbuffers::Offset<quantra::Error> error = 0) {
+    ::flatbuffers::Offset<quantra::Error> error = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> trade_id = 0) {
   CDSValuesBuilder builder_(_fbb);
   builder_.add_premium_leg_npv(premium_leg_npv);
   builder_.add_default_leg_npv(default_leg_npv);
   builder_.add_fair_upfront(fair_upfront);
   builder_.add_fair_spread(fair_spread);
   builder_.add_npv(npv);
+  builder_.add_trade_id(trade_id);
   builder_.add_error(error);
   return builder_.Finish();
 }
 
+inline ::flatbuffers::Offset<CDSValues> CreateCDSValuesDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    double npv = 0.0,
+    double fair_spread = 0.0,
+    double fair_upfront = 0.0,
+    double default_leg_npv = 0.0,
+    double premium_leg_npv = 0.0,
+    ::flatbuffers::Offset<quantra::Error> error = 0,
+    const char *trade_id = nullptr) {
+  auto trade_id__ = trade_id ? _fbb.CreateString(trade_id) : 0;
+  return quantra::CreateCDSValues(
+      _fbb,
+      npv,
+      fair_spread,
+      fair_upfront,
+      default_leg_npv,
+      premium_leg_npv,
+      error,
+      trade_id__);
+}
+
 ::flatbuffers::Offset<CDSValues> CreateCDSValues(::flatbuffers::FlatBufferBuilder &_fbb, const CDSValuesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 struct PriceCDSResponseT : public ::flatbuffers::NativeTable {
   typedef PriceCDSResponse TableType;
   std::vector<std::unique_ptr<quantra::CDSValuesT>> cds_list{};
+  std::vector<std::string> stale_curves{};
   PriceCDSResponseT() = default;
   PriceCDSResponseT(const PriceCDSResponseT &o);
   PriceCDSResponseT(PriceCDSResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -150,16 +185,25 @@ struct PriceCDSResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef PriceCDSResponseT NativeTableType;
   typedef PriceCDSResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_CDS_LIST = 4
+    VT_CDS_LIST = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::CDSValues>> *cds_list() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::CDSValues>> *>(VT_CDS_LIST);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_CDS_LIST) &&
            verifier.VerifyVector(cds_list()) &&
            verifier.VerifyVectorOfTables(cds_list()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   PriceCDSResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -174,6 +218,9 @@ struct PriceCDSResponseBuilder {
   void add_cds_list(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CDSValues>>> cds_list) {
     fbb_.AddOffset(PriceCDSResponse::VT_CDS_LIST, cds_list);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(PriceCDSResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit PriceCDSResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -187,19 +234,24 @@ struct PriceCDSResponseBuilder {
 
 inline ::flatbuffers::Offset<PriceCDSResponse> CreatePriceCDSResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CDSValues>>> cds_list = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CDSValues>>> cds_list = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   PriceCDSResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_cds_list(cds_list);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<PriceCDSResponse> CreatePriceCDSResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::CDSValues>> *cds_list = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::CDSValues>> *cds_list = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto cds_list__ = cds_list ? _fbb.CreateVector<::flatbuffers::Offset<quantra::CDSValues>>(*cds_list) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreatePriceCDSResponse(
       _fbb,
-      cds_list__);
+      cds_list__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<PriceCDSResponse> CreatePriceCDSResponse(::flatbuffers::FlatBufferBuilder &_fbb, const PriceCDSResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -210,7 +262,8 @@ inline CDSValuesT::CDSValuesT(const CDSValuesT &o)
         fair_upfront(o.fair_upfront),
         default_leg_npv(o.default_leg_npv),
         premium_leg_npv(o.premium_leg_npv),
-        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr) {
+        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr),
+        trade_id(o.trade_id) {
 }
 
 inline CDSValuesT &CDSValuesT::operator=(CDSValuesT o) FLATBUFFERS_NOEXCEPT {
@@ -220,6 +273,7 @@ inline CDSValuesT &CDSValuesT::operator=(CDSValuesT o) FLATBUFFERS_NOEXCEPT {
   std::swap(default_leg_npv, o.default_leg_npv);
   std::swap(premium_leg_npv, o.premium_leg_npv);
   std::swap(error, o.error);
+  std::swap(trade_id, o.trade_id);
   return *this;
 }
 
@@ -238,6 +292,7 @@ inline void CDSValues::UnPackTo(CDSValuesT *_o, const ::flatbuffers::resolver_fu
   { auto _e = default_leg_npv(); _o->default_leg_npv = _e; }
   { auto _e = premium_leg_npv(); _o->premium_leg_npv = _e; }
   { auto _e = error(); if (_e) { if(_o->error) { _e->UnPackTo(_o->error.get(), _resolver); } else { _o->error = std::unique_ptr<quantra::ErrorT>(_e->UnPack(_resolver)); } } else if (_o->error) { _o->error.reset(); } }
+  { auto _e = trade_id(); if (_e) _o->trade_id = _e->str(); }
 }
 
 inline ::flatbuffers::Offset<CDSValues> CDSValues::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const CDSValuesT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -254,6 +309,7 @@ inline ::flatbuffers::Offset<CDSValues> CreateCDSValues(::flatbuffers::FlatBuffe
   auto _default_leg_npv = _o->default_leg_npv;
   auto _premium_leg_npv = _o->premium_leg_npv;
   auto _error = _o->error ? CreateError(_fbb, _o->error.get(), _rehasher) : 0;
+  auto _trade_id = _o->trade_id.empty() ? 0 : _fbb.CreateString(_o->trade_id);
   return quantra::CreateCDSValues(
       _fbb,
       _npv,
@@ -261,16 +317,19 @@ inline ::flatbuffers::Offset<CDSValues> CreateCDSValues(::flatbuffers::FlatBuffe
       _fair_upfront,
       _default_leg_npv,
       _premium_leg_npv,
-      _error);
+      _error,
+      _trade_id);
 }
 
-inline PriceCDSResponseT::PriceCDSResponseT(const PriceCDSResponseT &o) {
+inline PriceCDSResponseT::PriceCDSResponseT(const PriceCDSResponseT &o)
+      : stale_curves(o.stale_curves) {
   cds_list.reserve(o.cds_list.size());
   for (const auto &cds_list_ : o.cds_list) { cds_list.emplace_back((cds_list_) ? new quantra::CDSValuesT(*cds_list_) : nullptr); }
 }
 
 inline PriceCDSResponseT &PriceCDSResponseT::operator=(PriceCDSResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(cds_list, o.cds_list);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -284,6 +343,7 @@ inline void PriceCDSResponse::UnPackTo(PriceCDSResponseT *_o, const ::flatbuffer
   (void)_o;
   (void)_resolver;
   { auto _e = cds_list(); if (_e) { _o->cds_list.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->cds_list[_i]) { _e->Get(_i)->UnPackTo(_o->cds_list[_i].get(), _resolver); } else { _o->cds_list[_i] = std::unique_ptr<quantra::CDSValuesT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->cds_list.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<PriceCDSResponse> PriceCDSResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceCDSResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -295,9 +355,11 @@ inline ::flatbuffers::Offset<PriceCDSResponse> CreatePriceCDSResponse(::flatbuff
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const PriceCDSResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _cds_list = _o->cds_list.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::CDSValues>> (_o->cds_list.size(), [](size_t i, _VectorArgs *__va) { return CreateCDSValues(*__va->__fbb, __va->__o->cds_list[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreatePriceCDSResponse(
       _fbb,
-      _cds_list);
+      _cds_list,
+      _stale_curves);
 }
 
 inline const quantra::PriceCDSResponse *GetPriceCDSResponse(const void *buf) {
@@ -15,6 +15,7 @@ static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
 
 #include "common_generated.h"
 #include "enums_generated.h"
+#include "sample_encoding_generated.h"
 
 namespace quantra {
 
@@ -549,6 +550,9 @@ struct QueryOptionsT : public ::flatbuffers::NativeTable {
   int32_t max_points = 50000;
   bool allow_extrapolation = true;
   bool strict = true;
+  quantra::DateEncoding date_encoding = quantra::DateEncoding_Iso;
+  quantra::ValueEncoding value_encoding = quantra::ValueEncoding_Float64;
+  double value_quantum = 1e-10;
 };
 
 /// Generic query options for reusable sampling endpoints.
@@ -560,7 +564,10 @@ struct QueryOptions FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_BUSINESS_DAY_CONVENTION = 6,
     VT_MAX_POINTS = 8,
     VT_ALLOW_EXTRAPOLATION = 10,
-    VT_STRICT = 12
+    VT_STRICT = 12,
+    VT_DATE_ENCODING = 14,
+    VT_VALUE_ENCODING = 16,
+    VT_VALUE_QUANTUM = 18
   };
   quantra::enums::Calendar calendar() const {
     return static_cast<quantra::enums::Calendar>(GetField<int8_t>(VT_CALENDAR, 21));
@@ -577,6 +584,18 @@ struct QueryOptions FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   bool strict() const {
     return GetField<uint8_t>(VT_STRICT, 1) != 0;
   }
+  /// Response encodings of sampled dates and values; the defaults keep
+  /// ISO strings and [double].
+  quantra::DateEncoding date_encoding() const {
+    return static_cast<quantra::DateEncoding>(GetField<int8_t>(VT_DATE_ENCODING, 0));
+  }
+  quantra::ValueEncoding value_encoding() const {
+    return static_cast<quantra::ValueEncoding>(GetField<int8_t>(VT_VALUE_ENCODING, 0));
+  }
+  /// DeltaFixed resolution
+  double value_quantum() const {
+    return GetField<double>(VT_VALUE_QUANTUM, 1e-10);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_CALENDAR, 1) &&
@@ -584,6 +603,9 @@ struct QueryOptions FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyField<int32_t>(verifier, VT_MAX_POINTS, 4) &&
            VerifyField<uint8_t>(verifier, VT_ALLOW_EXTRAPOLATION, 1) &&
            VerifyField<uint8_t>(verifier, VT_STRICT, 1) &&
+           VerifyField<int8_t>(verifier, VT_DATE_ENCODING, 1) &&
+           VerifyField<int8_t>(verifier, VT_VALUE_ENCODING, 1) &&
+           VerifyField<double>(verifier, VT_VALUE_QUANTUM, 8) &&
            verifier.EndTable();
   }
   QueryOptionsT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -610,6 +632,15 @@ struct QueryOptionsBuilder {
   void add_strict(bool strict) {
     fbb_.AddElement<uint8_t>(QueryOptions::VT_STRICT, static_cast<uint8_t>(strict), 1);
   }
+  void add_date_encoding(quantra::DateEncoding date_encoding) {
+    fbb_.AddElement<int8_t>(QueryOptions::VT_DATE_ENCODING, static_cast<int8_t>(date_encoding), 0);
+  }
+  void add_value_encoding(quantra::ValueEncoding value_encoding) {
+    fbb_.AddElement<int8_t>(QueryOptions::VT_VALUE_ENCODING, static_cast<int8_t>(value_encoding), 0);
+  }
+  void add_value_quantum(double value_quantum) {
+    fbb_.AddElement<double>(QueryOptions::VT_VALUE_QUANTUM, value_quantum, 1e-10);
+  }
   explicit QueryOptionsBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -627,9 +658,15 @@ inline ::flatbuffers::Offset<QueryOptions> CreateQueryOptions(
     quantra::enums::BusinessDayConvention business_day_convention = quantra::enums::BusinessDayConvention_Following,
     int32_t max_points = 50000,
     bool allow_extrapolation = true,
-    bool strict = true) {
+    bool strict = true,
+    quantra::DateEncoding date_encoding = quantra::DateEncoding_Iso,
+    quantra::ValueEncoding value_encoding = quantra::ValueEncoding_Float64,
+    double value_quantum = 1e-10) {
   QueryOptionsBuilder builder_(_fbb);
+  builder_.add_value_quantum(value_quantum);
   builder_.add_max_points(max_points);
+  builder_.add_value_encoding(value_encoding);
+  builder_.add_date_encoding(date_encoding);
   builder_.add_strict(strict);
   builder_.add_allow_extrapolation(allow_extrapolation);
   builder_.add_business_day_convention(business_day_convention);
@@ -1143,6 +1180,9 @@ inline void QueryOptions::UnPackTo(QueryOptionsT *_o, const ::flatbuffers::resol
   { auto _e = max_points(); _o->max_points = _e; }
   { auto _e = allow_extrapolation(); _o->allow_extrapolation = _e; }
   { auto _e = strict(); _o->strict = _e; }
+  { auto _e = date_encoding(); _o->date_encoding = _e; }
+  { auto _e = value_encoding(); _o->value_encoding = _e; }
+  { auto _e = value_quantum(); _o->value_quantum = _e; }
 }
 
 inline ::flatbuffers::Offset<QueryOptions> QueryOptions::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const QueryOptionsT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -1158,13 +1198,19 @@ inline ::flatbuffers::Offset<QueryOptions> CreateQueryOptions(::flatbuffers::Fla
   auto _max_points = _o->max_points;
   auto _allow_extrapolation = _o->allow_extrapolation;
   auto _strict = _o->strict;
+  auto _date_encoding = _o->date_encoding;
+  auto _value_encoding = _o->value_encoding;
+  auto _value_quantum = _o->value_quantum;
   return quantra::CreateQueryOptions(
       _fbb,
       _calendar,
       _business_day_convention,
       _max_points,
       _allow_extrapolation,
-      _strict);
+      _strict,
+      _date_encoding,
+      _value_encoding,
+      _value_quantum);
 }
 
 inline ZeroRateQueryT *ZeroRateQuery::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
@@ -0,0 +1,316 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_CURVERISKREQUEST_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_CURVERISKREQUEST_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+#include "common_generated.h"
+#include "price_fixed_rate_bond_request_generated.h"
+#include "price_fra_request_generated.h"
+#include "price_vanilla_swap_request_generated.h"
+#include "pricing_generated.h"
+
+namespace quantra {
+
+struct ComputeCurveRiskRequest;
+struct ComputeCurveRiskRequestBuilder;
+struct ComputeCurveRiskRequestT;
+
+/// How sensitivities are computed.
+///   Jacobian:   one bootstrap; dNPV/dquote from the bootstrap Jacobian.
+///   BumpQuotes: one bootstrap on live quotes; each quote is bumped up and
+///               down in place and the trades repriced. Only helpers that
+///               reference a quote_id are bucketed.
+enum CurveRiskMethod : int8_t {
+  CurveRiskMethod_Jacobian = 0,
+  CurveRiskMethod_BumpQuotes = 1,
+  CurveRiskMethod_MIN = CurveRiskMethod_Jacobian,
+  CurveRiskMethod_MAX = CurveRiskMethod_BumpQuotes
+};
+
+inline const CurveRiskMethod (&EnumValuesCurveRiskMethod())[2] {
+  static const CurveRiskMethod values[] = {
+    CurveRiskMethod_Jacobian,
+    CurveRiskMethod_BumpQuotes
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesCurveRiskMethod() {
+  static const char * const names[3] = {
+    "Jacobian",
+    "BumpQuotes",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCurveRiskMethod(CurveRiskMethod e) {
+  if (::flatbuffers::IsOutRange(e, CurveRiskMethod_Jacobian, CurveRiskMethod_BumpQuotes)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesCurveRiskMethod()[index];
+}
+
+struct ComputeCurveRiskRequestT : public ::flatbuffers::NativeTable {
+  typedef ComputeCurveRiskRequest TableType;
+  std::unique_ptr<quantra::PricingT> pricing{};
+  std::vector<std::unique_ptr<quantra::PriceFixedRateBondT>> bonds{};
+  std::vector<std::unique_ptr<quantra::PriceVanillaSwapT>> swaps{};
+  std::vector<std::unique_ptr<quantra::PriceFRAT>> fras{};
+  double bump_size = 0.0001;
+  quantra::CurveRiskMethod method = quantra::CurveRiskMethod_Jacobian;
+  ComputeCurveRiskRequestT() = default;
+  ComputeCurveRiskRequestT(const ComputeCurveRiskRequestT &o);
+  ComputeCurveRiskRequestT(ComputeCurveRiskRequestT&&) FLATBUFFERS_NOEXCEPT = default;
+  ComputeCurveRiskRequestT &operator=(ComputeCurveRiskRequestT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// Request for bucketed curve risk of a set of trades.
+///
+/// The curves the trades reference (plus their bootstrap dependencies) are
+/// bootstrapped once. Sensitivities come back per QuoteSpec id; helpers with
+/// an inline value are reported as "<curve_id>[<point index>]".
+struct ComputeCurveRiskRequest FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ComputeCurveRiskRequestT NativeTableType;
+  typedef ComputeCurveRiskRequestBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PRICING = 4,
+    VT_BONDS = 6,
+    VT_SWAPS = 8,
+    VT_FRAS = 10,
+    VT_BUMP_SIZE = 12,
+    VT_METHOD = 14
+  };
+  const quantra::Pricing *pricing() const {
+    return GetPointer<const quantra::Pricing *>(VT_PRICING);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceFixedRateBond>> *bonds() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceFixedRateBond>> *>(VT_BONDS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceVanillaSwap>> *swaps() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceVanillaSwap>> *>(VT_SWAPS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceFRA>> *fras() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceFRA>> *>(VT_FRAS);
+  }
+  /// Quote move the sensitivities are scaled to (0.0001 = 1bp on rate quotes).
+  double bump_size() const {
+    return GetField<double>(VT_BUMP_SIZE, 0.0001);
+  }
+  quantra::CurveRiskMethod method() const {
+    return static_cast<quantra::CurveRiskMethod>(GetField<int8_t>(VT_METHOD, 0));
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_PRICING) &&
+           verifier.VerifyTable(pricing()) &&
+           VerifyOffset(verifier, VT_BONDS) &&
+           verifier.VerifyVector(bonds()) &&
+           verifier.VerifyVectorOfTables(bonds()) &&
+           VerifyOffset(verifier, VT_SWAPS) &&
+           verifier.VerifyVector(swaps()) &&
+           verifier.VerifyVectorOfTables(swaps()) &&
+           VerifyOffset(verifier, VT_FRAS) &&
+           verifier.VerifyVector(fras()) &&
+           verifier.VerifyVectorOfTables(fras()) &&
+           VerifyField<double>(verifier, VT_BUMP_SIZE, 8) &&
+           VerifyField<int8_t>(verifier, VT_METHOD, 1) &&
+           verifier.EndTable();
+  }
+  ComputeCurveRiskRequestT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ComputeCurveRiskRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<ComputeCurveRiskRequest> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ComputeCurveRiskRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ComputeCurveRiskRequestBuilder {
+  typedef ComputeCurveRiskRequest Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_pricing(::flatbuffers::Offset<quantra::Pricing> pricing) {
+    fbb_.AddOffset(ComputeCurveRiskRequest::VT_PRICING, pricing);
+  }
+  void add_bonds(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceFixedRateBond>>> bonds) {
+    fbb_.AddOffset(ComputeCurveRiskRequest::VT_BONDS, bonds);
+  }
+  void add_swaps(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceVanillaSwap>>> swaps) {
+    fbb_.AddOffset(ComputeCurveRiskRequest::VT_SWAPS, swaps);
+  }
+  void add_fras(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceFRA>>> fras) {
+    fbb_.AddOffset(ComputeCurveRiskRequest::VT_FRAS, fras);
+  }
+  void add_bump_size(double bump_size) {
+    fbb_.AddElement<double>(ComputeCurveRiskRequest::VT_BUMP_SIZE, bump_size, 0.0001);
+  }
+  void add_method(quantra::CurveRiskMethod method) {
+    fbb_.AddElement<int8_t>(ComputeCurveRiskRequest::VT_METHOD, static_cast<int8_t>(method), 0);
+  }
+  explicit ComputeCurveRiskRequestBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ComputeCurveRiskRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ComputeCurveRiskRequest>(end);
+    fbb_.Required(o, ComputeCurveRiskRequest::VT_PRICING);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ComputeCurveRiskRequest> CreateComputeCurveRiskRequest(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<quantra::Pricing> pricing = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceFixedRateBond>>> bonds = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceVanillaSwap>>> swaps = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::PriceFRA>>> fras = 0,
+    double bump_size = 0.0001,
+    quantra::CurveRiskMethod method = quantra::CurveRiskMethod_Jacobian) {
+  ComputeCurveRiskRequestBuilder builder_(_fbb);
+  builder_.add_bump_size(bump_size);
+  builder_.add_fras(fras);
+  builder_.add_swaps(swaps);
+  builder_.add_bonds(bonds);
+  builder_.add_pricing(pricing);
+  builder_.add_method(method);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ComputeCurveRiskRequest> CreateComputeCurveRiskRequestDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<quantra::Pricing> pricing = 0,
+    const std::vector<::flatbuffers::Offset<quantra::PriceFixedRateBond>> *bonds = nullptr,
+    const std::vector<::flatbuffers::Offset<quantra::PriceVanillaSwap>> *swaps = nullptr,
+    const std::vector<::flatbuffers::Offset<quantra::PriceFRA>> *fras = nullptr,
+    double bump_size = 0.0001,
+    quantra::CurveRiskMethod method = quantra::CurveRiskMethod_Jacobian) {
+  auto bonds__ = bonds ? _fbb.CreateVector<::flatbuffers::Offset<quantra::PriceFixedRateBond>>(*bonds) : 0;
+  auto swaps__ = swaps ? _fbb.CreateVector<::flatbuffers::Offset<quantra::PriceVanillaSwap>>(*swaps) : 0;
+  auto fras__ = fras ? _fbb.CreateVector<::flatbuffers::Offset<quantra::PriceFRA>>(*fras) : 0;
+  return quantra::CreateComputeCurveRiskRequest(
+      _fbb,
+      pricing,
+      bonds__,
+      swaps__,
+      fras__,
+      bump_size,
+      method);
+}
+
+::flatbuffers::Offset<ComputeCurveRiskRequest> CreateComputeCurveRiskRequest(::flatbuffers::FlatBufferBuilder &_fbb, const ComputeCurveRiskRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline ComputeCurveRiskRequestT::ComputeCurveRiskRequestT(const ComputeCurveRiskRequestT &o)
+      : pricing((o.pricing) ? new quantra::PricingT(*o.pricing) : nullptr),
+        bump_size(o.bump_size),
+        method(o.method) {
+  bonds.reserve(o.bonds.size());
+  for (const auto &bonds_ : o.bonds) { bonds.emplace_back((bonds_) ? new quantra::PriceFixedRateBondT(*bonds_) : nullptr); }
+  swaps.reserve(o.swaps.size());
+  for (const auto &swaps_ : o.swaps) { swaps.emplace_back((swaps_) ? new quantra::PriceVanillaSwapT(*swaps_) : nullptr); }
+  fras.reserve(o.fras.size());
+  for (const auto &fras_ : o.fras) { fras.emplace_back((fras_) ? new quantra::PriceFRAT(*fras_) : nullptr); }
+}
+
+inline ComputeCurveRiskRequestT &ComputeCurveRiskRequestT::operator=(ComputeCurveRiskRequestT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(pricing, o.pricing);
+  std::swap(bonds, o.bonds);
+  std::swap(swaps, o.swaps);
+  std::swap(fras, o.fras);
+  std::swap(bump_size, o.bump_size);
+  std::swap(method, o.method);
+  return *this;
+}
+
+inline ComputeCurveRiskRequestT *ComputeCurveRiskRequest::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<ComputeCurveRiskRequestT>(new ComputeCurveRiskRequestT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void ComputeCurveRiskRequest::UnPackTo(ComputeCurveRiskRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = pricing(); if (_e) { if(_o->pricing) { _e->UnPackTo(_o->pricing.get(), _resolver); } else { _o->pricing = std::unique_ptr<quantra::PricingT>(_e->UnPack(_resolver)); } } else if (_o->pricing) { _o->pricing.reset(); } }
+  { auto _e = bonds(); if (_e) { _o->bonds.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->bonds[_i]) { _e->Get(_i)->UnPackTo(_o->bonds[_i].get(), _resolver); } else { _o->bonds[_i] = std::unique_ptr<quantra::PriceFixedRateBondT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->bonds.resize(0); } }
+  { auto _e = swaps(); if (_e) { _o->swaps.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->swaps[_i]) { _e->Get(_i)->UnPackTo(_o->swaps[_i].get(), _resolver); } else { _o->swaps[_i] = std::unique_ptr<quantra::PriceVanillaSwapT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->swaps.resize(0); } }
+  { auto _e = fras(); if (_e) { _o->fras.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->fras[_i]) { _e->Get(_i)->UnPackTo(_o->fras[_i].get(), _resolver); } else { _o->fras[_i] = std::unique_ptr<quantra::PriceFRAT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->fras.resize(0); } }
+  { auto _e = bump_size(); _o->bump_size = _e; }
+  { auto _e = method(); _o->method = _e; }
+}
+
+inline ::flatbuffers::Offset<ComputeCurveRiskRequest> ComputeCurveRiskRequest::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ComputeCurveRiskRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateComputeCurveRiskRequest(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<ComputeCurveRiskRequest> CreateComputeCurveRiskRequest(::flatbuffers::FlatBufferBuilder &_fbb, const ComputeCurveRiskRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const ComputeCurveRiskRequestT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _pricing = _o->pricing ? CreatePricing(_fbb, _o->pricing.get(), _rehasher) : 0;
+  auto _bonds = _o->bonds.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::PriceFixedRateBond>> (_o->bonds.size(), [](size_t i, _VectorArgs *__va) { return CreatePriceFixedRateBond(*__va->__fbb, __va->__o->bonds[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _swaps = _o->swaps.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::PriceVanillaSwap>> (_o->swaps.size(), [](size_t i, _VectorArgs *__va) { return CreatePriceVanillaSwap(*__va->__fbb, __va->__o->swaps[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _fras = _o->fras.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::PriceFRA>> (_o->fras.size(), [](size_t i, _VectorArgs *__va) { return CreatePriceFRA(*__va->__fbb, __va->__o->fras[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _bump_size = _o->bump_size;
+  auto _method = _o->method;
+  return quantra::CreateComputeCurveRiskRequest(
+      _fbb,
+      _pricing,
+      _bonds,
+      _swaps,
+      _fras,
+      _bump_size,
+      _method);
+}
+
+inline const quantra::ComputeCurveRiskRequest *GetComputeCurveRiskRequest(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::ComputeCurveRiskRequest>(buf);
+}
+
+inline const quantra::ComputeCurveRiskRequest *GetSizePrefixedComputeCurveRiskRequest(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::ComputeCurveRiskRequest>(buf);
+}
+
+inline bool VerifyComputeCurveRiskRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::ComputeCurveRiskRequest>(nullptr);
+}
+
+inline bool VerifySizePrefixedComputeCurveRiskRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::ComputeCurveRiskRequest>(nullptr);
+}
+
+inline void FinishComputeCurveRiskRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::ComputeCurveRiskRequest> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedComputeCurveRiskRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::ComputeCurveRiskRequest> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::ComputeCurveRiskRequestT> UnPackComputeCurveRiskRequest(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::ComputeCurveRiskRequestT>(GetComputeCurveRiskRequest(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::ComputeCurveRiskRequestT> UnPackSizePrefixedComputeCurveRiskRequest(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::ComputeCurveRiskRequestT>(GetSizePrefixedComputeCurveRiskRequest(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_CURVERISKREQUEST_QUANTRA_H_
@@ -0,0 +1,539 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_CURVERISKRESPONSE_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_CURVERISKRESPONSE_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+#include "common_generated.h"
+
+namespace quantra {
+
+struct QuoteSensitivity;
+struct QuoteSensitivityBuilder;
+struct QuoteSensitivityT;
+
+struct TradeCurveRisk;
+struct TradeCurveRiskBuilder;
+struct TradeCurveRiskT;
+
+struct ComputeCurveRiskResponse;
+struct ComputeCurveRiskResponseBuilder;
+struct ComputeCurveRiskResponseT;
+
+enum CurveRiskTradeType : int8_t {
+  CurveRiskTradeType_Bond = 0,
+  CurveRiskTradeType_Swap = 1,
+  CurveRiskTradeType_FRA = 2,
+  CurveRiskTradeType_MIN = CurveRiskTradeType_Bond,
+  CurveRiskTradeType_MAX = CurveRiskTradeType_FRA
+};
+
+inline const CurveRiskTradeType (&EnumValuesCurveRiskTradeType())[3] {
+  static const CurveRiskTradeType values[] = {
+    CurveRiskTradeType_Bond,
+    CurveRiskTradeType_Swap,
+    CurveRiskTradeType_FRA
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesCurveRiskTradeType() {
+  static const char * const names[4] = {
+    "Bond",
+    "Swap",
+    "FRA",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCurveRiskTradeType(CurveRiskTradeType e) {
+  if (::flatbuffers::IsOutRange(e, CurveRiskTradeType_Bond, CurveRiskTradeType_FRA)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesCurveRiskTradeType()[index];
+}
+
+struct QuoteSensitivityT : public ::flatbuffers::NativeTable {
+  typedef QuoteSensitivity TableType;
+  std::string quote_id{};
+  std::string curve_id{};
+  double dv01 = 0.0;
+};
+
+/// NPV change of one trade for a bump_size move of one quote.
+struct QuoteSensitivity FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef QuoteSensitivityT NativeTableType;
+  typedef QuoteSensitivityBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_QUOTE_ID = 4,
+    VT_CURVE_ID = 6,
+    VT_DV01 = 8
+  };
+  const ::flatbuffers::String *quote_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_QUOTE_ID);
+  }
+  /// Curve whose helper carries the quote (first one if shared).
+  const ::flatbuffers::String *curve_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_CURVE_ID);
+  }
+  double dv01() const {
+    return GetField<double>(VT_DV01, 0.0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_QUOTE_ID) &&
+           verifier.VerifyString(quote_id()) &&
+           VerifyOffset(verifier, VT_CURVE_ID) &&
+           verifier.VerifyString(curve_id()) &&
+           VerifyField<double>(verifier, VT_DV01, 8) &&
+           verifier.EndTable();
+  }
+  QuoteSensitivityT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(QuoteSensitivityT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<QuoteSensitivity> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const QuoteSensitivityT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct QuoteSensitivityBuilder {
+  typedef QuoteSensitivity Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_quote_id(::flatbuffers::Offset<::flatbuffers::String> quote_id) {
+    fbb_.AddOffset(QuoteSensitivity::VT_QUOTE_ID, quote_id);
+  }
+  void add_curve_id(::flatbuffers::Offset<::flatbuffers::String> curve_id) {
+    fbb_.AddOffset(QuoteSensitivity::VT_CURVE_ID, curve_id);
+  }
+  void add_dv01(double dv01) {
+    fbb_.AddElement<double>(QuoteSensitivity::VT_DV01, dv01, 0.0);
+  }
+  explicit QuoteSensitivityBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<QuoteSensitivity> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<QuoteSensitivity>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<QuoteSensitivity> CreateQuoteSensitivity(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> quote_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> curve_id = 0,
+    double dv01 = 0.0) {
+  QuoteSensitivityBuilder builder_(_fbb);
+  builder_.add_dv01(dv01);
+  builder_.add_curve_id(curve_id);
+  builder_.add_quote_id(quote_id);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<QuoteSensitivity> CreateQuoteSensitivityDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *quote_id = nullptr,
+    const char *curve_id = nullptr,
+    double dv01 = 0.0) {
+  auto quote_id__ = quote_id ? _fbb.CreateString(quote_id) : 0;
+  auto curve_id__ = curve_id ? _fbb.CreateString(curve_id) : 0;
+  return quantra::CreateQuoteSensitivity(
+      _fbb,
+      quote_id__,
+      curve_id__,
+      dv01);
+}
+
+::flatbuffers::Offset<QuoteSensitivity> CreateQuoteSensitivity(::flatbuffers::FlatBufferBuilder &_fbb, const QuoteSensitivityT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct TradeCurveRiskT : public ::flatbuffers::NativeTable {
+  typedef TradeCurveRisk TableType;
+  quantra::CurveRiskTradeType trade_type = quantra::CurveRiskTradeType_Bond;
+  int32_t index = 0;
+  double npv = 0.0;
+  std::vector<std::unique_ptr<quantra::QuoteSensitivityT>> buckets{};
+  std::unique_ptr<quantra::ErrorT> error{};
+  TradeCurveRiskT() = default;
+  TradeCurveRiskT(const TradeCurveRiskT &o);
+  TradeCurveRiskT(TradeCurveRiskT&&) FLATBUFFERS_NOEXCEPT = default;
+  TradeCurveRiskT &operator=(TradeCurveRiskT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// Bucketed risk of a single trade.
+struct TradeCurveRisk FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef TradeCurveRiskT NativeTableType;
+  typedef TradeCurveRiskBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_TRADE_TYPE = 4,
+    VT_INDEX = 6,
+    VT_NPV = 8,
+    VT_BUCKETS = 10,
+    VT_ERROR = 12
+  };
+  quantra::CurveRiskTradeType trade_type() const {
+    return static_cast<quantra::CurveRiskTradeType>(GetField<int8_t>(VT_TRADE_TYPE, 0));
+  }
+  /// Position of the trade in its request vector.
+  int32_t index() const {
+    return GetField<int32_t>(VT_INDEX, 0);
+  }
+  double npv() const {
+    return GetField<double>(VT_NPV, 0.0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::QuoteSensitivity>> *buckets() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::QuoteSensitivity>> *>(VT_BUCKETS);
+  }
+  const quantra::Error *error() const {
+    return GetPointer<const quantra::Error *>(VT_ERROR);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_TRADE_TYPE, 1) &&
+           VerifyField<int32_t>(verifier, VT_INDEX, 4) &&
+           VerifyField<double>(verifier, VT_NPV, 8) &&
+           VerifyOffset(verifier, VT_BUCKETS) &&
+           verifier.VerifyVector(buckets()) &&
+           verifier.VerifyVectorOfTables(buckets()) &&
+           VerifyOffset(verifier, VT_ERROR) &&
+           verifier.VerifyTable(error()) &&
+           verifier.EndTable();
+  }
+  TradeCurveRiskT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(TradeCurveRiskT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<TradeCurveRisk> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TradeCurveRiskT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct TradeCurveRiskBuilder {
+  typedef TradeCurveRisk Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_trade_type(quantra::CurveRiskTradeType trade_type) {
+    fbb_.AddElement<int8_t>(TradeCurveRisk::VT_TRADE_TYPE, static_cast<int8_t>(trade_type), 0);
+  }
+  void add_index(int32_t index) {
+    fbb_.AddElement<int32_t>(TradeCurveRisk::VT_INDEX, index, 0);
+  }
+  void add_npv(double npv) {
+    fbb_.AddElement<double>(TradeCurveRisk::VT_NPV, npv, 0.0);
+  }
+  void add_buckets(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::QuoteSensitivity>>> buckets) {
+    fbb_.AddOffset(TradeCurveRisk::VT_BUCKETS, buckets);
+  }
+  void add_error(::flatbuffers::Offset<quantra::Error> error) {
+    fbb_.AddOffset(TradeCurveRisk::VT_ERROR, error);
+  }
+  explicit TradeCurveRiskBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<TradeCurveRisk> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<TradeCurveRisk>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<TradeCurveRisk> CreateTradeCurveRisk(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    quantra::CurveRiskTradeType trade_type = quantra::CurveRiskTradeType_Bond,
+    int32_t index = 0,
+    double npv = 0.0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::QuoteSensitivity>>> buckets = 0,
+    ::flatbuffers::Offset<quantra::Error> error = 0) {
+  TradeCurveRiskBuilder builder_(_fbb);
+  builder_.add_npv(npv);
+  builder_.add_error(error);
+  builder_.add_buckets(buckets);
+  builder_.add_index(index);
+  builder_.add_trade_type(trade_type);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<TradeCurveRisk> CreateTradeCurveRiskDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    quantra::CurveRiskTradeType trade_type = quantra::CurveRiskTradeType_Bond,
+    int32_t index = 0,
+    double npv = 0.0,
+    const std::vector<::flatbuffers::Offset<quantra::QuoteSensitivity>> *buckets = nullptr,
+    ::flatbuffers::Offset<quantra::Error> error = 0) {
+  auto buckets__ = buckets ? _fbb.CreateVector<::flatbuffers::Offset<quantra::QuoteSensitivity>>(*buckets) : 0;
+  return quantra::CreateTradeCurveRisk(
+      _fbb,
+      trade_type,
+      index,
+      npv,
+      buckets__,
+      error);
+}
+
+::flatbuffers::Offset<TradeCurveRisk> CreateTradeCurveRisk(::flatbuffers::FlatBufferBuilder &_fbb, const TradeCurveRiskT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct ComputeCurveRiskResponseT : public ::flatbuffers::NativeTable {
+  typedef ComputeCurveRiskResponse TableType;
+  std::vector<std::unique_ptr<quantra::TradeCurveRiskT>> trades{};
+  std::vector<std::string> stale_curves{};
+  ComputeCurveRiskResponseT() = default;
+  ComputeCurveRiskResponseT(const ComputeCurveRiskResponseT &o);
+  ComputeCurveRiskResponseT(ComputeCurveRiskResponseT&&) FLATBUFFERS_NOEXCEPT = default;
+  ComputeCurveRiskResponseT &operator=(ComputeCurveRiskResponseT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// Response for all trades, bonds first, then swaps, then FRAs.
+struct ComputeCurveRiskResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ComputeCurveRiskResponseT NativeTableType;
+  typedef ComputeCurveRiskResponseBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_TRADES = 4,
+    VT_STALE_CURVES = 6
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::TradeCurveRisk>> *trades() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::TradeCurveRisk>> *>(VT_TRADES);
+  }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_TRADES) &&
+           verifier.VerifyVector(trades()) &&
+           verifier.VerifyVectorOfTables(trades()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
+           verifier.EndTable();
+  }
+  ComputeCurveRiskResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ComputeCurveRiskResponseT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<ComputeCurveRiskResponse> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ComputeCurveRiskResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ComputeCurveRiskResponseBuilder {
+  typedef ComputeCurveRiskResponse Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_trades(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::TradeCurveRisk>>> trades) {
+    fbb_.AddOffset(ComputeCurveRiskResponse::VT_TRADES, trades);
+  }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(ComputeCurveRiskResponse::VT_STALE_CURVES, stale_curves);
+  }
+  explicit ComputeCurveRiskResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ComputeCurveRiskResponse> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ComputeCurveRiskResponse>(end);
+    fbb_.Required(o, ComputeCurveRiskResponse::VT_TRADES);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ComputeCurveRiskResponse> CreateComputeCurveRiskResponse(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::TradeCurveRisk>>> trades = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
+  ComputeCurveRiskResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
+  builder_.add_trades(trades);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ComputeCurveRiskResponse> CreateComputeCurveRiskResponseDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<quantra::TradeCurveRisk>> *trades = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
+  auto trades__ = trades ? _fbb.CreateVector<::flatbuffers::Offset<quantra::TradeCurveRisk>>(*trades) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
+  return quantra::CreateComputeCurveRiskResponse(
+      _fbb,
+      trades__,
+      stale_curves__);
+}
+
+::flatbuffers::Offset<ComputeCurveRiskResponse> CreateComputeCurveRiskResponse(::flatbuffers::FlatBufferBuilder &_fbb, const ComputeCurveRiskResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline QuoteSensitivityT *QuoteSensitivity::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<QuoteSensitivityT>(new QuoteSensitivityT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void QuoteSensitivity::UnPackTo(QuoteSensitivityT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = quote_id(); if (_e) _o->quote_id = _e->str(); }
+  { auto _e = curve_id(); if (_e) _o->curve_id = _e->str(); }
+  { auto _e = dv01(); _o->dv01 = _e; }
+}
+
+inline ::flatbuffers::Offset<QuoteSensitivity> QuoteSensitivity::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const QuoteSensitivityT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateQuoteSensitivity(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<QuoteSensitivity> CreateQuoteSensitivity(::flatbuffers::FlatBufferBuilder &_fbb, const QuoteSensitivityT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const QuoteSensitivityT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _quote_id = _o->quote_id.empty() ? 0 : _fbb.CreateString(_o->quote_id);
+  auto _curve_id = _o->curve_id.empty() ? 0 : _fbb.CreateString(_o->curve_id);
+  auto _dv01 = _o->dv01;
+  return quantra::CreateQuoteSensitivity(
+      _fbb,
+      _quote_id,
+      _curve_id,
+      _dv01);
+}
+
+inline TradeCurveRiskT::TradeCurveRiskT(const TradeCurveRiskT &o)
+      : trade_type(o.trade_type),
+        index(o.index),
+        npv(o.npv),
+        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr) {
+  buckets.reserve(o.buckets.size());
+  for (const auto &buckets_ : o.buckets) { buckets.emplace_back((buckets_) ? new quantra::QuoteSensitivityT(*buckets_) : nullptr); }
+}
+
+inline TradeCurveRiskT &TradeCurveRiskT::operator=(TradeCurveRiskT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(trade_type, o.trade_type);
+  std::swap(index, o.index);
+  std::swap(npv, o.npv);
+  std::swap(buckets, o.buckets);
+  std::swap(error, o.error);
+  return *this;
+}
+
+inline TradeCurveRiskT *TradeCurveRisk::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<TradeCurveRiskT>(new TradeCurveRiskT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void TradeCurveRisk::UnPackTo(TradeCurveRiskT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = trade_type(); _o->trade_type = _e; }
+  { auto _e = index(); _o->index = _e; }
+  { auto _e = npv(); _o->npv = _e; }
+  { auto _e = buckets(); if (_e) { _o->buckets.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->buckets[_i]) { _e->Get(_i)->UnPackTo(_o->buckets[_i].get(), _resolver); } else { _o->buckets[_i] = std::unique_ptr<quantra::QuoteSensitivityT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->buckets.resize(0); } }
+  { auto _e = error(); if (_e) { if(_o->error) { _e->UnPackTo(_o->error.get(), _resolver); } else { _o->error = std::unique_ptr<quantra::ErrorT>(_e->UnPack(_resolver)); } } else if (_o->error) { _o->error.reset(); } }
+}
+
+inline ::flatbuffers::Offset<TradeCurveRisk> TradeCurveRisk::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TradeCurveRiskT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateTradeCurveRisk(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<TradeCurveRisk> CreateTradeCurveRisk(::flatbuffers::FlatBufferBuilder &_fbb, const TradeCurveRiskT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const TradeCurveRiskT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _trade_type = _o->trade_type;
+  auto _index = _o->index;
+  auto _npv = _o->npv;
+  auto _buckets = _o->buckets.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::QuoteSensitivity>> (_o->buckets.size(), [](size_t i, _VectorArgs *__va) { return CreateQuoteSensitivity(*__va->__fbb, __va->__o->buckets[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _error = _o->error ? CreateError(_fbb, _o->error.get(), _rehasher) : 0;
+  return quantra::CreateTradeCurveRisk(
+      _fbb,
+      _trade_type,
+      _index,
+      _npv,
+      _buckets,
+      _error);
+}
+
+inline ComputeCurveRiskResponseT::ComputeCurveRiskResponseT(const ComputeCurveRiskResponseT &o)
+      : stale_curves(o.stale_curves) {
+  trades.reserve(o.trades.size());
+  for (const auto &trades_ : o.trades) { trades.emplace_back((trades_) ? new quantra::TradeCurveRiskT(*trades_) : nullptr); }
+}
+
+inline ComputeCurveRiskResponseT &ComputeCurveRiskResponseT::operator=(ComputeCurveRiskResponseT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(trades, o.trades);
+  std::swap(stale_curves, o.stale_curves);
+  return *this;
+}
+
+inline ComputeCurveRiskResponseT *ComputeCurveRiskResponse::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<ComputeCurveRiskResponseT>(new ComputeCurveRiskResponseT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void ComputeCurveRiskResponse::UnPackTo(ComputeCurveRiskResponseT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = trades(); if (_e) { _o->trades.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->trades[_i]) { _e->Get(_i)->UnPackTo(_o->trades[_i].get(), _resolver); } else { _o->trades[_i] = std::unique_ptr<quantra::TradeCurveRiskT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->trades.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<ComputeCurveRiskResponse> ComputeCurveRiskResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ComputeCurveRiskResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateComputeCurveRiskResponse(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<ComputeCurveRiskResponse> CreateComputeCurveRiskResponse(::flatbuffers::FlatBufferBuilder &_fbb, const ComputeCurveRiskResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const ComputeCurveRiskResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _trades = _fbb.CreateVector<::flatbuffers::Offset<quantra::TradeCurveRisk>> (_o->trades.size(), [](size_t i, _VectorArgs *__va) { return CreateTradeCurveRisk(*__va->__fbb, __va->__o->trades[i].get(), __va->__rehasher); }, &_va );
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
+  return quantra::CreateComputeCurveRiskResponse(
+      _fbb,
+      _trades,
+      _stale_curves);
+}
+
+inline const quantra::ComputeCurveRiskResponse *GetComputeCurveRiskResponse(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::ComputeCurveRiskResponse>(buf);
+}
+
+inline const quantra::ComputeCurveRiskResponse *GetSizePrefixedComputeCurveRiskResponse(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::ComputeCurveRiskResponse>(buf);
+}
+
+inline bool VerifyComputeCurveRiskResponseBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::ComputeCurveRiskResponse>(nullptr);
+}
+
+inline bool VerifySizePrefixedComputeCurveRiskResponseBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::ComputeCurveRiskResponse>(nullptr);
+}
+
+inline void FinishComputeCurveRiskResponseBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::ComputeCurveRiskResponse> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedComputeCurveRiskResponseBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::ComputeCurveRiskResponse> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::ComputeCurveRiskResponseT> UnPackComputeCurveRiskResponse(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::ComputeCurveRiskResponseT>(GetComputeCurveRiskResponse(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::ComputeCurveRiskResponseT> UnPackSizePrefixedComputeCurveRiskResponse(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::ComputeCurveRiskResponseT>(GetSizePrefixedComputeCurveRiskResponse(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_CURVERISKRESPONSE_QUANTRA_H_
@@ -0,0 +1,176 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_DELETETRADESREQUEST_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_DELETETRADESREQUEST_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+namespace quantra {
+
+struct DeleteTradesRequest;
+struct DeleteTradesRequestBuilder;
+struct DeleteTradesRequestT;
+
+struct DeleteTradesRequestT : public ::flatbuffers::NativeTable {
+  typedef DeleteTradesRequest TableType;
+  std::vector<std::string> trade_ids{};
+  std::vector<std::string> book_ids{};
+};
+
+/// Removes stored trades by id and/or every trade of the given books.
+/// Unknown ids and books are ignored.
+struct DeleteTradesRequest FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef DeleteTradesRequestT NativeTableType;
+  typedef DeleteTradesRequestBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_TRADE_IDS = 4,
+    VT_BOOK_IDS = 6
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *trade_ids() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_TRADE_IDS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *book_ids() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_BOOK_IDS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_TRADE_IDS) &&
+           verifier.VerifyVector(trade_ids()) &&
+           verifier.VerifyVectorOfStrings(trade_ids()) &&
+           VerifyOffset(verifier, VT_BOOK_IDS) &&
+           verifier.VerifyVector(book_ids()) &&
+           verifier.VerifyVectorOfStrings(book_ids()) &&
+           verifier.EndTable();
+  }
+  DeleteTradesRequestT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(DeleteTradesRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<DeleteTradesRequest> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const DeleteTradesRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct DeleteTradesRequestBuilder {
+  typedef DeleteTradesRequest Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_trade_ids(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> trade_ids) {
+    fbb_.AddOffset(DeleteTradesRequest::VT_TRADE_IDS, trade_ids);
+  }
+  void add_book_ids(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> book_ids) {
+    fbb_.AddOffset(DeleteTradesRequest::VT_BOOK_IDS, book_ids);
+  }
+  explicit DeleteTradesRequestBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<DeleteTradesRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<DeleteTradesRequest>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<DeleteTradesRequest> CreateDeleteTradesRequest(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> trade_ids = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> book_ids = 0) {
+  DeleteTradesRequestBuilder builder_(_fbb);
+  builder_.add_book_ids(book_ids);
+  builder_.add_trade_ids(trade_ids);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<DeleteTradesRequest> CreateDeleteTradesRequestDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *trade_ids = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *book_ids = nullptr) {
+  auto trade_ids__ = trade_ids ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*trade_ids) : 0;
+  auto book_ids__ = book_ids ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*book_ids) : 0;
+  return quantra::CreateDeleteTradesRequest(
+      _fbb,
+      trade_ids__,
+      book_ids__);
+}
+
+::flatbuffers::Offset<DeleteTradesRequest> CreateDeleteTradesRequest(::flatbuffers::FlatBufferBuilder &_fbb, const DeleteTradesRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline DeleteTradesRequestT *DeleteTradesRequest::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<DeleteTradesRequestT>(new DeleteTradesRequestT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void DeleteTradesRequest::UnPackTo(DeleteTradesRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = trade_ids(); if (_e) { _o->trade_ids.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->trade_ids[_i] = _e->Get(_i)->str(); } } else { _o->trade_ids.resize(0); } }
+  { auto _e = book_ids(); if (_e) { _o->book_ids.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->book_ids[_i] = _e->Get(_i)->str(); } } else { _o->book_ids.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<DeleteTradesRequest> DeleteTradesRequest::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const DeleteTradesRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateDeleteTradesRequest(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<DeleteTradesRequest> CreateDeleteTradesRequest(::flatbuffers::FlatBufferBuilder &_fbb, const DeleteTradesRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const DeleteTradesRequestT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _trade_ids = _o->trade_ids.size() ? _fbb.CreateVectorOfStrings(_o->trade_ids) : 0;
+  auto _book_ids = _o->book_ids.size() ? _fbb.CreateVectorOfStrings(_o->book_ids) : 0;
+  return quantra::CreateDeleteTradesRequest(
+      _fbb,
+      _trade_ids,
+      _book_ids);
+}
+
+inline const quantra::DeleteTradesRequest *GetDeleteTradesRequest(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::DeleteTradesRequest>(buf);
+}
+
+inline const quantra::DeleteTradesRequest *GetSizePrefixedDeleteTradesRequest(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::DeleteTradesRequest>(buf);
+}
+
+inline bool VerifyDeleteTradesRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::DeleteTradesRequest>(nullptr);
+}
+
+inline bool VerifySizePrefixedDeleteTradesRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::DeleteTradesRequest>(nullptr);
+}
+
+inline void FinishDeleteTradesRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::DeleteTradesRequest> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedDeleteTradesRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::DeleteTradesRequest> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::DeleteTradesRequestT> UnPackDeleteTradesRequest(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::DeleteTradesRequestT>(GetDeleteTradesRequest(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::DeleteTradesRequestT> UnPackSizePrefixedDeleteTradesRequest(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::DeleteTradesRequestT>(GetSizePrefixedDeleteTradesRequest(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_DELETETRADESREQUEST_QUANTRA_H_
@@ -0,0 +1,159 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_DELETETRADESRESPONSE_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_DELETETRADESRESPONSE_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+namespace quantra {
+
+struct DeleteTradesResponse;
+struct DeleteTradesResponseBuilder;
+struct DeleteTradesResponseT;
+
+struct DeleteTradesResponseT : public ::flatbuffers::NativeTable {
+  typedef DeleteTradesResponse TableType;
+  int32_t deleted = 0;
+  int32_t trade_count = 0;
+};
+
+struct DeleteTradesResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef DeleteTradesResponseT NativeTableType;
+  typedef DeleteTradesResponseBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_DELETED = 4,
+    VT_TRADE_COUNT = 6
+  };
+  int32_t deleted() const {
+    return GetField<int32_t>(VT_DELETED, 0);
+  }
+  /// Trades in the store after the delete.
+  int32_t trade_count() const {
+    return GetField<int32_t>(VT_TRADE_COUNT, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_DELETED, 4) &&
+           VerifyField<int32_t>(verifier, VT_TRADE_COUNT, 4) &&
+           verifier.EndTable();
+  }
+  DeleteTradesResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(DeleteTradesResponseT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<DeleteTradesResponse> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const DeleteTradesResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct DeleteTradesResponseBuilder {
+  typedef DeleteTradesResponse Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_deleted(int32_t deleted) {
+    fbb_.AddElement<int32_t>(DeleteTradesResponse::VT_DELETED, deleted, 0);
+  }
+  void add_trade_count(int32_t trade_count) {
+    fbb_.AddElement<int32_t>(DeleteTradesResponse::VT_TRADE_COUNT, trade_count, 0);
+  }
+  explicit DeleteTradesResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<DeleteTradesResponse> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<DeleteTradesResponse>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<DeleteTradesResponse> CreateDeleteTradesResponse(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t deleted = 0,
+    int32_t trade_count = 0) {
+  DeleteTradesResponseBuilder builder_(_fbb);
+  builder_.add_trade_count(trade_count);
+  builder_.add_deleted(deleted);
+  return builder_.Finish();
+}
+
+::flatbuffers::Offset<DeleteTradesResponse> CreateDeleteTradesResponse(::flatbuffers::FlatBufferBuilder &_fbb, const DeleteTradesResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline DeleteTradesResponseT *DeleteTradesResponse::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<DeleteTradesResponseT>(new DeleteTradesResponseT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void DeleteTradesResponse::UnPackTo(DeleteTradesResponseT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = deleted(); _o->deleted = _e; }
+  { auto _e = trade_count(); _o->trade_count = _e; }
+}
+
+inline ::flatbuffers::Offset<DeleteTradesResponse> DeleteTradesResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const DeleteTradesResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateDeleteTradesResponse(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<DeleteTradesResponse> CreateDeleteTradesResponse(::flatbuffers::FlatBufferBuilder &_fbb, const DeleteTradesResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const DeleteTradesResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _deleted = _o->deleted;
+  auto _trade_count = _o->trade_count;
+  return quantra::CreateDeleteTradesResponse(
+      _fbb,
+      _deleted,
+      _trade_count);
+}
+
+inline const quantra::DeleteTradesResponse *GetDeleteTradesResponse(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::DeleteTradesResponse>(buf);
+}
+
+inline const quantra::DeleteTradesResponse *GetSizePrefixedDeleteTradesResponse(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::DeleteTradesResponse>(buf);
+}
+
+inline bool VerifyDeleteTradesResponseBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::DeleteTradesResponse>(nullptr);
+}
+
+inline bool VerifySizePrefixedDeleteTradesResponseBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::DeleteTradesResponse>(nullptr);
+}
+
+inline void FinishDeleteTradesResponseBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::DeleteTradesResponse> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedDeleteTradesResponseBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::DeleteTradesResponse> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::DeleteTradesResponseT> UnPackDeleteTradesResponse(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::DeleteTradesResponseT>(GetDeleteTradesResponse(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::DeleteTradesResponseT> UnPackSizePrefixedDeleteTradesResponse(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::DeleteTradesResponseT>(GetSizePrefixedDeleteTradesResponse(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_DELETETRADESRESPONSE_QUANTRA_H_
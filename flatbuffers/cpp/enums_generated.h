@@ -166,6 +166,39 @@ inline const char *EnumNameBootstrapTrait(BootstrapTrait e) {
   return EnumNamesBootstrapTrait()[index];
 }
 
+enum BootstrapAccuracy : int8_t {
+  BootstrapAccuracy_Exact = 0,
+  BootstrapAccuracy_Standard = 1,
+  BootstrapAccuracy_Fast = 2,
+  BootstrapAccuracy_MIN = BootstrapAccuracy_Exact,
+  BootstrapAccuracy_MAX = BootstrapAccuracy_Fast
+};
+
+inline const BootstrapAccuracy (&EnumValuesBootstrapAccuracy())[3] {
+  static const BootstrapAccuracy values[] = {
+    BootstrapAccuracy_Exact,
+    BootstrapAccuracy_Standard,
+    BootstrapAccuracy_Fast
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesBootstrapAccuracy() {
+  static const char * const names[4] = {
+    "Exact",
+    "Standard",
+    "Fast",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameBootstrapAccuracy(BootstrapAccuracy e) {
+  if (::flatbuffers::IsOutRange(e, BootstrapAccuracy_Exact, BootstrapAccuracy_Fast)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesBootstrapAccuracy()[index];
+}
+
 enum TimeUnit : int8_t {
   TimeUnit_Days = 0,
   TimeUnit_Hours = 1,
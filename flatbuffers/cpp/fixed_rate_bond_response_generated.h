@@ -38,6 +38,8 @@ struct FixedRateBondResponseT : public ::flatbuffers::NativeTable {
   double convexity = 0.0;
   double bps = 0.0;
   std::vector<std::unique_ptr<quantra::FlowsWrapperT>> flows{};
+  double z_spread = 0.0;
+  std::string trade_id{};
   FixedRateBondResponseT() = default;
   FixedRateBondResponseT(const FixedRateBondResponseT &o);
   FixedRateBondResponseT(FixedRateBondResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -58,7 +60,9 @@ struct FixedRateBondResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Ta
     VT_MODIFIED_DURATION = 18,
     VT_CONVEXITY = 20,
     VT_BPS = 22,
-    VT_FLOWS = 24
+    VT_FLOWS = 24,
+    VT_Z_SPREAD = 26,
+    VT_TRADE_ID = 28
   };
   double npv() const {
     return GetField<double>(VT_NPV, 0.0);
@@ -93,6 +97,14 @@ struct FixedRateBondResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Ta
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>> *flows() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>> *>(VT_FLOWS);
   }
+  /// Solved from z_spread_quote; zero when none was given.
+  double z_spread() const {
+    return GetField<double>(VT_Z_SPREAD, 0.0);
+  }
+  /// Id of the stored trade priced, when the entry referenced one.
+  const ::flatbuffers::String *trade_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TRADE_ID);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_NPV, 8) &&
@@ -108,6 +120,9 @@ struct FixedRateBondResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Ta
            VerifyOffset(verifier, VT_FLOWS) &&
            verifier.VerifyVector(flows()) &&
            verifier.VerifyVectorOfTables(flows()) &&
+           VerifyField<double>(verifier, VT_Z_SPREAD, 8) &&
+           VerifyOffset(verifier, VT_TRADE_ID) &&
+           verifier.VerifyString(trade_id()) &&
            verifier.EndTable();
   }
   FixedRateBondResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -152,6 +167,12 @@ struct FixedRateBondResponseBuilder {
   void add_flows(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>>> flows) {
     fbb_.AddOffset(FixedRateBondResponse::VT_FLOWS, flows);
   }
+  void add_z_spread(double z_spread) {
+    fbb_.AddElement<double>(FixedRateBondResponse::VT_Z_SPREAD, z_spread, 0.0);
+  }
+  void add_trade_id(::flatbuffers::Offset<::flatbuffers::String> trade_id) {
+    fbb_.AddOffset(FixedRateBondResponse::VT_TRADE_ID, trade_id);
+  }
   explicit FixedRateBondResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -175,8 +196,11 @@ inline ::flatbuffers::Offset<FixedRateBondResponse> CreateFixedRateBondResponse(
     double modified_duration = 0.0,
     double convexity = 0.0,
     double bps = 0.0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>>> flows = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>>> flows = 0,
+    double z_spread = 0.0,
+    ::flatbuffers::Offset<::flatbuffers::String> trade_id = 0) {
   FixedRateBondResponseBuilder builder_(_fbb);
+  builder_.add_z_spread(z_spread);
   builder_.add_bps(bps);
   builder_.add_convexity(convexity);
   builder_.add_modified_duration(modified_duration);
@@ -187,6 +211,7 @@ inline ::flatbuffers::Offset<FixedRateBondResponse> CreateFixedRateBondResponse(
   builder_.add_dirty_price(dirty_price);
   builder_.add_clean_price(clean_price);
   builder_.add_npv(npv);
+  builder_.add_trade_id(trade_id);
   builder_.add_flows(flows);
   return builder_.Finish();
 }
@@ -203,8 +228,11 @@ inline ::flatbuffers::Offset<FixedRateBondResponse> CreateFixedRateBondResponseD
     double modified_duration = 0.0,
     double convexity = 0.0,
     double bps = 0.0,
-    const std::vector<::flatbuffers::Offset<quantra::FlowsWrapper>> *flows = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::FlowsWrapper>> *flows = nullptr,
+    double z_spread = 0.0,
+    const char *trade_id = nullptr) {
   auto flows__ = flows ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FlowsWrapper>>(*flows) : 0;
+  auto trade_id__ = trade_id ? _fbb.CreateString(trade_id) : 0;
   return quantra::CreateFixedRateBondResponse(
       _fbb,
       npv,
@@ -217,7 +245,9 @@ inline ::flatbuffers::Offset<FixedRateBondResponse> CreateFixedRateBondResponseD
       modified_duration,
       convexity,
       bps,
-      flows__);
+      flows__,
+      z_spread,
+      trade_id__);
 }
 
 ::flatbuffers::Offset<FixedRateBondResponse> CreateFixedRateBondResponse(::flatbuffers::FlatBufferBuilder &_fbb, const FixedRateBondResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -225,6 +255,7 @@ inline ::flatbuffers::Offset<FixedRateBondResponse> CreateFixedRateBondResponseD
 struct PriceFixedRateBondResponseT : public ::flatbuffers::NativeTable {
   typedef PriceFixedRateBondResponse TableType;
   std::vector<std::unique_ptr<quantra::FixedRateBondResponseT>> bonds{};
+  std::vector<std::string> stale_curves{};
   PriceFixedRateBondResponseT() = default;
   PriceFixedRateBondResponseT(const PriceFixedRateBondResponseT &o);
   PriceFixedRateBondResponseT(PriceFixedRateBondResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -235,16 +266,25 @@ struct PriceFixedRateBondResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffer
   typedef PriceFixedRateBondResponseT NativeTableType;
   typedef PriceFixedRateBondResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_BONDS = 4
+    VT_BONDS = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FixedRateBondResponse>> *bonds() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FixedRateBondResponse>> *>(VT_BONDS);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_BONDS) &&
            verifier.VerifyVector(bonds()) &&
            verifier.VerifyVectorOfTables(bonds()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   PriceFixedRateBondResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -259,6 +299,9 @@ struct PriceFixedRateBondResponseBuilder {
   void add_bonds(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FixedRateBondResponse>>> bonds) {
     fbb_.AddOffset(PriceFixedRateBondResponse::VT_BONDS, bonds);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(PriceFixedRateBondResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit PriceFixedRateBondResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -272,19 +315,24 @@ struct PriceFixedRateBondResponseBuilder {
 
 inline ::flatbuffers::Offset<PriceFixedRateBondResponse> CreatePriceFixedRateBondResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FixedRateBondResponse>>> bonds = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FixedRateBondResponse>>> bonds = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   PriceFixedRateBondResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_bonds(bonds);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<PriceFixedRateBondResponse> CreatePriceFixedRateBondResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::FixedRateBondResponse>> *bonds = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::FixedRateBondResponse>> *bonds = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto bonds__ = bonds ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FixedRateBondResponse>>(*bonds) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreatePriceFixedRateBondResponse(
       _fbb,
-      bonds__);
+      bonds__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<PriceFixedRateBondResponse> CreatePriceFixedRateBondResponse(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFixedRateBondResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -299,7 +347,9 @@ inline FixedRateBondResponseT::FixedRateBondResponseT(const FixedRateBondRespons
         macaulay_duration(o.macaulay_duration),
         modified_duration(o.modified_duration),
         convexity(o.convexity),
-        bps(o.bps) {
+        bps(o.bps),
+        z_spread(o.z_spread),
+        trade_id(o.trade_id) {
   flows.reserve(o.flows.size());
   for (const auto &flows_ : o.flows) { flows.emplace_back((flows_) ? new quantra::FlowsWrapperT(*flows_) : nullptr); }
 }
@@ -316,6 +366,8 @@ inline FixedRateBondResponseT &FixedRateBondResponseT::operator=(FixedRateBondRe
   std::swap(convexity, o.convexity);
   std::swap(bps, o.bps);
   std::swap(flows, o.flows);
+  std::swap(z_spread, o.z_spread);
+  std::swap(trade_id, o.trade_id);
   return *this;
 }
 
@@ -339,6 +391,8 @@ inline void FixedRateBondResponse::UnPackTo(FixedRateBondResponseT *_o, const ::
   { auto _e = convexity(); _o->convexity = _e; }
   { auto _e = bps(); _o->bps = _e; }
   { auto _e = flows(); if (_e) { _o->flows.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->flows[_i]) { _e->Get(_i)->UnPackTo(_o->flows[_i].get(), _resolver); } else { _o->flows[_i] = std::unique_ptr<quantra::FlowsWrapperT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->flows.resize(0); } }
+  { auto _e = z_spread(); _o->z_spread = _e; }
+  { auto _e = trade_id(); if (_e) _o->trade_id = _e->str(); }
 }
 
 inline ::flatbuffers::Offset<FixedRateBondResponse> FixedRateBondResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const FixedRateBondResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -360,6 +414,8 @@ inline ::flatbuffers::Offset<FixedRateBondResponse> CreateFixedRateBondResponse(
   auto _convexity = _o->convexity;
   auto _bps = _o->bps;
   auto _flows = _o->flows.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FlowsWrapper>> (_o->flows.size(), [](size_t i, _VectorArgs *__va) { return CreateFlowsWrapper(*__va->__fbb, __va->__o->flows[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _z_spread = _o->z_spread;
+  auto _trade_id = _o->trade_id.empty() ? 0 : _fbb.CreateString(_o->trade_id);
   return quantra::CreateFixedRateBondResponse(
       _fbb,
       _npv,
@@ -372,16 +428,20 @@ inline ::flatbuffers::Offset<FixedRateBondResponse> CreateFixedRateBondResponse(
       _modified_duration,
       _convexity,
       _bps,
-      _flows);
+      _flows,
+      _z_spread,
+      _trade_id);
 }
 
-inline PriceFixedRateBondResponseT::PriceFixedRateBondResponseT(const PriceFixedRateBondResponseT &o) {
+inline PriceFixedRateBondResponseT::PriceFixedRateBondResponseT(const PriceFixedRateBondResponseT &o)
+      : stale_curves(o.stale_curves) {
   bonds.reserve(o.bonds.size());
   for (const auto &bonds_ : o.bonds) { bonds.emplace_back((bonds_) ? new quantra::FixedRateBondResponseT(*bonds_) : nullptr); }
 }
 
 inline PriceFixedRateBondResponseT &PriceFixedRateBondResponseT::operator=(PriceFixedRateBondResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(bonds, o.bonds);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -395,6 +455,7 @@ inline void PriceFixedRateBondResponse::UnPackTo(PriceFixedRateBondResponseT *_o
   (void)_o;
   (void)_resolver;
   { auto _e = bonds(); if (_e) { _o->bonds.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->bonds[_i]) { _e->Get(_i)->UnPackTo(_o->bonds[_i].get(), _resolver); } else { _o->bonds[_i] = std::unique_ptr<quantra::FixedRateBondResponseT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->bonds.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<PriceFixedRateBondResponse> PriceFixedRateBondResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFixedRateBondResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -406,9 +467,11 @@ inline ::flatbuffers::Offset<PriceFixedRateBondResponse> CreatePriceFixedRateBon
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const PriceFixedRateBondResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _bonds = _o->bonds.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FixedRateBondResponse>> (_o->bonds.size(), [](size_t i, _VectorArgs *__va) { return CreateFixedRateBondResponse(*__va->__fbb, __va->__o->bonds[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreatePriceFixedRateBondResponse(
       _fbb,
-      _bonds);
+      _bonds,
+      _stale_curves);
 }
 
 inline const quantra::PriceFixedRateBondResponse *GetPriceFixedRateBondResponse(const void *buf) {
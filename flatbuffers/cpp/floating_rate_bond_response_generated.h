@@ -38,6 +38,7 @@ struct FloatingRateBondResponseT : public ::flatbuffers::NativeTable {
   double convexity = 0.0;
   double bps = 0.0;
   std::vector<std::unique_ptr<quantra::FlowsWrapperT>> flows{};
+  double z_spread = 0.0;
   FloatingRateBondResponseT() = default;
   FloatingRateBondResponseT(const FloatingRateBondResponseT &o);
   FloatingRateBondResponseT(FloatingRateBondResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -58,7 +59,8 @@ struct FloatingRateBondResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers:
     VT_MODIFIED_DURATION = 18,
     VT_CONVEXITY = 20,
     VT_BPS = 22,
-    VT_FLOWS = 24
+    VT_FLOWS = 24,
+    VT_Z_SPREAD = 26
   };
   double npv() const {
     return GetField<double>(VT_NPV, 0.0);
@@ -93,6 +95,10 @@ struct FloatingRateBondResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers:
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>> *flows() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>> *>(VT_FLOWS);
   }
+  /// Solved from z_spread_quote; zero when none was given.
+  double z_spread() const {
+    return GetField<double>(VT_Z_SPREAD, 0.0);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_NPV, 8) &&
@@ -108,6 +114,7 @@ struct FloatingRateBondResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers:
            VerifyOffset(verifier, VT_FLOWS) &&
            verifier.VerifyVector(flows()) &&
            verifier.VerifyVectorOfTables(flows()) &&
+           VerifyField<double>(verifier, VT_Z_SPREAD, 8) &&
            verifier.EndTable();
   }
   FloatingRateBondResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -152,6 +159,9 @@ struct FloatingRateBondResponseBuilder {
   void add_flows(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>>> flows) {
     fbb_.AddOffset(FloatingRateBondResponse::VT_FLOWS, flows);
   }
+  void add_z_spread(double z_spread) {
+    fbb_.AddElement<double>(FloatingRateBondResponse::VT_Z_SPREAD, z_spread, 0.0);
+  }
   explicit FloatingRateBondResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -175,8 +185,10 @@ inline ::flatbuffers::Offset<FloatingRateBondResponse> CreateFloatingRateBondRes
     double modified_duration = 0.0,
     double convexity = 0.0,
     double bps = 0.0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>>> flows = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FlowsWrapper>>> flows = 0,
+    double z_spread = 0.0) {
   FloatingRateBondResponseBuilder builder_(_fbb);
+  builder_.add_z_spread(z_spread);
   builder_.add_bps(bps);
   builder_.add_convexity(convexity);
   builder_.add_modified_duration(modified_duration);
@@ -203,7 +215,8 @@ inline ::flatbuffers::Offset<FloatingRateBondResponse> CreateFloatingRateBondRes
     double modified_duration = 0.0,
     double convexity = 0.0,
     double bps = 0.0,
-    const std::vector<::flatbuffers::Offset<quantra::FlowsWrapper>> *flows = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::FlowsWrapper>> *flows = nullptr,
+    double z_spread = 0.0) {
   auto flows__ = flows ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FlowsWrapper>>(*flows) : 0;
   return quantra::CreateFloatingRateBondResponse(
       _fbb,
@@ -217,7 +230,8 @@ inline ::flatbuffers::Offset<FloatingRateBondResponse> CreateFloatingRateBondRes
       modified_duration,
       convexity,
       bps,
-      flows__);
+      flows__,
+      z_spread);
 }
 
 ::flatbuffers::Offset<FloatingRateBondResponse> CreateFloatingRateBondResponse(::flatbuffers::FlatBufferBuilder &_fbb, const FloatingRateBondResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -225,6 +239,7 @@ inline ::flatbuffers::Offset<FloatingRateBondResponse> CreateFloatingRateBondRes
 struct PriceFloatingRateBondResponseT : public ::flatbuffers::NativeTable {
   typedef PriceFloatingRateBondResponse TableType;
   std::vector<std::unique_ptr<quantra::FloatingRateBondResponseT>> bonds{};
+  std::vector<std::string> stale_curves{};
   PriceFloatingRateBondResponseT() = default;
   PriceFloatingRateBondResponseT(const PriceFloatingRateBondResponseT &o);
   PriceFloatingRateBondResponseT(PriceFloatingRateBondResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -235,16 +250,25 @@ struct PriceFloatingRateBondResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuf
   typedef PriceFloatingRateBondResponseT NativeTableType;
   typedef PriceFloatingRateBondResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_BONDS = 4
+    VT_BONDS = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>> *bonds() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>> *>(VT_BONDS);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_BONDS) &&
            verifier.VerifyVector(bonds()) &&
            verifier.VerifyVectorOfTables(bonds()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   PriceFloatingRateBondResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -259,6 +283,9 @@ struct PriceFloatingRateBondResponseBuilder {
   void add_bonds(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>>> bonds) {
     fbb_.AddOffset(PriceFloatingRateBondResponse::VT_BONDS, bonds);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(PriceFloatingRateBondResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit PriceFloatingRateBondResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -272,19 +299,24 @@ struct PriceFloatingRateBondResponseBuilder {
 
 inline ::flatbuffers::Offset<PriceFloatingRateBondResponse> CreatePriceFloatingRateBondResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>>> bonds = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>>> bonds = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   PriceFloatingRateBondResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_bonds(bonds);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<PriceFloatingRateBondResponse> CreatePriceFloatingRateBondResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>> *bonds = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>> *bonds = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto bonds__ = bonds ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>>(*bonds) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreatePriceFloatingRateBondResponse(
       _fbb,
-      bonds__);
+      bonds__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<PriceFloatingRateBondResponse> CreatePriceFloatingRateBondResponse(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFloatingRateBondResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -299,7 +331,8 @@ inline FloatingRateBondResponseT::FloatingRateBondResponseT(const FloatingRateBo
         macaulay_duration(o.macaulay_duration),
         modified_duration(o.modified_duration),
         convexity(o.convexity),
-        bps(o.bps) {
+        bps(o.bps),
+        z_spread(o.z_spread) {
   flows.reserve(o.flows.size());
   for (const auto &flows_ : o.flows) { flows.emplace_back((flows_) ? new quantra::FlowsWrapperT(*flows_) : nullptr); }
 }
@@ -316,6 +349,7 @@ inline FloatingRateBondResponseT &FloatingRateBondResponseT::operator=(FloatingR
   std::swap(convexity, o.convexity);
   std::swap(bps, o.bps);
   std::swap(flows, o.flows);
+  std::swap(z_spread, o.z_spread);
   return *this;
 }
 
@@ -339,6 +373,7 @@ inline void FloatingRateBondResponse::UnPackTo(FloatingRateBondResponseT *_o, co
   { auto _e = convexity(); _o->convexity = _e; }
   { auto _e = bps(); _o->bps = _e; }
   { auto _e = flows(); if (_e) { _o->flows.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->flows[_i]) { _e->Get(_i)->UnPackTo(_o->flows[_i].get(), _resolver); } else { _o->flows[_i] = std::unique_ptr<quantra::FlowsWrapperT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->flows.resize(0); } }
+  { auto _e = z_spread(); _o->z_spread = _e; }
 }
 
 inline ::flatbuffers::Offset<FloatingRateBondResponse> FloatingRateBondResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const FloatingRateBondResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -360,6 +395,7 @@ inline ::flatbuffers::Offset<FloatingRateBondResponse> CreateFloatingRateBondRes
   auto _convexity = _o->convexity;
   auto _bps = _o->bps;
   auto _flows = _o->flows.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FlowsWrapper>> (_o->flows.size(), [](size_t i, _VectorArgs *__va) { return CreateFlowsWrapper(*__va->__fbb, __va->__o->flows[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _z_spread = _o->z_spread;
   return quantra::CreateFloatingRateBondResponse(
       _fbb,
       _npv,
@@ -372,16 +408,19 @@ inline ::flatbuffers::Offset<FloatingRateBondResponse> CreateFloatingRateBondRes
       _modified_duration,
       _convexity,
       _bps,
-      _flows);
+      _flows,
+      _z_spread);
 }
 
-inline PriceFloatingRateBondResponseT::PriceFloatingRateBondResponseT(const PriceFloatingRateBondResponseT &o) {
+inline PriceFloatingRateBondResponseT::PriceFloatingRateBondResponseT(const PriceFloatingRateBondResponseT &o)
+      : stale_curves(o.stale_curves) {
   bonds.reserve(o.bonds.size());
   for (const auto &bonds_ : o.bonds) { bonds.emplace_back((bonds_) ? new quantra::FloatingRateBondResponseT(*bonds_) : nullptr); }
 }
 
 inline PriceFloatingRateBondResponseT &PriceFloatingRateBondResponseT::operator=(PriceFloatingRateBondResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(bonds, o.bonds);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -395,6 +434,7 @@ inline void PriceFloatingRateBondResponse::UnPackTo(PriceFloatingRateBondRespons
   (void)_o;
   (void)_resolver;
   { auto _e = bonds(); if (_e) { _o->bonds.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->bonds[_i]) { _e->Get(_i)->UnPackTo(_o->bonds[_i].get(), _resolver); } else { _o->bonds[_i] = std::unique_ptr<quantra::FloatingRateBondResponseT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->bonds.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<PriceFloatingRateBondResponse> PriceFloatingRateBondResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFloatingRateBondResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -406,9 +446,11 @@ inline ::flatbuffers::Offset<PriceFloatingRateBondResponse> CreatePriceFloatingR
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const PriceFloatingRateBondResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _bonds = _o->bonds.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FloatingRateBondResponse>> (_o->bonds.size(), [](size_t i, _VectorArgs *__va) { return CreateFloatingRateBondResponse(*__va->__fbb, __va->__o->bonds[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreatePriceFloatingRateBondResponse(
       _fbb,
-      _bonds);
+      _bonds,
+      _stale_curves);
 }
 
 inline const quantra::PriceFloatingRateBondResponse *GetPriceFloatingRateBondResponse(const void *buf) {
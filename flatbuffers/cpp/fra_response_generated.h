@@ -127,6 +127,7 @@ inline ::flatbuffers::Offset<FRAResponse> CreateFRAResponseDirect(
 struct PriceFRAResponseT : public ::flatbuffers::NativeTable {
   typedef PriceFRAResponse TableType;
   std::vector<std::unique_ptr<quantra::FRAResponseT>> fras{};
+  std::vector<std::string> stale_curves{};
   PriceFRAResponseT() = default;
   PriceFRAResponseT(const PriceFRAResponseT &o);
   PriceFRAResponseT(PriceFRAResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -137,16 +138,25 @@ struct PriceFRAResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   typedef PriceFRAResponseT NativeTableType;
   typedef PriceFRAResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_FRAS = 4
+    VT_FRAS = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FRAResponse>> *fras() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::FRAResponse>> *>(VT_FRAS);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_FRAS) &&
            verifier.VerifyVector(fras()) &&
            verifier.VerifyVectorOfTables(fras()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   PriceFRAResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -161,6 +171,9 @@ struct PriceFRAResponseBuilder {
   void add_fras(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FRAResponse>>> fras) {
     fbb_.AddOffset(PriceFRAResponse::VT_FRAS, fras);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(PriceFRAResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit PriceFRAResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -174,19 +187,24 @@ struct PriceFRAResponseBuilder {
 
 inline ::flatbuffers::Offset<PriceFRAResponse> CreatePriceFRAResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FRAResponse>>> fras = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::FRAResponse>>> fras = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   PriceFRAResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_fras(fras);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<PriceFRAResponse> CreatePriceFRAResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::FRAResponse>> *fras = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::FRAResponse>> *fras = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto fras__ = fras ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FRAResponse>>(*fras) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreatePriceFRAResponse(
       _fbb,
-      fras__);
+      fras__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<PriceFRAResponse> CreatePriceFRAResponse(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFRAResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -226,13 +244,15 @@ inline ::flatbuffers::Offset<FRAResponse> CreateFRAResponse(::flatbuffers::FlatB
       _settlement_date);
 }
 
-inline PriceFRAResponseT::PriceFRAResponseT(const PriceFRAResponseT &o) {
+inline PriceFRAResponseT::PriceFRAResponseT(const PriceFRAResponseT &o)
+      : stale_curves(o.stale_curves) {
   fras.reserve(o.fras.size());
   for (const auto &fras_ : o.fras) { fras.emplace_back((fras_) ? new quantra::FRAResponseT(*fras_) : nullptr); }
 }
 
 inline PriceFRAResponseT &PriceFRAResponseT::operator=(PriceFRAResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(fras, o.fras);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -246,6 +266,7 @@ inline void PriceFRAResponse::UnPackTo(PriceFRAResponseT *_o, const ::flatbuffer
   (void)_o;
   (void)_resolver;
   { auto _e = fras(); if (_e) { _o->fras.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->fras[_i]) { _e->Get(_i)->UnPackTo(_o->fras[_i].get(), _resolver); } else { _o->fras[_i] = std::unique_ptr<quantra::FRAResponseT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->fras.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<PriceFRAResponse> PriceFRAResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFRAResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -257,9 +278,11 @@ inline ::flatbuffers::Offset<PriceFRAResponse> CreatePriceFRAResponse(::flatbuff
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const PriceFRAResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _fras = _o->fras.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::FRAResponse>> (_o->fras.size(), [](size_t i, _VectorArgs *__va) { return CreateFRAResponse(*__va->__fbb, __va->__o->fras[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreatePriceFRAResponse(
       _fbb,
-      _fras);
+      _fras,
+      _stale_curves);
 }
 
 inline const quantra::PriceFRAResponse *GetPriceFRAResponse(const void *buf) {
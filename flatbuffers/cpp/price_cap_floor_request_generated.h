@@ -35,6 +35,8 @@ struct PriceCapFloorT : public ::flatbuffers::NativeTable {
   std::string volatility{};
   std::string model{};
   bool include_details = false;
+  std::string trade_id{};
+  std::string book_id{};
   PriceCapFloorT() = default;
   PriceCapFloorT(const PriceCapFloorT &o);
   PriceCapFloorT(PriceCapFloorT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -50,7 +52,9 @@ struct PriceCapFloor FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_FORWARDING_CURVE = 8,
     VT_VOLATILITY = 10,
     VT_MODEL = 12,
-    VT_INCLUDE_DETAILS = 14
+    VT_INCLUDE_DETAILS = 14,
+    VT_TRADE_ID = 16,
+    VT_BOOK_ID = 18
   };
   const quantra::CapFloor *cap_floor() const {
     return GetPointer<const quantra::CapFloor *>(VT_CAP_FLOOR);
@@ -70,6 +74,16 @@ struct PriceCapFloor FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   bool include_details() const {
     return GetField<uint8_t>(VT_INCLUDE_DETAILS, 0) != 0;
   }
+  /// Price the stored trade with this id (UpsertTrades) instead of an
+  /// inline cap_floor.
+  const ::flatbuffers::String *trade_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TRADE_ID);
+  }
+  /// Price every stored cap/floor of this book, each with this entry's
+  /// curves and settings; one response per trade.
+  const ::flatbuffers::String *book_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_BOOK_ID);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_CAP_FLOOR) &&
@@ -83,6 +97,10 @@ struct PriceCapFloor FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_MODEL) &&
            verifier.VerifyString(model()) &&
            VerifyField<uint8_t>(verifier, VT_INCLUDE_DETAILS, 1) &&
+           VerifyOffset(verifier, VT_TRADE_ID) &&
+           verifier.VerifyString(trade_id()) &&
+           VerifyOffset(verifier, VT_BOOK_ID) &&
+           verifier.VerifyString(book_id()) &&
            verifier.EndTable();
   }
   PriceCapFloorT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -112,6 +130,12 @@ struct PriceCapFloorBuilder {
   void add_include_details(bool include_details) {
     fbb_.AddElement<uint8_t>(PriceCapFloor::VT_INCLUDE_DETAILS, static_cast<uint8_t>(include_details), 0);
   }
+  void add_trade_id(::flatbuffers::Offset<::flatbuffers::String> trade_id) {
+    fbb_.AddOffset(PriceCapFloor::VT_TRADE_ID, trade_id);
+  }
+  void add_book_id(::flatbuffers::Offset<::flatbuffers::String> book_id) {
+    fbb_.AddOffset(PriceCapFloor::VT_BOOK_ID, book_id);
+  }
   explicit PriceCapFloorBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -130,8 +154,12 @@ inline ::flatbuffers::Offset<PriceCapFloor> CreatePriceCapFloor(
     ::flatbuffers::Offset<::flatbuffers::String> forwarding_curve = 0,
     ::flatbuffers::Offset<::flatbuffers::String> volatility = 0,
     ::flatbuffers::Offset<::flatbuffers::String> model = 0,
-    bool include_details = false) {
+    bool include_details = false,
+    ::flatbuffers::Offset<::flatbuffers::String> trade_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> book_id = 0) {
   PriceCapFloorBuilder builder_(_fbb);
+  builder_.add_book_id(book_id);
+  builder_.add_trade_id(trade_id);
   builder_.add_model(model);
   builder_.add_volatility(volatility);
   builder_.add_forwarding_curve(forwarding_curve);
@@ -148,11 +176,15 @@ inline ::flatbuffers::Offset<PriceCapFloor> CreatePriceCapFloorDirect(
     const char *forwarding_curve = nullptr,
     const char *volatility = nullptr,
     const char *model = nullptr,
-    bool include_details = false) {
+    bool include_details = false,
+    const char *trade_id = nullptr,
+    const char *book_id = nullptr) {
   auto discounting_curve__ = discounting_curve ? _fbb.CreateString(discounting_curve) : 0;
   auto forwarding_curve__ = forwarding_curve ? _fbb.CreateString(forwarding_curve) : 0;
   auto volatility__ = volatility ? _fbb.CreateString(volatility) : 0;
   auto model__ = model ? _fbb.CreateString(model) : 0;
+  auto trade_id__ = trade_id ? _fbb.CreateString(trade_id) : 0;
+  auto book_id__ = book_id ? _fbb.CreateString(book_id) : 0;
   return quantra::CreatePriceCapFloor(
       _fbb,
       cap_floor,
@@ -160,7 +192,9 @@ inline ::flatbuffers::Offset<PriceCapFloor> CreatePriceCapFloorDirect(
       forwarding_curve__,
       volatility__,
       model__,
-      include_details);
+      include_details,
+      trade_id__,
+      book_id__);
 }
 
 ::flatbuffers::Offset<PriceCapFloor> CreatePriceCapFloor(::flatbuffers::FlatBufferBuilder &_fbb, const PriceCapFloorT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -252,7 +286,9 @@ inline PriceCapFloorT::PriceCapFloorT(const PriceCapFloorT &o)
         forwarding_curve(o.forwarding_curve),
         volatility(o.volatility),
         model(o.model),
-        include_details(o.include_details) {
+        include_details(o.include_details),
+        trade_id(o.trade_id),
+        book_id(o.book_id) {
 }
 
 inline PriceCapFloorT &PriceCapFloorT::operator=(PriceCapFloorT o) FLATBUFFERS_NOEXCEPT {
@@ -262,6 +298,8 @@ inline PriceCapFloorT &PriceCapFloorT::operator=(PriceCapFloorT o) FLATBUFFERS_N
   std::swap(volatility, o.volatility);
   std::swap(model, o.model);
   std::swap(include_details, o.include_details);
+  std::swap(trade_id, o.trade_id);
+  std::swap(book_id, o.book_id);
   return *this;
 }
 
@@ -280,6 +318,8 @@ inline void PriceCapFloor::UnPackTo(PriceCapFloorT *_o, const ::flatbuffers::res
   { auto _e = volatility(); if (_e) _o->volatility = _e->str(); }
   { auto _e = model(); if (_e) _o->model = _e->str(); }
   { auto _e = include_details(); _o->include_details = _e; }
+  { auto _e = trade_id(); if (_e) _o->trade_id = _e->str(); }
+  { auto _e = book_id(); if (_e) _o->book_id = _e->str(); }
 }
 
 inline ::flatbuffers::Offset<PriceCapFloor> PriceCapFloor::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceCapFloorT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -296,6 +336,8 @@ inline ::flatbuffers::Offset<PriceCapFloor> CreatePriceCapFloor(::flatbuffers::F
   auto _volatility = _o->volatility.empty() ? 0 : _fbb.CreateString(_o->volatility);
   auto _model = _o->model.empty() ? 0 : _fbb.CreateString(_o->model);
   auto _include_details = _o->include_details;
+  auto _trade_id = _o->trade_id.empty() ? 0 : _fbb.CreateString(_o->trade_id);
+  auto _book_id = _o->book_id.empty() ? 0 : _fbb.CreateString(_o->book_id);
   return quantra::CreatePriceCapFloor(
       _fbb,
       _cap_floor,
@@ -303,7 +345,9 @@ inline ::flatbuffers::Offset<PriceCapFloor> CreatePriceCapFloor(::flatbuffers::F
       _forwarding_curve,
       _volatility,
       _model,
-      _include_details);
+      _include_details,
+      _trade_id,
+      _book_id);
 }
 
 inline PriceCapFloorRequestT::PriceCapFloorRequestT(const PriceCapFloorRequestT &o)
@@ -33,6 +33,8 @@ struct PriceCDST : public ::flatbuffers::NativeTable {
   std::string discounting_curve{};
   std::string credit_curve_id{};
   std::string model{};
+  std::string trade_id{};
+  std::string book_id{};
   PriceCDST() = default;
   PriceCDST(const PriceCDST &o);
   PriceCDST(PriceCDST&&) FLATBUFFERS_NOEXCEPT = default;
@@ -46,7 +48,9 @@ struct PriceCDS FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_CDS = 4,
     VT_DISCOUNTING_CURVE = 6,
     VT_CREDIT_CURVE_ID = 8,
-    VT_MODEL = 10
+    VT_MODEL = 10,
+    VT_TRADE_ID = 12,
+    VT_BOOK_ID = 14
   };
   const quantra::CDS *cds() const {
     return GetPointer<const quantra::CDS *>(VT_CDS);
@@ -60,6 +64,16 @@ struct PriceCDS FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::String *model() const {
     return GetPointer<const ::flatbuffers::String *>(VT_MODEL);
   }
+  /// Price the stored trade with this id (UpsertTrades) instead of an
+  /// inline cds.
+  const ::flatbuffers::String *trade_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TRADE_ID);
+  }
+  /// Price every stored CDS of this book, each with this entry's
+  /// curves and settings; one response per trade.
+  const ::flatbuffers::String *book_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_BOOK_ID);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_CDS) &&
@@ -70,6 +84,10 @@ struct PriceCDS FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyString(credit_curve_id()) &&
            VerifyOffset(verifier, VT_MODEL) &&
            verifier.VerifyString(model()) &&
+           VerifyOffset(verifier, VT_TRADE_ID) &&
+           verifier.VerifyString(trade_id()) &&
+           VerifyOffset(verifier, VT_BOOK_ID) &&
+           verifier.VerifyString(book_id()) &&
            verifier.EndTable();
   }
   PriceCDST *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -93,6 +111,12 @@ struct PriceCDSBuilder {
   void add_model(::flatbuffers::Offset<::flatbuffers::String> model) {
     fbb_.AddOffset(PriceCDS::VT_MODEL, model);
   }
+  void add_trade_id(::flatbuffers::Offset<::flatbuffers::String> trade_id) {
+    fbb_.AddOffset(PriceCDS::VT_TRADE_ID, trade_id);
+  }
+  void add_book_id(::flatbuffers::Offset<::flatbuffers::String> book_id) {
+    fbb_.AddOffset(PriceCDS::VT_BOOK_ID, book_id);
+  }
   explicit PriceCDSBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -109,8 +133,12 @@ inline ::flatbuffers::Offset<PriceCDS> CreatePriceCDS(
     ::flatbuffers::Offset<quantra::CDS> cds = 0,
     ::flatbuffers::Offset<::flatbuffers::String> discounting_curve = 0,
     ::flatbuffers::Offset<::flatbuffers::String> credit_curve_id = 0,
-    ::flatbuffers::Offset<::flatbuffers::String> model = 0) {
+    ::flatbuffers::Offset<::flatbuffers::String> model = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> trade_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> book_id = 0) {
   PriceCDSBuilder builder_(_fbb);
+  builder_.add_book_id(book_id);
+  builder_.add_trade_id(trade_id);
   builder_.add_model(model);
   builder_.add_credit_curve_id(credit_curve_id);
   builder_.add_discounting_curve(discounting_curve);
@@ -123,16 +151,22 @@ inline ::flatbuffers::Offset<PriceCDS> CreatePriceCDSDirect(
     ::flatbuffers::Offset<quantra::CDS> cds = 0,
     const char *discounting_curve = nullptr,
     const char *credit_curve_id = nullptr,
-    const char *model = nullptr) {
+    const char *model = nullptr,
+    const char *trade_id = nullptr,
+    const char *book_id = nullptr) {
   auto discounting_curve__ = discounting_curve ? _fbb.CreateString(discounting_curve) : 0;
   auto credit_curve_id__ = credit_curve_id ? _fbb.CreateString(credit_curve_id) : 0;
   auto model__ = model ? _fbb.CreateString(model) : 0;
+  auto trade_id__ = trade_id ? _fbb.CreateString(trade_id) : 0;
+  auto book_id__ = book_id ? _fbb.CreateString(book_id) : 0;
   return quantra::CreatePriceCDS(
       _fbb,
       cds,
       discounting_curve__,
       credit_curve_id__,
-      model__);
+      model__,
+      trade_id__,
+      book_id__);
 }
 
 ::flatbuffers::Offset<PriceCDS> CreatePriceCDS(::flatbuffers::FlatBufferBuilder &_fbb, const PriceCDST *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -222,7 +256,9 @@ inline PriceCDST::PriceCDST(const PriceCDST &o)
       : cds((o.cds) ? new quantra::CDST(*o.cds) : nullptr),
         discounting_curve(o.discounting_curve),
         credit_curve_id(o.credit_curve_id),
-        model(o.model) {
+        model(o.model),
+        trade_id(o.trade_id),
+        book_id(o.book_id) {
 }
 
 inline PriceCDST &PriceCDST::operator=(PriceCDST o) FLATBUFFERS_NOEXCEPT {
@@ -230,6 +266,8 @@ inline PriceCDST &PriceCDST::operator=(PriceCDST o) FLATBUFFERS_NOEXCEPT {
   std::swap(discounting_curve, o.discounting_curve);
   std::swap(credit_curve_id, o.credit_curve_id);
   std::swap(model, o.model);
+  std::swap(trade_id, o.trade_id);
+  std::swap(book_id, o.book_id);
   return *this;
 }
 
@@ -246,6 +284,8 @@ inline void PriceCDS::UnPackTo(PriceCDST *_o, const ::flatbuffers::resolver_func
   { auto _e = discounting_curve(); if (_e) _o->discounting_curve = _e->str(); }
   { auto _e = credit_curve_id(); if (_e) _o->credit_curve_id = _e->str(); }
   { auto _e = model(); if (_e) _o->model = _e->str(); }
+  { auto _e = trade_id(); if (_e) _o->trade_id = _e->str(); }
+  { auto _e = book_id(); if (_e) _o->book_id = _e->str(); }
 }
 
 inline ::flatbuffers::Offset<PriceCDS> PriceCDS::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceCDST* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -260,12 +300,16 @@ inline ::flatbuffers::Offset<PriceCDS> CreatePriceCDS(::flatbuffers::FlatBufferB
   auto _discounting_curve = _o->discounting_curve.empty() ? 0 : _fbb.CreateString(_o->discounting_curve);
   auto _credit_curve_id = _o->credit_curve_id.empty() ? 0 : _fbb.CreateString(_o->credit_curve_id);
   auto _model = _o->model.empty() ? 0 : _fbb.CreateString(_o->model);
+  auto _trade_id = _o->trade_id.empty() ? 0 : _fbb.CreateString(_o->trade_id);
+  auto _book_id = _o->book_id.empty() ? 0 : _fbb.CreateString(_o->book_id);
   return quantra::CreatePriceCDS(
       _fbb,
       _cds,
       _discounting_curve,
       _credit_curve_id,
-      _model);
+      _model,
+      _trade_id,
+      _book_id);
 }
 
 inline PriceCDSRequestT::PriceCDSRequestT(const PriceCDSRequestT &o)
@@ -18,6 +18,7 @@ static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
 #include "floating_rate_bond_generated.h"
 #include "pricing_generated.h"
 #include "term_structure_generated.h"
+#include "z_spread_quote_generated.h"
 
 namespace quantra {
 
@@ -34,6 +35,9 @@ struct PriceFixedRateBondT : public ::flatbuffers::NativeTable {
   std::unique_ptr<quantra::FixedRateBondT> fixed_rate_bond{};
   std::string discounting_curve{};
   std::unique_ptr<quantra::YieldT> yield{};
+  std::unique_ptr<quantra::ZSpreadQuoteT> z_spread_quote{};
+  std::string trade_id{};
+  std::string book_id{};
   PriceFixedRateBondT() = default;
   PriceFixedRateBondT(const PriceFixedRateBondT &o);
   PriceFixedRateBondT(PriceFixedRateBondT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -46,7 +50,10 @@ struct PriceFixedRateBond FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_FIXED_RATE_BOND = 4,
     VT_DISCOUNTING_CURVE = 6,
-    VT_YIELD = 8
+    VT_YIELD = 8,
+    VT_Z_SPREAD_QUOTE = 10,
+    VT_TRADE_ID = 12,
+    VT_BOOK_ID = 14
   };
   const quantra::FixedRateBond *fixed_rate_bond() const {
     return GetPointer<const quantra::FixedRateBond *>(VT_FIXED_RATE_BOND);
@@ -57,6 +64,21 @@ struct PriceFixedRateBond FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table
   const quantra::Yield *yield() const {
     return GetPointer<const quantra::Yield *>(VT_YIELD);
   }
+  /// When set, the response carries the Z-spread over discounting_curve
+  /// that reproduces this market price.
+  const quantra::ZSpreadQuote *z_spread_quote() const {
+    return GetPointer<const quantra::ZSpreadQuote *>(VT_Z_SPREAD_QUOTE);
+  }
+  /// Price the stored trade with this id (UpsertTrades) instead of an
+  /// inline fixed_rate_bond.
+  const ::flatbuffers::String *trade_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TRADE_ID);
+  }
+  /// Price every stored fixed-rate bond of this book, each with this entry's
+  /// curves and settings; one response per trade.
+  const ::flatbuffers::String *book_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_BOOK_ID);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_FIXED_RATE_BOND) &&
@@ -65,6 +87,12 @@ struct PriceFixedRateBond FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table
            verifier.VerifyString(discounting_curve()) &&
            VerifyOffset(verifier, VT_YIELD) &&
            verifier.VerifyTable(yield()) &&
+           VerifyOffset(verifier, VT_Z_SPREAD_QUOTE) &&
+           verifier.VerifyTable(z_spread_quote()) &&
+           VerifyOffset(verifier, VT_TRADE_ID) &&
+           verifier.VerifyString(trade_id()) &&
+           VerifyOffset(verifier, VT_BOOK_ID) &&
+           verifier.VerifyString(book_id()) &&
            verifier.EndTable();
   }
   PriceFixedRateBondT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -85,6 +113,15 @@ struct PriceFixedRateBondBuilder {
   void add_yield(::flatbuffers::Offset<quantra::Yield> yield) {
     fbb_.AddOffset(PriceFixedRateBond::VT_YIELD, yield);
   }
+  void add_z_spread_quote(::flatbuffers::Offset<quantra::ZSpreadQuote> z_spread_quote) {
+    fbb_.AddOffset(PriceFixedRateBond::VT_Z_SPREAD_QUOTE, z_spread_quote);
+  }
+  void add_trade_id(::flatbuffers::Offset<::flatbuffers::String> trade_id) {
+    fbb_.AddOffset(PriceFixedRateBond::VT_TRADE_ID, trade_id);
+  }
+  void add_book_id(::flatbuffers::Offset<::flatbuffers::String> book_id) {
+    fbb_.AddOffset(PriceFixedRateBond::VT_BOOK_ID, book_id);
+  }
   explicit PriceFixedRateBondBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -100,8 +137,14 @@ inline ::flatbuffers::Offset<PriceFixedRateBond> CreatePriceFixedRateBond(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ::flatbuffers::Offset<quantra::FixedRateBond> fixed_rate_bond = 0,
     ::flatbuffers::Offset<::flatbuffers::String> discounting_curve = 0,
-    ::flatbuffers::Offset<quantra::Yield> yield = 0) {
+    ::flatbuffers::Offset<quantra::Yield> yield = 0,
+    ::flatbuffers::Offset<quantra::ZSpreadQuote> z_spread_quote = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> trade_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> book_id = 0) {
   PriceFixedRateBondBuilder builder_(_fbb);
+  builder_.add_book_id(book_id);
+  builder_.add_trade_id(trade_id);
+  builder_.add_z_spread_quote(z_spread_quote);
   builder_.add_yield(yield);
   builder_.add_discounting_curve(discounting_curve);
   builder_.add_fixed_rate_bond(fixed_rate_bond);
@@ -112,13 +155,21 @@ inline ::flatbuffers::Offset<PriceFixedRateBond> CreatePriceFixedRateBondDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ::flatbuffers::Offset<quantra::FixedRateBond> fixed_rate_bond = 0,
     const char *discounting_curve = nullptr,
-    ::flatbuffers::Offset<quantra::Yield> yield = 0) {
+    ::flatbuffers::Offset<quantra::Yield> yield = 0,
+    ::flatbuffers::Offset<quantra::ZSpreadQuote> z_spread_quote = 0,
+    const char *trade_id = nullptr,
+    const char *book_id = nullptr) {
   auto discounting_curve__ = discounting_curve ? _fbb.CreateString(discounting_curve) : 0;
+  auto trade_id__ = trade_id ? _fbb.CreateString(trade_id) : 0;
+  auto book_id__ = book_id ? _fbb.CreateString(book_id) : 0;
   return quantra::CreatePriceFixedRateBond(
       _fbb,
       fixed_rate_bond,
       discounting_curve__,
-      yield);
+      yield,
+      z_spread_quote,
+      trade_id__,
+      book_id__);
 }
 
 ::flatbuffers::Offset<PriceFixedRateBond> CreatePriceFixedRateBond(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFixedRateBondT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -207,13 +258,19 @@ inline ::flatbuffers::Offset<PriceFixedRateBondRequest> CreatePriceFixedRateBond
 inline PriceFixedRateBondT::PriceFixedRateBondT(const PriceFixedRateBondT &o)
       : fixed_rate_bond((o.fixed_rate_bond) ? new quantra::FixedRateBondT(*o.fixed_rate_bond) : nullptr),
         discounting_curve(o.discounting_curve),
-        yield((o.yield) ? new quantra::YieldT(*o.yield) : nullptr) {
+        yield((o.yield) ? new quantra::YieldT(*o.yield) : nullptr),
+        z_spread_quote((o.z_spread_quote) ? new quantra::ZSpreadQuoteT(*o.z_spread_quote) : nullptr),
+        trade_id(o.trade_id),
+        book_id(o.book_id) {
 }
 
 inline PriceFixedRateBondT &PriceFixedRateBondT::operator=(PriceFixedRateBondT o) FLATBUFFERS_NOEXCEPT {
   std::swap(fixed_rate_bond, o.fixed_rate_bond);
   std::swap(discounting_curve, o.discounting_curve);
   std::swap(yield, o.yield);
+  std::swap(z_spread_quote, o.z_spread_quote);
+  std::swap(trade_id, o.trade_id);
+  std::swap(book_id, o.book_id);
   return *this;
 }
 
@@ -229,6 +286,9 @@ inline void PriceFixedRateBond::UnPackTo(PriceFixedRateBondT *_o, const ::flatbu
   { auto _e = fixed_rate_bond(); if (_e) { if(_o->fixed_rate_bond) { _e->UnPackTo(_o->fixed_rate_bond.get(), _resolver); } else { _o->fixed_rate_bond = std::unique_ptr<quantra::FixedRateBondT>(_e->UnPack(_resolver)); } } else if (_o->fixed_rate_bond) { _o->fixed_rate_bond.reset(); } }
   { auto _e = discounting_curve(); if (_e) _o->discounting_curve = _e->str(); }
   { auto _e = yield(); if (_e) { if(_o->yield) { _e->UnPackTo(_o->yield.get(), _resolver); } else { _o->yield = std::unique_ptr<quantra::YieldT>(_e->UnPack(_resolver)); } } else if (_o->yield) { _o->yield.reset(); } }
+  { auto _e = z_spread_quote(); if (_e) { if(_o->z_spread_quote) { _e->UnPackTo(_o->z_spread_quote.get(), _resolver); } else { _o->z_spread_quote = std::unique_ptr<quantra::ZSpreadQuoteT>(_e->UnPack(_resolver)); } } else if (_o->z_spread_quote) { _o->z_spread_quote.reset(); } }
+  { auto _e = trade_id(); if (_e) _o->trade_id = _e->str(); }
+  { auto _e = book_id(); if (_e) _o->book_id = _e->str(); }
 }
 
 inline ::flatbuffers::Offset<PriceFixedRateBond> PriceFixedRateBond::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFixedRateBondT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -242,11 +302,17 @@ inline ::flatbuffers::Offset<PriceFixedRateBond> CreatePriceFixedRateBond(::flat
   auto _fixed_rate_bond = _o->fixed_rate_bond ? CreateFixedRateBond(_fbb, _o->fixed_rate_bond.get(), _rehasher) : 0;
   auto _discounting_curve = _o->discounting_curve.empty() ? 0 : _fbb.CreateString(_o->discounting_curve);
   auto _yield = _o->yield ? CreateYield(_fbb, _o->yield.get(), _rehasher) : 0;
+  auto _z_spread_quote = _o->z_spread_quote ? CreateZSpreadQuote(_fbb, _o->z_spread_quote.get(), _rehasher) : 0;
+  auto _trade_id = _o->trade_id.empty() ? 0 : _fbb.CreateString(_o->trade_id);
+  auto _book_id = _o->book_id.empty() ? 0 : _fbb.CreateString(_o->book_id);
   return quantra::CreatePriceFixedRateBond(
       _fbb,
       _fixed_rate_bond,
       _discounting_curve,
-      _yield);
+      _yield,
+      _z_spread_quote,
+      _trade_id,
+      _book_id);
 }
 
 inline PriceFixedRateBondRequestT::PriceFixedRateBondRequestT(const PriceFixedRateBondRequestT &o)
@@ -17,6 +17,7 @@ static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
 #include "floating_rate_bond_generated.h"
 #include "pricing_generated.h"
 #include "term_structure_generated.h"
+#include "z_spread_quote_generated.h"
 
 namespace quantra {
 
@@ -35,6 +36,7 @@ struct PriceFloatingRateBondT : public ::flatbuffers::NativeTable {
   std::string forecasting_curve{};
   std::string coupon_pricer{};
   std::unique_ptr<quantra::YieldT> yield{};
+  std::unique_ptr<quantra::ZSpreadQuoteT> z_spread_quote{};
   PriceFloatingRateBondT() = default;
   PriceFloatingRateBondT(const PriceFloatingRateBondT &o);
   PriceFloatingRateBondT(PriceFloatingRateBondT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -49,7 +51,8 @@ struct PriceFloatingRateBond FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Ta
     VT_DISCOUNTING_CURVE = 6,
     VT_FORECASTING_CURVE = 8,
     VT_COUPON_PRICER = 10,
-    VT_YIELD = 12
+    VT_YIELD = 12,
+    VT_Z_SPREAD_QUOTE = 14
   };
   const quantra::FloatingRateBond *floating_rate_bond() const {
     return GetPointer<const quantra::FloatingRateBond *>(VT_FLOATING_RATE_BOND);
@@ -66,6 +69,11 @@ struct PriceFloatingRateBond FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Ta
   const quantra::Yield *yield() const {
     return GetPointer<const quantra::Yield *>(VT_YIELD);
   }
+  /// When set, the response carries the Z-spread over discounting_curve
+  /// that reproduces this market price.
+  const quantra::ZSpreadQuote *z_spread_quote() const {
+    return GetPointer<const quantra::ZSpreadQuote *>(VT_Z_SPREAD_QUOTE);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_FLOATING_RATE_BOND) &&
@@ -78,6 +86,8 @@ struct PriceFloatingRateBond FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Ta
            verifier.VerifyString(coupon_pricer()) &&
            VerifyOffset(verifier, VT_YIELD) &&
            verifier.VerifyTable(yield()) &&
+           VerifyOffset(verifier, VT_Z_SPREAD_QUOTE) &&
+           verifier.VerifyTable(z_spread_quote()) &&
            verifier.EndTable();
   }
   PriceFloatingRateBondT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -104,6 +114,9 @@ struct PriceFloatingRateBondBuilder {
   void add_yield(::flatbuffers::Offset<quantra::Yield> yield) {
     fbb_.AddOffset(PriceFloatingRateBond::VT_YIELD, yield);
   }
+  void add_z_spread_quote(::flatbuffers::Offset<quantra::ZSpreadQuote> z_spread_quote) {
+    fbb_.AddOffset(PriceFloatingRateBond::VT_Z_SPREAD_QUOTE, z_spread_quote);
+  }
   explicit PriceFloatingRateBondBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -121,8 +134,10 @@ inline ::flatbuffers::Offset<PriceFloatingRateBond> CreatePriceFloatingRateBond(
     ::flatbuffers::Offset<::flatbuffers::String> discounting_curve = 0,
     ::flatbuffers::Offset<::flatbuffers::String> forecasting_curve = 0,
     ::flatbuffers::Offset<::flatbuffers::String> coupon_pricer = 0,
-    ::flatbuffers::Offset<quantra::Yield> yield = 0) {
+    ::flatbuffers::Offset<quantra::Yield> yield = 0,
+    ::flatbuffers::Offset<quantra::ZSpreadQuote> z_spread_quote = 0) {
   PriceFloatingRateBondBuilder builder_(_fbb);
+  builder_.add_z_spread_quote(z_spread_quote);
   builder_.add_yield(yield);
   builder_.add_coupon_pricer(coupon_pricer);
   builder_.add_forecasting_curve(forecasting_curve);
@@ -137,7 +152,8 @@ inline ::flatbuffers::Offset<PriceFloatingRateBond> CreatePriceFloatingRateBondD
     const char *discounting_curve = nullptr,
     const char *forecasting_curve = nullptr,
     const char *coupon_pricer = nullptr,
-    ::flatbuffers::Offset<quantra::Yield> yield = 0) {
+    ::flatbuffers::Offset<quantra::Yield> yield = 0,
+    ::flatbuffers::Offset<quantra::ZSpreadQuote> z_spread_quote = 0) {
   auto discounting_curve__ = discounting_curve ? _fbb.CreateString(discounting_curve) : 0;
   auto forecasting_curve__ = forecasting_curve ? _fbb.CreateString(forecasting_curve) : 0;
   auto coupon_pricer__ = coupon_pricer ? _fbb.CreateString(coupon_pricer) : 0;
@@ -147,7 +163,8 @@ inline ::flatbuffers::Offset<PriceFloatingRateBond> CreatePriceFloatingRateBondD
       discounting_curve__,
       forecasting_curve__,
       coupon_pricer__,
-      yield);
+      yield,
+      z_spread_quote);
 }
 
 ::flatbuffers::Offset<PriceFloatingRateBond> CreatePriceFloatingRateBond(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFloatingRateBondT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -238,7 +255,8 @@ inline PriceFloatingRateBondT::PriceFloatingRateBondT(const PriceFloatingRateBon
         discounting_curve(o.discounting_curve),
         forecasting_curve(o.forecasting_curve),
         coupon_pricer(o.coupon_pricer),
-        yield((o.yield) ? new quantra::YieldT(*o.yield) : nullptr) {
+        yield((o.yield) ? new quantra::YieldT(*o.yield) : nullptr),
+        z_spread_quote((o.z_spread_quote) ? new quantra::ZSpreadQuoteT(*o.z_spread_quote) : nullptr) {
 }
 
 inline PriceFloatingRateBondT &PriceFloatingRateBondT::operator=(PriceFloatingRateBondT o) FLATBUFFERS_NOEXCEPT {
@@ -247,6 +265,7 @@ inline PriceFloatingRateBondT &PriceFloatingRateBondT::operator=(PriceFloatingRa
   std::swap(forecasting_curve, o.forecasting_curve);
   std::swap(coupon_pricer, o.coupon_pricer);
   std::swap(yield, o.yield);
+  std::swap(z_spread_quote, o.z_spread_quote);
   return *this;
 }
 
@@ -264,6 +283,7 @@ inline void PriceFloatingRateBond::UnPackTo(PriceFloatingRateBondT *_o, const ::
   { auto _e = forecasting_curve(); if (_e) _o->forecasting_curve = _e->str(); }
   { auto _e = coupon_pricer(); if (_e) _o->coupon_pricer = _e->str(); }
   { auto _e = yield(); if (_e) { if(_o->yield) { _e->UnPackTo(_o->yield.get(), _resolver); } else { _o->yield = std::unique_ptr<quantra::YieldT>(_e->UnPack(_resolver)); } } else if (_o->yield) { _o->yield.reset(); } }
+  { auto _e = z_spread_quote(); if (_e) { if(_o->z_spread_quote) { _e->UnPackTo(_o->z_spread_quote.get(), _resolver); } else { _o->z_spread_quote = std::unique_ptr<quantra::ZSpreadQuoteT>(_e->UnPack(_resolver)); } } else if (_o->z_spread_quote) { _o->z_spread_quote.reset(); } }
 }
 
 inline ::flatbuffers::Offset<PriceFloatingRateBond> PriceFloatingRateBond::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceFloatingRateBondT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -279,13 +299,15 @@ inline ::flatbuffers::Offset<PriceFloatingRateBond> CreatePriceFloatingRateBond(
   auto _forecasting_curve = _o->forecasting_curve.empty() ? 0 : _fbb.CreateString(_o->forecasting_curve);
   auto _coupon_pricer = _o->coupon_pricer.empty() ? 0 : _fbb.CreateString(_o->coupon_pricer);
   auto _yield = _o->yield ? CreateYield(_fbb, _o->yield.get(), _rehasher) : 0;
+  auto _z_spread_quote = _o->z_spread_quote ? CreateZSpreadQuote(_fbb, _o->z_spread_quote.get(), _rehasher) : 0;
   return quantra::CreatePriceFloatingRateBond(
       _fbb,
       _floating_rate_bond,
       _discounting_curve,
       _forecasting_curve,
       _coupon_pricer,
-      _yield);
+      _yield,
+      _z_spread_quote);
 }
 
 inline PriceFloatingRateBondRequestT::PriceFloatingRateBondRequestT(const PriceFloatingRateBondRequestT &o)
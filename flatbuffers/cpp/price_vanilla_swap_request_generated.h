@@ -32,6 +32,8 @@ struct PriceVanillaSwapT : public ::flatbuffers::NativeTable {
   std::unique_ptr<quantra::VanillaSwapT> vanilla_swap{};
   std::string discounting_curve{};
   std::string forwarding_curve{};
+  std::string trade_id{};
+  std::string book_id{};
   PriceVanillaSwapT() = default;
   PriceVanillaSwapT(const PriceVanillaSwapT &o);
   PriceVanillaSwapT(PriceVanillaSwapT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -44,7 +46,9 @@ struct PriceVanillaSwap FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_VANILLA_SWAP = 4,
     VT_DISCOUNTING_CURVE = 6,
-    VT_FORWARDING_CURVE = 8
+    VT_FORWARDING_CURVE = 8,
+    VT_TRADE_ID = 10,
+    VT_BOOK_ID = 12
   };
   const quantra::VanillaSwap *vanilla_swap() const {
     return GetPointer<const quantra::VanillaSwap *>(VT_VANILLA_SWAP);
@@ -55,6 +59,16 @@ struct PriceVanillaSwap FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::String *forwarding_curve() const {
     return GetPointer<const ::flatbuffers::String *>(VT_FORWARDING_CURVE);
   }
+  /// Price the stored trade with this id (UpsertTrades) instead of an
+  /// inline vanilla_swap.
+  const ::flatbuffers::String *trade_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TRADE_ID);
+  }
+  /// Price every stored vanilla swap of this book, each with this entry's
+  /// curves and settings; one response per trade.
+  const ::flatbuffers::String *book_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_BOOK_ID);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_VANILLA_SWAP) &&
@@ -63,6 +77,10 @@ struct PriceVanillaSwap FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyString(discounting_curve()) &&
            VerifyOffset(verifier, VT_FORWARDING_CURVE) &&
            verifier.VerifyString(forwarding_curve()) &&
+           VerifyOffset(verifier, VT_TRADE_ID) &&
+           verifier.VerifyString(trade_id()) &&
+           VerifyOffset(verifier, VT_BOOK_ID) &&
+           verifier.VerifyString(book_id()) &&
            verifier.EndTable();
   }
   PriceVanillaSwapT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -83,6 +101,12 @@ struct PriceVanillaSwapBuilder {
   void add_forwarding_curve(::flatbuffers::Offset<::flatbuffers::String> forwarding_curve) {
     fbb_.AddOffset(PriceVanillaSwap::VT_FORWARDING_CURVE, forwarding_curve);
   }
+  void add_trade_id(::flatbuffers::Offset<::flatbuffers::String> trade_id) {
+    fbb_.AddOffset(PriceVanillaSwap::VT_TRADE_ID, trade_id);
+  }
+  void add_book_id(::flatbuffers::Offset<::flatbuffers::String> book_id) {
+    fbb_.AddOffset(PriceVanillaSwap::VT_BOOK_ID, book_id);
+  }
   explicit PriceVanillaSwapBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -98,8 +122,12 @@ inline ::flatbuffers::Offset<PriceVanillaSwap> CreatePriceVanillaSwap(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ::flatbuffers::Offset<quantra::VanillaSwap> vanilla_swap = 0,
     ::flatbuffers::Offset<::flatbuffers::String> discounting_curve = 0,
-    ::flatbuffers::Offset<::flatbuffers::String> forwarding_curve = 0) {
+    ::flatbuffers::Offset<::flatbuffers::String> forwarding_curve = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> trade_id = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> book_id = 0) {
   PriceVanillaSwapBuilder builder_(_fbb);
+  builder_.add_book_id(book_id);
+  builder_.add_trade_id(trade_id);
   builder_.add_forwarding_curve(forwarding_curve);
   builder_.add_discounting_curve(discounting_curve);
   builder_.add_vanilla_swap(vanilla_swap);
@@ -110,14 +138,20 @@ inline ::flatbuffers::Offset<PriceVanillaSwap> CreatePriceVanillaSwapDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
     ::flatbuffers::Offset<quantra::VanillaSwap> vanilla_swap = 0,
     const char *discounting_curve = nullptr,
-    const char *forwarding_curve = nullptr) {
+    const char *forwarding_curve = nullptr,
+    const char *trade_id = nullptr,
+    const char *book_id = nullptr) {
   auto discounting_curve__ = discounting_curve ? _fbb.CreateString(discounting_curve) : 0;
   auto forwarding_curve__ = forwarding_curve ? _fbb.CreateString(forwarding_curve) : 0;
+  auto trade_id__ = trade_id ? _fbb.CreateString(trade_id) : 0;
+  auto book_id__ = book_id ? _fbb.CreateString(book_id) : 0;
   return quantra::CreatePriceVanillaSwap(
       _fbb,
       vanilla_swap,
       discounting_curve__,
-      forwarding_curve__);
+      forwarding_curve__,
+      trade_id__,
+      book_id__);
 }
 
 ::flatbuffers::Offset<PriceVanillaSwap> CreatePriceVanillaSwap(::flatbuffers::FlatBufferBuilder &_fbb, const PriceVanillaSwapT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -219,13 +253,17 @@ inline ::flatbuffers::Offset<PriceVanillaSwapRequest> CreatePriceVanillaSwapRequ
 inline PriceVanillaSwapT::PriceVanillaSwapT(const PriceVanillaSwapT &o)
       : vanilla_swap((o.vanilla_swap) ? new quantra::VanillaSwapT(*o.vanilla_swap) : nullptr),
         discounting_curve(o.discounting_curve),
-        forwarding_curve(o.forwarding_curve) {
+        forwarding_curve(o.forwarding_curve),
+        trade_id(o.trade_id),
+        book_id(o.book_id) {
 }
 
 inline PriceVanillaSwapT &PriceVanillaSwapT::operator=(PriceVanillaSwapT o) FLATBUFFERS_NOEXCEPT {
   std::swap(vanilla_swap, o.vanilla_swap);
   std::swap(discounting_curve, o.discounting_curve);
   std::swap(forwarding_curve, o.forwarding_curve);
+  std::swap(trade_id, o.trade_id);
+  std::swap(book_id, o.book_id);
   return *this;
 }
 
@@ -241,6 +279,8 @@ inline void PriceVanillaSwap::UnPackTo(PriceVanillaSwapT *_o, const ::flatbuffer
   { auto _e = vanilla_swap(); if (_e) { if(_o->vanilla_swap) { _e->UnPackTo(_o->vanilla_swap.get(), _resolver); } else { _o->vanilla_swap = std::unique_ptr<quantra::VanillaSwapT>(_e->UnPack(_resolver)); } } else if (_o->vanilla_swap) { _o->vanilla_swap.reset(); } }
   { auto _e = discounting_curve(); if (_e) _o->discounting_curve = _e->str(); }
   { auto _e = forwarding_curve(); if (_e) _o->forwarding_curve = _e->str(); }
+  { auto _e = trade_id(); if (_e) _o->trade_id = _e->str(); }
+  { auto _e = book_id(); if (_e) _o->book_id = _e->str(); }
 }
 
 inline ::flatbuffers::Offset<PriceVanillaSwap> PriceVanillaSwap::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceVanillaSwapT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -254,11 +294,15 @@ inline ::flatbuffers::Offset<PriceVanillaSwap> CreatePriceVanillaSwap(::flatbuff
   auto _vanilla_swap = _o->vanilla_swap ? CreateVanillaSwap(_fbb, _o->vanilla_swap.get(), _rehasher) : 0;
   auto _discounting_curve = _o->discounting_curve.empty() ? 0 : _fbb.CreateString(_o->discounting_curve);
   auto _forwarding_curve = _o->forwarding_curve.empty() ? 0 : _fbb.CreateString(_o->forwarding_curve);
+  auto _trade_id = _o->trade_id.empty() ? 0 : _fbb.CreateString(_o->trade_id);
+  auto _book_id = _o->book_id.empty() ? 0 : _fbb.CreateString(_o->book_id);
   return quantra::CreatePriceVanillaSwap(
       _fbb,
       _vanilla_swap,
       _discounting_curve,
-      _forwarding_curve);
+      _forwarding_curve,
+      _trade_id,
+      _book_id);
 }
 
 inline PriceVanillaSwapRequestT::PriceVanillaSwapRequestT(const PriceVanillaSwapRequestT &o)
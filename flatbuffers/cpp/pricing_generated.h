@@ -45,6 +45,8 @@ struct PricingT : public ::flatbuffers::NativeTable {
   bool swaption_pricing_details = false;
   bool swaption_pricing_rebump = false;
   std::vector<std::unique_ptr<quantra::CouponPricerT>> coupon_pricers{};
+  int32_t bootstrap_budget_ms = 0;
+  bool stale_curve_fallback = false;
   PricingT() = default;
   PricingT(const PricingT &o);
   PricingT(PricingT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -68,7 +70,9 @@ struct Pricing FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_BOND_PRICING_FLOWS = 24,
     VT_SWAPTION_PRICING_DETAILS = 26,
     VT_SWAPTION_PRICING_REBUMP = 28,
-    VT_COUPON_PRICERS = 30
+    VT_COUPON_PRICERS = 30,
+    VT_BOOTSTRAP_BUDGET_MS = 32,
+    VT_STALE_CURVE_FALLBACK = 34
   };
   /// Valuation date (YYYY-MM-DD). Used by: ALL
   const ::flatbuffers::String *as_of_date() const {
@@ -127,6 +131,17 @@ struct Pricing FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::CouponPricer>> *coupon_pricers() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::CouponPricer>> *>(VT_COUPON_PRICERS);
   }
+  /// Wall-clock budget in ms for bootstrapping this request's curves
+  /// (0 = unlimited). Once it runs out the request fails, unless
+  /// stale_curve_fallback is set.
+  int32_t bootstrap_budget_ms() const {
+    return GetField<int32_t>(VT_BOOTSTRAP_BUDGET_MS, 0);
+  }
+  /// On a budget overrun, serve the last cached curve of the same structure
+  /// instead of failing. Such curves are listed in the response's stale_curves.
+  bool stale_curve_fallback() const {
+    return GetField<uint8_t>(VT_STALE_CURVE_FALLBACK, 0) != 0;
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_AS_OF_DATE) &&
@@ -161,6 +176,8 @@ struct Pricing FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_COUPON_PRICERS) &&
            verifier.VerifyVector(coupon_pricers()) &&
            verifier.VerifyVectorOfTables(coupon_pricers()) &&
+           VerifyField<int32_t>(verifier, VT_BOOTSTRAP_BUDGET_MS, 4) &&
+           VerifyField<uint8_t>(verifier, VT_STALE_CURVE_FALLBACK, 1) &&
            verifier.EndTable();
   }
   PricingT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -214,6 +231,12 @@ struct PricingBuilder {
   void add_coupon_pricers(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CouponPricer>>> coupon_pricers) {
     fbb_.AddOffset(Pricing::VT_COUPON_PRICERS, coupon_pricers);
   }
+  void add_bootstrap_budget_ms(int32_t bootstrap_budget_ms) {
+    fbb_.AddElement<int32_t>(Pricing::VT_BOOTSTRAP_BUDGET_MS, bootstrap_budget_ms, 0);
+  }
+  void add_stale_curve_fallback(bool stale_curve_fallback) {
+    fbb_.AddElement<uint8_t>(Pricing::VT_STALE_CURVE_FALLBACK, static_cast<uint8_t>(stale_curve_fallback), 0);
+  }
   explicit PricingBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -242,8 +265,11 @@ inline ::flatbuffers::Offset<Pricing> CreatePricing(
     bool bond_pricing_flows = false,
     bool swaption_pricing_details = false,
     bool swaption_pricing_rebump = false,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CouponPricer>>> coupon_pricers = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::CouponPricer>>> coupon_pricers = 0,
+    int32_t bootstrap_budget_ms = 0,
+    bool stale_curve_fallback = false) {
   PricingBuilder builder_(_fbb);
+  builder_.add_bootstrap_budget_ms(bootstrap_budget_ms);
   builder_.add_coupon_pricers(coupon_pricers);
   builder_.add_models(models);
   builder_.add_vol_surfaces(vol_surfaces);
@@ -254,6 +280,7 @@ inline ::flatbuffers::Offset<Pricing> CreatePricing(
   builder_.add_indices(indices);
   builder_.add_settlement_date(settlement_date);
   builder_.add_as_of_date(as_of_date);
+  builder_.add_stale_curve_fallback(stale_curve_fallback);
   builder_.add_swaption_pricing_rebump(swaption_pricing_rebump);
   builder_.add_swaption_pricing_details(swaption_pricing_details);
   builder_.add_bond_pricing_flows(bond_pricing_flows);
@@ -276,7 +303,9 @@ inline ::flatbuffers::Offset<Pricing> CreatePricingDirect(
     bool bond_pricing_flows = false,
     bool swaption_pricing_details = false,
     bool swaption_pricing_rebump = false,
-    const std::vector<::flatbuffers::Offset<quantra::CouponPricer>> *coupon_pricers = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::CouponPricer>> *coupon_pricers = nullptr,
+    int32_t bootstrap_budget_ms = 0,
+    bool stale_curve_fallback = false) {
   auto as_of_date__ = as_of_date ? _fbb.CreateString(as_of_date) : 0;
   auto settlement_date__ = settlement_date ? _fbb.CreateString(settlement_date) : 0;
   auto indices__ = indices ? _fbb.CreateVector<::flatbuffers::Offset<quantra::IndexDef>>(*indices) : 0;
@@ -302,7 +331,9 @@ inline ::flatbuffers::Offset<Pricing> CreatePricingDirect(
       bond_pricing_flows,
       swaption_pricing_details,
       swaption_pricing_rebump,
-      coupon_pricers__);
+      coupon_pricers__,
+      bootstrap_budget_ms,
+      stale_curve_fallback);
 }
 
 ::flatbuffers::Offset<Pricing> CreatePricing(::flatbuffers::FlatBufferBuilder &_fbb, const PricingT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -313,7 +344,9 @@ inline PricingT::PricingT(const PricingT &o)
         bond_pricing_details(o.bond_pricing_details),
         bond_pricing_flows(o.bond_pricing_flows),
         swaption_pricing_details(o.swaption_pricing_details),
-        swaption_pricing_rebump(o.swaption_pricing_rebump) {
+        swaption_pricing_rebump(o.swaption_pricing_rebump),
+        bootstrap_budget_ms(o.bootstrap_budget_ms),
+        stale_curve_fallback(o.stale_curve_fallback) {
   indices.reserve(o.indices.size());
   for (const auto &indices_ : o.indices) { indices.emplace_back((indices_) ? new quantra::IndexDefT(*indices_) : nullptr); }
   swap_indices.reserve(o.swap_indices.size());
@@ -347,6 +380,8 @@ inline PricingT &PricingT::operator=(PricingT o) FLATBUFFERS_NOEXCEPT {
   std::swap(swaption_pricing_details, o.swaption_pricing_details);
   std::swap(swaption_pricing_rebump, o.swaption_pricing_rebump);
   std::swap(coupon_pricers, o.coupon_pricers);
+  std::swap(bootstrap_budget_ms, o.bootstrap_budget_ms);
+  std::swap(stale_curve_fallback, o.stale_curve_fallback);
   return *this;
 }
 
@@ -373,6 +408,8 @@ inline void Pricing::UnPackTo(PricingT *_o, const ::flatbuffers::resolver_functi
   { auto _e = swaption_pricing_details(); _o->swaption_pricing_details = _e; }
   { auto _e = swaption_pricing_rebump(); _o->swaption_pricing_rebump = _e; }
   { auto _e = coupon_pricers(); if (_e) { _o->coupon_pricers.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->coupon_pricers[_i]) { _e->Get(_i)->UnPackTo(_o->coupon_pricers[_i].get(), _resolver); } else { _o->coupon_pricers[_i] = std::unique_ptr<quantra::CouponPricerT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->coupon_pricers.resize(0); } }
+  { auto _e = bootstrap_budget_ms(); _o->bootstrap_budget_ms = _e; }
+  { auto _e = stale_curve_fallback(); _o->stale_curve_fallback = _e; }
 }
 
 inline ::flatbuffers::Offset<Pricing> Pricing::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PricingT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -397,6 +434,8 @@ inline ::flatbuffers::Offset<Pricing> CreatePricing(::flatbuffers::FlatBufferBui
   auto _swaption_pricing_details = _o->swaption_pricing_details;
   auto _swaption_pricing_rebump = _o->swaption_pricing_rebump;
   auto _coupon_pricers = _o->coupon_pricers.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::CouponPricer>> (_o->coupon_pricers.size(), [](size_t i, _VectorArgs *__va) { return CreateCouponPricer(*__va->__fbb, __va->__o->coupon_pricers[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _bootstrap_budget_ms = _o->bootstrap_budget_ms;
+  auto _stale_curve_fallback = _o->stale_curve_fallback;
   return quantra::CreatePricing(
       _fbb,
       _as_of_date,
@@ -412,7 +451,9 @@ inline ::flatbuffers::Offset<Pricing> CreatePricing(::flatbuffers::FlatBufferBui
       _bond_pricing_flows,
       _swaption_pricing_details,
       _swaption_pricing_rebump,
-      _coupon_pricers);
+      _coupon_pricers,
+      _bootstrap_budget_ms,
+      _stale_curve_fallback);
 }
 
 }  // namespace quantra
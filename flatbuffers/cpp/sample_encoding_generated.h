@@ -0,0 +1,416 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_SAMPLEENCODING_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_SAMPLEENCODING_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+namespace quantra {
+
+struct EncodedDates;
+struct EncodedDatesBuilder;
+struct EncodedDatesT;
+
+struct EncodedValues;
+struct EncodedValuesBuilder;
+struct EncodedValuesT;
+
+/// How sampled dates are returned.
+enum DateEncoding : int8_t {
+  /// ISO-8601 strings in the plain date fields
+  DateEncoding_Iso = 0,
+  /// int32 serial numbers (QuantLib / Excel day numbers)
+  DateEncoding_Serial = 1,
+  /// start + i * step_days if the dates are evenly spaced in days; else Serial
+  DateEncoding_Range = 2,
+  DateEncoding_MIN = DateEncoding_Iso,
+  DateEncoding_MAX = DateEncoding_Range
+};
+
+inline const DateEncoding (&EnumValuesDateEncoding())[3] {
+  static const DateEncoding values[] = {
+    DateEncoding_Iso,
+    DateEncoding_Serial,
+    DateEncoding_Range
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesDateEncoding() {
+  static const char * const names[4] = {
+    "Iso",
+    "Serial",
+    "Range",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameDateEncoding(DateEncoding e) {
+  if (::flatbuffers::IsOutRange(e, DateEncoding_Iso, DateEncoding_Range)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesDateEncoding()[index];
+}
+
+/// How sampled values are returned.
+enum ValueEncoding : int8_t {
+  /// [double] in the plain value fields
+  ValueEncoding_Float64 = 0,
+  /// [float]
+  ValueEncoding_Float32 = 1,
+  /// Delta-encoded fixed point on a quantum. Falls back to Float64 for
+  /// non-finite values or deltas that do not fit in int32.
+  ValueEncoding_DeltaFixed = 2,
+  ValueEncoding_MIN = ValueEncoding_Float64,
+  ValueEncoding_MAX = ValueEncoding_DeltaFixed
+};
+
+inline const ValueEncoding (&EnumValuesValueEncoding())[3] {
+  static const ValueEncoding values[] = {
+    ValueEncoding_Float64,
+    ValueEncoding_Float32,
+    ValueEncoding_DeltaFixed
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesValueEncoding() {
+  static const char * const names[4] = {
+    "Float64",
+    "Float32",
+    "DeltaFixed",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameValueEncoding(ValueEncoding e) {
+  if (::flatbuffers::IsOutRange(e, ValueEncoding_Float64, ValueEncoding_DeltaFixed)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesValueEncoding()[index];
+}
+
+struct EncodedDatesT : public ::flatbuffers::NativeTable {
+  typedef EncodedDates TableType;
+  quantra::DateEncoding encoding = quantra::DateEncoding_Serial;
+  std::vector<int32_t> serials{};
+  int32_t start = 0;
+  int32_t step_days = 0;
+  int32_t size = 0;
+};
+
+/// Compact date list (DateEncoding.Serial or Range).
+struct EncodedDates FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef EncodedDatesT NativeTableType;
+  typedef EncodedDatesBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENCODING = 4,
+    VT_SERIALS = 6,
+    VT_START = 8,
+    VT_STEP_DAYS = 10,
+    VT_SIZE = 12
+  };
+  quantra::DateEncoding encoding() const {
+    return static_cast<quantra::DateEncoding>(GetField<int8_t>(VT_ENCODING, 1));
+  }
+  /// Serial: one serial number per date
+  const ::flatbuffers::Vector<int32_t> *serials() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_SERIALS);
+  }
+  /// Range: date i = start + i * step_days, for i < size
+  int32_t start() const {
+    return GetField<int32_t>(VT_START, 0);
+  }
+  int32_t step_days() const {
+    return GetField<int32_t>(VT_STEP_DAYS, 0);
+  }
+  int32_t size() const {
+    return GetField<int32_t>(VT_SIZE, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_ENCODING, 1) &&
+           VerifyOffset(verifier, VT_SERIALS) &&
+           verifier.VerifyVector(serials()) &&
+           VerifyField<int32_t>(verifier, VT_START, 4) &&
+           VerifyField<int32_t>(verifier, VT_STEP_DAYS, 4) &&
+           VerifyField<int32_t>(verifier, VT_SIZE, 4) &&
+           verifier.EndTable();
+  }
+  EncodedDatesT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EncodedDatesT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<EncodedDates> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const EncodedDatesT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EncodedDatesBuilder {
+  typedef EncodedDates Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_encoding(quantra::DateEncoding encoding) {
+    fbb_.AddElement<int8_t>(EncodedDates::VT_ENCODING, static_cast<int8_t>(encoding), 1);
+  }
+  void add_serials(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> serials) {
+    fbb_.AddOffset(EncodedDates::VT_SERIALS, serials);
+  }
+  void add_start(int32_t start) {
+    fbb_.AddElement<int32_t>(EncodedDates::VT_START, start, 0);
+  }
+  void add_step_days(int32_t step_days) {
+    fbb_.AddElement<int32_t>(EncodedDates::VT_STEP_DAYS, step_days, 0);
+  }
+  void add_size(int32_t size) {
+    fbb_.AddElement<int32_t>(EncodedDates::VT_SIZE, size, 0);
+  }
+  explicit EncodedDatesBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<EncodedDates> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<EncodedDates>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<EncodedDates> CreateEncodedDates(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    quantra::DateEncoding encoding = quantra::DateEncoding_Serial,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> serials = 0,
+    int32_t start = 0,
+    int32_t step_days = 0,
+    int32_t size = 0) {
+  EncodedDatesBuilder builder_(_fbb);
+  builder_.add_size(size);
+  builder_.add_step_days(step_days);
+  builder_.add_start(start);
+  builder_.add_serials(serials);
+  builder_.add_encoding(encoding);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<EncodedDates> CreateEncodedDatesDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    quantra::DateEncoding encoding = quantra::DateEncoding_Serial,
+    const std::vector<int32_t> *serials = nullptr,
+    int32_t start = 0,
+    int32_t step_days = 0,
+    int32_t size = 0) {
+  auto serials__ = serials ? _fbb.CreateVector<int32_t>(*serials) : 0;
+  return quantra::CreateEncodedDates(
+      _fbb,
+      encoding,
+      serials__,
+      start,
+      step_days,
+      size);
+}
+
+::flatbuffers::Offset<EncodedDates> CreateEncodedDates(::flatbuffers::FlatBufferBuilder &_fbb, const EncodedDatesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct EncodedValuesT : public ::flatbuffers::NativeTable {
+  typedef EncodedValues TableType;
+  quantra::ValueEncoding encoding = quantra::ValueEncoding_Float32;
+  std::vector<float> f32{};
+  int64_t base = 0;
+  std::vector<int32_t> deltas{};
+  double quantum = 0.0;
+};
+
+/// Compact value list (ValueEncoding.Float32 or DeltaFixed).
+struct EncodedValues FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef EncodedValuesT NativeTableType;
+  typedef EncodedValuesBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENCODING = 4,
+    VT_F32 = 6,
+    VT_BASE = 8,
+    VT_DELTAS = 10,
+    VT_QUANTUM = 12
+  };
+  quantra::ValueEncoding encoding() const {
+    return static_cast<quantra::ValueEncoding>(GetField<int8_t>(VT_ENCODING, 1));
+  }
+  /// Float32
+  const ::flatbuffers::Vector<float> *f32() const {
+    return GetPointer<const ::flatbuffers::Vector<float> *>(VT_F32);
+  }
+  /// DeltaFixed: value i = (base + deltas[0] + ... + deltas[i]) * quantum,
+  /// with deltas[0] = 0
+  int64_t base() const {
+    return GetField<int64_t>(VT_BASE, 0);
+  }
+  const ::flatbuffers::Vector<int32_t> *deltas() const {
+    return GetPointer<const ::flatbuffers::Vector<int32_t> *>(VT_DELTAS);
+  }
+  double quantum() const {
+    return GetField<double>(VT_QUANTUM, 0.0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_ENCODING, 1) &&
+           VerifyOffset(verifier, VT_F32) &&
+           verifier.VerifyVector(f32()) &&
+           VerifyField<int64_t>(verifier, VT_BASE, 8) &&
+           VerifyOffset(verifier, VT_DELTAS) &&
+           verifier.VerifyVector(deltas()) &&
+           VerifyField<double>(verifier, VT_QUANTUM, 8) &&
+           verifier.EndTable();
+  }
+  EncodedValuesT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EncodedValuesT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<EncodedValues> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const EncodedValuesT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EncodedValuesBuilder {
+  typedef EncodedValues Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_encoding(quantra::ValueEncoding encoding) {
+    fbb_.AddElement<int8_t>(EncodedValues::VT_ENCODING, static_cast<int8_t>(encoding), 1);
+  }
+  void add_f32(::flatbuffers::Offset<::flatbuffers::Vector<float>> f32) {
+    fbb_.AddOffset(EncodedValues::VT_F32, f32);
+  }
+  void add_base(int64_t base) {
+    fbb_.AddElement<int64_t>(EncodedValues::VT_BASE, base, 0);
+  }
+  void add_deltas(::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> deltas) {
+    fbb_.AddOffset(EncodedValues::VT_DELTAS, deltas);
+  }
+  void add_quantum(double quantum) {
+    fbb_.AddElement<double>(EncodedValues::VT_QUANTUM, quantum, 0.0);
+  }
+  explicit EncodedValuesBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<EncodedValues> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<EncodedValues>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<EncodedValues> CreateEncodedValues(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    quantra::ValueEncoding encoding = quantra::ValueEncoding_Float32,
+    ::flatbuffers::Offset<::flatbuffers::Vector<float>> f32 = 0,
+    int64_t base = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<int32_t>> deltas = 0,
+    double quantum = 0.0) {
+  EncodedValuesBuilder builder_(_fbb);
+  builder_.add_quantum(quantum);
+  builder_.add_base(base);
+  builder_.add_deltas(deltas);
+  builder_.add_f32(f32);
+  builder_.add_encoding(encoding);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<EncodedValues> CreateEncodedValuesDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    quantra::ValueEncoding encoding = quantra::ValueEncoding_Float32,
+    const std::vector<float> *f32 = nullptr,
+    int64_t base = 0,
+    const std::vector<int32_t> *deltas = nullptr,
+    double quantum = 0.0) {
+  auto f32__ = f32 ? _fbb.CreateVector<float>(*f32) : 0;
+  auto deltas__ = deltas ? _fbb.CreateVector<int32_t>(*deltas) : 0;
+  return quantra::CreateEncodedValues(
+      _fbb,
+      encoding,
+      f32__,
+      base,
+      deltas__,
+      quantum);
+}
+
+::flatbuffers::Offset<EncodedValues> CreateEncodedValues(::flatbuffers::FlatBufferBuilder &_fbb, const EncodedValuesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline EncodedDatesT *EncodedDates::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<EncodedDatesT>(new EncodedDatesT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void EncodedDates::UnPackTo(EncodedDatesT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = encoding(); _o->encoding = _e; }
+  { auto _e = serials(); if (_e) { _o->serials.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->serials[_i] = _e->Get(_i); } } else { _o->serials.resize(0); } }
+  { auto _e = start(); _o->start = _e; }
+  { auto _e = step_days(); _o->step_days = _e; }
+  { auto _e = size(); _o->size = _e; }
+}
+
+inline ::flatbuffers::Offset<EncodedDates> EncodedDates::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const EncodedDatesT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateEncodedDates(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<EncodedDates> CreateEncodedDates(::flatbuffers::FlatBufferBuilder &_fbb, const EncodedDatesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const EncodedDatesT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _encoding = _o->encoding;
+  auto _serials = _o->serials.size() ? _fbb.CreateVector(_o->serials) : 0;
+  auto _start = _o->start;
+  auto _step_days = _o->step_days;
+  auto _size = _o->size;
+  return quantra::CreateEncodedDates(
+      _fbb,
+      _encoding,
+      _serials,
+      _start,
+      _step_days,
+      _size);
+}
+
+inline EncodedValuesT *EncodedValues::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<EncodedValuesT>(new EncodedValuesT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void EncodedValues::UnPackTo(EncodedValuesT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = encoding(); _o->encoding = _e; }
+  { auto _e = f32(); if (_e) { _o->f32.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->f32[_i] = _e->Get(_i); } } else { _o->f32.resize(0); } }
+  { auto _e = base(); _o->base = _e; }
+  { auto _e = deltas(); if (_e) { _o->deltas.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->deltas[_i] = _e->Get(_i); } } else { _o->deltas.resize(0); } }
+  { auto _e = quantum(); _o->quantum = _e; }
+}
+
+inline ::flatbuffers::Offset<EncodedValues> EncodedValues::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const EncodedValuesT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateEncodedValues(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<EncodedValues> CreateEncodedValues(::flatbuffers::FlatBufferBuilder &_fbb, const EncodedValuesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const EncodedValuesT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _encoding = _o->encoding;
+  auto _f32 = _o->f32.size() ? _fbb.CreateVector(_o->f32) : 0;
+  auto _base = _o->base;
+  auto _deltas = _o->deltas.size() ? _fbb.CreateVector(_o->deltas) : 0;
+  auto _quantum = _o->quantum;
+  return quantra::CreateEncodedValues(
+      _fbb,
+      _encoding,
+      _f32,
+      _base,
+      _deltas,
+      _quantum);
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_SAMPLEENCODING_QUANTRA_H_
@@ -25,6 +25,7 @@ struct SampleVolSurfacesResponseT;
 struct SampleVolSurfacesResponseT : public ::flatbuffers::NativeTable {
   typedef SampleVolSurfacesResponse TableType;
   std::vector<std::unique_ptr<quantra::VolSurfaceSampleT>> results{};
+  std::vector<std::string> stale_curves{};
   SampleVolSurfacesResponseT() = default;
   SampleVolSurfacesResponseT(const SampleVolSurfacesResponseT &o);
   SampleVolSurfacesResponseT(SampleVolSurfacesResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -35,16 +36,25 @@ struct SampleVolSurfacesResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers
   typedef SampleVolSurfacesResponseT NativeTableType;
   typedef SampleVolSurfacesResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_RESULTS = 4
+    VT_RESULTS = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::VolSurfaceSample>> *results() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::VolSurfaceSample>> *>(VT_RESULTS);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_RESULTS) &&
            verifier.VerifyVector(results()) &&
            verifier.VerifyVectorOfTables(results()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   SampleVolSurfacesResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -59,6 +69,9 @@ struct SampleVolSurfacesResponseBuilder {
   void add_results(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::VolSurfaceSample>>> results) {
     fbb_.AddOffset(SampleVolSurfacesResponse::VT_RESULTS, results);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(SampleVolSurfacesResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit SampleVolSurfacesResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -73,30 +86,37 @@ struct SampleVolSurfacesResponseBuilder {
 
 inline ::flatbuffers::Offset<SampleVolSurfacesResponse> CreateSampleVolSurfacesResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::VolSurfaceSample>>> results = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::VolSurfaceSample>>> results = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   SampleVolSurfacesResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_results(results);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<SampleVolSurfacesResponse> CreateSampleVolSurfacesResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::VolSurfaceSample>> *results = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::VolSurfaceSample>> *results = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto results__ = results ? _fbb.CreateVector<::flatbuffers::Offset<quantra::VolSurfaceSample>>(*results) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreateSampleVolSurfacesResponse(
       _fbb,
-      results__);
+      results__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<SampleVolSurfacesResponse> CreateSampleVolSurfacesResponse(::flatbuffers::FlatBufferBuilder &_fbb, const SampleVolSurfacesResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
-inline SampleVolSurfacesResponseT::SampleVolSurfacesResponseT(const SampleVolSurfacesResponseT &o) {
+inline SampleVolSurfacesResponseT::SampleVolSurfacesResponseT(const SampleVolSurfacesResponseT &o)
+      : stale_curves(o.stale_curves) {
   results.reserve(o.results.size());
   for (const auto &results_ : o.results) { results.emplace_back((results_) ? new quantra::VolSurfaceSampleT(*results_) : nullptr); }
 }
 
 inline SampleVolSurfacesResponseT &SampleVolSurfacesResponseT::operator=(SampleVolSurfacesResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(results, o.results);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -110,6 +130,7 @@ inline void SampleVolSurfacesResponse::UnPackTo(SampleVolSurfacesResponseT *_o,
   (void)_o;
   (void)_resolver;
   { auto _e = results(); if (_e) { _o->results.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->results[_i]) { _e->Get(_i)->UnPackTo(_o->results[_i].get(), _resolver); } else { _o->results[_i] = std::unique_ptr<quantra::VolSurfaceSampleT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->results.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<SampleVolSurfacesResponse> SampleVolSurfacesResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const SampleVolSurfacesResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -121,9 +142,11 @@ inline ::flatbuffers::Offset<SampleVolSurfacesResponse> CreateSampleVolSurfacesR
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const SampleVolSurfacesResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _results = _fbb.CreateVector<::flatbuffers::Offset<quantra::VolSurfaceSample>> (_o->results.size(), [](size_t i, _VectorArgs *__va) { return CreateVolSurfaceSample(*__va->__fbb, __va->__o->results[i].get(), __va->__rehasher); }, &_va );
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreateSampleVolSurfacesResponse(
       _fbb,
-      _results);
+      _results,
+      _stale_curves);
 }
 
 inline const quantra::SampleVolSurfacesResponse *GetSampleVolSurfacesResponse(const void *buf) {
@@ -0,0 +1,271 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_STOREDTRADE_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_STOREDTRADE_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+#include "cap_floor_generated.h"
+#include "cds_generated.h"
+#include "fixed_rate_bond_generated.h"
+#include "vanilla_swap_generated.h"
+
+namespace quantra {
+
+struct StoredTrade;
+struct StoredTradeBuilder;
+struct StoredTradeT;
+
+struct StoredTradeT : public ::flatbuffers::NativeTable {
+  typedef StoredTrade TableType;
+  std::string id{};
+  std::string book_id{};
+  std::unique_ptr<quantra::FixedRateBondT> fixed_rate_bond{};
+  std::unique_ptr<quantra::VanillaSwapT> vanilla_swap{};
+  std::unique_ptr<quantra::CDST> cds{};
+  std::unique_ptr<quantra::CapFloorT> cap_floor{};
+  StoredTradeT() = default;
+  StoredTradeT(const StoredTradeT &o);
+  StoredTradeT(StoredTradeT&&) FLATBUFFERS_NOEXCEPT = default;
+  StoredTradeT &operator=(StoredTradeT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// A trade kept in the worker's trade store, referenced by id (or through
+/// its book) from the Price* requests. Exactly one product is set.
+struct StoredTrade FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef StoredTradeT NativeTableType;
+  typedef StoredTradeBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_BOOK_ID = 6,
+    VT_FIXED_RATE_BOND = 8,
+    VT_VANILLA_SWAP = 10,
+    VT_CDS = 12,
+    VT_CAP_FLOOR = 14
+  };
+  const ::flatbuffers::String *id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_ID);
+  }
+  const ::flatbuffers::String *book_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_BOOK_ID);
+  }
+  const quantra::FixedRateBond *fixed_rate_bond() const {
+    return GetPointer<const quantra::FixedRateBond *>(VT_FIXED_RATE_BOND);
+  }
+  const quantra::VanillaSwap *vanilla_swap() const {
+    return GetPointer<const quantra::VanillaSwap *>(VT_VANILLA_SWAP);
+  }
+  const quantra::CDS *cds() const {
+    return GetPointer<const quantra::CDS *>(VT_CDS);
+  }
+  const quantra::CapFloor *cap_floor() const {
+    return GetPointer<const quantra::CapFloor *>(VT_CAP_FLOOR);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_ID) &&
+           verifier.VerifyString(id()) &&
+           VerifyOffset(verifier, VT_BOOK_ID) &&
+           verifier.VerifyString(book_id()) &&
+           VerifyOffset(verifier, VT_FIXED_RATE_BOND) &&
+           verifier.VerifyTable(fixed_rate_bond()) &&
+           VerifyOffset(verifier, VT_VANILLA_SWAP) &&
+           verifier.VerifyTable(vanilla_swap()) &&
+           VerifyOffset(verifier, VT_CDS) &&
+           verifier.VerifyTable(cds()) &&
+           VerifyOffset(verifier, VT_CAP_FLOOR) &&
+           verifier.VerifyTable(cap_floor()) &&
+           verifier.EndTable();
+  }
+  StoredTradeT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(StoredTradeT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<StoredTrade> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoredTradeT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct StoredTradeBuilder {
+  typedef StoredTrade Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_id(::flatbuffers::Offset<::flatbuffers::String> id) {
+    fbb_.AddOffset(StoredTrade::VT_ID, id);
+  }
+  void add_book_id(::flatbuffers::Offset<::flatbuffers::String> book_id) {
+    fbb_.AddOffset(StoredTrade::VT_BOOK_ID, book_id);
+  }
+  void add_fixed_rate_bond(::flatbuffers::Offset<quantra::FixedRateBond> fixed_rate_bond) {
+    fbb_.AddOffset(StoredTrade::VT_FIXED_RATE_BOND, fixed_rate_bond);
+  }
+  void add_vanilla_swap(::flatbuffers::Offset<quantra::VanillaSwap> vanilla_swap) {
+    fbb_.AddOffset(StoredTrade::VT_VANILLA_SWAP, vanilla_swap);
+  }
+  void add_cds(::flatbuffers::Offset<quantra::CDS> cds) {
+    fbb_.AddOffset(StoredTrade::VT_CDS, cds);
+  }
+  void add_cap_floor(::flatbuffers::Offset<quantra::CapFloor> cap_floor) {
+    fbb_.AddOffset(StoredTrade::VT_CAP_FLOOR, cap_floor);
+  }
+  explicit StoredTradeBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<StoredTrade> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<StoredTrade>(end);
+    fbb_.Required(o, StoredTrade::VT_ID);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<StoredTrade> CreateStoredTrade(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> id = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> book_id = 0,
+    ::flatbuffers::Offset<quantra::FixedRateBond> fixed_rate_bond = 0,
+    ::flatbuffers::Offset<quantra::VanillaSwap> vanilla_swap = 0,
+    ::flatbuffers::Offset<quantra::CDS> cds = 0,
+    ::flatbuffers::Offset<quantra::CapFloor> cap_floor = 0) {
+  StoredTradeBuilder builder_(_fbb);
+  builder_.add_cap_floor(cap_floor);
+  builder_.add_cds(cds);
+  builder_.add_vanilla_swap(vanilla_swap);
+  builder_.add_fixed_rate_bond(fixed_rate_bond);
+  builder_.add_book_id(book_id);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<StoredTrade> CreateStoredTradeDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr,
+    const char *book_id = nullptr,
+    ::flatbuffers::Offset<quantra::FixedRateBond> fixed_rate_bond = 0,
+    ::flatbuffers::Offset<quantra::VanillaSwap> vanilla_swap = 0,
+    ::flatbuffers::Offset<quantra::CDS> cds = 0,
+    ::flatbuffers::Offset<quantra::CapFloor> cap_floor = 0) {
+  auto id__ = id ? _fbb.CreateString(id) : 0;
+  auto book_id__ = book_id ? _fbb.CreateString(book_id) : 0;
+  return quantra::CreateStoredTrade(
+      _fbb,
+      id__,
+      book_id__,
+      fixed_rate_bond,
+      vanilla_swap,
+      cds,
+      cap_floor);
+}
+
+::flatbuffers::Offset<StoredTrade> CreateStoredTrade(::flatbuffers::FlatBufferBuilder &_fbb, const StoredTradeT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline StoredTradeT::StoredTradeT(const StoredTradeT &o)
+      : id(o.id),
+        book_id(o.book_id),
+        fixed_rate_bond((o.fixed_rate_bond) ? new quantra::FixedRateBondT(*o.fixed_rate_bond) : nullptr),
+        vanilla_swap((o.vanilla_swap) ? new quantra::VanillaSwapT(*o.vanilla_swap) : nullptr),
+        cds((o.cds) ? new quantra::CDST(*o.cds) : nullptr),
+        cap_floor((o.cap_floor) ? new quantra::CapFloorT(*o.cap_floor) : nullptr) {
+}
+
+inline StoredTradeT &StoredTradeT::operator=(StoredTradeT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(id, o.id);
+  std::swap(book_id, o.book_id);
+  std::swap(fixed_rate_bond, o.fixed_rate_bond);
+  std::swap(vanilla_swap, o.vanilla_swap);
+  std::swap(cds, o.cds);
+  std::swap(cap_floor, o.cap_floor);
+  return *this;
+}
+
+inline StoredTradeT *StoredTrade::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<StoredTradeT>(new StoredTradeT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void StoredTrade::UnPackTo(StoredTradeT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = id(); if (_e) _o->id = _e->str(); }
+  { auto _e = book_id(); if (_e) _o->book_id = _e->str(); }
+  { auto _e = fixed_rate_bond(); if (_e) { if(_o->fixed_rate_bond) { _e->UnPackTo(_o->fixed_rate_bond.get(), _resolver); } else { _o->fixed_rate_bond = std::unique_ptr<quantra::FixedRateBondT>(_e->UnPack(_resolver)); } } else if (_o->fixed_rate_bond) { _o->fixed_rate_bond.reset(); } }
+  { auto _e = vanilla_swap(); if (_e) { if(_o->vanilla_swap) { _e->UnPackTo(_o->vanilla_swap.get(), _resolver); } else { _o->vanilla_swap = std::unique_ptr<quantra::VanillaSwapT>(_e->UnPack(_resolver)); } } else if (_o->vanilla_swap) { _o->vanilla_swap.reset(); } }
+  { auto _e = cds(); if (_e) { if(_o->cds) { _e->UnPackTo(_o->cds.get(), _resolver); } else { _o->cds = std::unique_ptr<quantra::CDST>(_e->UnPack(_resolver)); } } else if (_o->cds) { _o->cds.reset(); } }
+  { auto _e = cap_floor(); if (_e) { if(_o->cap_floor) { _e->UnPackTo(_o->cap_floor.get(), _resolver); } else { _o->cap_floor = std::unique_ptr<quantra::CapFloorT>(_e->UnPack(_resolver)); } } else if (_o->cap_floor) { _o->cap_floor.reset(); } }
+}
+
+inline ::flatbuffers::Offset<StoredTrade> StoredTrade::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StoredTradeT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateStoredTrade(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<StoredTrade> CreateStoredTrade(::flatbuffers::FlatBufferBuilder &_fbb, const StoredTradeT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const StoredTradeT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _id = _fbb.CreateString(_o->id);
+  auto _book_id = _o->book_id.empty() ? 0 : _fbb.CreateString(_o->book_id);
+  auto _fixed_rate_bond = _o->fixed_rate_bond ? CreateFixedRateBond(_fbb, _o->fixed_rate_bond.get(), _rehasher) : 0;
+  auto _vanilla_swap = _o->vanilla_swap ? CreateVanillaSwap(_fbb, _o->vanilla_swap.get(), _rehasher) : 0;
+  auto _cds = _o->cds ? CreateCDS(_fbb, _o->cds.get(), _rehasher) : 0;
+  auto _cap_floor = _o->cap_floor ? CreateCapFloor(_fbb, _o->cap_floor.get(), _rehasher) : 0;
+  return quantra::CreateStoredTrade(
+      _fbb,
+      _id,
+      _book_id,
+      _fixed_rate_bond,
+      _vanilla_swap,
+      _cds,
+      _cap_floor);
+}
+
+inline const quantra::StoredTrade *GetStoredTrade(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::StoredTrade>(buf);
+}
+
+inline const quantra::StoredTrade *GetSizePrefixedStoredTrade(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::StoredTrade>(buf);
+}
+
+inline bool VerifyStoredTradeBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::StoredTrade>(nullptr);
+}
+
+inline bool VerifySizePrefixedStoredTradeBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::StoredTrade>(nullptr);
+}
+
+inline void FinishStoredTradeBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::StoredTrade> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedStoredTradeBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::StoredTrade> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::StoredTradeT> UnPackStoredTrade(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::StoredTradeT>(GetStoredTrade(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::StoredTradeT> UnPackSizePrefixedStoredTrade(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::StoredTradeT>(GetSizePrefixedStoredTrade(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_STOREDTRADE_QUANTRA_H_
@@ -313,6 +313,7 @@ inline ::flatbuffers::Offset<SwaptionResponse> CreateSwaptionResponseDirect(
 struct PriceSwaptionResponseT : public ::flatbuffers::NativeTable {
   typedef PriceSwaptionResponse TableType;
   std::vector<std::unique_ptr<quantra::SwaptionResponseT>> swaptions{};
+  std::vector<std::string> stale_curves{};
   PriceSwaptionResponseT() = default;
   PriceSwaptionResponseT(const PriceSwaptionResponseT &o);
   PriceSwaptionResponseT(PriceSwaptionResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -323,16 +324,25 @@ struct PriceSwaptionResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Ta
   typedef PriceSwaptionResponseT NativeTableType;
   typedef PriceSwaptionResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_SWAPTIONS = 4
+    VT_SWAPTIONS = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwaptionResponse>> *swaptions() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwaptionResponse>> *>(VT_SWAPTIONS);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_SWAPTIONS) &&
            verifier.VerifyVector(swaptions()) &&
            verifier.VerifyVectorOfTables(swaptions()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   PriceSwaptionResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -347,6 +357,9 @@ struct PriceSwaptionResponseBuilder {
   void add_swaptions(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwaptionResponse>>> swaptions) {
     fbb_.AddOffset(PriceSwaptionResponse::VT_SWAPTIONS, swaptions);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(PriceSwaptionResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit PriceSwaptionResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -360,19 +373,24 @@ struct PriceSwaptionResponseBuilder {
 
 inline ::flatbuffers::Offset<PriceSwaptionResponse> CreatePriceSwaptionResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwaptionResponse>>> swaptions = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwaptionResponse>>> swaptions = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   PriceSwaptionResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_swaptions(swaptions);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<PriceSwaptionResponse> CreatePriceSwaptionResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::SwaptionResponse>> *swaptions = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::SwaptionResponse>> *swaptions = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto swaptions__ = swaptions ? _fbb.CreateVector<::flatbuffers::Offset<quantra::SwaptionResponse>>(*swaptions) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreatePriceSwaptionResponse(
       _fbb,
-      swaptions__);
+      swaptions__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<PriceSwaptionResponse> CreatePriceSwaptionResponse(::flatbuffers::FlatBufferBuilder &_fbb, const PriceSwaptionResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -454,13 +472,15 @@ inline ::flatbuffers::Offset<SwaptionResponse> CreateSwaptionResponse(::flatbuff
       _vol_kind);
 }
 
-inline PriceSwaptionResponseT::PriceSwaptionResponseT(const PriceSwaptionResponseT &o) {
+inline PriceSwaptionResponseT::PriceSwaptionResponseT(const PriceSwaptionResponseT &o)
+      : stale_curves(o.stale_curves) {
   swaptions.reserve(o.swaptions.size());
   for (const auto &swaptions_ : o.swaptions) { swaptions.emplace_back((swaptions_) ? new quantra::SwaptionResponseT(*swaptions_) : nullptr); }
 }
 
 inline PriceSwaptionResponseT &PriceSwaptionResponseT::operator=(PriceSwaptionResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(swaptions, o.swaptions);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -474,6 +494,7 @@ inline void PriceSwaptionResponse::UnPackTo(PriceSwaptionResponseT *_o, const ::
   (void)_o;
   (void)_resolver;
   { auto _e = swaptions(); if (_e) { _o->swaptions.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->swaptions[_i]) { _e->Get(_i)->UnPackTo(_o->swaptions[_i].get(), _resolver); } else { _o->swaptions[_i] = std::unique_ptr<quantra::SwaptionResponseT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->swaptions.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<PriceSwaptionResponse> PriceSwaptionResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceSwaptionResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -485,9 +506,11 @@ inline ::flatbuffers::Offset<PriceSwaptionResponse> CreatePriceSwaptionResponse(
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const PriceSwaptionResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _swaptions = _o->swaptions.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::SwaptionResponse>> (_o->swaptions.size(), [](size_t i, _VectorArgs *__va) { return CreateSwaptionResponse(*__va->__fbb, __va->__o->swaptions[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreatePriceSwaptionResponse(
       _fbb,
-      _swaptions);
+      _swaptions,
+      _stale_curves);
 }
 
 inline const quantra::PriceSwaptionResponse *GetPriceSwaptionResponse(const void *buf) {
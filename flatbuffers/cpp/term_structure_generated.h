@@ -2537,6 +2537,8 @@ struct TermStructureT : public ::flatbuffers::NativeTable {
   quantra::enums::BootstrapTrait bootstrap_trait = quantra::enums::BootstrapTrait_Discount;
   std::vector<std::unique_ptr<quantra::PointsWrapperT>> points{};
   std::string reference_date{};
+  quantra::enums::BootstrapAccuracy bootstrap_accuracy = quantra::enums::BootstrapAccuracy_Exact;
+  int32_t bootstrap_max_iterations = 0;
   TermStructureT() = default;
   TermStructureT(const TermStructureT &o);
   TermStructureT(TermStructureT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -2552,7 +2554,9 @@ struct TermStructure FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_INTERPOLATOR = 8,
     VT_BOOTSTRAP_TRAIT = 10,
     VT_POINTS = 12,
-    VT_REFERENCE_DATE = 14
+    VT_REFERENCE_DATE = 14,
+    VT_BOOTSTRAP_ACCURACY = 16,
+    VT_BOOTSTRAP_MAX_ITERATIONS = 18
   };
   const ::flatbuffers::String *id() const {
     return GetPointer<const ::flatbuffers::String *>(VT_ID);
@@ -2572,6 +2576,14 @@ struct TermStructure FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::String *reference_date() const {
     return GetPointer<const ::flatbuffers::String *>(VT_REFERENCE_DATE);
   }
+  /// Solver tolerance tier; Exact matches the historical 1e-15.
+  quantra::enums::BootstrapAccuracy bootstrap_accuracy() const {
+    return static_cast<quantra::enums::BootstrapAccuracy>(GetField<int8_t>(VT_BOOTSTRAP_ACCURACY, 0));
+  }
+  /// Cap on solver evaluations per pillar (0 = QuantLib default).
+  int32_t bootstrap_max_iterations() const {
+    return GetField<int32_t>(VT_BOOTSTRAP_MAX_ITERATIONS, 0);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_ID) &&
@@ -2584,6 +2596,8 @@ struct TermStructure FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyVectorOfTables(points()) &&
            VerifyOffset(verifier, VT_REFERENCE_DATE) &&
            verifier.VerifyString(reference_date()) &&
+           VerifyField<int8_t>(verifier, VT_BOOTSTRAP_ACCURACY, 1) &&
+           VerifyField<int32_t>(verifier, VT_BOOTSTRAP_MAX_ITERATIONS, 4) &&
            verifier.EndTable();
   }
   TermStructureT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -2613,6 +2627,12 @@ struct TermStructureBuilder {
   void add_reference_date(::flatbuffers::Offset<::flatbuffers::String> reference_date) {
     fbb_.AddOffset(TermStructure::VT_REFERENCE_DATE, reference_date);
   }
+  void add_bootstrap_accuracy(quantra::enums::BootstrapAccuracy bootstrap_accuracy) {
+    fbb_.AddElement<int8_t>(TermStructure::VT_BOOTSTRAP_ACCURACY, static_cast<int8_t>(bootstrap_accuracy), 0);
+  }
+  void add_bootstrap_max_iterations(int32_t bootstrap_max_iterations) {
+    fbb_.AddElement<int32_t>(TermStructure::VT_BOOTSTRAP_MAX_ITERATIONS, bootstrap_max_iterations, 0);
+  }
   explicit TermStructureBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -2631,11 +2651,15 @@ inline ::flatbuffers::Offset<TermStructure> CreateTermStructure(
     quantra::enums::Interpolator interpolator = quantra::enums::Interpolator_BackwardFlat,
     quantra::enums::BootstrapTrait bootstrap_trait = quantra::enums::BootstrapTrait_Discount,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::PointsWrapper>>> points = 0,
-    ::flatbuffers::Offset<::flatbuffers::String> reference_date = 0) {
+    ::flatbuffers::Offset<::flatbuffers::String> reference_date = 0,
+    quantra::enums::BootstrapAccuracy bootstrap_accuracy = quantra::enums::BootstrapAccuracy_Exact,
+    int32_t bootstrap_max_iterations = 0) {
   TermStructureBuilder builder_(_fbb);
+  builder_.add_bootstrap_max_iterations(bootstrap_max_iterations);
   builder_.add_reference_date(reference_date);
   builder_.add_points(points);
   builder_.add_id(id);
+  builder_.add_bootstrap_accuracy(bootstrap_accuracy);
   builder_.add_bootstrap_trait(bootstrap_trait);
   builder_.add_interpolator(interpolator);
   builder_.add_day_counter(day_counter);
@@ -2649,7 +2673,9 @@ inline ::flatbuffers::Offset<TermStructure> CreateTermStructureDirect(
     quantra::enums::Interpolator interpolator = quantra::enums::Interpolator_BackwardFlat,
     quantra::enums::BootstrapTrait bootstrap_trait = quantra::enums::BootstrapTrait_Discount,
     const std::vector<::flatbuffers::Offset<quantra::PointsWrapper>> *points = nullptr,
-    const char *reference_date = nullptr) {
+    const char *reference_date = nullptr,
+    quantra::enums::BootstrapAccuracy bootstrap_accuracy = quantra::enums::BootstrapAccuracy_Exact,
+    int32_t bootstrap_max_iterations = 0) {
   auto id__ = id ? _fbb.CreateString(id) : 0;
   auto points__ = points ? _fbb.CreateVector<::flatbuffers::Offset<quantra::PointsWrapper>>(*points) : 0;
   auto reference_date__ = reference_date ? _fbb.CreateString(reference_date) : 0;
@@ -2660,7 +2686,9 @@ inline ::flatbuffers::Offset<TermStructure> CreateTermStructureDirect(
       interpolator,
       bootstrap_trait,
       points__,
-      reference_date__);
+      reference_date__,
+      bootstrap_accuracy,
+      bootstrap_max_iterations);
 }
 
 ::flatbuffers::Offset<TermStructure> CreateTermStructure(::flatbuffers::FlatBufferBuilder &_fbb, const TermStructureT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -3522,7 +3550,9 @@ inline TermStructureT::TermStructureT(const TermStructureT &o)
         day_counter(o.day_counter),
         interpolator(o.interpolator),
         bootstrap_trait(o.bootstrap_trait),
-        reference_date(o.reference_date) {
+        reference_date(o.reference_date),
+        bootstrap_accuracy(o.bootstrap_accuracy),
+        bootstrap_max_iterations(o.bootstrap_max_iterations) {
   points.reserve(o.points.size());
   for (const auto &points_ : o.points) { points.emplace_back((points_) ? new quantra::PointsWrapperT(*points_) : nullptr); }
 }
@@ -3534,6 +3564,8 @@ inline TermStructureT &TermStructureT::operator=(TermStructureT o) FLATBUFFERS_N
   std::swap(bootstrap_trait, o.bootstrap_trait);
   std::swap(points, o.points);
   std::swap(reference_date, o.reference_date);
+  std::swap(bootstrap_accuracy, o.bootstrap_accuracy);
+  std::swap(bootstrap_max_iterations, o.bootstrap_max_iterations);
   return *this;
 }
 
@@ -3552,6 +3584,8 @@ inline void TermStructure::UnPackTo(TermStructureT *_o, const ::flatbuffers::res
   { auto _e = bootstrap_trait(); _o->bootstrap_trait = _e; }
   { auto _e = points(); if (_e) { _o->points.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->points[_i]) { _e->Get(_i)->UnPackTo(_o->points[_i].get(), _resolver); } else { _o->points[_i] = std::unique_ptr<quantra::PointsWrapperT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->points.resize(0); } }
   { auto _e = reference_date(); if (_e) _o->reference_date = _e->str(); }
+  { auto _e = bootstrap_accuracy(); _o->bootstrap_accuracy = _e; }
+  { auto _e = bootstrap_max_iterations(); _o->bootstrap_max_iterations = _e; }
 }
 
 inline ::flatbuffers::Offset<TermStructure> TermStructure::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TermStructureT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -3568,6 +3602,8 @@ inline ::flatbuffers::Offset<TermStructure> CreateTermStructure(::flatbuffers::F
   auto _bootstrap_trait = _o->bootstrap_trait;
   auto _points = _o->points.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::PointsWrapper>> (_o->points.size(), [](size_t i, _VectorArgs *__va) { return CreatePointsWrapper(*__va->__fbb, __va->__o->points[i].get(), __va->__rehasher); }, &_va ) : 0;
   auto _reference_date = _o->reference_date.empty() ? 0 : _fbb.CreateString(_o->reference_date);
+  auto _bootstrap_accuracy = _o->bootstrap_accuracy;
+  auto _bootstrap_max_iterations = _o->bootstrap_max_iterations;
   return quantra::CreateTermStructure(
       _fbb,
       _id,
@@ -3575,7 +3611,9 @@ inline ::flatbuffers::Offset<TermStructure> CreateTermStructure(::flatbuffers::F
       _interpolator,
       _bootstrap_trait,
       _points,
-      _reference_date);
+      _reference_date,
+      _bootstrap_accuracy,
+      _bootstrap_max_iterations);
 }
 
 inline bool VerifyPoint(::flatbuffers::Verifier &verifier, const void *obj, Point type) {
@@ -0,0 +1,173 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_UPSERTTRADESREQUEST_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_UPSERTTRADESREQUEST_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+#include "stored_trade_generated.h"
+
+namespace quantra {
+
+struct UpsertTradesRequest;
+struct UpsertTradesRequestBuilder;
+struct UpsertTradesRequestT;
+
+struct UpsertTradesRequestT : public ::flatbuffers::NativeTable {
+  typedef UpsertTradesRequest TableType;
+  std::vector<std::unique_ptr<quantra::StoredTradeT>> trades{};
+  UpsertTradesRequestT() = default;
+  UpsertTradesRequestT(const UpsertTradesRequestT &o);
+  UpsertTradesRequestT(UpsertTradesRequestT&&) FLATBUFFERS_NOEXCEPT = default;
+  UpsertTradesRequestT &operator=(UpsertTradesRequestT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// Stores trades by id, replacing any stored trade with the same id.
+struct UpsertTradesRequest FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef UpsertTradesRequestT NativeTableType;
+  typedef UpsertTradesRequestBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_TRADES = 4
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::StoredTrade>> *trades() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::StoredTrade>> *>(VT_TRADES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_TRADES) &&
+           verifier.VerifyVector(trades()) &&
+           verifier.VerifyVectorOfTables(trades()) &&
+           verifier.EndTable();
+  }
+  UpsertTradesRequestT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(UpsertTradesRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<UpsertTradesRequest> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const UpsertTradesRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct UpsertTradesRequestBuilder {
+  typedef UpsertTradesRequest Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_trades(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::StoredTrade>>> trades) {
+    fbb_.AddOffset(UpsertTradesRequest::VT_TRADES, trades);
+  }
+  explicit UpsertTradesRequestBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<UpsertTradesRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<UpsertTradesRequest>(end);
+    fbb_.Required(o, UpsertTradesRequest::VT_TRADES);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<UpsertTradesRequest> CreateUpsertTradesRequest(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::StoredTrade>>> trades = 0) {
+  UpsertTradesRequestBuilder builder_(_fbb);
+  builder_.add_trades(trades);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<UpsertTradesRequest> CreateUpsertTradesRequestDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<quantra::StoredTrade>> *trades = nullptr) {
+  auto trades__ = trades ? _fbb.CreateVector<::flatbuffers::Offset<quantra::StoredTrade>>(*trades) : 0;
+  return quantra::CreateUpsertTradesRequest(
+      _fbb,
+      trades__);
+}
+
+::flatbuffers::Offset<UpsertTradesRequest> CreateUpsertTradesRequest(::flatbuffers::FlatBufferBuilder &_fbb, const UpsertTradesRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline UpsertTradesRequestT::UpsertTradesRequestT(const UpsertTradesRequestT &o) {
+  trades.reserve(o.trades.size());
+  for (const auto &trades_ : o.trades) { trades.emplace_back((trades_) ? new quantra::StoredTradeT(*trades_) : nullptr); }
+}
+
+inline UpsertTradesRequestT &UpsertTradesRequestT::operator=(UpsertTradesRequestT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(trades, o.trades);
+  return *this;
+}
+
+inline UpsertTradesRequestT *UpsertTradesRequest::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<UpsertTradesRequestT>(new UpsertTradesRequestT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void UpsertTradesRequest::UnPackTo(UpsertTradesRequestT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = trades(); if (_e) { _o->trades.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->trades[_i]) { _e->Get(_i)->UnPackTo(_o->trades[_i].get(), _resolver); } else { _o->trades[_i] = std::unique_ptr<quantra::StoredTradeT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->trades.resize(0); } }
+}
+
+inline ::flatbuffers::Offset<UpsertTradesRequest> UpsertTradesRequest::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const UpsertTradesRequestT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateUpsertTradesRequest(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<UpsertTradesRequest> CreateUpsertTradesRequest(::flatbuffers::FlatBufferBuilder &_fbb, const UpsertTradesRequestT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const UpsertTradesRequestT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _trades = _fbb.CreateVector<::flatbuffers::Offset<quantra::StoredTrade>> (_o->trades.size(), [](size_t i, _VectorArgs *__va) { return CreateStoredTrade(*__va->__fbb, __va->__o->trades[i].get(), __va->__rehasher); }, &_va );
+  return quantra::CreateUpsertTradesRequest(
+      _fbb,
+      _trades);
+}
+
+inline const quantra::UpsertTradesRequest *GetUpsertTradesRequest(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::UpsertTradesRequest>(buf);
+}
+
+inline const quantra::UpsertTradesRequest *GetSizePrefixedUpsertTradesRequest(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::UpsertTradesRequest>(buf);
+}
+
+inline bool VerifyUpsertTradesRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::UpsertTradesRequest>(nullptr);
+}
+
+inline bool VerifySizePrefixedUpsertTradesRequestBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::UpsertTradesRequest>(nullptr);
+}
+
+inline void FinishUpsertTradesRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::UpsertTradesRequest> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedUpsertTradesRequestBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::UpsertTradesRequest> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::UpsertTradesRequestT> UnPackUpsertTradesRequest(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::UpsertTradesRequestT>(GetUpsertTradesRequest(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::UpsertTradesRequestT> UnPackSizePrefixedUpsertTradesRequest(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::UpsertTradesRequestT>(GetSizePrefixedUpsertTradesRequest(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_UPSERTTRADESREQUEST_QUANTRA_H_
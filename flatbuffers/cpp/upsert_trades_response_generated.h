@@ -0,0 +1,333 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_UPSERTTRADESRESPONSE_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_UPSERTTRADESRESPONSE_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+#include "common_generated.h"
+
+namespace quantra {
+
+struct RejectedTrade;
+struct RejectedTradeBuilder;
+struct RejectedTradeT;
+
+struct UpsertTradesResponse;
+struct UpsertTradesResponseBuilder;
+struct UpsertTradesResponseT;
+
+struct RejectedTradeT : public ::flatbuffers::NativeTable {
+  typedef RejectedTrade TableType;
+  std::string id{};
+  std::unique_ptr<quantra::ErrorT> error{};
+  RejectedTradeT() = default;
+  RejectedTradeT(const RejectedTradeT &o);
+  RejectedTradeT(RejectedTradeT&&) FLATBUFFERS_NOEXCEPT = default;
+  RejectedTradeT &operator=(RejectedTradeT o) FLATBUFFERS_NOEXCEPT;
+};
+
+/// A trade that was not stored, and why.
+struct RejectedTrade FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef RejectedTradeT NativeTableType;
+  typedef RejectedTradeBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_ERROR = 6
+  };
+  const ::flatbuffers::String *id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_ID);
+  }
+  const quantra::Error *error() const {
+    return GetPointer<const quantra::Error *>(VT_ERROR);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ID) &&
+           verifier.VerifyString(id()) &&
+           VerifyOffset(verifier, VT_ERROR) &&
+           verifier.VerifyTable(error()) &&
+           verifier.EndTable();
+  }
+  RejectedTradeT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(RejectedTradeT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<RejectedTrade> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const RejectedTradeT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct RejectedTradeBuilder {
+  typedef RejectedTrade Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_id(::flatbuffers::Offset<::flatbuffers::String> id) {
+    fbb_.AddOffset(RejectedTrade::VT_ID, id);
+  }
+  void add_error(::flatbuffers::Offset<quantra::Error> error) {
+    fbb_.AddOffset(RejectedTrade::VT_ERROR, error);
+  }
+  explicit RejectedTradeBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<RejectedTrade> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<RejectedTrade>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<RejectedTrade> CreateRejectedTrade(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> id = 0,
+    ::flatbuffers::Offset<quantra::Error> error = 0) {
+  RejectedTradeBuilder builder_(_fbb);
+  builder_.add_error(error);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<RejectedTrade> CreateRejectedTradeDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr,
+    ::flatbuffers::Offset<quantra::Error> error = 0) {
+  auto id__ = id ? _fbb.CreateString(id) : 0;
+  return quantra::CreateRejectedTrade(
+      _fbb,
+      id__,
+      error);
+}
+
+::flatbuffers::Offset<RejectedTrade> CreateRejectedTrade(::flatbuffers::FlatBufferBuilder &_fbb, const RejectedTradeT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct UpsertTradesResponseT : public ::flatbuffers::NativeTable {
+  typedef UpsertTradesResponse TableType;
+  int32_t stored = 0;
+  std::vector<std::unique_ptr<quantra::RejectedTradeT>> rejected{};
+  int32_t trade_count = 0;
+  UpsertTradesResponseT() = default;
+  UpsertTradesResponseT(const UpsertTradesResponseT &o);
+  UpsertTradesResponseT(UpsertTradesResponseT&&) FLATBUFFERS_NOEXCEPT = default;
+  UpsertTradesResponseT &operator=(UpsertTradesResponseT o) FLATBUFFERS_NOEXCEPT;
+};
+
+struct UpsertTradesResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef UpsertTradesResponseT NativeTableType;
+  typedef UpsertTradesResponseBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_STORED = 4,
+    VT_REJECTED = 6,
+    VT_TRADE_COUNT = 8
+  };
+  int32_t stored() const {
+    return GetField<int32_t>(VT_STORED, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::RejectedTrade>> *rejected() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::RejectedTrade>> *>(VT_REJECTED);
+  }
+  /// Trades in the store after the upsert.
+  int32_t trade_count() const {
+    return GetField<int32_t>(VT_TRADE_COUNT, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_STORED, 4) &&
+           VerifyOffset(verifier, VT_REJECTED) &&
+           verifier.VerifyVector(rejected()) &&
+           verifier.VerifyVectorOfTables(rejected()) &&
+           VerifyField<int32_t>(verifier, VT_TRADE_COUNT, 4) &&
+           verifier.EndTable();
+  }
+  UpsertTradesResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(UpsertTradesResponseT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<UpsertTradesResponse> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const UpsertTradesResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct UpsertTradesResponseBuilder {
+  typedef UpsertTradesResponse Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_stored(int32_t stored) {
+    fbb_.AddElement<int32_t>(UpsertTradesResponse::VT_STORED, stored, 0);
+  }
+  void add_rejected(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::RejectedTrade>>> rejected) {
+    fbb_.AddOffset(UpsertTradesResponse::VT_REJECTED, rejected);
+  }
+  void add_trade_count(int32_t trade_count) {
+    fbb_.AddElement<int32_t>(UpsertTradesResponse::VT_TRADE_COUNT, trade_count, 0);
+  }
+  explicit UpsertTradesResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<UpsertTradesResponse> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<UpsertTradesResponse>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<UpsertTradesResponse> CreateUpsertTradesResponse(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t stored = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::RejectedTrade>>> rejected = 0,
+    int32_t trade_count = 0) {
+  UpsertTradesResponseBuilder builder_(_fbb);
+  builder_.add_trade_count(trade_count);
+  builder_.add_rejected(rejected);
+  builder_.add_stored(stored);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<UpsertTradesResponse> CreateUpsertTradesResponseDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t stored = 0,
+    const std::vector<::flatbuffers::Offset<quantra::RejectedTrade>> *rejected = nullptr,
+    int32_t trade_count = 0) {
+  auto rejected__ = rejected ? _fbb.CreateVector<::flatbuffers::Offset<quantra::RejectedTrade>>(*rejected) : 0;
+  return quantra::CreateUpsertTradesResponse(
+      _fbb,
+      stored,
+      rejected__,
+      trade_count);
+}
+
+::flatbuffers::Offset<UpsertTradesResponse> CreateUpsertTradesResponse(::flatbuffers::FlatBufferBuilder &_fbb, const UpsertTradesResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline RejectedTradeT::RejectedTradeT(const RejectedTradeT &o)
+      : id(o.id),
+        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr) {
+}
+
+inline RejectedTradeT &RejectedTradeT::operator=(RejectedTradeT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(id, o.id);
+  std::swap(error, o.error);
+  return *this;
+}
+
+inline RejectedTradeT *RejectedTrade::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<RejectedTradeT>(new RejectedTradeT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void RejectedTrade::UnPackTo(RejectedTradeT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = id(); if (_e) _o->id = _e->str(); }
+  { auto _e = error(); if (_e) { if(_o->error) { _e->UnPackTo(_o->error.get(), _resolver); } else { _o->error = std::unique_ptr<quantra::ErrorT>(_e->UnPack(_resolver)); } } else if (_o->error) { _o->error.reset(); } }
+}
+
+inline ::flatbuffers::Offset<RejectedTrade> RejectedTrade::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const RejectedTradeT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateRejectedTrade(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<RejectedTrade> CreateRejectedTrade(::flatbuffers::FlatBufferBuilder &_fbb, const RejectedTradeT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const RejectedTradeT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _id = _o->id.empty() ? 0 : _fbb.CreateString(_o->id);
+  auto _error = _o->error ? CreateError(_fbb, _o->error.get(), _rehasher) : 0;
+  return quantra::CreateRejectedTrade(
+      _fbb,
+      _id,
+      _error);
+}
+
+inline UpsertTradesResponseT::UpsertTradesResponseT(const UpsertTradesResponseT &o)
+      : stored(o.stored),
+        trade_count(o.trade_count) {
+  rejected.reserve(o.rejected.size());
+  for (const auto &rejected_ : o.rejected) { rejected.emplace_back((rejected_) ? new quantra::RejectedTradeT(*rejected_) : nullptr); }
+}
+
+inline UpsertTradesResponseT &UpsertTradesResponseT::operator=(UpsertTradesResponseT o) FLATBUFFERS_NOEXCEPT {
+  std::swap(stored, o.stored);
+  std::swap(rejected, o.rejected);
+  std::swap(trade_count, o.trade_count);
+  return *this;
+}
+
+inline UpsertTradesResponseT *UpsertTradesResponse::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<UpsertTradesResponseT>(new UpsertTradesResponseT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void UpsertTradesResponse::UnPackTo(UpsertTradesResponseT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = stored(); _o->stored = _e; }
+  { auto _e = rejected(); if (_e) { _o->rejected.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->rejected[_i]) { _e->Get(_i)->UnPackTo(_o->rejected[_i].get(), _resolver); } else { _o->rejected[_i] = std::unique_ptr<quantra::RejectedTradeT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->rejected.resize(0); } }
+  { auto _e = trade_count(); _o->trade_count = _e; }
+}
+
+inline ::flatbuffers::Offset<UpsertTradesResponse> UpsertTradesResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const UpsertTradesResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateUpsertTradesResponse(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<UpsertTradesResponse> CreateUpsertTradesResponse(::flatbuffers::FlatBufferBuilder &_fbb, const UpsertTradesResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const UpsertTradesResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _stored = _o->stored;
+  auto _rejected = _o->rejected.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::RejectedTrade>> (_o->rejected.size(), [](size_t i, _VectorArgs *__va) { return CreateRejectedTrade(*__va->__fbb, __va->__o->rejected[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _trade_count = _o->trade_count;
+  return quantra::CreateUpsertTradesResponse(
+      _fbb,
+      _stored,
+      _rejected,
+      _trade_count);
+}
+
+inline const quantra::UpsertTradesResponse *GetUpsertTradesResponse(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::UpsertTradesResponse>(buf);
+}
+
+inline const quantra::UpsertTradesResponse *GetSizePrefixedUpsertTradesResponse(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::UpsertTradesResponse>(buf);
+}
+
+inline bool VerifyUpsertTradesResponseBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::UpsertTradesResponse>(nullptr);
+}
+
+inline bool VerifySizePrefixedUpsertTradesResponseBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::UpsertTradesResponse>(nullptr);
+}
+
+inline void FinishUpsertTradesResponseBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::UpsertTradesResponse> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedUpsertTradesResponseBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::UpsertTradesResponse> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::UpsertTradesResponseT> UnPackUpsertTradesResponse(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::UpsertTradesResponseT>(GetUpsertTradesResponse(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::UpsertTradesResponseT> UnPackSizePrefixedUpsertTradesResponse(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::UpsertTradesResponseT>(GetSizePrefixedUpsertTradesResponse(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_UPSERTTRADESRESPONSE_QUANTRA_H_
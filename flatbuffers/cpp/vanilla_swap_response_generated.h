@@ -322,6 +322,7 @@ struct VanillaSwapResponseT : public ::flatbuffers::NativeTable {
   double floating_leg_npv = 0.0;
   std::vector<std::unique_ptr<quantra::SwapLegFlowT>> fixed_leg_flows{};
   std::vector<std::unique_ptr<quantra::SwapLegFlowT>> floating_leg_flows{};
+  std::string trade_id{};
   VanillaSwapResponseT() = default;
   VanillaSwapResponseT(const VanillaSwapResponseT &o);
   VanillaSwapResponseT(VanillaSwapResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -340,7 +341,8 @@ struct VanillaSwapResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Tabl
     VT_FIXED_LEG_NPV = 14,
     VT_FLOATING_LEG_NPV = 16,
     VT_FIXED_LEG_FLOWS = 18,
-    VT_FLOATING_LEG_FLOWS = 20
+    VT_FLOATING_LEG_FLOWS = 20,
+    VT_TRADE_ID = 22
   };
   double npv() const {
     return GetField<double>(VT_NPV, 0.0);
@@ -369,6 +371,10 @@ struct VanillaSwapResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Tabl
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwapLegFlow>> *floating_leg_flows() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwapLegFlow>> *>(VT_FLOATING_LEG_FLOWS);
   }
+  /// Id of the stored trade priced, when the entry referenced one.
+  const ::flatbuffers::String *trade_id() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TRADE_ID);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<double>(verifier, VT_NPV, 8) &&
@@ -384,6 +390,8 @@ struct VanillaSwapResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Tabl
            VerifyOffset(verifier, VT_FLOATING_LEG_FLOWS) &&
            verifier.VerifyVector(floating_leg_flows()) &&
            verifier.VerifyVectorOfTables(floating_leg_flows()) &&
+           VerifyOffset(verifier, VT_TRADE_ID) &&
+           verifier.VerifyString(trade_id()) &&
            verifier.EndTable();
   }
   VanillaSwapResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -422,6 +430,9 @@ struct VanillaSwapResponseBuilder {
   void add_floating_leg_flows(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwapLegFlow>>> floating_leg_flows) {
     fbb_.AddOffset(VanillaSwapResponse::VT_FLOATING_LEG_FLOWS, floating_leg_flows);
   }
+  void add_trade_id(::flatbuffers::Offset<::flatbuffers::String> trade_id) {
+    fbb_.AddOffset(VanillaSwapResponse::VT_TRADE_ID, trade_id);
+  }
   explicit VanillaSwapResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -443,7 +454,8 @@ inline ::flatbuffers::Offset<VanillaSwapResponse> CreateVanillaSwapResponse(
     double fixed_leg_npv = 0.0,
     double floating_leg_npv = 0.0,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwapLegFlow>>> fixed_leg_flows = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwapLegFlow>>> floating_leg_flows = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::SwapLegFlow>>> floating_leg_flows = 0,
+    ::flatbuffers::Offset<::flatbuffers::String> trade_id = 0) {
   VanillaSwapResponseBuilder builder_(_fbb);
   builder_.add_floating_leg_npv(floating_leg_npv);
   builder_.add_fixed_leg_npv(fixed_leg_npv);
@@ -452,6 +464,7 @@ inline ::flatbuffers::Offset<VanillaSwapResponse> CreateVanillaSwapResponse(
   builder_.add_fair_spread(fair_spread);
   builder_.add_fair_rate(fair_rate);
   builder_.add_npv(npv);
+  builder_.add_trade_id(trade_id);
   builder_.add_floating_leg_flows(floating_leg_flows);
   builder_.add_fixed_leg_flows(fixed_leg_flows);
   return builder_.Finish();
@@ -467,9 +480,11 @@ inline ::flatbuffers::Offset<VanillaSwapResponse> CreateVanillaSwapResponseDirec
     double fixed_leg_npv = 0.0,
     double floating_leg_npv = 0.0,
     const std::vector<::flatbuffers::Offset<quantra::SwapLegFlow>> *fixed_leg_flows = nullptr,
-    const std::vector<::flatbuffers::Offset<quantra::SwapLegFlow>> *floating_leg_flows = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::SwapLegFlow>> *floating_leg_flows = nullptr,
+    const char *trade_id = nullptr) {
   auto fixed_leg_flows__ = fixed_leg_flows ? _fbb.CreateVector<::flatbuffers::Offset<quantra::SwapLegFlow>>(*fixed_leg_flows) : 0;
   auto floating_leg_flows__ = floating_leg_flows ? _fbb.CreateVector<::flatbuffers::Offset<quantra::SwapLegFlow>>(*floating_leg_flows) : 0;
+  auto trade_id__ = trade_id ? _fbb.CreateString(trade_id) : 0;
   return quantra::CreateVanillaSwapResponse(
       _fbb,
       npv,
@@ -480,7 +495,8 @@ inline ::flatbuffers::Offset<VanillaSwapResponse> CreateVanillaSwapResponseDirec
       fixed_leg_npv,
       floating_leg_npv,
       fixed_leg_flows__,
-      floating_leg_flows__);
+      floating_leg_flows__,
+      trade_id__);
 }
 
 ::flatbuffers::Offset<VanillaSwapResponse> CreateVanillaSwapResponse(::flatbuffers::FlatBufferBuilder &_fbb, const VanillaSwapResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -488,6 +504,7 @@ inline ::flatbuffers::Offset<VanillaSwapResponse> CreateVanillaSwapResponseDirec
 struct PriceVanillaSwapResponseT : public ::flatbuffers::NativeTable {
   typedef PriceVanillaSwapResponse TableType;
   std::vector<std::unique_ptr<quantra::VanillaSwapResponseT>> swaps{};
+  std::vector<std::string> stale_curves{};
   PriceVanillaSwapResponseT() = default;
   PriceVanillaSwapResponseT(const PriceVanillaSwapResponseT &o);
   PriceVanillaSwapResponseT(PriceVanillaSwapResponseT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -498,16 +515,25 @@ struct PriceVanillaSwapResponse FLATBUFFERS_FINAL_CLASS : private ::flatbuffers:
   typedef PriceVanillaSwapResponseT NativeTableType;
   typedef PriceVanillaSwapResponseBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
-    VT_SWAPS = 4
+    VT_SWAPS = 4,
+    VT_STALE_CURVES = 6
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::VanillaSwapResponse>> *swaps() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<quantra::VanillaSwapResponse>> *>(VT_SWAPS);
   }
+  /// Curves served from the last cached solve of the same structure because
+  /// the bootstrap budget ran out (Pricing.stale_curve_fallback).
+  const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>> *>(VT_STALE_CURVES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_SWAPS) &&
            verifier.VerifyVector(swaps()) &&
            verifier.VerifyVectorOfTables(swaps()) &&
+           VerifyOffset(verifier, VT_STALE_CURVES) &&
+           verifier.VerifyVector(stale_curves()) &&
+           verifier.VerifyVectorOfStrings(stale_curves()) &&
            verifier.EndTable();
   }
   PriceVanillaSwapResponseT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -522,6 +548,9 @@ struct PriceVanillaSwapResponseBuilder {
   void add_swaps(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::VanillaSwapResponse>>> swaps) {
     fbb_.AddOffset(PriceVanillaSwapResponse::VT_SWAPS, swaps);
   }
+  void add_stale_curves(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves) {
+    fbb_.AddOffset(PriceVanillaSwapResponse::VT_STALE_CURVES, stale_curves);
+  }
   explicit PriceVanillaSwapResponseBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -535,19 +564,24 @@ struct PriceVanillaSwapResponseBuilder {
 
 inline ::flatbuffers::Offset<PriceVanillaSwapResponse> CreatePriceVanillaSwapResponse(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::VanillaSwapResponse>>> swaps = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<quantra::VanillaSwapResponse>>> swaps = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<::flatbuffers::String>>> stale_curves = 0) {
   PriceVanillaSwapResponseBuilder builder_(_fbb);
+  builder_.add_stale_curves(stale_curves);
   builder_.add_swaps(swaps);
   return builder_.Finish();
 }
 
 inline ::flatbuffers::Offset<PriceVanillaSwapResponse> CreatePriceVanillaSwapResponseDirect(
     ::flatbuffers::FlatBufferBuilder &_fbb,
-    const std::vector<::flatbuffers::Offset<quantra::VanillaSwapResponse>> *swaps = nullptr) {
+    const std::vector<::flatbuffers::Offset<quantra::VanillaSwapResponse>> *swaps = nullptr,
+    const std::vector<::flatbuffers::Offset<::flatbuffers::String>> *stale_curves = nullptr) {
   auto swaps__ = swaps ? _fbb.CreateVector<::flatbuffers::Offset<quantra::VanillaSwapResponse>>(*swaps) : 0;
+  auto stale_curves__ = stale_curves ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*stale_curves) : 0;
   return quantra::CreatePriceVanillaSwapResponse(
       _fbb,
-      swaps__);
+      swaps__,
+      stale_curves__);
 }
 
 ::flatbuffers::Offset<PriceVanillaSwapResponse> CreatePriceVanillaSwapResponse(::flatbuffers::FlatBufferBuilder &_fbb, const PriceVanillaSwapResponseT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -658,7 +692,8 @@ inline VanillaSwapResponseT::VanillaSwapResponseT(const VanillaSwapResponseT &o)
         fixed_leg_bps(o.fixed_leg_bps),
         floating_leg_bps(o.floating_leg_bps),
         fixed_leg_npv(o.fixed_leg_npv),
-        floating_leg_npv(o.floating_leg_npv) {
+        floating_leg_npv(o.floating_leg_npv),
+        trade_id(o.trade_id) {
   fixed_leg_flows.reserve(o.fixed_leg_flows.size());
   for (const auto &fixed_leg_flows_ : o.fixed_leg_flows) { fixed_leg_flows.emplace_back((fixed_leg_flows_) ? new quantra::SwapLegFlowT(*fixed_leg_flows_) : nullptr); }
   floating_leg_flows.reserve(o.floating_leg_flows.size());
@@ -675,6 +710,7 @@ inline VanillaSwapResponseT &VanillaSwapResponseT::operator=(VanillaSwapResponse
   std::swap(floating_leg_npv, o.floating_leg_npv);
   std::swap(fixed_leg_flows, o.fixed_leg_flows);
   std::swap(floating_leg_flows, o.floating_leg_flows);
+  std::swap(trade_id, o.trade_id);
   return *this;
 }
 
@@ -696,6 +732,7 @@ inline void VanillaSwapResponse::UnPackTo(VanillaSwapResponseT *_o, const ::flat
   { auto _e = floating_leg_npv(); _o->floating_leg_npv = _e; }
   { auto _e = fixed_leg_flows(); if (_e) { _o->fixed_leg_flows.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->fixed_leg_flows[_i]) { _e->Get(_i)->UnPackTo(_o->fixed_leg_flows[_i].get(), _resolver); } else { _o->fixed_leg_flows[_i] = std::unique_ptr<quantra::SwapLegFlowT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->fixed_leg_flows.resize(0); } }
   { auto _e = floating_leg_flows(); if (_e) { _o->floating_leg_flows.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->floating_leg_flows[_i]) { _e->Get(_i)->UnPackTo(_o->floating_leg_flows[_i].get(), _resolver); } else { _o->floating_leg_flows[_i] = std::unique_ptr<quantra::SwapLegFlowT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->floating_leg_flows.resize(0); } }
+  { auto _e = trade_id(); if (_e) _o->trade_id = _e->str(); }
 }
 
 inline ::flatbuffers::Offset<VanillaSwapResponse> VanillaSwapResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const VanillaSwapResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -715,6 +752,7 @@ inline ::flatbuffers::Offset<VanillaSwapResponse> CreateVanillaSwapResponse(::fl
   auto _floating_leg_npv = _o->floating_leg_npv;
   auto _fixed_leg_flows = _o->fixed_leg_flows.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::SwapLegFlow>> (_o->fixed_leg_flows.size(), [](size_t i, _VectorArgs *__va) { return CreateSwapLegFlow(*__va->__fbb, __va->__o->fixed_leg_flows[i].get(), __va->__rehasher); }, &_va ) : 0;
   auto _floating_leg_flows = _o->floating_leg_flows.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::SwapLegFlow>> (_o->floating_leg_flows.size(), [](size_t i, _VectorArgs *__va) { return CreateSwapLegFlow(*__va->__fbb, __va->__o->floating_leg_flows[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _trade_id = _o->trade_id.empty() ? 0 : _fbb.CreateString(_o->trade_id);
   return quantra::CreateVanillaSwapResponse(
       _fbb,
       _npv,
@@ -725,16 +763,19 @@ inline ::flatbuffers::Offset<VanillaSwapResponse> CreateVanillaSwapResponse(::fl
       _fixed_leg_npv,
       _floating_leg_npv,
       _fixed_leg_flows,
-      _floating_leg_flows);
+      _floating_leg_flows,
+      _trade_id);
 }
 
-inline PriceVanillaSwapResponseT::PriceVanillaSwapResponseT(const PriceVanillaSwapResponseT &o) {
+inline PriceVanillaSwapResponseT::PriceVanillaSwapResponseT(const PriceVanillaSwapResponseT &o)
+      : stale_curves(o.stale_curves) {
   swaps.reserve(o.swaps.size());
   for (const auto &swaps_ : o.swaps) { swaps.emplace_back((swaps_) ? new quantra::VanillaSwapResponseT(*swaps_) : nullptr); }
 }
 
 inline PriceVanillaSwapResponseT &PriceVanillaSwapResponseT::operator=(PriceVanillaSwapResponseT o) FLATBUFFERS_NOEXCEPT {
   std::swap(swaps, o.swaps);
+  std::swap(stale_curves, o.stale_curves);
   return *this;
 }
 
@@ -748,6 +789,7 @@ inline void PriceVanillaSwapResponse::UnPackTo(PriceVanillaSwapResponseT *_o, co
   (void)_o;
   (void)_resolver;
   { auto _e = swaps(); if (_e) { _o->swaps.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->swaps[_i]) { _e->Get(_i)->UnPackTo(_o->swaps[_i].get(), _resolver); } else { _o->swaps[_i] = std::unique_ptr<quantra::VanillaSwapResponseT>(_e->Get(_i)->UnPack(_resolver)); }; } } else { _o->swaps.resize(0); } }
+  { auto _e = stale_curves(); if (_e) { _o->stale_curves.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->stale_curves[_i] = _e->Get(_i)->str(); } } else { _o->stale_curves.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<PriceVanillaSwapResponse> PriceVanillaSwapResponse::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const PriceVanillaSwapResponseT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -759,9 +801,11 @@ inline ::flatbuffers::Offset<PriceVanillaSwapResponse> CreatePriceVanillaSwapRes
   (void)_o;
   struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const PriceVanillaSwapResponseT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
   auto _swaps = _o->swaps.size() ? _fbb.CreateVector<::flatbuffers::Offset<quantra::VanillaSwapResponse>> (_o->swaps.size(), [](size_t i, _VectorArgs *__va) { return CreateVanillaSwapResponse(*__va->__fbb, __va->__o->swaps[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _stale_curves = _o->stale_curves.size() ? _fbb.CreateVectorOfStrings(_o->stale_curves) : 0;
   return quantra::CreatePriceVanillaSwapResponse(
       _fbb,
-      _swaps);
+      _swaps,
+      _stale_curves);
 }
 
 inline const quantra::PriceVanillaSwapResponse *GetPriceVanillaSwapResponse(const void *buf) {
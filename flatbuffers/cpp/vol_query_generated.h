@@ -504,6 +504,10 @@ struct VolSurfaceSampleT : public ::flatbuffers::NativeTable {
   int32_t n_strikes = 0;
   std::vector<double> atm_levels{};
   std::unique_ptr<quantra::ErrorT> error{};
+  std::unique_ptr<quantra::EncodedDatesT> encoded_expiries{};
+  std::unique_ptr<quantra::EncodedDatesT> encoded_effective_swap_starts{};
+  std::unique_ptr<quantra::EncodedDatesT> encoded_effective_swap_ends{};
+  std::unique_ptr<quantra::EncodedValuesT> encoded_vols{};
   VolSurfaceSampleT() = default;
   VolSurfaceSampleT(const VolSurfaceSampleT &o);
   VolSurfaceSampleT(VolSurfaceSampleT&&) FLATBUFFERS_NOEXCEPT = default;
@@ -534,7 +538,11 @@ struct VolSurfaceSample FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_N_TENORS = 38,
     VT_N_STRIKES = 40,
     VT_ATM_LEVELS = 42,
-    VT_ERROR = 44
+    VT_ERROR = 44,
+    VT_ENCODED_EXPIRIES = 46,
+    VT_ENCODED_EFFECTIVE_SWAP_STARTS = 48,
+    VT_ENCODED_EFFECTIVE_SWAP_ENDS = 50,
+    VT_ENCODED_VOLS = 52
   };
   const ::flatbuffers::String *vol_id() const {
     return GetPointer<const ::flatbuffers::String *>(VT_VOL_ID);
@@ -599,6 +607,18 @@ struct VolSurfaceSample FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const quantra::Error *error() const {
     return GetPointer<const quantra::Error *>(VT_ERROR);
   }
+  const quantra::EncodedDates *encoded_expiries() const {
+    return GetPointer<const quantra::EncodedDates *>(VT_ENCODED_EXPIRIES);
+  }
+  const quantra::EncodedDates *encoded_effective_swap_starts() const {
+    return GetPointer<const quantra::EncodedDates *>(VT_ENCODED_EFFECTIVE_SWAP_STARTS);
+  }
+  const quantra::EncodedDates *encoded_effective_swap_ends() const {
+    return GetPointer<const quantra::EncodedDates *>(VT_ENCODED_EFFECTIVE_SWAP_ENDS);
+  }
+  const quantra::EncodedValues *encoded_vols() const {
+    return GetPointer<const quantra::EncodedValues *>(VT_ENCODED_VOLS);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_VOL_ID) &&
@@ -638,6 +658,14 @@ struct VolSurfaceSample FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyVector(atm_levels()) &&
            VerifyOffset(verifier, VT_ERROR) &&
            verifier.VerifyTable(error()) &&
+           VerifyOffset(verifier, VT_ENCODED_EXPIRIES) &&
+           verifier.VerifyTable(encoded_expiries()) &&
+           VerifyOffset(verifier, VT_ENCODED_EFFECTIVE_SWAP_STARTS) &&
+           verifier.VerifyTable(encoded_effective_swap_starts()) &&
+           VerifyOffset(verifier, VT_ENCODED_EFFECTIVE_SWAP_ENDS) &&
+           verifier.VerifyTable(encoded_effective_swap_ends()) &&
+           VerifyOffset(verifier, VT_ENCODED_VOLS) &&
+           verifier.VerifyTable(encoded_vols()) &&
            verifier.EndTable();
   }
   VolSurfaceSampleT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
@@ -712,6 +740,18 @@ struct VolSurfaceSampleBuilder {
   void add_error(::flatbuffers::Offset<quantra::Error> error) {
     fbb_.AddOffset(VolSurfaceSample::VT_ERROR, error);
   }
+  void add_encoded_expiries(::flatbuffers::Offset<quantra::EncodedDates> encoded_expiries) {
+    fbb_.AddOffset(VolSurfaceSample::VT_ENCODED_EXPIRIES, encoded_expiries);
+  }
+  void add_encoded_effective_swap_starts(::flatbuffers::Offset<quantra::EncodedDates> encoded_effective_swap_starts) {
+    fbb_.AddOffset(VolSurfaceSample::VT_ENCODED_EFFECTIVE_SWAP_STARTS, encoded_effective_swap_starts);
+  }
+  void add_encoded_effective_swap_ends(::flatbuffers::Offset<quantra::EncodedDates> encoded_effective_swap_ends) {
+    fbb_.AddOffset(VolSurfaceSample::VT_ENCODED_EFFECTIVE_SWAP_ENDS, encoded_effective_swap_ends);
+  }
+  void add_encoded_vols(::flatbuffers::Offset<quantra::EncodedValues> encoded_vols) {
+    fbb_.AddOffset(VolSurfaceSample::VT_ENCODED_VOLS, encoded_vols);
+  }
   explicit VolSurfaceSampleBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -746,8 +786,16 @@ inline ::flatbuffers::Offset<VolSurfaceSample> CreateVolSurfaceSample(
     int32_t n_tenors = 0,
     int32_t n_strikes = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<double>> atm_levels = 0,
-    ::flatbuffers::Offset<quantra::Error> error = 0) {
+    ::flatbuffers::Offset<quantra::Error> error = 0,
+    ::flatbuffers::Offset<quantra::EncodedDates> encoded_expiries = 0,
+    ::flatbuffers::Offset<quantra::EncodedDates> encoded_effective_swap_starts = 0,
+    ::flatbuffers::Offset<quantra::EncodedDates> encoded_effective_swap_ends = 0,
+    ::flatbuffers::Offset<quantra::EncodedValues> encoded_vols = 0) {
   VolSurfaceSampleBuilder builder_(_fbb);
+  builder_.add_encoded_vols(encoded_vols);
+  builder_.add_encoded_effective_swap_ends(encoded_effective_swap_ends);
+  builder_.add_encoded_effective_swap_starts(encoded_effective_swap_starts);
+  builder_.add_encoded_expiries(encoded_expiries);
   builder_.add_error(error);
   builder_.add_atm_levels(atm_levels);
   builder_.add_n_strikes(n_strikes);
@@ -794,7 +842,11 @@ inline ::flatbuffers::Offset<VolSurfaceSample> CreateVolSurfaceSampleDirect(
     int32_t n_tenors = 0,
     int32_t n_strikes = 0,
     const std::vector<double> *atm_levels = nullptr,
-    ::flatbuffers::Offset<quantra::Error> error = 0) {
+    ::flatbuffers::Offset<quantra::Error> error = 0,
+    ::flatbuffers::Offset<quantra::EncodedDates> encoded_expiries = 0,
+    ::flatbuffers::Offset<quantra::EncodedDates> encoded_effective_swap_starts = 0,
+    ::flatbuffers::Offset<quantra::EncodedDates> encoded_effective_swap_ends = 0,
+    ::flatbuffers::Offset<quantra::EncodedValues> encoded_vols = 0) {
   auto vol_id__ = vol_id ? _fbb.CreateString(vol_id) : 0;
   auto reference_date__ = reference_date ? _fbb.CreateString(reference_date) : 0;
   auto expiries__ = expiries ? _fbb.CreateVector<::flatbuffers::Offset<::flatbuffers::String>>(*expiries) : 0;
@@ -827,7 +879,11 @@ inline ::flatbuffers::Offset<VolSurfaceSample> CreateVolSurfaceSampleDirect(
       n_tenors,
       n_strikes,
       atm_levels__,
-      error);
+      error,
+      encoded_expiries,
+      encoded_effective_swap_starts,
+      encoded_effective_swap_ends,
+      encoded_vols);
 }
 
 ::flatbuffers::Offset<VolSurfaceSample> CreateVolSurfaceSample(::flatbuffers::FlatBufferBuilder &_fbb, const VolSurfaceSampleT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -981,7 +1037,11 @@ inline VolSurfaceSampleT::VolSurfaceSampleT(const VolSurfaceSampleT &o)
         n_tenors(o.n_tenors),
         n_strikes(o.n_strikes),
         atm_levels(o.atm_levels),
-        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr) {
+        error((o.error) ? new quantra::ErrorT(*o.error) : nullptr),
+        encoded_expiries((o.encoded_expiries) ? new quantra::EncodedDatesT(*o.encoded_expiries) : nullptr),
+        encoded_effective_swap_starts((o.encoded_effective_swap_starts) ? new quantra::EncodedDatesT(*o.encoded_effective_swap_starts) : nullptr),
+        encoded_effective_swap_ends((o.encoded_effective_swap_ends) ? new quantra::EncodedDatesT(*o.encoded_effective_swap_ends) : nullptr),
+        encoded_vols((o.encoded_vols) ? new quantra::EncodedValuesT(*o.encoded_vols) : nullptr) {
   tenors.reserve(o.tenors.size());
   for (const auto &tenors_ : o.tenors) { tenors.emplace_back((tenors_) ? new quantra::PeriodT(*tenors_) : nullptr); }
 }
@@ -1008,6 +1068,10 @@ inline VolSurfaceSampleT &VolSurfaceSampleT::operator=(VolSurfaceSampleT o) FLAT
   std::swap(n_strikes, o.n_strikes);
   std::swap(atm_levels, o.atm_levels);
   std::swap(error, o.error);
+  std::swap(encoded_expiries, o.encoded_expiries);
+  std::swap(encoded_effective_swap_starts, o.encoded_effective_swap_starts);
+  std::swap(encoded_effective_swap_ends, o.encoded_effective_swap_ends);
+  std::swap(encoded_vols, o.encoded_vols);
   return *this;
 }
 
@@ -1041,6 +1105,10 @@ inline void VolSurfaceSample::UnPackTo(VolSurfaceSampleT *_o, const ::flatbuffer
   { auto _e = n_strikes(); _o->n_strikes = _e; }
   { auto _e = atm_levels(); if (_e) { _o->atm_levels.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->atm_levels[_i] = _e->Get(_i); } } else { _o->atm_levels.resize(0); } }
   { auto _e = error(); if (_e) { if(_o->error) { _e->UnPackTo(_o->error.get(), _resolver); } else { _o->error = std::unique_ptr<quantra::ErrorT>(_e->UnPack(_resolver)); } } else if (_o->error) { _o->error.reset(); } }
+  { auto _e = encoded_expiries(); if (_e) { if(_o->encoded_expiries) { _e->UnPackTo(_o->encoded_expiries.get(), _resolver); } else { _o->encoded_expiries = std::unique_ptr<quantra::EncodedDatesT>(_e->UnPack(_resolver)); } } else if (_o->encoded_expiries) { _o->encoded_expiries.reset(); } }
+  { auto _e = encoded_effective_swap_starts(); if (_e) { if(_o->encoded_effective_swap_starts) { _e->UnPackTo(_o->encoded_effective_swap_starts.get(), _resolver); } else { _o->encoded_effective_swap_starts = std::unique_ptr<quantra::EncodedDatesT>(_e->UnPack(_resolver)); } } else if (_o->encoded_effective_swap_starts) { _o->encoded_effective_swap_starts.reset(); } }
+  { auto _e = encoded_effective_swap_ends(); if (_e) { if(_o->encoded_effective_swap_ends) { _e->UnPackTo(_o->encoded_effective_swap_ends.get(), _resolver); } else { _o->encoded_effective_swap_ends = std::unique_ptr<quantra::EncodedDatesT>(_e->UnPack(_resolver)); } } else if (_o->encoded_effective_swap_ends) { _o->encoded_effective_swap_ends.reset(); } }
+  { auto _e = encoded_vols(); if (_e) { if(_o->encoded_vols) { _e->UnPackTo(_o->encoded_vols.get(), _resolver); } else { _o->encoded_vols = std::unique_ptr<quantra::EncodedValuesT>(_e->UnPack(_resolver)); } } else if (_o->encoded_vols) { _o->encoded_vols.reset(); } }
 }
 
 inline ::flatbuffers::Offset<VolSurfaceSample> VolSurfaceSample::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const VolSurfaceSampleT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
@@ -1072,6 +1140,10 @@ inline ::flatbuffers::Offset<VolSurfaceSample> CreateVolSurfaceSample(::flatbuff
   auto _n_strikes = _o->n_strikes;
   auto _atm_levels = _o->atm_levels.size() ? _fbb.CreateVector(_o->atm_levels) : 0;
   auto _error = _o->error ? CreateError(_fbb, _o->error.get(), _rehasher) : 0;
+  auto _encoded_expiries = _o->encoded_expiries ? CreateEncodedDates(_fbb, _o->encoded_expiries.get(), _rehasher) : 0;
+  auto _encoded_effective_swap_starts = _o->encoded_effective_swap_starts ? CreateEncodedDates(_fbb, _o->encoded_effective_swap_starts.get(), _rehasher) : 0;
+  auto _encoded_effective_swap_ends = _o->encoded_effective_swap_ends ? CreateEncodedDates(_fbb, _o->encoded_effective_swap_ends.get(), _rehasher) : 0;
+  auto _encoded_vols = _o->encoded_vols ? CreateEncodedValues(_fbb, _o->encoded_vols.get(), _rehasher) : 0;
   return quantra::CreateVolSurfaceSample(
       _fbb,
       _vol_id,
@@ -1094,7 +1166,11 @@ inline ::flatbuffers::Offset<VolSurfaceSample> CreateVolSurfaceSample(::flatbuff
       _n_tenors,
       _n_strikes,
       _atm_levels,
-      _error);
+      _error,
+      _encoded_expiries,
+      _encoded_effective_swap_starts,
+      _encoded_effective_swap_ends,
+      _encoded_vols);
 }
 
 }  // namespace quantra
@@ -0,0 +1,178 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_ZSPREADQUOTE_QUANTRA_H_
+#define FLATBUFFERS_GENERATED_ZSPREADQUOTE_QUANTRA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
+              FLATBUFFERS_VERSION_MINOR == 12 &&
+              FLATBUFFERS_VERSION_REVISION == 23,
+             "Non-compatible flatbuffers version included");
+
+#include "enums_generated.h"
+
+namespace quantra {
+
+struct ZSpreadQuote;
+struct ZSpreadQuoteBuilder;
+struct ZSpreadQuoteT;
+
+struct ZSpreadQuoteT : public ::flatbuffers::NativeTable {
+  typedef ZSpreadQuote TableType;
+  double clean_price = 0.0;
+  quantra::enums::Compounding compounding = quantra::enums::Compounding_Continuous;
+  quantra::enums::Frequency frequency = quantra::enums::Frequency_Annual;
+};
+
+/// Market price to solve a Z-spread for: the constant spread over the
+/// discounting curve's zero rates (curve day counter, given compounding)
+/// that reprices the bond to clean_price at its settlement date.
+struct ZSpreadQuote FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ZSpreadQuoteT NativeTableType;
+  typedef ZSpreadQuoteBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CLEAN_PRICE = 4,
+    VT_COMPOUNDING = 6,
+    VT_FREQUENCY = 8
+  };
+  /// Per 100 notional.
+  double clean_price() const {
+    return GetField<double>(VT_CLEAN_PRICE, 0.0);
+  }
+  quantra::enums::Compounding compounding() const {
+    return static_cast<quantra::enums::Compounding>(GetField<int8_t>(VT_COMPOUNDING, 1));
+  }
+  quantra::enums::Frequency frequency() const {
+    return static_cast<quantra::enums::Frequency>(GetField<int8_t>(VT_FREQUENCY, 0));
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<double>(verifier, VT_CLEAN_PRICE, 8) &&
+           VerifyField<int8_t>(verifier, VT_COMPOUNDING, 1) &&
+           VerifyField<int8_t>(verifier, VT_FREQUENCY, 1) &&
+           verifier.EndTable();
+  }
+  ZSpreadQuoteT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ZSpreadQuoteT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static ::flatbuffers::Offset<ZSpreadQuote> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ZSpreadQuoteT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ZSpreadQuoteBuilder {
+  typedef ZSpreadQuote Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_clean_price(double clean_price) {
+    fbb_.AddElement<double>(ZSpreadQuote::VT_CLEAN_PRICE, clean_price, 0.0);
+  }
+  void add_compounding(quantra::enums::Compounding compounding) {
+    fbb_.AddElement<int8_t>(ZSpreadQuote::VT_COMPOUNDING, static_cast<int8_t>(compounding), 1);
+  }
+  void add_frequency(quantra::enums::Frequency frequency) {
+    fbb_.AddElement<int8_t>(ZSpreadQuote::VT_FREQUENCY, static_cast<int8_t>(frequency), 0);
+  }
+  explicit ZSpreadQuoteBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ZSpreadQuote> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ZSpreadQuote>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ZSpreadQuote> CreateZSpreadQuote(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    double clean_price = 0.0,
+    quantra::enums::Compounding compounding = quantra::enums::Compounding_Continuous,
+    quantra::enums::Frequency frequency = quantra::enums::Frequency_Annual) {
+  ZSpreadQuoteBuilder builder_(_fbb);
+  builder_.add_clean_price(clean_price);
+  builder_.add_frequency(frequency);
+  builder_.add_compounding(compounding);
+  return builder_.Finish();
+}
+
+::flatbuffers::Offset<ZSpreadQuote> CreateZSpreadQuote(::flatbuffers::FlatBufferBuilder &_fbb, const ZSpreadQuoteT *_o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline ZSpreadQuoteT *ZSpreadQuote::UnPack(const ::flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = std::unique_ptr<ZSpreadQuoteT>(new ZSpreadQuoteT());
+  UnPackTo(_o.get(), _resolver);
+  return _o.release();
+}
+
+inline void ZSpreadQuote::UnPackTo(ZSpreadQuoteT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = clean_price(); _o->clean_price = _e; }
+  { auto _e = compounding(); _o->compounding = _e; }
+  { auto _e = frequency(); _o->frequency = _e; }
+}
+
+inline ::flatbuffers::Offset<ZSpreadQuote> ZSpreadQuote::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ZSpreadQuoteT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateZSpreadQuote(_fbb, _o, _rehasher);
+}
+
+inline ::flatbuffers::Offset<ZSpreadQuote> CreateZSpreadQuote(::flatbuffers::FlatBufferBuilder &_fbb, const ZSpreadQuoteT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { ::flatbuffers::FlatBufferBuilder *__fbb; const ZSpreadQuoteT* __o; const ::flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _clean_price = _o->clean_price;
+  auto _compounding = _o->compounding;
+  auto _frequency = _o->frequency;
+  return quantra::CreateZSpreadQuote(
+      _fbb,
+      _clean_price,
+      _compounding,
+      _frequency);
+}
+
+inline const quantra::ZSpreadQuote *GetZSpreadQuote(const void *buf) {
+  return ::flatbuffers::GetRoot<quantra::ZSpreadQuote>(buf);
+}
+
+inline const quantra::ZSpreadQuote *GetSizePrefixedZSpreadQuote(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<quantra::ZSpreadQuote>(buf);
+}
+
+inline bool VerifyZSpreadQuoteBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<quantra::ZSpreadQuote>(nullptr);
+}
+
+inline bool VerifySizePrefixedZSpreadQuoteBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<quantra::ZSpreadQuote>(nullptr);
+}
+
+inline void FinishZSpreadQuoteBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::ZSpreadQuote> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedZSpreadQuoteBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<quantra::ZSpreadQuote> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline std::unique_ptr<quantra::ZSpreadQuoteT> UnPackZSpreadQuote(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::ZSpreadQuoteT>(GetZSpreadQuote(buf)->UnPack(res));
+}
+
+inline std::unique_ptr<quantra::ZSpreadQuoteT> UnPackSizePrefixedZSpreadQuote(
+    const void *buf,
+    const ::flatbuffers::resolver_function_t *res = nullptr) {
+  return std::unique_ptr<quantra::ZSpreadQuoteT>(GetSizePrefixedZSpreadQuote(buf)->UnPack(res));
+}
+
+}  // namespace quantra
+
+#endif  // FLATBUFFERS_GENERATED_ZSPREADQUOTE_QUANTRA_H_
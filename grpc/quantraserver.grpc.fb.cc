@@ -25,6 +25,12 @@ static const char* QuantraServer_method_names[] = {
   "/quantra.QuantraServer/PriceCDS",
   "/quantra.QuantraServer/BootstrapCurves",
   "/quantra.QuantraServer/SampleVolSurfaces",
+  "/quantra.QuantraServer/ComputeCurveRisk",
+  "/quantra.QuantraServer/BootstrapCurvesStream",
+  "/quantra.QuantraServer/SampleVolSurfacesStream",
+  "/quantra.QuantraServer/BondYieldAnalytics",
+  "/quantra.QuantraServer/UpsertTrades",
+  "/quantra.QuantraServer/DeleteTrades",
 };
 
 std::unique_ptr< QuantraServer::Stub> QuantraServer::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& /*options*/) {
@@ -42,6 +48,12 @@ QuantraServer::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_PriceCDS_(QuantraServer_method_names[6], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_BootstrapCurves_(QuantraServer_method_names[7], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_SampleVolSurfaces_(QuantraServer_method_names[8], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ComputeCurveRisk_(QuantraServer_method_names[9], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_BootstrapCurvesStream_(QuantraServer_method_names[10], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_SampleVolSurfacesStream_(QuantraServer_method_names[11], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_BondYieldAnalytics_(QuantraServer_method_names[12], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_UpsertTrades_(QuantraServer_method_names[13], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_DeleteTrades_(QuantraServer_method_names[14], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
   
 ::grpc::Status QuantraServer::Stub::PriceFixedRateBond(::grpc::ClientContext* context, const flatbuffers::grpc::Message<PriceFixedRateBondRequest>& request, flatbuffers::grpc::Message<PriceFixedRateBondResponse>* response) {
@@ -152,6 +164,78 @@ QuantraServer::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>::Create(channel_.get(), cq, rpcmethod_SampleVolSurfaces_, context, request, false);
 }
 
+::grpc::Status QuantraServer::Stub::ComputeCurveRisk(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, flatbuffers::grpc::Message<ComputeCurveRiskResponse>* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_ComputeCurveRisk_, context, request, response);
+}
+
+::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>* QuantraServer::Stub::AsyncComputeCurveRiskRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>::Create(channel_.get(), cq, rpcmethod_ComputeCurveRisk_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>* QuantraServer::Stub::PrepareAsyncComputeCurveRiskRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>::Create(channel_.get(), cq, rpcmethod_ComputeCurveRisk_, context, request, false);
+}
+
+::grpc::ClientReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* QuantraServer::Stub::BootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request) {
+  return ::grpc::internal::ClientReaderFactory< flatbuffers::grpc::Message<BootstrapCurvesResponse>>::Create(channel_.get(), rpcmethod_BootstrapCurvesStream_, context, request);
+}
+
+::grpc::ClientAsyncReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* QuantraServer::Stub::AsyncBootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< flatbuffers::grpc::Message<BootstrapCurvesResponse>>::Create(channel_.get(), cq, rpcmethod_BootstrapCurvesStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* QuantraServer::Stub::PrepareAsyncBootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< flatbuffers::grpc::Message<BootstrapCurvesResponse>>::Create(channel_.get(), cq, rpcmethod_BootstrapCurvesStream_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* QuantraServer::Stub::SampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request) {
+  return ::grpc::internal::ClientReaderFactory< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>::Create(channel_.get(), rpcmethod_SampleVolSurfacesStream_, context, request);
+}
+
+::grpc::ClientAsyncReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* QuantraServer::Stub::AsyncSampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>::Create(channel_.get(), cq, rpcmethod_SampleVolSurfacesStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* QuantraServer::Stub::PrepareAsyncSampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>::Create(channel_.get(), cq, rpcmethod_SampleVolSurfacesStream_, context, request, false, nullptr);
+}
+
+::grpc::Status QuantraServer::Stub::BondYieldAnalytics(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_BondYieldAnalytics_, context, request, response);
+}
+
+::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>* QuantraServer::Stub::AsyncBondYieldAnalyticsRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>::Create(channel_.get(), cq, rpcmethod_BondYieldAnalytics_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>* QuantraServer::Stub::PrepareAsyncBondYieldAnalyticsRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>::Create(channel_.get(), cq, rpcmethod_BondYieldAnalytics_, context, request, false);
+}
+
+::grpc::Status QuantraServer::Stub::UpsertTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, flatbuffers::grpc::Message<UpsertTradesResponse>* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_UpsertTrades_, context, request, response);
+}
+
+::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<UpsertTradesResponse>>* QuantraServer::Stub::AsyncUpsertTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<UpsertTradesResponse>>::Create(channel_.get(), cq, rpcmethod_UpsertTrades_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<UpsertTradesResponse>>* QuantraServer::Stub::PrepareAsyncUpsertTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<UpsertTradesResponse>>::Create(channel_.get(), cq, rpcmethod_UpsertTrades_, context, request, false);
+}
+
+::grpc::Status QuantraServer::Stub::DeleteTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, flatbuffers::grpc::Message<DeleteTradesResponse>* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_DeleteTrades_, context, request, response);
+}
+
+::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<DeleteTradesResponse>>* QuantraServer::Stub::AsyncDeleteTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<DeleteTradesResponse>>::Create(channel_.get(), cq, rpcmethod_DeleteTrades_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<DeleteTradesResponse>>* QuantraServer::Stub::PrepareAsyncDeleteTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderFactory< flatbuffers::grpc::Message<DeleteTradesResponse>>::Create(channel_.get(), cq, rpcmethod_DeleteTrades_, context, request, false);
+}
+
 QuantraServer::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       QuantraServer_method_names[0],
@@ -198,6 +282,36 @@ QuantraServer::Service::Service() {
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< QuantraServer::Service, flatbuffers::grpc::Message<SampleVolSurfacesRequest>, flatbuffers::grpc::Message<SampleVolSurfacesResponse>>(
           std::mem_fn(&QuantraServer::Service::SampleVolSurfaces), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      QuantraServer_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< QuantraServer::Service, flatbuffers::grpc::Message<ComputeCurveRiskRequest>, flatbuffers::grpc::Message<ComputeCurveRiskResponse>>(
+          std::mem_fn(&QuantraServer::Service::ComputeCurveRisk), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      QuantraServer_method_names[10],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< QuantraServer::Service, flatbuffers::grpc::Message<BootstrapCurvesRequest>, flatbuffers::grpc::Message<BootstrapCurvesResponse>>(
+          std::mem_fn(&QuantraServer::Service::BootstrapCurvesStream), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      QuantraServer_method_names[11],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< QuantraServer::Service, flatbuffers::grpc::Message<SampleVolSurfacesRequest>, flatbuffers::grpc::Message<SampleVolSurfacesResponse>>(
+          std::mem_fn(&QuantraServer::Service::SampleVolSurfacesStream), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      QuantraServer_method_names[12],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< QuantraServer::Service, flatbuffers::grpc::Message<BondYieldAnalyticsRequest>, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>(
+          std::mem_fn(&QuantraServer::Service::BondYieldAnalytics), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      QuantraServer_method_names[13],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< QuantraServer::Service, flatbuffers::grpc::Message<UpsertTradesRequest>, flatbuffers::grpc::Message<UpsertTradesResponse>>(
+          std::mem_fn(&QuantraServer::Service::UpsertTrades), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      QuantraServer_method_names[14],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< QuantraServer::Service, flatbuffers::grpc::Message<DeleteTradesRequest>, flatbuffers::grpc::Message<DeleteTradesResponse>>(
+          std::mem_fn(&QuantraServer::Service::DeleteTrades), this)));
 }
 
 QuantraServer::Service::~Service() {
@@ -239,6 +353,30 @@ QuantraServer::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status QuantraServer::Service::ComputeCurveRisk(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>* /*request*/, flatbuffers::grpc::Message<ComputeCurveRiskResponse>* /*response*/) {
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status QuantraServer::Service::DeleteTrades(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<DeleteTradesRequest>* /*request*/, flatbuffers::grpc::Message<DeleteTradesResponse>* /*response*/) {
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status QuantraServer::Service::UpsertTrades(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<UpsertTradesRequest>* /*request*/, flatbuffers::grpc::Message<UpsertTradesResponse>* /*response*/) {
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status QuantraServer::Service::BondYieldAnalytics(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>* /*request*/, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>* /*response*/) {
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status QuantraServer::Service::BootstrapCurvesStream(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<BootstrapCurvesRequest>* /*request*/, ::grpc::ServerWriter< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* /*writer*/) {
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status QuantraServer::Service::SampleVolSurfacesStream(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>* /*request*/, ::grpc::ServerWriter< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* /*writer*/) {
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace quantra
 
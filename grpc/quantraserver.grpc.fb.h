@@ -97,6 +97,52 @@ class QuantraServer final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>> PrepareAsyncSampleVolSurfaces(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>>(PrepareAsyncSampleVolSurfacesRaw(context, request, cq));
     }
+    virtual ::grpc::Status ComputeCurveRisk(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, flatbuffers::grpc::Message<ComputeCurveRiskResponse>* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>> AsyncComputeCurveRisk(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>>(AsyncComputeCurveRiskRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>> PrepareAsyncComputeCurveRisk(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>>(PrepareAsyncComputeCurveRiskRaw(context, request, cq));
+    }
+    virtual ::grpc::Status DeleteTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, flatbuffers::grpc::Message<DeleteTradesResponse>* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<DeleteTradesResponse>>> AsyncDeleteTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<DeleteTradesResponse>>>(AsyncDeleteTradesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<DeleteTradesResponse>>> PrepareAsyncDeleteTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<DeleteTradesResponse>>>(PrepareAsyncDeleteTradesRaw(context, request, cq));
+    }
+    virtual ::grpc::Status UpsertTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, flatbuffers::grpc::Message<UpsertTradesResponse>* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<UpsertTradesResponse>>> AsyncUpsertTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<UpsertTradesResponse>>>(AsyncUpsertTradesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<UpsertTradesResponse>>> PrepareAsyncUpsertTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<UpsertTradesResponse>>>(PrepareAsyncUpsertTradesRaw(context, request, cq));
+    }
+    virtual ::grpc::Status BondYieldAnalytics(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>> AsyncBondYieldAnalytics(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>>(AsyncBondYieldAnalyticsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>> PrepareAsyncBondYieldAnalytics(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>>(PrepareAsyncBondYieldAnalyticsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>> BootstrapCurvesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>>(BootstrapCurvesStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>> AsyncBootstrapCurvesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>>(AsyncBootstrapCurvesStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>> PrepareAsyncBootstrapCurvesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>>(PrepareAsyncBootstrapCurvesStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>> SampleVolSurfacesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>>(SampleVolSurfacesStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>> AsyncSampleVolSurfacesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>>(AsyncSampleVolSurfacesStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>> PrepareAsyncSampleVolSurfacesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>>(PrepareAsyncSampleVolSurfacesStreamRaw(context, request, cq));
+    }
   private:
     virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<PriceFixedRateBondResponse>>* AsyncPriceFixedRateBondRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<PriceFixedRateBondRequest>& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<PriceFixedRateBondResponse>>* PrepareAsyncPriceFixedRateBondRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<PriceFixedRateBondRequest>& request, ::grpc::CompletionQueue* cq) = 0;
@@ -116,6 +162,20 @@ class QuantraServer final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* PrepareAsyncBootstrapCurvesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* AsyncSampleVolSurfacesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* PrepareAsyncSampleVolSurfacesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>* AsyncComputeCurveRiskRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>* PrepareAsyncComputeCurveRiskRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<DeleteTradesResponse>>* AsyncDeleteTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<DeleteTradesResponse>>* PrepareAsyncDeleteTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<UpsertTradesResponse>>* AsyncUpsertTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<UpsertTradesResponse>>* PrepareAsyncUpsertTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>* AsyncBondYieldAnalyticsRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>* PrepareAsyncBondYieldAnalyticsRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* BootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* AsyncBootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* PrepareAsyncBootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* SampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* AsyncSampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* PrepareAsyncSampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -183,6 +243,52 @@ class QuantraServer final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>> PrepareAsyncSampleVolSurfaces(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>>(PrepareAsyncSampleVolSurfacesRaw(context, request, cq));
     }
+    ::grpc::Status ComputeCurveRisk(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, flatbuffers::grpc::Message<ComputeCurveRiskResponse>* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>> AsyncComputeCurveRisk(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>>(AsyncComputeCurveRiskRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>> PrepareAsyncComputeCurveRisk(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>>(PrepareAsyncComputeCurveRiskRaw(context, request, cq));
+    }
+    ::grpc::Status DeleteTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, flatbuffers::grpc::Message<DeleteTradesResponse>* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<DeleteTradesResponse>>> AsyncDeleteTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<DeleteTradesResponse>>>(AsyncDeleteTradesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<DeleteTradesResponse>>> PrepareAsyncDeleteTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<DeleteTradesResponse>>>(PrepareAsyncDeleteTradesRaw(context, request, cq));
+    }
+    ::grpc::Status UpsertTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, flatbuffers::grpc::Message<UpsertTradesResponse>* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<UpsertTradesResponse>>> AsyncUpsertTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<UpsertTradesResponse>>>(AsyncUpsertTradesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<UpsertTradesResponse>>> PrepareAsyncUpsertTrades(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<UpsertTradesResponse>>>(PrepareAsyncUpsertTradesRaw(context, request, cq));
+    }
+    ::grpc::Status BondYieldAnalytics(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>> AsyncBondYieldAnalytics(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>>(AsyncBondYieldAnalyticsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>> PrepareAsyncBondYieldAnalytics(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>>(PrepareAsyncBondYieldAnalyticsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>> BootstrapCurvesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request) {
+      return std::unique_ptr< ::grpc::ClientReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>>(BootstrapCurvesStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>> AsyncBootstrapCurvesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>>(AsyncBootstrapCurvesStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>> PrepareAsyncBootstrapCurvesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>>(PrepareAsyncBootstrapCurvesStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>> SampleVolSurfacesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request) {
+      return std::unique_ptr< ::grpc::ClientReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>>(SampleVolSurfacesStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>> AsyncSampleVolSurfacesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>>(AsyncSampleVolSurfacesStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>> PrepareAsyncSampleVolSurfacesStream(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>>(PrepareAsyncSampleVolSurfacesStreamRaw(context, request, cq));
+    }
   
    private:
     std::shared_ptr< ::grpc::ChannelInterface> channel_;
@@ -204,6 +310,20 @@ class QuantraServer final {
     ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* PrepareAsyncBootstrapCurvesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* AsyncSampleVolSurfacesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* PrepareAsyncSampleVolSurfacesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>* AsyncComputeCurveRiskRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>* PrepareAsyncComputeCurveRiskRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<DeleteTradesResponse>>* AsyncDeleteTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<DeleteTradesResponse>>* PrepareAsyncDeleteTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<UpsertTradesResponse>>* AsyncUpsertTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<UpsertTradesResponse>>* PrepareAsyncUpsertTradesRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>* AsyncBondYieldAnalyticsRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>* PrepareAsyncBondYieldAnalyticsRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* BootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request) override;
+    ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* AsyncBootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* PrepareAsyncBootstrapCurvesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* SampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request) override;
+    ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* AsyncSampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* PrepareAsyncSampleVolSurfacesStreamRaw(::grpc::ClientContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_PriceFixedRateBond_;
     const ::grpc::internal::RpcMethod rpcmethod_PriceFloatingRateBond_;
     const ::grpc::internal::RpcMethod rpcmethod_PriceVanillaSwap_;
@@ -213,6 +333,12 @@ class QuantraServer final {
     const ::grpc::internal::RpcMethod rpcmethod_PriceCDS_;
     const ::grpc::internal::RpcMethod rpcmethod_BootstrapCurves_;
     const ::grpc::internal::RpcMethod rpcmethod_SampleVolSurfaces_;
+    const ::grpc::internal::RpcMethod rpcmethod_ComputeCurveRisk_;
+    const ::grpc::internal::RpcMethod rpcmethod_BootstrapCurvesStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_SampleVolSurfacesStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_BondYieldAnalytics_;
+    const ::grpc::internal::RpcMethod rpcmethod_UpsertTrades_;
+    const ::grpc::internal::RpcMethod rpcmethod_DeleteTrades_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
   
@@ -229,6 +355,12 @@ class QuantraServer final {
     virtual ::grpc::Status PriceCDS(::grpc::ServerContext* context, const flatbuffers::grpc::Message<PriceCDSRequest>* request, flatbuffers::grpc::Message<PriceCDSResponse>* response);
     virtual ::grpc::Status BootstrapCurves(::grpc::ServerContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>* request, flatbuffers::grpc::Message<BootstrapCurvesResponse>* response);
     virtual ::grpc::Status SampleVolSurfaces(::grpc::ServerContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>* request, flatbuffers::grpc::Message<SampleVolSurfacesResponse>* response);
+    virtual ::grpc::Status ComputeCurveRisk(::grpc::ServerContext* context, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>* request, flatbuffers::grpc::Message<ComputeCurveRiskResponse>* response);
+    virtual ::grpc::Status DeleteTrades(::grpc::ServerContext* context, const flatbuffers::grpc::Message<DeleteTradesRequest>* request, flatbuffers::grpc::Message<DeleteTradesResponse>* response);
+    virtual ::grpc::Status UpsertTrades(::grpc::ServerContext* context, const flatbuffers::grpc::Message<UpsertTradesRequest>* request, flatbuffers::grpc::Message<UpsertTradesResponse>* response);
+    virtual ::grpc::Status BondYieldAnalytics(::grpc::ServerContext* context, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>* request, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>* response);
+    virtual ::grpc::Status BootstrapCurvesStream(::grpc::ServerContext* context, const flatbuffers::grpc::Message<BootstrapCurvesRequest>* request, ::grpc::ServerWriter< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* writer);
+    virtual ::grpc::Status SampleVolSurfacesStream(::grpc::ServerContext* context, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>* request, ::grpc::ServerWriter< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_PriceFixedRateBond : public BaseClass {
@@ -410,7 +542,127 @@ class QuantraServer final {
       ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef   WithAsyncMethod_PriceFixedRateBond<  WithAsyncMethod_PriceFloatingRateBond<  WithAsyncMethod_PriceVanillaSwap<  WithAsyncMethod_PriceFRA<  WithAsyncMethod_PriceCapFloor<  WithAsyncMethod_PriceSwaption<  WithAsyncMethod_PriceCDS<  WithAsyncMethod_BootstrapCurves<  WithAsyncMethod_SampleVolSurfaces<  Service   >   >   >   >   >   >   >   >   >   AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_ComputeCurveRisk : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithAsyncMethod_ComputeCurveRisk() {
+      ::grpc::Service::MarkMethodAsync(9);
+    }
+    ~WithAsyncMethod_ComputeCurveRisk() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ComputeCurveRisk(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>* /*request*/, flatbuffers::grpc::Message<ComputeCurveRiskResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestComputeCurveRisk(::grpc::ServerContext* context, flatbuffers::grpc::Message<ComputeCurveRiskRequest>* request, ::grpc::ServerAsyncResponseWriter< flatbuffers::grpc::Message<ComputeCurveRiskResponse>>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_BootstrapCurvesStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithAsyncMethod_BootstrapCurvesStream() {
+      ::grpc::Service::MarkMethodAsync(10);
+    }
+    ~WithAsyncMethod_BootstrapCurvesStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BootstrapCurvesStream(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<BootstrapCurvesRequest>* /*request*/, ::grpc::ServerWriter< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* /*writer*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestBootstrapCurvesStream(::grpc::ServerContext* context, flatbuffers::grpc::Message<BootstrapCurvesRequest>* request, ::grpc::ServerAsyncWriter< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(10, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SampleVolSurfacesStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithAsyncMethod_SampleVolSurfacesStream() {
+      ::grpc::Service::MarkMethodAsync(11);
+    }
+    ~WithAsyncMethod_SampleVolSurfacesStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SampleVolSurfacesStream(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>* /*request*/, ::grpc::ServerWriter< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* /*writer*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSampleVolSurfacesStream(::grpc::ServerContext* context, flatbuffers::grpc::Message<SampleVolSurfacesRequest>* request, ::grpc::ServerAsyncWriter< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(11, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_BondYieldAnalytics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithAsyncMethod_BondYieldAnalytics() {
+      ::grpc::Service::MarkMethodAsync(12);
+    }
+    ~WithAsyncMethod_BondYieldAnalytics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BondYieldAnalytics(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>* /*request*/, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestBondYieldAnalytics(::grpc::ServerContext* context, flatbuffers::grpc::Message<BondYieldAnalyticsRequest>* request, ::grpc::ServerAsyncResponseWriter< flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_UpsertTrades : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithAsyncMethod_UpsertTrades() {
+      ::grpc::Service::MarkMethodAsync(13);
+    }
+    ~WithAsyncMethod_UpsertTrades() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UpsertTrades(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<UpsertTradesRequest>* /*request*/, flatbuffers::grpc::Message<UpsertTradesResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestUpsertTrades(::grpc::ServerContext* context, flatbuffers::grpc::Message<UpsertTradesRequest>* request, ::grpc::ServerAsyncResponseWriter< flatbuffers::grpc::Message<UpsertTradesResponse>>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_DeleteTrades : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithAsyncMethod_DeleteTrades() {
+      ::grpc::Service::MarkMethodAsync(14);
+    }
+    ~WithAsyncMethod_DeleteTrades() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeleteTrades(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<DeleteTradesRequest>* /*request*/, flatbuffers::grpc::Message<DeleteTradesResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestDeleteTrades(::grpc::ServerContext* context, flatbuffers::grpc::Message<DeleteTradesRequest>* request, ::grpc::ServerAsyncResponseWriter< flatbuffers::grpc::Message<DeleteTradesResponse>>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef   WithAsyncMethod_PriceFixedRateBond<  WithAsyncMethod_PriceFloatingRateBond<  WithAsyncMethod_PriceVanillaSwap<  WithAsyncMethod_PriceFRA<  WithAsyncMethod_PriceCapFloor<  WithAsyncMethod_PriceSwaption<  WithAsyncMethod_PriceCDS<  WithAsyncMethod_BootstrapCurves<  WithAsyncMethod_SampleVolSurfaces<  WithAsyncMethod_ComputeCurveRisk<  WithAsyncMethod_BootstrapCurvesStream<  WithAsyncMethod_SampleVolSurfacesStream<  WithAsyncMethod_BondYieldAnalytics<  WithAsyncMethod_UpsertTrades<  WithAsyncMethod_DeleteTrades<  Service   >   >   >   >   >   >   >   >   >   >   >   >   >   >   >   AsyncService;
   template <class BaseClass>
   class WithGenericMethod_PriceFixedRateBond : public BaseClass {
    private:
@@ -565,6 +817,108 @@ class QuantraServer final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ComputeCurveRisk : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithGenericMethod_ComputeCurveRisk() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_ComputeCurveRisk() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ComputeCurveRisk(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>* /*request*/, flatbuffers::grpc::Message<ComputeCurveRiskResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_BootstrapCurvesStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithGenericMethod_BootstrapCurvesStream() {
+      ::grpc::Service::MarkMethodGeneric(10);
+    }
+    ~WithGenericMethod_BootstrapCurvesStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BootstrapCurvesStream(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<BootstrapCurvesRequest>* /*request*/, ::grpc::ServerWriter< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* /*writer*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SampleVolSurfacesStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithGenericMethod_SampleVolSurfacesStream() {
+      ::grpc::Service::MarkMethodGeneric(11);
+    }
+    ~WithGenericMethod_SampleVolSurfacesStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SampleVolSurfacesStream(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>* /*request*/, ::grpc::ServerWriter< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* /*writer*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_BondYieldAnalytics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithGenericMethod_BondYieldAnalytics() {
+      ::grpc::Service::MarkMethodGeneric(12);
+    }
+    ~WithGenericMethod_BondYieldAnalytics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status BondYieldAnalytics(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>* /*request*/, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_UpsertTrades : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithGenericMethod_UpsertTrades() {
+      ::grpc::Service::MarkMethodGeneric(13);
+    }
+    ~WithGenericMethod_UpsertTrades() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status UpsertTrades(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<UpsertTradesRequest>* /*request*/, flatbuffers::grpc::Message<UpsertTradesResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_DeleteTrades : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithGenericMethod_DeleteTrades() {
+      ::grpc::Service::MarkMethodGeneric(14);
+    }
+    ~WithGenericMethod_DeleteTrades() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status DeleteTrades(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<DeleteTradesRequest>* /*request*/, flatbuffers::grpc::Message<DeleteTradesResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_PriceFixedRateBond : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
@@ -744,9 +1098,129 @@ class QuantraServer final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedSampleVolSurfaces(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< flatbuffers::grpc::Message<SampleVolSurfacesRequest>,flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* server_unary_streamer) = 0;
   };
-  typedef   WithStreamedUnaryMethod_PriceFixedRateBond<  WithStreamedUnaryMethod_PriceFloatingRateBond<  WithStreamedUnaryMethod_PriceVanillaSwap<  WithStreamedUnaryMethod_PriceFRA<  WithStreamedUnaryMethod_PriceCapFloor<  WithStreamedUnaryMethod_PriceSwaption<  WithStreamedUnaryMethod_PriceCDS<  WithStreamedUnaryMethod_BootstrapCurves<  WithStreamedUnaryMethod_SampleVolSurfaces<  Service   >   >   >   >   >   >   >   >   >   StreamedUnaryService;
-  typedef   Service   SplitStreamedService;
-  typedef   WithStreamedUnaryMethod_PriceFixedRateBond<  WithStreamedUnaryMethod_PriceFloatingRateBond<  WithStreamedUnaryMethod_PriceVanillaSwap<  WithStreamedUnaryMethod_PriceFRA<  WithStreamedUnaryMethod_PriceCapFloor<  WithStreamedUnaryMethod_PriceSwaption<  WithStreamedUnaryMethod_PriceCDS<  WithStreamedUnaryMethod_BootstrapCurves<  WithStreamedUnaryMethod_SampleVolSurfaces<  Service   >   >   >   >   >   >   >   >   >   StreamedService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_ComputeCurveRisk : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ComputeCurveRisk() {
+      ::grpc::Service::MarkMethodStreamed(9,
+        new ::grpc::internal::StreamedUnaryHandler< flatbuffers::grpc::Message<ComputeCurveRiskRequest>, flatbuffers::grpc::Message<ComputeCurveRiskResponse>>(std::bind(&WithStreamedUnaryMethod_ComputeCurveRisk<BaseClass>::StreamedComputeCurveRisk, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithStreamedUnaryMethod_ComputeCurveRisk() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ComputeCurveRisk(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<ComputeCurveRiskRequest>* /*request*/, flatbuffers::grpc::Message<ComputeCurveRiskResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedComputeCurveRisk(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< flatbuffers::grpc::Message<ComputeCurveRiskRequest>,flatbuffers::grpc::Message<ComputeCurveRiskResponse>>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_BondYieldAnalytics : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithStreamedUnaryMethod_BondYieldAnalytics() {
+      ::grpc::Service::MarkMethodStreamed(12,
+        new ::grpc::internal::StreamedUnaryHandler< flatbuffers::grpc::Message<BondYieldAnalyticsRequest>, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>(std::bind(&WithStreamedUnaryMethod_BondYieldAnalytics<BaseClass>::StreamedBondYieldAnalytics, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithStreamedUnaryMethod_BondYieldAnalytics() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status BondYieldAnalytics(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<BondYieldAnalyticsRequest>* /*request*/, flatbuffers::grpc::Message<BondYieldAnalyticsResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedBondYieldAnalytics(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< flatbuffers::grpc::Message<BondYieldAnalyticsRequest>,flatbuffers::grpc::Message<BondYieldAnalyticsResponse>>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_UpsertTrades : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithStreamedUnaryMethod_UpsertTrades() {
+      ::grpc::Service::MarkMethodStreamed(13,
+        new ::grpc::internal::StreamedUnaryHandler< flatbuffers::grpc::Message<UpsertTradesRequest>, flatbuffers::grpc::Message<UpsertTradesResponse>>(std::bind(&WithStreamedUnaryMethod_UpsertTrades<BaseClass>::StreamedUpsertTrades, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithStreamedUnaryMethod_UpsertTrades() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status UpsertTrades(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<UpsertTradesRequest>* /*request*/, flatbuffers::grpc::Message<UpsertTradesResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedUpsertTrades(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< flatbuffers::grpc::Message<UpsertTradesRequest>,flatbuffers::grpc::Message<UpsertTradesResponse>>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_DeleteTrades : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithStreamedUnaryMethod_DeleteTrades() {
+      ::grpc::Service::MarkMethodStreamed(14,
+        new ::grpc::internal::StreamedUnaryHandler< flatbuffers::grpc::Message<DeleteTradesRequest>, flatbuffers::grpc::Message<DeleteTradesResponse>>(std::bind(&WithStreamedUnaryMethod_DeleteTrades<BaseClass>::StreamedDeleteTrades, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithStreamedUnaryMethod_DeleteTrades() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status DeleteTrades(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<DeleteTradesRequest>* /*request*/, flatbuffers::grpc::Message<DeleteTradesResponse>* /*response*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedDeleteTrades(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< flatbuffers::grpc::Message<DeleteTradesRequest>,flatbuffers::grpc::Message<DeleteTradesResponse>>* server_unary_streamer) = 0;
+  };
+  typedef   WithStreamedUnaryMethod_PriceFixedRateBond<  WithStreamedUnaryMethod_PriceFloatingRateBond<  WithStreamedUnaryMethod_PriceVanillaSwap<  WithStreamedUnaryMethod_PriceFRA<  WithStreamedUnaryMethod_PriceCapFloor<  WithStreamedUnaryMethod_PriceSwaption<  WithStreamedUnaryMethod_PriceCDS<  WithStreamedUnaryMethod_BootstrapCurves<  WithStreamedUnaryMethod_SampleVolSurfaces<  WithStreamedUnaryMethod_ComputeCurveRisk<  WithStreamedUnaryMethod_BondYieldAnalytics<  WithStreamedUnaryMethod_UpsertTrades<  WithStreamedUnaryMethod_DeleteTrades<  Service   >   >   >   >   >   >   >   >   >   >   >   >   >   StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_BootstrapCurvesStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithSplitStreamingMethod_BootstrapCurvesStream() {
+      ::grpc::Service::MarkMethodStreamed(10,
+        new ::grpc::internal::SplitServerStreamingHandler< flatbuffers::grpc::Message<BootstrapCurvesRequest>, flatbuffers::grpc::Message<BootstrapCurvesResponse>>(std::bind(&WithSplitStreamingMethod_BootstrapCurvesStream<BaseClass>::StreamedBootstrapCurvesStream, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithSplitStreamingMethod_BootstrapCurvesStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status BootstrapCurvesStream(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<BootstrapCurvesRequest>* /*request*/, ::grpc::ServerWriter< flatbuffers::grpc::Message<BootstrapCurvesResponse>>* /*writer*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedBootstrapCurvesStream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< flatbuffers::grpc::Message<BootstrapCurvesRequest>,flatbuffers::grpc::Message<BootstrapCurvesResponse>>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SampleVolSurfacesStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service */*service*/) {}
+   public:
+    WithSplitStreamingMethod_SampleVolSurfacesStream() {
+      ::grpc::Service::MarkMethodStreamed(11,
+        new ::grpc::internal::SplitServerStreamingHandler< flatbuffers::grpc::Message<SampleVolSurfacesRequest>, flatbuffers::grpc::Message<SampleVolSurfacesResponse>>(std::bind(&WithSplitStreamingMethod_SampleVolSurfacesStream<BaseClass>::StreamedSampleVolSurfacesStream, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithSplitStreamingMethod_SampleVolSurfacesStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SampleVolSurfacesStream(::grpc::ServerContext* /*context*/, const flatbuffers::grpc::Message<SampleVolSurfacesRequest>* /*request*/, ::grpc::ServerWriter< flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* /*writer*/) final override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSampleVolSurfacesStream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< flatbuffers::grpc::Message<SampleVolSurfacesRequest>,flatbuffers::grpc::Message<SampleVolSurfacesResponse>>* server_split_streamer) = 0;
+  };
+  typedef   WithSplitStreamingMethod_BootstrapCurvesStream<  WithSplitStreamingMethod_SampleVolSurfacesStream<  Service   >   >   SplitStreamedService;
+  typedef   WithStreamedUnaryMethod_PriceFixedRateBond<  WithStreamedUnaryMethod_PriceFloatingRateBond<  WithStreamedUnaryMethod_PriceVanillaSwap<  WithStreamedUnaryMethod_PriceFRA<  WithStreamedUnaryMethod_PriceCapFloor<  WithStreamedUnaryMethod_PriceSwaption<  WithStreamedUnaryMethod_PriceCDS<  WithStreamedUnaryMethod_BootstrapCurves<  WithStreamedUnaryMethod_SampleVolSurfaces<  WithStreamedUnaryMethod_ComputeCurveRisk<  WithSplitStreamingMethod_BootstrapCurvesStream<  WithSplitStreamingMethod_SampleVolSurfacesStream<  WithStreamedUnaryMethod_BondYieldAnalytics<  WithStreamedUnaryMethod_UpsertTrades<  WithStreamedUnaryMethod_DeleteTrades<  Service   >   >   >   >   >   >   >   >   >   >   >   >   >   >   >   StreamedService;
 };
 
 }  // namespace quantra
@@ -13,10 +13,16 @@ static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
               FLATBUFFERS_VERSION_REVISION == 23,
              "Non-compatible flatbuffers version included");
 
+#include "bond_yield_analytics_request_generated.h"
+#include "bond_yield_analytics_response_generated.h"
 #include "bootstrap_curves_request_generated.h"
 #include "bootstrap_curves_response_generated.h"
 #include "cap_floor_response_generated.h"
 #include "cds_response_generated.h"
+#include "curve_risk_request_generated.h"
+#include "curve_risk_response_generated.h"
+#include "delete_trades_request_generated.h"
+#include "delete_trades_response_generated.h"
 #include "fixed_rate_bond_response_generated.h"
 #include "floating_rate_bond_response_generated.h"
 #include "fra_response_generated.h"
@@ -30,6 +36,8 @@ static_assert(FLATBUFFERS_VERSION_MAJOR == 24 &&
 #include "sample_vol_surfaces_request_generated.h"
 #include "sample_vol_surfaces_response_generated.h"
 #include "swaption_response_generated.h"
+#include "upsert_trades_request_generated.h"
+#include "upsert_trades_response_generated.h"
 #include "vanilla_swap_response_generated.h"
 
 #endif  // FLATBUFFERS_GENERATED_QUANTRASERVER_QUANTRA_H_
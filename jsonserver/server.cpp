@@ -113,6 +113,30 @@ int main(int argc, char** argv) {
             auto r = client.SampleVolSurfacesJSON(req.body);
             return crow::response(r.status_code, r.body);
         });
+
+        CROW_ROUTE(app, "/compute-curve-risk").methods("POST"_method)
+        ([&](const crow::request& req) {
+            auto r = client.ComputeCurveRiskJSON(req.body);
+            return crow::response(r.status_code, r.body);
+        });
+
+        CROW_ROUTE(app, "/bond-yield-analytics").methods("POST"_method)
+        ([&](const crow::request& req) {
+            auto r = client.BondYieldAnalyticsJSON(req.body);
+            return crow::response(r.status_code, r.body);
+        });
+
+        CROW_ROUTE(app, "/upsert-trades").methods("POST"_method)
+        ([&](const crow::request& req) {
+            auto r = client.UpsertTradesJSON(req.body);
+            return crow::response(r.status_code, r.body);
+        });
+
+        CROW_ROUTE(app, "/delete-trades").methods("POST"_method)
+        ([&](const crow::request& req) {
+            auto r = client.DeleteTradesJSON(req.body);
+            return crow::response(r.status_code, r.body);
+        });
         
         // Print endpoints
         std::cout << "Endpoints:\n"
@@ -125,6 +149,10 @@ int main(int argc, char** argv) {
                   << "  POST /price-cds\n"
                   << "  POST /bootstrap-curves\n"
                   << "  POST /sample-vol-surfaces\n"
+                  << "  POST /compute-curve-risk\n"
+                  << "  POST /bond-yield-analytics\n"
+                  << "  POST /upsert-trades\n"
+                  << "  POST /delete-trades\n"
                   << "  GET  /health\n\n"
                   << "Starting server...\n";
         
@@ -0,0 +1,200 @@
+#include "business_day_calendar.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace QuantLib;
+
+namespace quantra {
+
+/// Business days of one calendar over [origin, origin + size).
+struct BusinessDayBitmap {
+    Date::serial_type origin = 0;
+    Date::serial_type size = 0;
+    std::vector<std::uint64_t> words;           // bit i of word w: day origin + 64w + i
+    std::vector<Date::serial_type> rankBefore;  // business days before each word
+    std::vector<Date::serial_type> days;        // business days, ascending
+
+    bool covers(Date::serial_type s) const { return s >= origin && s < origin + size; }
+
+    bool test(Date::serial_type s) const {
+        const Date::serial_type i = s - origin;
+        return (words[i >> 6] >> (i & 63)) & 1u;
+    }
+
+    /// Business days in [origin, s), for s in [origin, origin + size].
+    Date::serial_type rank(Date::serial_type s) const {
+        const Date::serial_type i = s - origin;
+        const std::uint64_t below = words[i >> 6] & ((std::uint64_t(1) << (i & 63)) - 1);
+        return rankBefore[i >> 6] + static_cast<Date::serial_type>(std::bitset<64>(below).count());
+    }
+
+    /// The k-th business day of the table, if there is one.
+    bool select(Date::serial_type k, Date& out) const {
+        if (k < 0 || k >= static_cast<Date::serial_type>(days.size())) return false;
+        out = Date(days[k]);
+        return true;
+    }
+
+    bool nextOnOrAfter(Date::serial_type s, Date& out) const {
+        return covers(s) && select(rank(s), out);
+    }
+
+    bool previousOnOrBefore(Date::serial_type s, Date& out) const {
+        return covers(s) && select(rank(s + 1) - 1, out);
+    }
+
+    /// Calendar::advance(d, n, Days) for n != 0.
+    bool shift(Date::serial_type s, Integer n, Date& out) const {
+        if (!covers(s)) return false;
+        return select(n > 0 ? rank(s + 1) + n - 1 : rank(s) + n, out);
+    }
+
+    /// Calendar::adjust(d, c); false when it needs dates outside the table.
+    bool adjust(const Date& d, BusinessDayConvention c, Date& out) const {
+        const Date::serial_type s = d.serialNumber();
+        switch (c) {
+        case Unadjusted:
+            if (!covers(s)) return false;
+            out = d;
+            return true;
+        case Following:
+        case ModifiedFollowing:
+        case HalfMonthModifiedFollowing: {
+            Date next;
+            if (!nextOnOrAfter(s, next)) return false;
+            if (c != Following) {
+                if (next.month() != d.month()) return previousOnOrBefore(s, out);
+                if (c == HalfMonthModifiedFollowing && d.dayOfMonth() <= 15 && next.dayOfMonth() > 15)
+                    return previousOnOrBefore(s, out);
+            }
+            out = next;
+            return true;
+        }
+        case Preceding:
+        case ModifiedPreceding: {
+            Date previous;
+            if (!previousOnOrBefore(s, previous)) return false;
+            if (c == ModifiedPreceding && previous.month() != d.month()) return nextOnOrAfter(s, out);
+            out = previous;
+            return true;
+        }
+        case Nearest: {
+            // Ties go forward, as QuantLib tests the later date first
+            Date next, previous;
+            if (!nextOnOrAfter(s, next) || !previousOnOrBefore(s, previous)) return false;
+            out = (next - d <= d - previous) ? next : previous;
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+};
+
+namespace {
+
+bool bitmapEnabled() {
+    static const bool enabled = [] {
+        const char* env = std::getenv("QUANTRA_CALENDAR_BITMAP");
+        return !(env && std::string(env) == "0");
+    }();
+    return enabled;
+}
+
+Year horizonYear(const char* name, Year fallback) {
+    const char* env = std::getenv(name);
+    Year year = env ? std::atoi(env) : fallback;
+    return std::min<Year>(std::max<Year>(year, 1901), 2199);
+}
+
+std::shared_ptr<const BusinessDayBitmap> buildBitmap(const Calendar& calendar) {
+    static const Year startYear = horizonYear("QUANTRA_CALENDAR_BITMAP_START_YEAR", 1990);
+    static const Year endYear = horizonYear("QUANTRA_CALENDAR_BITMAP_END_YEAR", 2100);
+    if (endYear < startYear) return nullptr;
+
+    auto bitmap = std::make_shared<BusinessDayBitmap>();
+    const Date first(1, January, startYear);
+    const Date last(31, December, endYear);
+    bitmap->origin = first.serialNumber();
+    bitmap->size = last - first + 1;
+
+    // One spare word so rank(origin + size) stays in range
+    const size_t nWords = static_cast<size_t>(bitmap->size >> 6) + 1;
+    bitmap->words.assign(nWords, 0);
+    bitmap->rankBefore.assign(nWords, 0);
+    for (Date::serial_type i = 0; i < bitmap->size; i++) {
+        const Date::serial_type s = bitmap->origin + i;
+        if (calendar.isBusinessDay(Date(s))) {
+            bitmap->words[i >> 6] |= std::uint64_t(1) << (i & 63);
+            bitmap->days.push_back(s);
+        }
+    }
+    for (size_t w = 1; w < nWords; w++) {
+        bitmap->rankBefore[w] = bitmap->rankBefore[w - 1] +
+            static_cast<Date::serial_type>(std::bitset<64>(bitmap->words[w - 1]).count());
+    }
+    return bitmap;
+}
+
+/// Process-wide, one bitmap per calendar name.
+std::shared_ptr<const BusinessDayBitmap> bitmapFor(const Calendar& calendar) {
+    static std::mutex mutex;
+    static std::map<std::string, std::shared_ptr<const BusinessDayBitmap>> bitmaps;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = bitmaps.find(calendar.name());
+    if (it == bitmaps.end()) {
+        it = bitmaps.emplace(calendar.name(), buildBitmap(calendar)).first;
+    }
+    return it->second;
+}
+
+} // namespace
+
+BusinessDayCalendar::BusinessDayCalendar(const Calendar& calendar)
+    : calendar_(calendar) {
+    if (bitmapEnabled() && !calendar_.empty()) bitmap_ = bitmapFor(calendar_);
+}
+
+bool BusinessDayCalendar::isBusinessDay(const Date& d) const {
+    if (bitmap_ && bitmap_->covers(d.serialNumber())) return bitmap_->test(d.serialNumber());
+    return calendar_.isBusinessDay(d);
+}
+
+Date BusinessDayCalendar::adjust(const Date& d, BusinessDayConvention c) const {
+    Date out;
+    if (bitmap_ && bitmap_->adjust(d, c, out)) return out;
+    return calendar_.adjust(d, c);
+}
+
+Date BusinessDayCalendar::advance(const Date& d,
+                                  Integer n,
+                                  TimeUnit unit,
+                                  BusinessDayConvention c,
+                                  bool endOfMonth) const {
+    if (bitmap_ && bitmap_->covers(d.serialNumber())) {
+        if (n == 0) return adjust(d, c);
+        if (unit == Days) {
+            Date out;
+            if (bitmap_->shift(d.serialNumber(), n, out)) return out;
+        } else if (!endOfMonth) {
+            return adjust(d + QuantLib::Period(n, unit), c);
+        }
+    }
+    return calendar_.advance(d, n, unit, c, endOfMonth);
+}
+
+Date BusinessDayCalendar::advance(const Date& d,
+                                  const QuantLib::Period& period,
+                                  BusinessDayConvention c,
+                                  bool endOfMonth) const {
+    return advance(d, period.length(), period.units(), c, endOfMonth);
+}
+
+} // namespace quantra
@@ -0,0 +1,69 @@
+#ifndef QUANTRASERVER_BUSINESS_DAY_CALENDAR_H
+#define QUANTRASERVER_BUSINESS_DAY_CALENDAR_H
+
+#include <memory>
+
+#include <ql/time/businessdayconvention.hpp>
+#include <ql/time/calendar.hpp>
+#include <ql/time/date.hpp>
+#include <ql/time/period.hpp>
+
+namespace quantra {
+
+struct BusinessDayBitmap;
+
+/**
+ * BusinessDayCalendar - Calendar::isBusinessDay/adjust/advance through a
+ * precomputed business-day bitmap.
+ *
+ * QuantLib evaluates the holiday rules of a calendar through a virtual call
+ * for every date it looks at, so rolling a long date grid costs several rule
+ * evaluations per point. For each calendar (by name) the process builds once
+ * a packed bitmap of its business days over a fixed horizon, with per-word
+ * prefix counts and the sorted list of business days. Business-day tests,
+ * adjustments and advances by N business days are then O(1) lookups.
+ *
+ * Results are identical to the wrapped QuantLib::Calendar; any date or
+ * result outside the horizon, and end-of-month advances, go through the
+ * calendar itself. Calendars whose holidays are changed at runtime
+ * (addHoliday/removeHoliday) must not be used through this class.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_CALENDAR_BITMAP=0                Always use the QuantLib calendar
+ *   QUANTRA_CALENDAR_BITMAP_START_YEAR=<y>   First year covered (default 1990)
+ *   QUANTRA_CALENDAR_BITMAP_END_YEAR=<y>     Last year covered (default 2100)
+ */
+class BusinessDayCalendar {
+public:
+    explicit BusinessDayCalendar(const QuantLib::Calendar& calendar);
+
+    bool isBusinessDay(const QuantLib::Date& d) const;
+
+    QuantLib::Date adjust(const QuantLib::Date& d,
+                          QuantLib::BusinessDayConvention c = QuantLib::Following) const;
+
+    QuantLib::Date advance(const QuantLib::Date& d,
+                           QuantLib::Integer n,
+                           QuantLib::TimeUnit unit,
+                           QuantLib::BusinessDayConvention c = QuantLib::Following,
+                           bool endOfMonth = false) const;
+
+    QuantLib::Date advance(const QuantLib::Date& d,
+                           const QuantLib::Period& period,
+                           QuantLib::BusinessDayConvention c = QuantLib::Following,
+                           bool endOfMonth = false) const;
+
+    const QuantLib::Calendar& calendar() const { return calendar_; }
+
+    /// True when lookups go through the bitmap (the feature is enabled and
+    /// the calendar is not empty).
+    bool cached() const { return bitmap_ != nullptr; }
+
+private:
+    QuantLib::Calendar calendar_;
+    std::shared_ptr<const BusinessDayBitmap> bitmap_;
+};
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_BUSINESS_DAY_CALENDAR_H
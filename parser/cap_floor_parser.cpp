@@ -1,5 +1,7 @@
 #include "cap_floor_parser.h"
 #include <ql/cashflows/couponpricer.hpp>
+#include "instrument_cache.h"
+#include "instrument_cache_key.h"
 
 std::shared_ptr<QuantLib::CapFloor> CapFloorParser::parse(
     const quantra::CapFloor *capFloor,
@@ -14,13 +16,30 @@ std::shared_ptr<QuantLib::CapFloor> CapFloorParser::parse(
     if (!capFloor->index() || !capFloor->index()->id())
         QUANTRA_ERROR("CapFloor index.id is required");
 
+    std::string indexId = capFloor->index()->id()->str();
+
+    // A cached cap/floor owns its forwarding handle, relinked on every hit
+    InstrumentCache& cache = InstrumentCache::instance();
+    const bool cached = use_instrument_cache_ && cache.enabled() && !forwarding_term_structure_.empty();
+    std::string key;
+    InstrumentCache::Entry entry;
+    if (cached)
+    {
+        key = InstrumentKeyBuilder::capFloor(capFloor, *indices.getIbor(indexId));
+        if (auto hit = cache.get(key))
+        {
+            hit->forwarding.linkTo(forwarding_term_structure_.currentLink());
+            return std::static_pointer_cast<QuantLib::CapFloor>(hit->instrument);
+        }
+        entry.forwarding.linkTo(forwarding_term_structure_.currentLink());
+    }
+
     // Parse schedule
     ScheduleParser scheduleParser;
     auto schedule = scheduleParser.parse(capFloor->schedule());
 
     // Resolve index from registry and clone with forwarding curve
-    std::string indexId = capFloor->index()->id()->str();
-    auto iborIndex = indices.getIborWithCurve(indexId, forwarding_term_structure_);
+    auto iborIndex = indices.getIborWithCurve(indexId, cached ? entry.forwarding : forwarding_term_structure_);
 
     // Create the floating leg (IborLeg)
     Leg leg = IborLeg(*schedule, iborIndex)
@@ -46,6 +65,12 @@ std::shared_ptr<QuantLib::CapFloor> CapFloorParser::parse(
             QUANTRA_ERROR("Invalid CapFloor type");
     }
 
+    if (cached)
+    {
+        entry.instrument = instrument;
+        cache.put(key, std::move(entry));
+    }
+
     return instrument;
 }
 
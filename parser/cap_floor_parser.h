@@ -17,6 +17,7 @@ using namespace QuantLib;
 class CapFloorParser {
 private:
     RelinkableHandle<YieldTermStructure> forwarding_term_structure_;
+    bool use_instrument_cache_ = true;
 
 public:
     std::shared_ptr<QuantLib::CapFloor> parse(
@@ -24,6 +25,10 @@ public:
         const quantra::IndexRegistry& indices);
 
     void linkForwardingTermStructure(std::shared_ptr<YieldTermStructure> term_structure);
+
+    /// Always parse a fresh instrument, for callers that keep several
+    /// instruments alive and relinked at once (see InstrumentCache).
+    void disableInstrumentCache() { use_instrument_cache_ = false; }
 };
 
 #endif // QUANTRASERVER_CAPFLOORPARSER_H
@@ -1,10 +1,21 @@
 #include "cds_parser.h"
+#include "instrument_cache.h"
+#include "instrument_cache_key.h"
 
 std::shared_ptr<QuantLib::CreditDefaultSwap> CDSParser::parse(const quantra::CDS *cds)
 {
     if (cds == NULL)
         QUANTRA_ERROR("CDS not found");
 
+    InstrumentCache& cache = InstrumentCache::instance();
+    std::string key;
+    if (cache.enabled())
+    {
+        key = InstrumentKeyBuilder::cds(cds, Settings::instance().evaluationDate());
+        if (auto hit = cache.get(key))
+            return std::static_pointer_cast<QuantLib::CreditDefaultSwap>(hit->instrument);
+    }
+
     ScheduleParser schedule_parser;
     auto schedule = schedule_parser.parse(cds->schedule());
 
@@ -63,8 +74,9 @@ std::shared_ptr<QuantLib::CreditDefaultSwap> CDSParser::parse(const quantra::CDS
         tradeDate = DateToQL(cds->trade_date()->str());
     }
 
+    std::shared_ptr<QuantLib::CreditDefaultSwap> instrument;
     if (cds->upfront() != 0.0 || (cds->upfront_date() && cds->upfront_date()->size() > 0)) {
-        return std::make_shared<QuantLib::CreditDefaultSwap>(
+        instrument = std::make_shared<QuantLib::CreditDefaultSwap>(
             side,
             cds->notional(),
             cds->upfront(),
@@ -82,24 +94,29 @@ std::shared_ptr<QuantLib::CreditDefaultSwap> CDSParser::parse(const quantra::CDS
             tradeDate,
             cds->cash_settlement_days()
         );
+    } else {
+        instrument = std::make_shared<QuantLib::CreditDefaultSwap>(
+            side,
+            cds->notional(),
+            cds->running_coupon(),
+            *schedule,
+            ConventionToQL(cds->business_day_convention()),
+            DayCounterToQL(cds->day_counter()),
+            settlesAccrual,
+            paysAtDefaultTime,
+            protectionStart,
+            nullptr,
+            lastPeriodDc,
+            rebatesAccrual,
+            tradeDate,
+            cds->cash_settlement_days()
+        );
     }
 
-    return std::make_shared<QuantLib::CreditDefaultSwap>(
-        side,
-        cds->notional(),
-        cds->running_coupon(),
-        *schedule,
-        ConventionToQL(cds->business_day_convention()),
-        DayCounterToQL(cds->day_counter()),
-        settlesAccrual,
-        paysAtDefaultTime,
-        protectionStart,
-        nullptr,
-        lastPeriodDc,
-        rebatesAccrual,
-        tradeDate,
-        cds->cash_settlement_days()
-    );
+    if (cache.enabled())
+        cache.put(key, InstrumentCache::Entry{instrument, {}});
+
+    return instrument;
 }
 
 std::shared_ptr<QuantLib::DefaultProbabilityTermStructure> CreditCurveParser::parse(
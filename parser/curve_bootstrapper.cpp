@@ -2,13 +2,18 @@
 
 #include <queue>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <functional>
 
 #include "common.h"
 #include "term_structure_parser.h"
 #include "curve_cache.h"
 #include "curve_cache_key.h"
 #include "curve_serializer.h"
+#include "worker_pool.h"
 
 namespace quantra {
 
@@ -168,6 +173,240 @@ std::vector<std::string> CurveBootstrapper::topoSort(
     return order;
 }
 
+// =============================================================================
+// Transitive dependency closure
+// =============================================================================
+
+std::unordered_set<std::string> CurveBootstrapper::dependencyClosure(
+    const std::unordered_map<std::string, std::vector<std::string>>& deps,
+    const std::unordered_set<std::string>& roots)
+{
+    std::unordered_set<std::string> seen;
+    std::vector<std::string> stack(roots.begin(), roots.end());
+
+    while (!stack.empty()) {
+        std::string id = std::move(stack.back());
+        stack.pop_back();
+        if (!seen.insert(id).second) continue;
+
+        auto it = deps.find(id);
+        if (it == deps.end()) continue;
+        for (const auto& d : it->second) {
+            if (!seen.count(d)) stack.push_back(d);
+        }
+    }
+
+    return seen;
+}
+
+// =============================================================================
+// Dependency levels (Kahn's algorithm, one frontier at a time)
+// =============================================================================
+
+std::vector<std::vector<std::string>> CurveBootstrapper::dependencyLevels(
+    const std::unordered_map<std::string, std::vector<std::string>>& deps)
+{
+    std::unordered_map<std::string, int> indeg;
+    std::unordered_map<std::string, std::vector<std::string>> adj;
+
+    for (const auto& kv : deps) {
+        indeg.try_emplace(kv.first, 0);
+        for (const auto& d : kv.second) {
+            indeg.try_emplace(d, 0);
+        }
+    }
+
+    for (const auto& kv : deps) {
+        const auto& u = kv.first;
+        for (const auto& v : kv.second) {
+            adj[v].push_back(u);
+            indeg[u] += 1;
+        }
+    }
+
+    std::vector<std::string> frontier;
+    for (const auto& kv : indeg) {
+        if (kv.second == 0) frontier.push_back(kv.first);
+    }
+
+    std::vector<std::vector<std::string>> levels;
+    size_t visited = 0;
+
+    while (!frontier.empty()) {
+        // Sorted so bootstrap/log order does not depend on hash order
+        std::sort(frontier.begin(), frontier.end());
+        visited += frontier.size();
+
+        std::vector<std::string> next;
+        for (const auto& node : frontier) {
+            for (const auto& dependent : adj[node]) {
+                if (--indeg[dependent] == 0) {
+                    next.push_back(dependent);
+                }
+            }
+        }
+
+        levels.push_back(std::move(frontier));
+        frontier = std::move(next);
+    }
+
+    if (visited != indeg.size()) {
+        QUANTRA_ERROR("Curve dependency graph has a cycle.");
+    }
+
+    return levels;
+}
+
+// =============================================================================
+// Level bootstrap
+// =============================================================================
+
+/// Worker threads used to bootstrap the curves of one dependency level:
+/// `requested`, else QUANTRA_BOOTSTRAP_THREADS (default 1 = sequential).
+/// Only honoured when QuantLib is built with the thread-safe observer
+/// pattern: forcing a curve notifies and recalculates through handles and
+/// observables other curves of the level share, which is a data race
+/// otherwise.
+static unsigned bootstrapThreads(unsigned requested) {
+#ifdef QL_ENABLE_THREAD_SAFE_OBSERVER_PATTERN
+    static const unsigned threads = [] {
+        const char* env = std::getenv("QUANTRA_BOOTSTRAP_THREADS");
+        int val = env ? std::atoi(env) : 1;
+        return val > 1 ? static_cast<unsigned>(val) : 1u;
+    }();
+    return requested ? requested : threads;
+#else
+    (void)requested;
+    return 1;
+#endif
+}
+
+/// Level workers, kept for the life of the process so requests do not
+/// start threads per level.
+static WorkerPool& bootstrapPool() {
+    static WorkerPool pool;
+    return pool;
+}
+
+/// Parse one pending curve, forcing its bootstrap if `force`. A curve the
+/// deadline catches is marked timedOut and left without a curve.
+static void bootstrapPending(
+    TermStructureParser& tsParser,
+    PendingCurve& pc,
+    const QuoteRegistry& quoteReg,
+    const CurveRegistry& curveReg,
+    const IndexRegistry& indexReg,
+    double curveBump,
+    const std::shared_ptr<const BootstrapDeadline>& deadline,
+    bool force)
+{
+    if (deadline && deadline->expired()) {
+        pc.timedOut = true;
+        return;
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    tsParser.setWarmStart(pc.seed, pc.sink);
+    tsParser.setDeadline(deadline);
+    try {
+        pc.curve = tsParser.parse(pc.ts, &quoteReg, &curveReg, &indexReg, curveBump);
+        if (force) pc.curve->maxDate();
+    } catch (const BootstrapTimeout&) {
+        pc.curve.reset();
+        pc.timedOut = true;
+        return;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    pc.bootMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+/// Force the bootstrap of a parsed pending curve (maxDate() triggers
+/// PiecewiseYieldCurve::calculate()), with the same deadline handling.
+static void forcePending(
+    PendingCurve& pc,
+    const std::shared_ptr<const BootstrapDeadline>& deadline)
+{
+    if (!pc.curve) return;
+    if (deadline && deadline->expired()) {
+        pc.curve.reset();
+        pc.timedOut = true;
+        return;
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    try {
+        pc.curve->maxDate();
+    } catch (const BootstrapTimeout&) {
+        pc.curve.reset();
+        pc.timedOut = true;
+        return;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    pc.bootMs += std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+void CurveBootstrapper::bootstrapLevel(
+    std::vector<PendingCurve>& pending,
+    unsigned threads,
+    const QuoteRegistry& quoteReg,
+    const CurveRegistry& curveReg,
+    const IndexRegistry& indexReg,
+    double curveBump,
+    const std::shared_ptr<const BootstrapDeadline>& deadline)
+{
+    TermStructureParser tsParser;
+
+    if (threads <= 1) {
+        // Lazy unless on a budget: the overrun must surface here, not while
+        // pricing.
+        for (auto& pc : pending) {
+            bootstrapPending(tsParser, pc, quoteReg, curveReg, indexReg, curveBump,
+                             deadline, deadline != nullptr);
+        }
+        return;
+    }
+
+    // Curves are built on the calling thread, so helper registration stays
+    // sequential; the workers only force the bootstraps. Every curve is
+    // forced, even on a single-curve level, so that later levels never
+    // trigger a lazy calculate() concurrently. Handles of this level are
+    // linked by the caller after every worker has finished.
+    for (auto& pc : pending) {
+        bootstrapPending(tsParser, pc, quoteReg, curveReg, indexReg, curveBump,
+                         deadline, false);
+    }
+
+    // A helper fixing today reads its index history from IndexManager, whose
+    // first lookup of a name inserts into a process-wide map that the
+    // thread-safe observer build does not lock. Looking every index up here
+    // leaves the workers only reading it.
+    indexReg.forEach([](const std::shared_ptr<QuantLib::InterestRateIndex>& index) {
+        index->timeSeries();
+    });
+
+    const size_t workers = std::min<size_t>(threads, pending.size());
+    std::atomic<size_t> next{0};
+    std::vector<std::exception_ptr> errors(pending.size());
+
+    std::function<void()> work = [&]() {
+        for (size_t i = next++; i < pending.size(); i = next++) {
+            try {
+                forcePending(pending[i], deadline);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+    if (workers > 1) {
+        bootstrapPool().run(workers - 1, work);
+    } else {
+        work();
+    }
+
+    // Report the first failure in level order, as the sequential path would.
+    for (auto& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+}
+
 // =============================================================================
 // Bootstrap all curves in dependency order
 // =============================================================================
@@ -176,7 +415,10 @@ BootstrappedCurves CurveBootstrapper::bootstrapAll(
     const flatbuffers::Vector<flatbuffers::Offset<quantra::TermStructure>>* curves,
     const flatbuffers::Vector<flatbuffers::Offset<quantra::QuoteSpec>>* quotes,
     const flatbuffers::Vector<flatbuffers::Offset<quantra::IndexDef>>* indices,
-    double curveBump
+    double curveBump,
+    const std::unordered_set<std::string>* required,
+    const QuoteRegistry* liveQuotes,
+    const BootstrapBudget* budget
 ) const {
     if (!curves || curves->size() == 0) {
         QUANTRA_ERROR("curves is required (at least one curve)");
@@ -184,7 +426,9 @@ BootstrappedCurves CurveBootstrapper::bootstrapAll(
 
     // ---- 1. Build QuoteRegistry ----
     QuoteRegistry quoteReg;
-    if (quotes) {
+    if (liveQuotes) {
+        quoteReg = *liveQuotes;  // shares the caller's SimpleQuotes
+    } else if (quotes) {
         for (flatbuffers::uoffset_t i = 0; i < quotes->size(); i++) {
             auto q = quotes->Get(i);
             if (!q->id()) QUANTRA_ERROR("QuoteSpec.id is required");
@@ -208,7 +452,33 @@ BootstrappedCurves CurveBootstrapper::bootstrapAll(
         curveIndex[ts->id()->str()] = ts;
     }
 
-    // ---- 4. Create empty handles and register them ----
+    // ---- 4. Build dependency graph ----
+    std::unordered_map<std::string, std::vector<std::string>> deps;
+    for (flatbuffers::uoffset_t i = 0; i < curves->size(); i++) {
+        collectDeps(curves->Get(i), deps);
+    }
+
+    // Restrict to the requested curves and what they depend on. Ids that are
+    // requested but not provided are left out; callers report them as missing.
+    if (required) {
+        auto needed = dependencyClosure(deps, *required);
+        for (auto it = deps.begin(); it != deps.end();) {
+            if (needed.count(it->first)) {
+                ++it;
+            } else {
+                it = deps.erase(it);
+            }
+        }
+        for (auto it = curveIndex.begin(); it != curveIndex.end();) {
+            if (needed.count(it->first)) {
+                ++it;
+            } else {
+                it = curveIndex.erase(it);
+            }
+        }
+    }
+
+    // ---- 5. Create empty handles and register them ----
     BootstrappedCurves out;
     CurveRegistry curveReg;
 
@@ -218,109 +488,162 @@ BootstrappedCurves CurveBootstrapper::bootstrapAll(
         curveReg.put(kv.first, *h);
     }
 
-    // ---- 5. Build dependency graph ----
-    std::unordered_map<std::string, std::vector<std::string>> deps;
-    for (flatbuffers::uoffset_t i = 0; i < curves->size(); i++) {
-        collectDeps(curves->Get(i), deps);
-    }
-
-    // ---- 6. Topological sort ----
-    auto order = topoSort(deps);
+    // ---- 6. Group into dependency levels ----
+    // Curves within a level only depend on curves of earlier levels.
+    auto levels = dependencyLevels(deps);
 
-    // ---- 7. Bootstrap in order (with cache) ----
-    TermStructureParser tsParser;
+    // ---- 7. Bootstrap level by level (with cache) ----
     auto& cache = CurveCache::instance();
     std::map<std::string, std::string> depKeys; // curve_id → cache_key (for dep chaining)
 
-    // Build quote/index lookup maps once (O(1) lookups during key computation)
+    // Build quote/index lookup maps once (O(1) lookups during key computation).
+    // Bumped scenarios are cached too: the bump is part of the key, and the
+    // (possibly rolled) evaluation date is the key's as-of date.
     KeyContext keyCtx;
-    bool useCache = cache.enabled() && curveBump == 0.0;
+    bool useCache = cache.enabled() && !liveQuotes;
+    std::string asOfDate;
     if (useCache) {
         keyCtx = KeyContext::build(quotes, indices);
+        std::ostringstream os;
+        os << QuantLib::io::iso_date(QuantLib::Settings::instance().evaluationDate());
+        asOfDate = os.str();
     }
 
-    for (const auto& id : order) {
-        auto it = curveIndex.find(id);
-        if (it == curveIndex.end()) {
-            if (curveReg.has(id)) continue;
-            QUANTRA_ERROR("Curve id '" + id + "' referenced in dependencies but not provided");
-        }
+    const unsigned threads = bootstrapThreads(threads_);
+    std::shared_ptr<const BootstrapDeadline> deadline =
+        budget ? budget->deadline : nullptr;
+
+    for (const auto& level : levels) {
+        // -- a. Resolve from cache; collect the curves that need a bootstrap --
+        std::vector<PendingCurve> pending;
+        for (const auto& id : level) {
+            auto it = curveIndex.find(id);
+            if (it == curveIndex.end()) {
+                if (curveReg.has(id)) continue;
+                QUANTRA_ERROR("Curve id '" + id + "' referenced in dependencies but not provided");
+            }
+
+            PendingCurve pc;
+            pc.id = id;
+            pc.ts = it->second;
+
+            if (useCache) {
+                auto t0 = std::chrono::steady_clock::now();
+
+                // Compute canonical cache key
+                // depKeys contains keys of already-resolved dependency curves
+                std::map<std::string, std::string> relevantDepKeys;
+                if (deps.count(id)) {
+                    for (const auto& depId : deps.at(id)) {
+                        if (depKeys.count(depId)) {
+                            relevantDepKeys[depId] = depKeys.at(depId);
+                        }
+                    }
+                }
 
-        const auto* ts = it->second;
+                pc.key = CurveKeyBuilder::compute(
+                    asOfDate, pc.ts, keyCtx, relevantDepKeys, curveBump);
 
-        if (useCache) {
-            auto t0 = std::chrono::steady_clock::now();
+                auto tKey = std::chrono::steady_clock::now();
+                double keyMs = std::chrono::duration<double, std::milli>(tKey - t0).count();
 
-            // Compute canonical cache key
-            // depKeys contains keys of already-resolved dependency curves
-            std::map<std::string, std::string> relevantDepKeys;
-            if (deps.count(id)) {
-                for (const auto& depId : deps.at(id)) {
-                    if (depKeys.count(depId)) {
-                        relevantDepKeys[depId] = depKeys.at(depId);
+                // --- L1 check ---
+                auto cached = cache.backend().getL1(pc.key);
+                if (cached) {
+                    cache.stats().l1_hits++;
+                    cache.logEvent(id, pc.key, "L1_HIT", keyMs);
+                    out.handles.at(id)->linkTo(cached);
+                    depKeys[id] = pc.key;
+                    continue;
+                }
+                cache.stats().l1_misses++;
+
+                // --- L2 check (future: Redis) ---
+                auto l2data = cache.backend().getL2(pc.key);
+                if (l2data.has_value()) {
+                    cache.stats().l2_hits++;
+                    auto curve = CurveSerializer::reconstruct(l2data.value());
+                    cache.backend().putL1(pc.key, curve);
+                    cache.logEvent(id, pc.key, "L2_HIT");
+                    out.handles.at(id)->linkTo(curve);
+                    depKeys[id] = pc.key;
+                    continue;
+                }
+                cache.stats().l2_misses++;
+
+                // --- Warm start from the last solve of this structure ---
+                pc.structureKey = CurveKeyBuilder::computeStructure(
+                    asOfDate, pc.ts, keyCtx, curveBump);
+                pc.depKeys = relevantDepKeys;
+                if (cache.warmStartEnabled()) {
+                    pc.sink = std::make_shared<BootstrapSeed>();
+                    auto warm = cache.getWarmStart(pc.structureKey);
+                    if (warm && warm->seed) {
+                        if (warm->depKeys == relevantDepKeys) {
+                            pc.seed = warm->seed;
+                        } else {
+                            // A dependency moved: the old nodes are guesses only
+                            auto seed = std::make_shared<BootstrapSeed>(*warm->seed);
+                            seed->reusePrefix = false;
+                            pc.seed = seed;
+                        }
+                        cache.stats().warm_starts++;
                     }
                 }
             }
 
-            std::string asOfDate;
-            auto evalDate = QuantLib::Settings::instance().evaluationDate();
-            std::ostringstream os;
-            os << QuantLib::io::iso_date(evalDate);
-            asOfDate = os.str();
-
-            std::string key = CurveKeyBuilder::compute(
-                asOfDate, ts, keyCtx, relevantDepKeys);
-
-            auto tKey = std::chrono::steady_clock::now();
-            double keyMs = std::chrono::duration<double, std::milli>(tKey - t0).count();
-
-            // --- L1 check ---
-            auto cached = cache.backend().getL1(key);
-            if (cached) {
-                cache.stats().l1_hits++;
-                cache.logEvent(id, key, "L1_HIT", keyMs);
-                out.handles.at(id)->linkTo(cached);
-                depKeys[id] = key;
-                continue;
-            }
-            cache.stats().l1_misses++;
-
-            // --- L2 check (future: Redis) ---
-            auto l2data = cache.backend().getL2(key);
-            if (l2data.has_value()) {
-                cache.stats().l2_hits++;
-                auto curve = CurveSerializer::reconstruct(l2data.value());
-                cache.backend().putL1(key, curve);
-                cache.logEvent(id, key, "L2_HIT");
-                out.handles.at(id)->linkTo(curve);
-                depKeys[id] = key;
+            pending.push_back(std::move(pc));
+        }
+
+        // -- b. Bootstrap the misses (concurrently when allowed) --
+        bootstrapLevel(pending, threads, quoteReg, curveReg, indexReg, curveBump, deadline);
+
+        // -- c. Publish: cache and link handles once the level is complete --
+        for (auto& pc : pending) {
+            if (pc.timedOut) {
+                // Out of budget: fail, or serve the last solve of this structure
+                const CurveCache::WarmStart* last = nullptr;
+                if (budget->staleFallback && !pc.structureKey.empty()) {
+                    last = cache.getWarmStart(pc.structureKey);
+                }
+                if (!last || !last->curve) {
+                    QUANTRA_ERROR("Bootstrap time budget of " + std::to_string(budget->budgetMs) +
+                        " ms exceeded at curve '" + pc.id + "'" +
+                        (budget->staleFallback
+                            ? " and no cached curve of the same structure to fall back on"
+                            : ""));
+                }
+                cache.stats().stale_served++;
+                cache.logEvent(pc.id, last->key, "STALE_FALLBACK");
+                out.handles.at(pc.id)->linkTo(last->curve);
+                out.stale.push_back(pc.id);
+                depKeys[pc.id] = last->key;
                 continue;
             }
-            cache.stats().l2_misses++;
 
-            // --- Full bootstrap (cache miss) ---
-            auto tBootStart = std::chrono::steady_clock::now();
-            auto curve = tsParser.parse(ts, &quoteReg, &curveReg, &indexReg, curveBump);
-            auto tBootEnd = std::chrono::steady_clock::now();
-            double bootMs = std::chrono::duration<double, std::milli>(tBootEnd - tBootStart).count();
+            if (useCache) {
+                cache.stats().bootstraps++;
 
-            cache.stats().bootstraps++;
+                // Store in L1
+                cache.backend().putL1(pc.key, pc.curve);
 
-            // Store in L1
-            cache.backend().putL1(key, curve);
+                // Store in L2 (serialized DFs — for future Redis)
+                auto serialized = CurveSerializer::serialize(pc.curve, pc.ts);
+                cache.backend().putL2(pc.key, serialized);
 
-            // Store in L2 (serialized DFs — for future Redis)
-            auto serialized = CurveSerializer::serialize(curve, ts);
-            cache.backend().putL2(key, serialized);
+                cache.logEvent(pc.id, pc.key,
+                    pc.seed ? "MISS_WARM_BOOTSTRAP" : "MISS_BOOTSTRAP", pc.bootMs);
+                depKeys[pc.id] = pc.key;
 
-            cache.logEvent(id, key, "MISS_BOOTSTRAP", bootMs);
-
-            out.handles.at(id)->linkTo(curve);
-            depKeys[id] = key;
-        } else {
-            // Cache disabled — original behavior
-            auto curve = tsParser.parse(ts, &quoteReg, &curveReg, &indexReg, curveBump);
-            out.handles.at(id)->linkTo(curve);
+                // Serializing forced the bootstrap, so the sink holds this
+                // solve; snapshot it as the seed for the next quote change.
+                std::shared_ptr<const BootstrapSeed> seed;
+                if (pc.sink && !pc.sink->dates.empty()) {
+                    seed = std::make_shared<const BootstrapSeed>(*pc.sink);
+                }
+                cache.putWarmStart(pc.structureKey, {seed, pc.depKeys, pc.key, pc.curve});
+            }
+            out.handles.at(pc.id)->linkTo(pc.curve);
         }
     }
 
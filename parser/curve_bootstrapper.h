@@ -1,8 +1,11 @@
 #ifndef QUANTRASERVER_CURVE_BOOTSTRAPPER_H
 #define QUANTRASERVER_CURVE_BOOTSTRAPPER_H
 
+#include <chrono>
+#include <map>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <memory>
 
@@ -16,6 +19,7 @@
 #include "curve_registry.h"
 #include "index_registry.h"
 #include "index_registry_builder.h"
+#include "warm_start_bootstrap.h"
 
 namespace quantra {
 
@@ -25,6 +29,54 @@ namespace quantra {
 struct BootstrappedCurves {
     std::unordered_map<std::string,
         std::shared_ptr<QuantLib::RelinkableHandle<QuantLib::YieldTermStructure>>> handles;
+
+    // Ids linked to a previous solve of their structure after a budget overrun
+    std::vector<std::string> stale;
+};
+
+/**
+ * Wall-clock budget for the bootstraps of one request.
+ *
+ * Once the deadline has passed, curves that still need a bootstrap are not
+ * started, and warm-started ones stop at their next solver evaluation. Such
+ * a curve fails the request, or with `staleFallback` is linked to the last
+ * cached solve of the same structure and reported in BootstrappedCurves::stale.
+ */
+struct BootstrapBudget {
+    int budgetMs = 0;
+    bool staleFallback = false;
+    std::shared_ptr<const BootstrapDeadline> deadline;
+
+    /// Budget starting now; budgetMs <= 0 means unlimited (no deadline).
+    static BootstrapBudget start(int budgetMs, bool staleFallback) {
+        BootstrapBudget b;
+        b.budgetMs = budgetMs;
+        b.staleFallback = staleFallback;
+        if (budgetMs > 0) {
+            b.deadline = std::make_shared<const BootstrapDeadline>(BootstrapDeadline{
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(budgetMs)});
+        }
+        return b;
+    }
+};
+
+/**
+ * A curve of the current dependency level that missed the cache.
+ */
+struct PendingCurve {
+    std::string id;
+    const quantra::TermStructure* ts = nullptr;
+    std::string key;
+    std::shared_ptr<QuantLib::YieldTermStructure> curve;
+    double bootMs = 0.0;
+    bool timedOut = false;  // deadline passed before the bootstrap finished
+
+    // Warm start: seed from the last solve of the same structure, and the
+    // sink this bootstrap records its own nodes into.
+    std::string structureKey;
+    std::map<std::string, std::string> depKeys;
+    std::shared_ptr<const BootstrapSeed> seed;
+    std::shared_ptr<BootstrapSeed> sink;
 };
 
 /**
@@ -32,6 +84,25 @@ struct BootstrappedCurves {
  *
  * Orchestrates multi-curve bootstrapping with dependency resolution.
  * Now accepts an IndexRegistry for resolving IndexRef in helpers.
+ *
+ * If `required` is given, only those curve ids and their transitive
+ * dependencies get handles and are bootstrapped; other specs are skipped.
+ *
+ * If `liveQuotes` is given, helpers resolve quote_id against it instead of a
+ * private copy of `quotes`, so setValue() on those quotes moves the curves.
+ * The cache is bypassed in that mode: cached curves would not observe the
+ * quotes, and curves built on them must not be shared with other requests.
+ *
+ * Curves are bootstrapped one dependency level at a time. Curves within a
+ * level are independent and may be built concurrently (see
+ * QUANTRA_BOOTSTRAP_THREADS, honoured only when QuantLib is built with the
+ * thread-safe observer pattern); their handles are linked once the level is
+ * done. With more than one thread, every bootstrap is forced before its
+ * handle is linked.
+ *
+ * If `budget` has a deadline, every bootstrap is forced within it (see
+ * BootstrapBudget); otherwise, on a single thread, curves not taken from the
+ * cache stay lazy.
  */
 class CurveBootstrapper {
 public:
@@ -39,15 +110,44 @@ public:
         const flatbuffers::Vector<flatbuffers::Offset<quantra::TermStructure>>* curves,
         const flatbuffers::Vector<flatbuffers::Offset<quantra::QuoteSpec>>* quotes = nullptr,
         const flatbuffers::Vector<flatbuffers::Offset<quantra::IndexDef>>* indices = nullptr,
-        double curveBump = 0.0
+        double curveBump = 0.0,
+        const std::unordered_set<std::string>* required = nullptr,
+        const QuoteRegistry* liveQuotes = nullptr,
+        const BootstrapBudget* budget = nullptr
     ) const;
 
+    /// Ids in `roots` plus everything they transitively depend on.
+    static std::unordered_set<std::string> dependencyClosure(
+        const std::unordered_map<std::string, std::vector<std::string>>& deps,
+        const std::unordered_set<std::string>& roots);
+
     static std::vector<std::string> topoSort(
         const std::unordered_map<std::string, std::vector<std::string>>& deps);
 
+    /// Kahn order grouped into levels; each level only depends on earlier ones.
+    static std::vector<std::vector<std::string>> dependencyLevels(
+        const std::unordered_map<std::string, std::vector<std::string>>& deps);
+
     static void collectDeps(
         const quantra::TermStructure* ts,
         std::unordered_map<std::string, std::vector<std::string>>& deps);
+
+    /// Worker threads per dependency level; 0 (default) uses
+    /// QUANTRA_BOOTSTRAP_THREADS. Ignored without the thread-safe observer
+    /// pattern.
+    void setThreads(unsigned threads) { threads_ = threads; }
+
+private:
+    unsigned threads_ = 0;
+
+    static void bootstrapLevel(
+        std::vector<PendingCurve>& pending,
+        unsigned threads,
+        const QuoteRegistry& quoteReg,
+        const CurveRegistry& curveReg,
+        const IndexRegistry& indexReg,
+        double curveBump,
+        const std::shared_ptr<const BootstrapDeadline>& deadline);
 };
 
 } // namespace quantra
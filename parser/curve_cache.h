@@ -8,13 +8,18 @@
 #include <unordered_map>
 #include <chrono>
 #include <list>
+#include <map>
 #include <iostream>
 #include <cstdlib>
 
 #include <ql/termstructures/yieldtermstructure.hpp>
 
+#include "discount_table.h"
+
 namespace quantra {
 
+struct BootstrapSeed;
+
 // =============================================================================
 // Serialized curve representation (for L2 / Redis)
 // =============================================================================
@@ -66,10 +71,16 @@ public:
         const std::string& key,
         const CachedCurveData& data) = 0;
 
+    // --- Dense discount tables of hot L1 curves ---
+    // Null when the curve is not cached or has no table.
+    virtual std::shared_ptr<const DiscountTable>
+        discountTable(const QuantLib::YieldTermStructure* curve) const = 0;
+
     // --- Management ---
     virtual void clear() = 0;
     virtual size_t sizeL1() const = 0;
     virtual size_t sizeL2() const = 0;
+    virtual size_t tableBytesL1() const = 0;
 };
 
 
@@ -77,16 +88,29 @@ public:
 // L1-only in-process LRU cache
 // =============================================================================
 
+/// When and how large the dense discount tables of hot curves are built.
+struct DiscountTableConfig {
+    bool enabled = false;
+    uint64_t minHits = 2;           // L1 hits before a curve gets a table
+    size_t maxDays = 50 * 366;      // longer curves get no table
+    size_t maxBytes = 64u << 20;    // all tables together
+};
+
 /**
  * InProcessCurveCache - LRU cache of live QuantLib YieldTermStructure objects.
  *
  * Single-threaded (no locking needed — each worker is a single-threaded process).
  * L2 methods return nullopt / no-op (ready for override by Redis backend).
+ *
+ * With tables enabled, a curve hit minHits times gets a DiscountTable. The
+ * tables count against maxBytes; making room drops the tables of the least
+ * recently used curves, which then have to become hot again.
  */
 class InProcessCurveCache : public CurveCacheBackend {
 public:
-    explicit InProcessCurveCache(size_t maxEntries = 100)
-        : maxEntries_(maxEntries) {}
+    explicit InProcessCurveCache(size_t maxEntries = 100,
+                                 DiscountTableConfig tables = DiscountTableConfig())
+        : maxEntries_(maxEntries), tables_(tables) {}
 
     std::shared_ptr<QuantLib::YieldTermStructure>
     getL1(const std::string& key) override {
@@ -95,7 +119,13 @@ public:
 
         // Move to front (most recently used)
         lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
-        return it->second.curve;
+
+        Entry& entry = it->second;
+        entry.hits++;
+        if (tables_.enabled && !entry.tableTried && entry.hits >= tables_.minHits) {
+            buildTable(entry);
+        }
+        return entry.curve;
     }
 
     void putL1(
@@ -105,7 +135,10 @@ public:
         auto it = cacheMap_.find(key);
         if (it != cacheMap_.end()) {
             // Update existing
+            dropTable(it->second);
+            byCurve_.erase(it->second.curve.get());
             it->second.curve = curve;
+            byCurve_[curve.get()] = key;
             lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
             return;
         }
@@ -113,13 +146,27 @@ public:
         // Evict if at capacity
         while (cacheMap_.size() >= maxEntries_ && !lruList_.empty()) {
             auto& evictKey = lruList_.back();
-            cacheMap_.erase(evictKey);
+            auto evictIt = cacheMap_.find(evictKey);
+            dropTable(evictIt->second);
+            byCurve_.erase(evictIt->second.curve.get());
+            cacheMap_.erase(evictIt);
             lruList_.pop_back();
         }
 
         // Insert
         lruList_.push_front(key);
-        cacheMap_[key] = { curve, lruList_.begin() };
+        Entry entry;
+        entry.curve = curve;
+        entry.lruIt = lruList_.begin();
+        cacheMap_[key] = std::move(entry);
+        byCurve_[curve.get()] = key;
+    }
+
+    std::shared_ptr<const DiscountTable>
+    discountTable(const QuantLib::YieldTermStructure* curve) const override {
+        auto byIt = byCurve_.find(curve);
+        if (byIt == byCurve_.end()) return nullptr;
+        return cacheMap_.at(byIt->second).table;
     }
 
     // L2 not implemented — return nullopt / no-op
@@ -134,20 +181,55 @@ public:
     void clear() override {
         cacheMap_.clear();
         lruList_.clear();
+        byCurve_.clear();
+        tableBytes_ = 0;
     }
 
     size_t sizeL1() const override { return cacheMap_.size(); }
     size_t sizeL2() const override { return 0; }
+    size_t tableBytesL1() const override { return tableBytes_; }
 
 private:
     struct Entry {
         std::shared_ptr<QuantLib::YieldTermStructure> curve;
         std::list<std::string>::iterator lruIt;
+        uint64_t hits = 0;
+        bool tableTried = false;
+        std::shared_ptr<const DiscountTable> table;
     };
 
+    void buildTable(Entry& entry) {
+        entry.tableTried = true;
+        auto table = DiscountTable::build(entry.curve, tables_.maxDays);
+        if (!table) return;
+        const size_t bytes = table->bytes();
+        // Would not fit even alone: keep the other tables
+        if (bytes > tables_.maxBytes) return;
+        for (auto lit = lruList_.rbegin();
+             tableBytes_ + bytes > tables_.maxBytes && lit != lruList_.rend(); ++lit) {
+            Entry& other = cacheMap_.at(*lit);
+            if (&other != &entry) dropTable(other);
+        }
+        if (tableBytes_ + bytes > tables_.maxBytes) return;
+        entry.table = std::move(table);
+        tableBytes_ += bytes;
+    }
+
+    void dropTable(Entry& entry) {
+        if (entry.table) {
+            tableBytes_ -= entry.table->bytes();
+            entry.table.reset();
+            entry.hits = 0;
+        }
+        entry.tableTried = false;
+    }
+
     size_t maxEntries_;
+    DiscountTableConfig tables_;
     std::unordered_map<std::string, Entry> cacheMap_;
     std::list<std::string> lruList_; // front = most recent
+    std::unordered_map<const QuantLib::YieldTermStructure*, std::string> byCurve_;
+    size_t tableBytes_ = 0;
 };
 
 
@@ -162,6 +244,13 @@ private:
  *   QUANTRA_CURVE_CACHE_ENABLED=1       Enable caching (default: 0)
  *   QUANTRA_CURVE_CACHE_MAX_ENTRIES=100  Max L1 entries (default: 100)
  *   QUANTRA_CURVE_CACHE_LOG=1           Log hits/misses to stdout (default: 0)
+ *   QUANTRA_CURVE_WARM_START=0          Disable warm-started re-bootstraps
+ *                                       (default: on when caching is enabled)
+ *   QUANTRA_CURVE_DF_TABLE=1            Dense daily DF tables for hot curves
+ *                                       (default: 0)
+ *   QUANTRA_CURVE_DF_TABLE_MIN_HITS=2   L1 hits before a curve gets a table
+ *   QUANTRA_CURVE_DF_TABLE_MAX_DAYS=18300  Longest curve that gets a table
+ *   QUANTRA_CURVE_DF_TABLE_MAX_MB=64    Memory for all tables together
  *
  * Future L2 config:
  *   QUANTRA_REDIS_HOST=127.0.0.1
@@ -176,7 +265,10 @@ public:
     }
 
     bool enabled() const { return enabled_; }
+    /// Overrides QUANTRA_CURVE_CACHE_ENABLED (tests).
+    void setEnabled(bool enabled) { enabled_ = enabled; }
     bool logging() const { return logging_; }
+    bool warmStartEnabled() const { return enabled_ && warmStart_; }
 
     CurveCacheBackend& backend() { return *backend_; }
 
@@ -187,6 +279,8 @@ public:
         uint64_t l2_hits = 0;
         uint64_t l2_misses = 0;
         uint64_t bootstraps = 0;
+        uint64_t warm_starts = 0;       // bootstraps seeded from a previous solve
+        uint64_t stale_served = 0;      // budget overruns served a previous solve
     };
 
     Stats& stats() { return stats_; }
@@ -194,6 +288,34 @@ public:
 
     void resetStats() { stats_ = Stats{}; }
 
+    // --- Warm starts / stale fallback ---
+    // Last solve per curve structure (CurveKeyBuilder::computeStructure): its
+    // nodes (only with warm starts on) and the dependency keys they were
+    // solved against, plus the curve itself and its cache key, which a
+    // request that runs out of bootstrap budget may be served instead.
+    struct WarmStart {
+        std::shared_ptr<const BootstrapSeed> seed;
+        std::map<std::string, std::string> depKeys;
+        std::string key;
+        std::shared_ptr<QuantLib::YieldTermStructure> curve;
+    };
+
+    const WarmStart* getWarmStart(const std::string& structureKey) const {
+        auto it = warmStarts_.find(structureKey);
+        return it == warmStarts_.end() ? nullptr : &it->second;
+    }
+
+    void putWarmStart(const std::string& structureKey, WarmStart entry) {
+        if (!warmStarts_.count(structureKey)) {
+            while (warmStarts_.size() >= maxEntries_ && !warmOrder_.empty()) {
+                warmStarts_.erase(warmOrder_.front());
+                warmOrder_.pop_front();
+            }
+            warmOrder_.push_back(structureKey);
+        }
+        warmStarts_[structureKey] = std::move(entry);
+    }
+
     void logEvent(const std::string& curveId, const std::string& key,
                   const std::string& event, double timeMs = 0.0) const {
         if (!logging_) return;
@@ -213,28 +335,82 @@ private:
         const char* envLog = std::getenv("QUANTRA_CURVE_CACHE_LOG");
         logging_ = envLog && std::string(envLog) == "1";
 
+        const char* envWarm = std::getenv("QUANTRA_CURVE_WARM_START");
+        warmStart_ = !(envWarm && std::string(envWarm) == "0");
+
         size_t maxEntries = 100;
         const char* envMax = std::getenv("QUANTRA_CURVE_CACHE_MAX_ENTRIES");
         if (envMax) {
             int val = std::atoi(envMax);
             if (val > 0) maxEntries = static_cast<size_t>(val);
         }
+        maxEntries_ = maxEntries;
+
+        DiscountTableConfig tables;
+        const char* envTable = std::getenv("QUANTRA_CURVE_DF_TABLE");
+        tables.enabled = envTable && std::string(envTable) == "1";
+        const char* envMinHits = std::getenv("QUANTRA_CURVE_DF_TABLE_MIN_HITS");
+        if (envMinHits) {
+            int val = std::atoi(envMinHits);
+            if (val > 0) tables.minHits = static_cast<uint64_t>(val);
+        }
+        const char* envMaxDays = std::getenv("QUANTRA_CURVE_DF_TABLE_MAX_DAYS");
+        if (envMaxDays) {
+            int val = std::atoi(envMaxDays);
+            if (val > 0) tables.maxDays = static_cast<size_t>(val);
+        }
+        const char* envMaxMb = std::getenv("QUANTRA_CURVE_DF_TABLE_MAX_MB");
+        if (envMaxMb) {
+            int val = std::atoi(envMaxMb);
+            if (val >= 0) tables.maxBytes = static_cast<size_t>(val) << 20;
+        }
 
         // For now, always create InProcessCurveCache.
         // When Redis is added, check QUANTRA_REDIS_HOST and create
         // a layered backend instead.
-        backend_ = std::make_unique<InProcessCurveCache>(maxEntries);
+        backend_ = std::make_unique<InProcessCurveCache>(maxEntries, tables);
 
         if (enabled_) {
             std::cout << "[CurveCache] Enabled. L1 max_entries=" << maxEntries
-                      << " logging=" << (logging_ ? "on" : "off") << std::endl;
+                      << " logging=" << (logging_ ? "on" : "off")
+                      << " warm_start=" << (warmStart_ ? "on" : "off")
+                      << " df_tables=" << (tables.enabled ? "on" : "off") << std::endl;
         }
     }
 
     bool enabled_ = false;
     bool logging_ = false;
+    bool warmStart_ = true;
+    size_t maxEntries_ = 100;
     std::unique_ptr<CurveCacheBackend> backend_;
     Stats stats_;
+    std::unordered_map<std::string, WarmStart> warmStarts_;
+    std::list<std::string> warmOrder_;   // insertion order, for eviction
+};
+
+/**
+ * CachedDiscounts - curve->discount(d), read from the curve's dense
+ * DiscountTable when the cache holds one for it and d is inside it.
+ * Look the table up once per curve, then call per cash flow.
+ */
+class CachedDiscounts {
+public:
+    explicit CachedDiscounts(std::shared_ptr<QuantLib::YieldTermStructure> curve)
+        : curve_(std::move(curve)) {
+        if (curve_ && CurveCache::instance().enabled()) {
+            table_ = CurveCache::instance().backend().discountTable(curve_.get());
+            if (table_ && table_->referenceDate() != curve_->referenceDate()) table_.reset();
+        }
+    }
+
+    double operator()(const QuantLib::Date& d) const {
+        if (table_ && table_->covers(d)) return table_->discount(d);
+        return curve_->discount(d);
+    }
+
+private:
+    std::shared_ptr<QuantLib::YieldTermStructure> curve_;
+    std::shared_ptr<const DiscountTable> table_;
 };
 
 } // namespace quantra
@@ -30,8 +30,10 @@ std::string CurveKeyBuilder::sha256hex(const std::vector<uint8_t>& data) {
 double CurveKeyBuilder::resolveQuoteValue(
     double inlineValue,
     const flatbuffers::String* quoteId,
-    const KeyContext& ctx)
+    const KeyContext& ctx,
+    bool withQuotes)
 {
+    if (!withQuotes) return 0.0;
     if (quoteId) {
         std::string id = quoteId->str();
         if (!id.empty()) {
@@ -119,7 +121,8 @@ void CurveKeyBuilder::writeSchedule(
 
 std::vector<uint8_t> CurveKeyBuilder::serializePoint(
     const quantra::PointsWrapper* pw,
-    const KeyContext& ctx)
+    const KeyContext& ctx,
+    bool withQuotes)
 {
     CanonicalBuffer buf;
 
@@ -130,7 +133,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
 
     case quantra::Point_DepositHelper: {
         auto p = pw->point_as_DepositHelper();
-        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx, withQuotes));
         buf.writeI32(p->tenor() ? p->tenor()->n() : 0);
         buf.writeU8(static_cast<uint8_t>(p->tenor() ? p->tenor()->unit() : quantra::enums::TimeUnit_Days));
         buf.writeI32(p->fixing_days());
@@ -142,7 +145,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
 
     case quantra::Point_FRAHelper: {
         auto p = pw->point_as_FRAHelper();
-        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx, withQuotes));
         buf.writeI32(p->months_to_start());
         buf.writeI32(p->months_to_end());
         buf.writeI32(p->fixing_days());
@@ -159,7 +162,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
             rateValue = 1.0 - (p->futures_price() / 100.0);
         }
         rateValue += p->convexity_adjustment();
-        buf.writeDouble(resolveQuoteValue(rateValue, p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(rateValue, p->quote_id(), ctx, withQuotes));
         buf.writeFbString(p->future_start_date());
         buf.writeI32(p->future_months());
         buf.writeU8(static_cast<uint8_t>(p->calendar()));
@@ -172,7 +175,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
 
     case quantra::Point_SwapHelper: {
         auto p = pw->point_as_SwapHelper();
-        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx, withQuotes));
         buf.writeI32(p->tenor() ? p->tenor()->n() : 0);
         buf.writeU8(static_cast<uint8_t>(p->tenor() ? p->tenor()->unit() : quantra::enums::TimeUnit_Days));
         buf.writeU8(static_cast<uint8_t>(p->calendar()));
@@ -190,7 +193,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
         auto p = pw->point_as_BondHelper();
         double px = p->price();
         if (px == 0.0) px = p->rate();
-        buf.writeDouble(resolveQuoteValue(px, p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(px, p->quote_id(), ctx, withQuotes));
         buf.writeI32(p->settlement_days());
         buf.writeDouble(p->face_amount());
         writeSchedule(buf, p->schedule());
@@ -204,7 +207,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
 
     case quantra::Point_OISHelper: {
         auto p = pw->point_as_OISHelper();
-        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx, withQuotes));
         buf.writeI32(p->tenor() ? p->tenor()->n() : 0);
         buf.writeU8(static_cast<uint8_t>(p->tenor() ? p->tenor()->unit() : quantra::enums::TimeUnit_Days));
         writeIndexRef(buf, p->overnight_index());
@@ -219,7 +222,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
 
     case quantra::Point_DatedOISHelper: {
         auto p = pw->point_as_DatedOISHelper();
-        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(p->rate(), p->quote_id(), ctx, withQuotes));
         buf.writeFbString(p->start_date());
         buf.writeFbString(p->end_date());
         writeIndexRef(buf, p->overnight_index());
@@ -246,7 +249,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
 
     case quantra::Point_TenorBasisSwapHelper: {
         auto p = pw->point_as_TenorBasisSwapHelper();
-        buf.writeDouble(resolveQuoteValue(p->spread(), p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(p->spread(), p->quote_id(), ctx, withQuotes));
         buf.writeI32(p->tenor() ? p->tenor()->n() : 0);
         buf.writeU8(static_cast<uint8_t>(p->tenor() ? p->tenor()->unit() : quantra::enums::TimeUnit_Days));
         writeIndexRef(buf, p->index_short());
@@ -258,7 +261,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
 
     case quantra::Point_FxSwapHelper: {
         auto p = pw->point_as_FxSwapHelper();
-        buf.writeDouble(resolveQuoteValue(p->fx_points(), p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(p->fx_points(), p->quote_id(), ctx, withQuotes));
         buf.writeI32(p->tenor() ? p->tenor()->n() : 0);
         buf.writeU8(static_cast<uint8_t>(p->tenor() ? p->tenor()->unit() : quantra::enums::TimeUnit_Days));
         buf.writeI32(p->spot_days());
@@ -270,7 +273,7 @@ std::vector<uint8_t> CurveKeyBuilder::serializePoint(
 
     case quantra::Point_CrossCcyBasisHelper: {
         auto p = pw->point_as_CrossCcyBasisHelper();
-        buf.writeDouble(resolveQuoteValue(p->spread(), p->quote_id(), ctx));
+        buf.writeDouble(resolveQuoteValue(p->spread(), p->quote_id(), ctx, withQuotes));
         buf.writeI32(p->tenor() ? p->tenor()->n() : 0);
         buf.writeU8(static_cast<uint8_t>(p->tenor() ? p->tenor()->unit() : quantra::enums::TimeUnit_Days));
         writeIndexRef(buf, p->index_domestic());
@@ -395,34 +398,34 @@ void CurveKeyBuilder::writeCurveHeader(
     buf.writeU8(static_cast<uint8_t>(ts->interpolator()));
     buf.writeU8(static_cast<uint8_t>(ts->bootstrap_trait()));
     buf.writeFbString(ts->reference_date());
+
+    // Solver settings. Only written when non-default so existing keys for
+    // Exact / uncapped curves are unchanged.
+    if (ts->bootstrap_accuracy() != quantra::enums::BootstrapAccuracy_Exact ||
+        ts->bootstrap_max_iterations() != 0) {
+        buf.writeTag("ACC");
+        buf.writeU8(static_cast<uint8_t>(ts->bootstrap_accuracy()));
+        buf.writeI32(ts->bootstrap_max_iterations());
+    }
 }
 
 // =============================================================================
-// Main compute
+// Helpers (order-independent)
 // =============================================================================
 
-std::string CurveKeyBuilder::compute(
-    const std::string& asOfDate,
+void CurveKeyBuilder::writePoints(
+    CanonicalBuffer& buf,
     const quantra::TermStructure* ts,
     const KeyContext& ctx,
-    const std::map<std::string, std::string>& depKeys)
+    bool withQuotes)
 {
-    CanonicalBuffer buf;
-
-    // 1. Curve header
-    writeCurveHeader(buf, asOfDate, ts);
-
-    // 2. Index definitions (sorted by id)
-    writeReferencedIndices(buf, ts, ctx);
-
-    // 3. Helpers — serialize each independently, then sort byte arrays
     buf.writeTag("PTS");
     if (ts->points()) {
         std::vector<std::vector<uint8_t>> helperBlobs;
         helperBlobs.reserve(ts->points()->size());
 
         for (flatbuffers::uoffset_t i = 0; i < ts->points()->size(); i++) {
-            helperBlobs.push_back(serializePoint(ts->points()->Get(i), ctx));
+            helperBlobs.push_back(serializePoint(ts->points()->Get(i), ctx, withQuotes));
         }
 
         // Sort helper blobs lexicographically for order-independence
@@ -436,6 +439,29 @@ std::string CurveKeyBuilder::compute(
     } else {
         buf.writeU32(0);
     }
+}
+
+// =============================================================================
+// Main compute
+// =============================================================================
+
+std::string CurveKeyBuilder::compute(
+    const std::string& asOfDate,
+    const quantra::TermStructure* ts,
+    const KeyContext& ctx,
+    const std::map<std::string, std::string>& depKeys,
+    double curveBump)
+{
+    CanonicalBuffer buf;
+
+    // 1. Curve header
+    writeCurveHeader(buf, asOfDate, ts);
+
+    // 2. Index definitions (sorted by id)
+    writeReferencedIndices(buf, ts, ctx);
+
+    // 3. Helpers — serialize each independently, then sort byte arrays
+    writePoints(buf, ts, ctx, true);
 
     // 4. Dependency curve keys (std::map already sorted by depId)
     buf.writeTag("DEP");
@@ -445,8 +471,32 @@ std::string CurveKeyBuilder::compute(
         buf.writeString(depKey);
     }
 
-    // 5. Hash
+    // 5. Scenario bump. Only written when non-zero so base-curve keys are
+    //    unchanged and base/bumped curves can share the same cache.
+    if (curveBump != 0.0) {
+        buf.writeTag("BMP");
+        buf.writeDouble(curveBump);
+    }
+
+    // 6. Hash
     return "yc:v1:" + sha256hex(buf.data());
 }
 
+std::string CurveKeyBuilder::computeStructure(
+    const std::string& asOfDate,
+    const quantra::TermStructure* ts,
+    const KeyContext& ctx,
+    double curveBump)
+{
+    CanonicalBuffer buf;
+    writeCurveHeader(buf, asOfDate, ts);
+    writeReferencedIndices(buf, ts, ctx);
+    writePoints(buf, ts, ctx, false);
+    if (curveBump != 0.0) {
+        buf.writeTag("BMP");
+        buf.writeDouble(curveBump);
+    }
+    return "ycs:v1:" + sha256hex(buf.data());
+}
+
 } // namespace quantra
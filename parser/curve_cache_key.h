@@ -135,11 +135,13 @@ struct KeyContext {
  *
  * The key captures everything that affects bootstrapping output:
  * - as_of_date
- * - TermStructure config (day counter, interpolator, bootstrap trait, reference date)
+ * - TermStructure config (day counter, interpolator, bootstrap trait, reference date,
+ *   bootstrap accuracy tier and iteration cap)
  * - All helpers with their full field values (sorted for order-independence)
  * - Resolved quote values (not quote IDs)
  * - Index definitions referenced by helpers (full conventions)
  * - Dependency curve keys (for multi-curve bootstrap)
+ * - Parallel curve bump (scenario re-bootstraps, e.g. swaption rebump)
  */
 class CurveKeyBuilder {
 public:
@@ -150,13 +152,28 @@ public:
      * @param ts            The curve spec
      * @param ctx           Pre-built quote/index lookup maps
      * @param depKeys       Keys of dependency curves (sorted by depId)
+     * @param curveBump     Parallel bump applied to curve quotes (0 = base curve)
      * @return              Key string "yc:v1:<sha256hex>"
      */
     static std::string compute(
         const std::string& asOfDate,
         const quantra::TermStructure* ts,
         const KeyContext& ctx,
-        const std::map<std::string, std::string>& depKeys);
+        const std::map<std::string, std::string>& depKeys,
+        double curveBump = 0.0);
+
+    /**
+     * Key of the curve's structure: compute() with every quote value masked
+     * and without dependency keys. Two requests share it when they bootstrap
+     * the same helpers on different quotes, which is what warm starts need.
+     *
+     * @return              Key string "ycs:v1:<sha256hex>"
+     */
+    static std::string computeStructure(
+        const std::string& asOfDate,
+        const quantra::TermStructure* ts,
+        const KeyContext& ctx,
+        double curveBump = 0.0);
 
 private:
     static void writeCurveHeader(
@@ -166,7 +183,14 @@ private:
 
     static std::vector<uint8_t> serializePoint(
         const quantra::PointsWrapper* pw,
-        const KeyContext& ctx);
+        const KeyContext& ctx,
+        bool withQuotes);
+
+    static void writePoints(
+        CanonicalBuffer& buf,
+        const quantra::TermStructure* ts,
+        const KeyContext& ctx,
+        bool withQuotes);
 
     static void writeReferencedIndices(
         CanonicalBuffer& buf,
@@ -174,10 +198,12 @@ private:
         const KeyContext& ctx);
 
     /// Resolve a quote_id to its numeric value via O(1) map lookup
+    /// (0.0 when `withQuotes` is false, for structure keys)
     static double resolveQuoteValue(
         double inlineValue,
         const flatbuffers::String* quoteId,
-        const KeyContext& ctx);
+        const KeyContext& ctx,
+        bool withQuotes);
 
     static void writeDeps(
         CanonicalBuffer& buf,
@@ -187,6 +213,10 @@ private:
         CanonicalBuffer& buf,
         const quantra::IndexRef* ref);
 
+    // Shared with InstrumentKeyBuilder and SabrCalibrator
+    friend class InstrumentKeyBuilder;
+    friend class SabrCalibrator;
+
     static void writeSchedule(
         CanonicalBuffer& buf,
         const quantra::Schedule* sched);
@@ -0,0 +1,220 @@
+#include "curve_sampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+#include <ql/math/interpolations/backwardflatinterpolation.hpp>
+#include <ql/math/interpolations/forwardflatinterpolation.hpp>
+#include <ql/math/interpolations/linearinterpolation.hpp>
+#include <ql/math/interpolations/loginterpolation.hpp>
+#include <ql/termstructures/yield/discountcurve.hpp>
+#include <ql/termstructures/yield/zerocurve.hpp>
+
+#include "common.h"
+#include "year_fractions.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+namespace {
+
+enum class NodeInterpolation { BackwardFlat, ForwardFlat, Linear, LogLinear };
+
+/// Node arrays of a curve whose interpolation the batch loop reproduces.
+struct CurveNodes {
+    const std::vector<Time>* times = nullptr;
+    const std::vector<Real>* data = nullptr;
+    NodeInterpolation interpolation = NodeInterpolation::Linear;
+    bool zeroYields = false;    // data are zero yields rather than DFs
+};
+
+/// Matches InterpolatedDiscountCurve / InterpolatedZeroCurve, and so the
+/// PiecewiseYieldCurves built on them.
+template <class Interpolator>
+bool findNodes(const YieldTermStructure& curve, NodeInterpolation interpolation,
+               CurveNodes& nodes) {
+    if (auto c = dynamic_cast<const InterpolatedDiscountCurve<Interpolator>*>(&curve)) {
+        nodes.times = &c->times();
+        nodes.data = &c->data();
+        nodes.zeroYields = false;
+    } else if (auto c = dynamic_cast<const InterpolatedZeroCurve<Interpolator>*>(&curve)) {
+        nodes.times = &c->times();
+        nodes.data = &c->data();
+        nodes.zeroYields = true;
+    } else {
+        return false;
+    }
+    nodes.interpolation = interpolation;
+    return true;
+}
+
+bool findNodes(const YieldTermStructure& curve, CurveNodes& nodes) {
+    return findNodes<BackwardFlat>(curve, NodeInterpolation::BackwardFlat, nodes) ||
+           findNodes<ForwardFlat>(curve, NodeInterpolation::ForwardFlat, nodes) ||
+           findNodes<Linear>(curve, NodeInterpolation::Linear, nodes) ||
+           findNodes<LogLinear>(curve, NodeInterpolation::LogLinear, nodes);
+}
+
+/// Linear interpolation slopes, as LinearInterpolationImpl::update().
+std::vector<Real> slopes(const std::vector<Time>& x, const std::vector<Real>& y) {
+    std::vector<Real> s(x.size() - 1);
+    for (Size i = 1; i < x.size(); ++i) {
+        Real dx = x[i] - x[i - 1];
+        s[i - 1] = (y[i] - y[i - 1]) / dx;
+    }
+    return s;
+}
+
+/**
+ * Discount factors at sorted times t, all within [x.front(), x.back()].
+ *
+ * One forward walk finds each time's segment (the index QuantLib's
+ * Interpolation::locate() returns); the values are then computed in flat
+ * loops over the node arrays, with the same operations as the QuantLib
+ * interpolation and curve classes.
+ */
+void evaluate(const CurveNodes& nodes, const std::vector<Time>& t, std::vector<Real>& out) {
+    const std::vector<Time>& x = *nodes.times;
+    const Size n = x.size();
+    const Size m = t.size();
+
+    std::vector<Size> seg(m);
+    Size i = 0;
+    for (Size k = 0; k < m; ++k) {
+        while (i + 2 < n && x[i + 1] <= t[k]) ++i;
+        seg[k] = i;
+    }
+
+    out.resize(m);
+    switch (nodes.interpolation) {
+    case NodeInterpolation::BackwardFlat: {
+        const std::vector<Real>& y = *nodes.data;
+        for (Size k = 0; k < m; ++k) {
+            const Size j = seg[k];
+            out[k] = (t[k] == x[j]) ? y[j] : y[j + 1];
+        }
+        break;
+    }
+    case NodeInterpolation::ForwardFlat: {
+        const std::vector<Real>& y = *nodes.data;
+        for (Size k = 0; k < m; ++k) {
+            out[k] = (t[k] >= x[n - 1]) ? y[n - 1] : y[seg[k]];
+        }
+        break;
+    }
+    case NodeInterpolation::Linear: {
+        const std::vector<Real>& y = *nodes.data;
+        const std::vector<Real> s = slopes(x, y);
+        for (Size k = 0; k < m; ++k) {
+            const Size j = seg[k];
+            out[k] = y[j] + (t[k] - x[j]) * s[j];
+        }
+        break;
+    }
+    case NodeInterpolation::LogLinear: {
+        std::vector<Real> logY(n);
+        for (Size j = 0; j < n; ++j) logY[j] = std::log((*nodes.data)[j]);
+        const std::vector<Real> s = slopes(x, logY);
+        for (Size k = 0; k < m; ++k) {
+            const Size j = seg[k];
+            out[k] = logY[j] + (t[k] - x[j]) * s[j];
+        }
+        for (Size k = 0; k < m; ++k) {
+            out[k] = std::exp(out[k]);
+        }
+        break;
+    }
+    }
+
+    // ZeroYieldStructure::discountImpl()
+    if (nodes.zeroYields) {
+        for (Size k = 0; k < m; ++k) {
+            out[k] = (t[k] == 0.0) ? 1.0 : std::exp(-out[k] * t[k]);
+        }
+    }
+}
+
+bool batchEnabled() {
+    static const bool enabled = [] {
+        const char* env = std::getenv("QUANTRA_CURVE_BATCH_EVAL");
+        return !(env && std::string(env) == "0");
+    }();
+    return enabled;
+}
+
+/// Negative when verification is off.
+double verifyTolerance() {
+    static const double tolerance = [] {
+        const char* env = std::getenv("QUANTRA_CURVE_BATCH_VERIFY");
+        return env ? std::atof(env) : -1.0;
+    }();
+    return tolerance;
+}
+
+} // namespace
+
+std::vector<double> CurveSampler::discounts(
+    const std::shared_ptr<YieldTermStructure>& curve,
+    const std::vector<Date>& dates) {
+    std::vector<double> values(dates.size());
+
+    CurveNodes nodes;
+    bool batch = batchEnabled() && dates.size() > 1 &&
+                 std::is_sorted(dates.begin(), dates.end()) &&
+                 curve->jumpDates().empty();
+    if (batch) {
+        curve->maxDate();   // bootstraps a lazy curve, so its nodes are final
+        batch = findNodes(*curve, nodes) && nodes.times->size() >= 2;
+    }
+    if (!batch) {
+        for (size_t k = 0; k < dates.size(); k++) values[k] = curve->discount(dates[k]);
+        return values;
+    }
+
+    // Times as discount(d) computes them. Dates outside the nodes (before the
+    // reference date, or extrapolated) keep QuantLib's per-date path.
+    const Date ref = curve->referenceDate();
+    const DayCounter dc = curve->dayCounter();
+    const Time tMin = std::max<Time>(nodes.times->front(), 0.0);
+    const Time tMax = nodes.times->back();
+
+    const std::vector<Time> allTimes = YearFractions::from(dc, ref, dates);
+    std::vector<Time> times;
+    std::vector<size_t> index;
+    times.reserve(dates.size());
+    index.reserve(dates.size());
+    for (size_t k = 0; k < dates.size(); k++) {
+        const Time t = allTimes[k];
+        if (t >= tMin && t <= tMax) {
+            times.push_back(t);
+            index.push_back(k);
+        } else {
+            values[k] = curve->discount(dates[k]);
+        }
+    }
+
+    std::vector<Real> inside;
+    evaluate(nodes, times, inside);
+    for (size_t j = 0; j < index.size(); j++) values[index[j]] = inside[j];
+
+    const double tolerance = verifyTolerance();
+    if (tolerance >= 0.0) {
+        for (size_t j = 0; j < index.size(); j++) {
+            const Date& d = dates[index[j]];
+            double expected = curve->discount(d);
+            if (std::fabs(values[index[j]] - expected) > tolerance) {
+                std::ostringstream os;
+                os << "Batch curve evaluation differs from QuantLib at " << io::iso_date(d)
+                   << ": " << values[index[j]] << " vs " << expected;
+                QUANTRA_ERROR(os.str());
+            }
+        }
+    }
+    return values;
+}
+
+} // namespace quantra
@@ -0,0 +1,41 @@
+#ifndef QUANTRASERVER_CURVE_SAMPLER_H
+#define QUANTRASERVER_CURVE_SAMPLER_H
+
+#include <memory>
+#include <vector>
+
+#include <ql/termstructures/yieldtermstructure.hpp>
+#include <ql/time/date.hpp>
+
+namespace quantra {
+
+/**
+ * CurveSampler - Discount factors of a yield curve on a whole date grid.
+ *
+ * YieldTermStructure::discount() is virtual and locates the interpolation
+ * segment again on every call. For a sorted grid on a curve with discount or
+ * zero-yield nodes and a flat or linear interpolator (BackwardFlat,
+ * ForwardFlat, Linear, LogLinear), the sampler instead walks the pillar
+ * segments once and evaluates the grid in a flat loop over the node arrays,
+ * using QuantLib's own arithmetic so values are identical to discount(d).
+ *
+ * Anything else (unsorted grid, other curve types, jumps, dates before the
+ * first node or past the last one) goes through curve->discount(d), so
+ * extrapolation and range errors are QuantLib's.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_CURVE_BATCH_EVAL=0          Always use curve->discount(d)
+ *   QUANTRA_CURVE_BATCH_VERIFY=<tol>    Check every batch value against
+ *                                       curve->discount(d); error if the
+ *                                       difference exceeds tol (0 = exact)
+ */
+class CurveSampler {
+public:
+    static std::vector<double> discounts(
+        const std::shared_ptr<QuantLib::YieldTermStructure>& curve,
+        const std::vector<QuantLib::Date>& dates);
+};
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_CURVE_SAMPLER_H
@@ -17,6 +17,7 @@
 #include "enums.h"
 #include "common.h"
 #include "term_structure_generated.h"
+#include "warm_start_bootstrap.h"
 
 namespace quantra {
 
@@ -92,27 +93,39 @@ public:
         QuantLib::DayCounter dc = DayCounterToQL(
             static_cast<quantra::enums::DayCounter>(data.day_counter));
 
-        auto interpolator = static_cast<quantra::enums::Interpolator>(data.interpolator);
+        return reconstruct(dates, data.discount_factors, dc,
+            static_cast<quantra::enums::Interpolator>(data.interpolator));
+    }
 
+    /**
+     * Build an InterpolatedDiscountCurve on the given nodes, using the same
+     * interpolator mapping as cached curves.
+     */
+    static std::shared_ptr<QuantLib::YieldTermStructure> reconstruct(
+        const std::vector<QuantLib::Date>& dates,
+        const std::vector<double>& discountFactors,
+        const QuantLib::DayCounter& dc,
+        quantra::enums::Interpolator interpolator)
+    {
         std::shared_ptr<QuantLib::YieldTermStructure> curve;
 
         switch (interpolator) {
         case quantra::enums::Interpolator_LogLinear:
             curve = std::make_shared<
                 QuantLib::InterpolatedDiscountCurve<QuantLib::LogLinear>>(
-                dates, data.discount_factors, dc);
+                dates, discountFactors, dc);
             break;
 
         case quantra::enums::Interpolator_Linear:
             curve = std::make_shared<
                 QuantLib::InterpolatedDiscountCurve<QuantLib::Linear>>(
-                dates, data.discount_factors, dc);
+                dates, discountFactors, dc);
             break;
 
         case quantra::enums::Interpolator_BackwardFlat:
             curve = std::make_shared<
                 QuantLib::InterpolatedDiscountCurve<QuantLib::BackwardFlat>>(
-                dates, data.discount_factors, dc);
+                dates, discountFactors, dc);
             break;
 
         case quantra::enums::Interpolator_ForwardFlat:
@@ -120,19 +133,19 @@ public:
             // standard DF interpolation and produces identical pillars
             curve = std::make_shared<
                 QuantLib::InterpolatedDiscountCurve<QuantLib::LogLinear>>(
-                dates, data.discount_factors, dc);
+                dates, discountFactors, dc);
             break;
 
         case quantra::enums::Interpolator_LogCubic:
             curve = std::make_shared<
                 QuantLib::InterpolatedDiscountCurve<QuantLib::LogCubic>>(
-                dates, data.discount_factors, dc, QuantLib::MonotonicLogCubic());
+                dates, discountFactors, dc, QuantLib::MonotonicLogCubic());
             break;
 
         default:
             curve = std::make_shared<
                 QuantLib::InterpolatedDiscountCurve<QuantLib::LogLinear>>(
-                dates, data.discount_factors, dc);
+                dates, discountFactors, dc);
             break;
         }
 
@@ -151,7 +164,8 @@ private:
     /**
      * Try to extract actual pillar dates from a PiecewiseYieldCurve.
      *
-     * PiecewiseYieldCurve<Trait, Interp>::dates() returns the bootstrap nodes.
+     * PiecewiseYieldCurve<Trait, Interp>::dates() returns the bootstrap nodes
+     * (every curve is a WarmStartCurve, see TermStructureParser).
      * We try the (trait, interpolator) combo specified in the TermStructure.
      */
     static bool tryExtractPillars(
@@ -159,10 +173,10 @@ private:
         const quantra::TermStructure* ts,
         std::vector<QuantLib::Date>& out)
     {
-        #define TRY_EXTRACT(TraitT, InterpT) \
+        #define TRY_EXTRACT(CurveT, TraitT, InterpT) \
             { \
                 auto ptr = std::dynamic_pointer_cast< \
-                    QuantLib::PiecewiseYieldCurve<TraitT, InterpT>>(curve); \
+                    CurveT<TraitT, InterpT>>(curve); \
                 if (ptr) { \
                     out = ptr->dates(); \
                     return true; \
@@ -177,29 +191,29 @@ private:
         // Try the expected combination first (most likely hit)
         switch (interp) {
         case enums::Interpolator_LogLinear:
-            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(Discount, LogLinear);
-            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(ZeroYield, LogLinear);
-            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(ForwardRate, LogLinear);
+            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(WarmStartCurve, Discount, LogLinear);
+            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(WarmStartCurve, ZeroYield, LogLinear);
+            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(WarmStartCurve, ForwardRate, LogLinear);
             break;
         case enums::Interpolator_Linear:
-            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(Discount, Linear);
-            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(ZeroYield, Linear);
-            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(ForwardRate, Linear);
+            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(WarmStartCurve, Discount, Linear);
+            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(WarmStartCurve, ZeroYield, Linear);
+            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(WarmStartCurve, ForwardRate, Linear);
             break;
         case enums::Interpolator_BackwardFlat:
-            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(Discount, BackwardFlat);
-            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(ZeroYield, BackwardFlat);
-            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(ForwardRate, BackwardFlat);
+            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(WarmStartCurve, Discount, BackwardFlat);
+            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(WarmStartCurve, ZeroYield, BackwardFlat);
+            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(WarmStartCurve, ForwardRate, BackwardFlat);
             break;
         case enums::Interpolator_ForwardFlat:
-            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(Discount, ForwardFlat);
-            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(ZeroYield, ForwardFlat);
-            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(ForwardRate, ForwardFlat);
+            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(WarmStartCurve, Discount, ForwardFlat);
+            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(WarmStartCurve, ZeroYield, ForwardFlat);
+            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(WarmStartCurve, ForwardRate, ForwardFlat);
             break;
         case enums::Interpolator_LogCubic:
-            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(Discount, LogCubic);
-            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(ZeroYield, LogCubic);
-            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(ForwardRate, LogCubic);
+            if (trait == enums::BootstrapTrait_Discount)  TRY_EXTRACT(WarmStartCurve, Discount, LogCubic);
+            if (trait == enums::BootstrapTrait_ZeroRate)   TRY_EXTRACT(WarmStartCurve, ZeroYield, LogCubic);
+            if (trait == enums::BootstrapTrait_FwdRate)    TRY_EXTRACT(WarmStartCurve, ForwardRate, LogCubic);
             break;
         default:
             break;
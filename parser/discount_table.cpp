@@ -0,0 +1,27 @@
+#include "discount_table.h"
+
+#include "curve_sampler.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+std::shared_ptr<const DiscountTable> DiscountTable::build(
+    const std::shared_ptr<YieldTermStructure>& curve,
+    size_t maxDays) {
+    if (!curve) return nullptr;
+    const Date ref = curve->referenceDate();
+    const Date last = curve->maxDate();
+    if (last < ref || static_cast<size_t>(last - ref) + 1 > maxDays) return nullptr;
+
+    std::vector<Date> dates;
+    dates.reserve(static_cast<size_t>(last - ref) + 1);
+    for (Date d = ref; d <= last; d++) dates.push_back(d);
+
+    auto table = std::make_shared<DiscountTable>();
+    table->first_ = ref.serialNumber();
+    table->dfs_ = CurveSampler::discounts(curve, dates);
+    return table;
+}
+
+} // namespace quantra
@@ -0,0 +1,47 @@
+#ifndef QUANTRASERVER_DISCOUNT_TABLE_H
+#define QUANTRASERVER_DISCOUNT_TABLE_H
+
+#include <memory>
+#include <vector>
+
+#include <ql/termstructures/yieldtermstructure.hpp>
+#include <ql/time/date.hpp>
+
+namespace quantra {
+
+/**
+ * DiscountTable - Discount factors of a curve on every day from its
+ * reference date to its max date, as one contiguous array indexed by the
+ * serial-date offset from the reference date.
+ *
+ * Values come from CurveSampler, so they are the curve's own discount(d).
+ * The table is only valid while the curve keeps the reference date it was
+ * built with; callers check referenceDate() before using it.
+ */
+class DiscountTable {
+public:
+    /// Null when the curve spans more than maxDays days or has no range.
+    static std::shared_ptr<const DiscountTable> build(
+        const std::shared_ptr<QuantLib::YieldTermStructure>& curve,
+        size_t maxDays);
+
+    QuantLib::Date referenceDate() const { return QuantLib::Date(first_); }
+
+    bool covers(const QuantLib::Date& d) const {
+        const QuantLib::Date::serial_type k = d.serialNumber() - first_;
+        return k >= 0 && k < static_cast<QuantLib::Date::serial_type>(dfs_.size());
+    }
+
+    /// Requires covers(d).
+    double discount(const QuantLib::Date& d) const { return dfs_[d.serialNumber() - first_]; }
+
+    size_t bytes() const { return sizeof(*this) + dfs_.capacity() * sizeof(double); }
+
+private:
+    QuantLib::Date::serial_type first_ = 0;
+    std::vector<double> dfs_;
+};
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_DISCOUNT_TABLE_H
@@ -1,13 +1,25 @@
 #include "fixed_rate_bond_parser.h"
+#include "instrument_cache.h"
+#include "instrument_cache_key.h"
 
 std::shared_ptr<QuantLib::FixedRateBond> FixedRateBondParser::parse(const quantra::FixedRateBond *bond)
 {
     if (bond == NULL)
         QUANTRA_ERROR("Fixed Rate Bond not found");
 
+    InstrumentCache& cache = InstrumentCache::instance();
+    const bool cached = use_instrument_cache_ && cache.enabled();
+    std::string key;
+    if (cached)
+    {
+        key = InstrumentKeyBuilder::fixedRateBond(bond);
+        if (auto hit = cache.get(key))
+            return std::static_pointer_cast<QuantLib::FixedRateBond>(hit->instrument);
+    }
+
     ScheduleParser schedule_parser = ScheduleParser();
 
-    return std::make_shared<QuantLib::FixedRateBond>(
+    auto fixedRateBond = std::make_shared<QuantLib::FixedRateBond>(
         bond->settlement_days(),
         bond->face_amount(),
         *schedule_parser.parse(bond->schedule()),
@@ -16,4 +28,9 @@ std::shared_ptr<QuantLib::FixedRateBond> FixedRateBondParser::parse(const quantr
         ConventionToQL(bond->payment_convention()),
         bond->redemption(),
         DateToQL(bond->issue_date()->str()));
+
+    if (cached)
+        cache.put(key, InstrumentCache::Entry{fixedRateBond, {}});
+
+    return fixedRateBond;
 }
\ No newline at end of file
@@ -29,8 +29,14 @@ class FixedRateBondParser
 {
 
 private:
+    bool use_instrument_cache_ = true;
+
 public:
     std::shared_ptr<QuantLib::FixedRateBond> parse(const quantra::FixedRateBond *ts);
+
+    /// Always parse a fresh instrument, for callers that keep several
+    /// instruments alive and relinked at once (see InstrumentCache).
+    void disableInstrumentCache() { use_instrument_cache_ = false; }
 };
 
 #endif //QUANTRASERVER_FIXEDRATEBONDPARSER_H
\ No newline at end of file
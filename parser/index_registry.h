@@ -100,6 +100,12 @@ public:
         return result;
     }
 
+    /// Calls f(index) for every registered index.
+    template <class F>
+    void forEach(F f) const {
+        for (const auto& kv : indices_) f(kv.second);
+    }
+
 private:
     std::unordered_map<std::string, std::shared_ptr<QuantLib::InterestRateIndex>> indices_;
 };
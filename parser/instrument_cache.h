@@ -0,0 +1,130 @@
+#ifndef QUANTRASERVER_INSTRUMENT_CACHE_H
+#define QUANTRASERVER_INSTRUMENT_CACHE_H
+
+#include <string>
+#include <memory>
+#include <unordered_map>
+#include <list>
+#include <iostream>
+#include <cstdlib>
+
+#include <ql/instrument.hpp>
+#include <ql/handle.hpp>
+#include <ql/termstructures/yieldtermstructure.hpp>
+
+namespace quantra {
+
+/**
+ * InstrumentCache - LRU cache of parsed QuantLib instruments.
+ *
+ * Static trades arrive unchanged request after request; caching them by
+ * content (InstrumentKeyBuilder) pays schedule and leg construction once
+ * per trade per worker. Instruments with a floating leg own their
+ * forwarding RelinkableHandle: the parser relinks it to the request's
+ * forwarding curve on every hit, and the handler sets the request's
+ * pricing engine as before, so a cached instrument prices exactly like a
+ * freshly parsed one.
+ *
+ * Single-threaded, like InProcessCurveCache: each worker is a
+ * single-threaded process. A hit returns the same object, so a request
+ * must finish with an instrument before parsing the next trade that
+ * relinks it - which the per-trade pricing loops do. Handlers that keep
+ * instruments across trades (ComputeCurveRisk reprices all of them per
+ * bump) parse with disableInstrumentCache().
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_INSTRUMENT_CACHE_ENABLED=1          Enable caching (default: 0)
+ *   QUANTRA_INSTRUMENT_CACHE_MAX_ENTRIES=10000  Max cached instruments
+ */
+class InstrumentCache {
+public:
+    struct Entry {
+        std::shared_ptr<QuantLib::Instrument> instrument;
+        QuantLib::RelinkableHandle<QuantLib::YieldTermStructure> forwarding;
+    };
+
+    static InstrumentCache& instance() {
+        static InstrumentCache inst;
+        return inst;
+    }
+
+    bool enabled() const { return enabled_; }
+    /// Overrides QUANTRA_INSTRUMENT_CACHE_ENABLED (tests).
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+
+    /// Null on a miss; on a hit the entry becomes most recently used.
+    Entry* get(const std::string& key) {
+        auto it = cacheMap_.find(key);
+        if (it == cacheMap_.end()) {
+            stats_.misses++;
+            return nullptr;
+        }
+        stats_.hits++;
+        lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
+        return &it->second.entry;
+    }
+
+    void put(const std::string& key, Entry entry) {
+        auto it = cacheMap_.find(key);
+        if (it != cacheMap_.end()) {
+            it->second.entry = std::move(entry);
+            lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
+            return;
+        }
+
+        while (cacheMap_.size() >= maxEntries_ && !lruList_.empty()) {
+            cacheMap_.erase(lruList_.back());
+            lruList_.pop_back();
+        }
+
+        lruList_.push_front(key);
+        cacheMap_[key] = Slot{std::move(entry), lruList_.begin()};
+    }
+
+    void clear() {
+        cacheMap_.clear();
+        lruList_.clear();
+    }
+
+    size_t size() const { return cacheMap_.size(); }
+
+    // --- Stats ---
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    const Stats& stats() const { return stats_; }
+    void resetStats() { stats_ = Stats{}; }
+
+private:
+    struct Slot {
+        Entry entry;
+        std::list<std::string>::iterator lruIt;
+    };
+
+    InstrumentCache() {
+        const char* envEnabled = std::getenv("QUANTRA_INSTRUMENT_CACHE_ENABLED");
+        enabled_ = envEnabled && std::string(envEnabled) == "1";
+
+        const char* envMax = std::getenv("QUANTRA_INSTRUMENT_CACHE_MAX_ENTRIES");
+        if (envMax) {
+            int val = std::atoi(envMax);
+            if (val > 0) maxEntries_ = static_cast<size_t>(val);
+        }
+
+        if (enabled_) {
+            std::cout << "[InstrumentCache] Enabled. max_entries=" << maxEntries_ << std::endl;
+        }
+    }
+
+    bool enabled_ = false;
+    size_t maxEntries_ = 10000;
+    std::unordered_map<std::string, Slot> cacheMap_;
+    std::list<std::string> lruList_; // front = most recent
+    Stats stats_;
+};
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_INSTRUMENT_CACHE_H
@@ -0,0 +1,125 @@
+#include "instrument_cache_key.h"
+
+#include <sstream>
+
+namespace quantra {
+
+// =============================================================================
+// Shared pieces
+// =============================================================================
+
+void InstrumentKeyBuilder::writeIndex(CanonicalBuffer& buf, const QuantLib::IborIndex& index)
+{
+    buf.writeTag("IDX");
+    buf.writeString(index.familyName());
+    std::ostringstream tenor;
+    tenor << index.tenor();
+    buf.writeString(tenor.str());
+    buf.writeU32(static_cast<uint32_t>(index.fixingDays()));
+    buf.writeString(index.fixingCalendar().name());
+    buf.writeString(index.currency().code());
+    buf.writeString(index.dayCounter().name());
+    buf.writeI32(static_cast<int32_t>(index.businessDayConvention()));
+    buf.writeBool(index.endOfMonth());
+}
+
+std::string InstrumentKeyBuilder::finish(const char* product, const CanonicalBuffer& buf)
+{
+    return std::string("ins:v1:") + product + ":" + CurveKeyBuilder::sha256hex(buf.data());
+}
+
+// =============================================================================
+// Products
+// =============================================================================
+
+std::string InstrumentKeyBuilder::fixedRateBond(const quantra::FixedRateBond* bond)
+{
+    CanonicalBuffer buf;
+    buf.writeI32(bond->settlement_days());
+    buf.writeDouble(bond->face_amount());
+    buf.writeDouble(bond->rate());
+    buf.writeU8(static_cast<uint8_t>(bond->accrual_day_counter()));
+    buf.writeU8(static_cast<uint8_t>(bond->payment_convention()));
+    buf.writeDouble(bond->redemption());
+    buf.writeFbString(bond->issue_date());
+    CurveKeyBuilder::writeSchedule(buf, bond->schedule());
+    return finish("frb", buf);
+}
+
+std::string InstrumentKeyBuilder::vanillaSwap(
+    const quantra::VanillaSwap* swap,
+    const QuantLib::IborIndex& index)
+{
+    CanonicalBuffer buf;
+    buf.writeU8(static_cast<uint8_t>(swap->swap_type()));
+
+    auto fixed = swap->fixed_leg();
+    buf.writeTag("FIX");
+    CurveKeyBuilder::writeSchedule(buf, fixed->schedule());
+    buf.writeDouble(fixed->notional());
+    buf.writeDouble(fixed->rate());
+    buf.writeU8(static_cast<uint8_t>(fixed->day_counter()));
+    buf.writeU8(static_cast<uint8_t>(fixed->payment_convention()));
+
+    auto floating = swap->floating_leg();
+    buf.writeTag("FLT");
+    CurveKeyBuilder::writeSchedule(buf, floating->schedule());
+    buf.writeDouble(floating->notional());
+    CurveKeyBuilder::writeIndexRef(buf, floating->index());
+    buf.writeDouble(floating->spread());
+    buf.writeU8(static_cast<uint8_t>(floating->day_counter()));
+    buf.writeU8(static_cast<uint8_t>(floating->payment_convention()));
+    buf.writeI32(floating->fixing_days());
+    buf.writeBool(floating->in_arrears());
+
+    writeIndex(buf, index);
+    return finish("swp", buf);
+}
+
+std::string InstrumentKeyBuilder::cds(
+    const quantra::CDS* cds,
+    const QuantLib::Date& evaluationDate)
+{
+    CanonicalBuffer buf;
+    buf.writeU8(static_cast<uint8_t>(cds->side()));
+    buf.writeDouble(cds->notional());
+    buf.writeDouble(cds->running_coupon());
+    CurveKeyBuilder::writeSchedule(buf, cds->schedule());
+    buf.writeDouble(cds->upfront());
+    buf.writeU8(static_cast<uint8_t>(cds->day_counter()));
+    buf.writeU8(static_cast<uint8_t>(cds->business_day_convention()));
+    buf.writeBool(cds->settles_accrual());
+    buf.writeBool(cds->pays_at_default_time());
+    buf.writeBool(cds->rebates_accrual());
+    buf.writeFbString(cds->protection_start());
+    buf.writeFbString(cds->upfront_date());
+    buf.writeU8(static_cast<uint8_t>(cds->last_period_day_counter()));
+    buf.writeFbString(cds->trade_date());
+    buf.writeI32(cds->cash_settlement_days());
+
+    // Empty trade_date: QuantLib takes the evaluation date
+    if (!cds->trade_date() || cds->trade_date()->size() == 0) {
+        buf.writeTag("EVAL");
+        buf.writeI32(static_cast<int32_t>(evaluationDate.serialNumber()));
+    }
+    return finish("cds", buf);
+}
+
+std::string InstrumentKeyBuilder::capFloor(
+    const quantra::CapFloor* capFloor,
+    const QuantLib::IborIndex& index)
+{
+    CanonicalBuffer buf;
+    buf.writeU8(static_cast<uint8_t>(capFloor->cap_floor_type()));
+    buf.writeDouble(capFloor->notional());
+    buf.writeDouble(capFloor->strike());
+    CurveKeyBuilder::writeSchedule(buf, capFloor->schedule());
+    CurveKeyBuilder::writeIndexRef(buf, capFloor->index());
+    buf.writeU8(static_cast<uint8_t>(capFloor->day_counter()));
+    buf.writeU8(static_cast<uint8_t>(capFloor->business_day_convention()));
+
+    writeIndex(buf, index);
+    return finish("cpf", buf);
+}
+
+} // namespace quantra
@@ -0,0 +1,55 @@
+#ifndef QUANTRASERVER_INSTRUMENT_CACHE_KEY_H
+#define QUANTRASERVER_INSTRUMENT_CACHE_KEY_H
+
+#include <string>
+
+#include <ql/indexes/iborindex.hpp>
+#include <ql/time/date.hpp>
+
+#include "curve_cache_key.h"
+#include "fixed_rate_bond_generated.h"
+#include "vanilla_swap_generated.h"
+#include "cds_generated.h"
+#include "cap_floor_generated.h"
+
+namespace quantra {
+
+/**
+ * InstrumentKeyBuilder - Builds deterministic cache keys for trade tables.
+ *
+ * Produces: "ins:v1:<product>:<sha256hex>"
+ *
+ * The key captures everything the parser reads to build the instrument:
+ * every field of the trade table (schedules included), and for floating
+ * legs the conventions of the resolved index (name, tenor, fixing days,
+ * calendar, currency, adjustment, end of month). Fixings are not part of
+ * it; they live in the IndexManager and are read at pricing time.
+ *
+ * CDS construction defaults its trade date to the evaluation date, so a
+ * CDS without trade_date also keys on it.
+ */
+class InstrumentKeyBuilder {
+public:
+    static std::string fixedRateBond(const quantra::FixedRateBond* bond);
+
+    static std::string vanillaSwap(
+        const quantra::VanillaSwap* swap,
+        const QuantLib::IborIndex& index);
+
+    static std::string cds(
+        const quantra::CDS* cds,
+        const QuantLib::Date& evaluationDate);
+
+    static std::string capFloor(
+        const quantra::CapFloor* capFloor,
+        const QuantLib::IborIndex& index);
+
+private:
+    static void writeIndex(CanonicalBuffer& buf, const QuantLib::IborIndex& index);
+
+    static std::string finish(const char* product, const CanonicalBuffer& buf);
+};
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_INSTRUMENT_CACHE_KEY_H
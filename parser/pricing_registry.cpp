@@ -18,7 +18,10 @@
 
 namespace quantra {
 
-PricingRegistry PricingRegistryBuilder::build(const quantra::Pricing* pricing) const {
+PricingRegistry PricingRegistryBuilder::build(
+    const quantra::Pricing* pricing,
+    const PricingDemand* demand,
+    bool liveQuotes) const {
     // ==========================================================================
     // Validation
     // ==========================================================================
@@ -62,6 +65,7 @@ PricingRegistry PricingRegistryBuilder::build(const quantra::Pricing* pricing) c
     // ==========================================================================
     // Parse Vol Surfaces (optional)
     // Parsed before curves so swap_index_id contracts are available early.
+    // With a demand set, surfaces no trade references are left unparsed.
     // ==========================================================================
     if (pricing->vol_surfaces()) {
         for (auto it = pricing->vol_surfaces()->begin(); it != pricing->vol_surfaces()->end(); ++it) {
@@ -70,6 +74,9 @@ PricingRegistry PricingRegistryBuilder::build(const quantra::Pricing* pricing) c
                 QUANTRA_ERROR("VolSurfaceSpec.id is required");
             }
             std::string id = spec->id()->str();
+            if (demand && !demand->vols.count(id)) {
+                continue;
+            }
 
             switch (spec->payload_type()) {
                 case quantra::VolPayload_OptionletVolSpec:
@@ -109,22 +116,35 @@ PricingRegistry PricingRegistryBuilder::build(const quantra::Pricing* pricing) c
 
     // ==========================================================================
     // Parse Curves (dependency-aware via CurveBootstrapper)
-    // Now passes indices to CurveBootstrapper for helper index resolution
+    // Now passes indices to CurveBootstrapper for helper index resolution.
+    // With a demand set, only the demanded curves and their transitive
+    // dependencies are bootstrapped.
     // ==========================================================================
     if (!pricing->curves()) {
         QUANTRA_ERROR("curves is required (at least one curve needed)");
     }
 
+    if (pricing->bootstrap_budget_ms() < 0) {
+        QUANTRA_ERROR("bootstrap_budget_ms must be >= 0");
+    }
+    auto budget = BootstrapBudget::start(
+        pricing->bootstrap_budget_ms(), pricing->stale_curve_fallback());
+
     CurveBootstrapper bootstrapper;
     auto booted = bootstrapper.bootstrapAll(
         pricing->curves(),
         pricing->quotes(),
-        pricing->indices()
+        pricing->indices(),
+        0.0,
+        demand ? &demand->curves : nullptr,
+        liveQuotes ? &quoteRegistry : nullptr,
+        &budget
     );
 
     for (auto& kv : booted.handles) {
         reg.curves.emplace(kv.first, kv.second);
     }
+    reg.staleCurves = std::move(booted.stale);
 
     // ==========================================================================
     // Parse Models (optional)
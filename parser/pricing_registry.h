@@ -4,6 +4,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include <ql/handle.hpp>
@@ -62,6 +63,35 @@ struct PricingRegistry {
     // Swaption analytics flag
     bool swaptionPricingDetails = false;
     bool swaptionPricingRebump = false;
+
+    // Curves served from a previous solve after the bootstrap budget ran out
+    std::vector<std::string> staleCurves;
+};
+
+/// reg.staleCurves as a response stale_curves field (null if none).
+inline flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>>
+staleCurvesVector(flatbuffers::FlatBufferBuilder& builder, const PricingRegistry& reg) {
+    if (reg.staleCurves.empty()) return 0;
+    return builder.CreateVectorOfStrings(reg.staleCurves);
+}
+
+/**
+ * Market data referenced by the trades/queries of one request.
+ *
+ * Handlers fill this from their trades before building the registry so only
+ * the referenced curves (plus their bootstrap dependencies) and vol surfaces
+ * are built. Specs nobody references are never parsed.
+ */
+struct PricingDemand {
+    std::unordered_set<std::string> curves;
+    std::unordered_set<std::string> vols;
+
+    void addCurve(const flatbuffers::String* id) {
+        if (id) curves.insert(id->str());
+    }
+    void addVol(const flatbuffers::String* id) {
+        if (id) vols.insert(id->str());
+    }
 };
 
 /**
@@ -69,7 +99,18 @@ struct PricingRegistry {
  */
 class PricingRegistryBuilder {
 public:
-    PricingRegistry build(const quantra::Pricing* pricing) const;
+    /**
+     * Build the registry. When `demand` is null every curve and vol surface
+     * in `pricing` is built; otherwise only what `demand` references.
+     *
+     * With `liveQuotes`, curves are bootstrapped on reg.quoteRegistry itself
+     * (never from the curve cache), so bumping a registry quote in place
+     * re-bootstraps the dependent curves lazily.
+     */
+    PricingRegistry build(
+        const quantra::Pricing* pricing,
+        const PricingDemand* demand = nullptr,
+        bool liveQuotes = false) const;
 };
 
 } // namespace quantra
@@ -68,6 +68,15 @@ public:
         return getHandle(id, expected)->value();
     }
 
+    /// The shared quote itself, for in-place bumps (setValue).
+    std::shared_ptr<QuantLib::SimpleQuote> getQuote(const std::string& id) const {
+        auto it = quotes_.find(id);
+        if (it == quotes_.end()) {
+            QUANTRA_ERROR("Unknown quote id: " + id);
+        }
+        return it->second;
+    }
+
 private:
     std::unordered_map<std::string, std::shared_ptr<QuantLib::SimpleQuote>> quotes_;
     std::unordered_map<std::string, quantra::QuoteType> types_;
@@ -0,0 +1,232 @@
+#include "sabr_calibrator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
+
+#include <ql/math/optimization/constraint.hpp>
+#include <ql/math/optimization/costfunction.hpp>
+#include <ql/math/optimization/endcriteria.hpp>
+#include <ql/math/optimization/levenbergmarquardt.hpp>
+#include <ql/math/optimization/problem.hpp>
+#include <ql/termstructures/volatility/sabr.hpp>
+
+#include "curve_cache_key.h"
+#include "error.h"
+#include "worker_pool.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+namespace {
+
+/// Fitting threads: QUANTRA_SABR_THREADS (default 1 = sequential), like
+/// QUANTRA_BOOTSTRAP_THREADS. Each worker process fits on its own, so more
+/// only pays off with fewer workers than cores.
+unsigned sabrThreads() {
+    static const unsigned threads = [] {
+        const char* env = std::getenv("QUANTRA_SABR_THREADS");
+        int val = env ? std::atoi(env) : 1;
+        return val > 1 ? static_cast<unsigned>(val) : 1u;
+    }();
+    return threads;
+}
+
+/// Fitting helpers, kept for the life of the process so calibrate() does
+/// not start threads per call.
+WorkerPool& fitPool() {
+    static WorkerPool pool;
+    return pool;
+}
+
+const double kRhoBound = 0.9999;
+
+/// Unconstrained coordinates to SABR parameters.
+struct SabrCoordinates {
+    double beta;
+    bool betaFixed;
+
+    SabrParams params(const Array& x) const {
+        SabrParams p;
+        p.alpha = std::exp(x[0]);
+        p.rho = kRhoBound * std::tanh(x[1]);
+        p.nu = std::exp(x[2]);
+        p.beta = betaFixed ? beta : 1.0 / (1.0 + std::exp(-x[3]));
+        return p;
+    }
+};
+
+/// Weighted vol residuals of one node's usable quotes.
+class SmileCost : public CostFunction {
+public:
+    SmileCost(const SabrSmile& smile, const std::vector<size_t>& quotes,
+              VolatilityType volType, double shift, SabrCoordinates coordinates)
+        : smile_(smile), quotes_(quotes), volType_(volType), shift_(shift), coordinates_(coordinates) {}
+
+    Array values(const Array& x) const override {
+        const SabrParams p = coordinates_.params(x);
+        Array residuals(quotes_.size());
+        for (size_t q = 0; q < quotes_.size(); q++) {
+            const size_t k = quotes_[q];
+            double diff = 1.0;      // stands in for a vol the formula cannot produce
+            try {
+                const double model = shiftedSabrVolatility(smile_.strikes[k], smile_.forward, smile_.time,
+                                                           p.alpha, p.beta, p.nu, p.rho, shift_, volType_);
+                if (std::isfinite(model)) diff = model - smile_.vols[k];
+            } catch (...) {
+            }
+            residuals[q] = std::sqrt(weight(k)) * diff;
+        }
+        return residuals;
+    }
+
+    Real value(const Array& x) const override {
+        const Array residuals = values(x);
+        return DotProduct(residuals, residuals);
+    }
+
+    double weight(size_t k) const { return smile_.weights.empty() ? 1.0 : smile_.weights[k]; }
+
+private:
+    const SabrSmile& smile_;
+    const std::vector<size_t>& quotes_;
+    VolatilityType volType_;
+    double shift_;
+    SabrCoordinates coordinates_;
+};
+
+} // namespace
+
+std::vector<SabrParams> SabrCalibrator::calibrate(const std::vector<SabrSmile>& smiles) const {
+    SabrCalibrationCache& cache = SabrCalibrationCache::instance();
+    const std::string key = cacheKey(smiles);
+    if (const std::vector<SabrParams>* hit = cache.get(key)) {
+        return *hit;
+    }
+
+    // Nodes are independent; workers take the next unfitted node
+    std::vector<SabrParams> params(smiles.size());
+    std::vector<std::exception_ptr> errors(smiles.size());
+    std::atomic<size_t> next{0};
+    std::function<void()> work = [&]() {
+        for (size_t i = next++; i < smiles.size(); i = next++) {
+            try {
+                params[i] = fit(smiles[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    const size_t workers = std::min<size_t>(sabrThreads(), smiles.size());
+    if (workers <= 1) {
+        work();
+    } else {
+        fitPool().run(workers - 1, work);
+    }
+
+    // Report the first failure in node order, as a sequential fit would
+    for (auto& e : errors) {
+        if (e) std::rethrow_exception(e);
+    }
+
+    cache.put(key, params);
+    return params;
+}
+
+std::string SabrCalibrator::cacheKey(const std::vector<SabrSmile>& smiles) const {
+    CanonicalBuffer buf;
+    buf.writeTag("SABR");
+    buf.writeU8(static_cast<uint8_t>(volType_));
+    buf.writeDouble(shift_);
+    buf.writeDouble(beta_);
+    buf.writeBool(betaFixed_);
+    buf.writeU32(static_cast<uint32_t>(smiles.size()));
+    for (const auto& smile : smiles) {
+        buf.writeDouble(smile.time);
+        buf.writeDouble(smile.forward);
+        buf.writeU32(static_cast<uint32_t>(smile.strikes.size()));
+        for (double k : smile.strikes) buf.writeDouble(k);
+        for (double v : smile.vols) buf.writeDouble(v);
+        buf.writeU32(static_cast<uint32_t>(smile.weights.size()));
+        for (double w : smile.weights) buf.writeDouble(w);
+    }
+    return "sabr:v1:" + CurveKeyBuilder::sha256hex(buf.data());
+}
+
+SabrParams SabrCalibrator::fit(const SabrSmile& smile) const {
+    // Quotes that carry weight and, for lognormal vols, a valid shifted strike
+    std::vector<size_t> quotes;
+    for (size_t k = 0; k < smile.strikes.size(); k++) {
+        const double w = smile.weights.empty() ? 1.0 : smile.weights[k];
+        if (w <= 0.0) continue;
+        if (volType_ == ShiftedLognormal && !(smile.strikes[k] + shift_ > 0.0)) continue;
+        quotes.push_back(k);
+    }
+    const size_t freeParams = betaFixed_ ? 3 : 4;
+    if (quotes.size() < freeParams) {
+        QUANTRA_ERROR("SABR calibration needs at least " + std::to_string(freeParams) +
+                      " weighted quotes per node, got " + std::to_string(quotes.size()));
+    }
+    if (volType_ == ShiftedLognormal && !(smile.forward + shift_ > 0.0)) {
+        QUANTRA_ERROR("SABR calibration requires forward + displacement > 0 (forward=" +
+                      std::to_string(smile.forward) + ")");
+    }
+
+    // Starting alpha from the quote nearest the forward
+    size_t atm = quotes.front();
+    for (size_t k : quotes) {
+        if (std::fabs(smile.strikes[k] - smile.forward) < std::fabs(smile.strikes[atm] - smile.forward)) atm = k;
+    }
+    const double betaStart = betaFixed_ ? beta_ : 0.5;
+    const double level = std::max(smile.forward + shift_, 1.0e-8);
+    const double alphaStart = (volType_ == Normal)
+        ? smile.vols[atm] / std::pow(level, betaStart)
+        : smile.vols[atm] * std::pow(level, 1.0 - betaStart);
+
+    const SabrCoordinates coordinates{beta_, betaFixed_};
+    SmileCost cost(smile, quotes, volType_, shift_, coordinates);
+    NoConstraint constraint;
+    EndCriteria endCriteria(1000, 100, 1.0e-12, 1.0e-12, 1.0e-12);
+
+    // A few (rho, nu) starting points; keep the best fit
+    const double starts[][2] = {{0.0, 0.4}, {-0.4, 0.8}, {0.4, 0.2}};
+    double bestValue = std::numeric_limits<double>::infinity();
+    Array best;
+    for (const auto& start : starts) {
+        Array x(freeParams);
+        x[0] = std::log(alphaStart);
+        x[1] = std::atanh(start[0] / kRhoBound);
+        x[2] = std::log(start[1]);
+        if (!betaFixed_) x[3] = 0.0;
+
+        Problem problem(cost, constraint, x);
+        LevenbergMarquardt optimizer;
+        try {
+            optimizer.minimize(problem, endCriteria);
+        } catch (...) {
+            continue;
+        }
+        const double value = cost.value(problem.currentValue());
+        if (value < bestValue) {
+            bestValue = value;
+            best = problem.currentValue();
+        }
+    }
+    if (best.empty()) {
+        QUANTRA_ERROR("SABR calibration failed to converge (forward=" + std::to_string(smile.forward) +
+                      ", expiry=" + std::to_string(smile.time) + ")");
+    }
+
+    double weightSum = 0.0;
+    for (size_t k : quotes) weightSum += cost.weight(k);
+    SabrParams p = coordinates.params(best);
+    p.rmsError = std::sqrt(bestValue / weightSum);
+    return p;
+}
+
+} // namespace quantra
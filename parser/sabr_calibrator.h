@@ -0,0 +1,149 @@
+#ifndef QUANTRASERVER_SABR_CALIBRATOR_H
+#define QUANTRASERVER_SABR_CALIBRATOR_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <list>
+#include <cstdlib>
+#include <cstdint>
+
+#include <ql/termstructures/volatility/volatilitytype.hpp>
+
+namespace quantra {
+
+/// Quoted smile of one expiry x tenor node.
+struct SabrSmile {
+    double time = 0.0;                  // option expiry
+    double forward = 0.0;               // ATM forward swap rate
+    std::vector<double> strikes;        // absolute
+    std::vector<double> vols;
+    std::vector<double> weights;        // empty = all 1
+};
+
+struct SabrParams {
+    double alpha = 0.0;
+    double beta = 0.0;
+    double rho = 0.0;
+    double nu = 0.0;
+    double rmsError = 0.0;              // weighted, in vol units
+};
+
+/**
+ * SabrCalibrator - Fits (alpha, rho, nu), and beta unless fixed, to each
+ * node's quoted smile with QuantLib's (shifted) SABR formula.
+ *
+ * Nodes are independent least-squares problems (Levenberg-Marquardt over
+ * alpha = exp(x), rho = tanh(x), nu = exp(x), from a few starting points)
+ * and may be fitted in parallel on a pool kept across calls. The fit
+ * touches no QuantLib observables, so it is safe without the thread-safe
+ * observer pattern.
+ *
+ * Results are cached by a hash of every input (smiles, forwards, times,
+ * vol type, shift, beta): a repeat request with the same quotes and
+ * curves skips calibration.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_SABR_THREADS=<n>              Fitting threads (default: 1, like
+ *                                         QUANTRA_BOOTSTRAP_THREADS)
+ *   QUANTRA_SABR_CACHE_MAX_ENTRIES=256    Max cached calibrations
+ */
+class SabrCalibrator {
+public:
+    SabrCalibrator(QuantLib::VolatilityType volType, double shift, double beta, bool betaFixed)
+        : volType_(volType), shift_(shift), beta_(beta), betaFixed_(betaFixed) {}
+
+    /// One parameter set per smile, in order. Throws when a smile has
+    /// fewer usable quotes than free parameters.
+    std::vector<SabrParams> calibrate(const std::vector<SabrSmile>& smiles) const;
+
+private:
+    std::string cacheKey(const std::vector<SabrSmile>& smiles) const;
+    SabrParams fit(const SabrSmile& smile) const;
+
+    QuantLib::VolatilityType volType_;
+    double shift_;
+    double beta_;
+    bool betaFixed_;
+};
+
+/**
+ * SabrCalibrationCache - LRU of calibrated parameter grids by input hash.
+ * Single-threaded, like the other caches: only the request thread reads
+ * and writes it.
+ */
+class SabrCalibrationCache {
+public:
+    static SabrCalibrationCache& instance() {
+        static SabrCalibrationCache inst;
+        return inst;
+    }
+
+    /// Null on a miss.
+    const std::vector<SabrParams>* get(const std::string& key) {
+        auto it = cacheMap_.find(key);
+        if (it == cacheMap_.end()) {
+            stats_.misses++;
+            return nullptr;
+        }
+        stats_.hits++;
+        lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
+        return &it->second.params;
+    }
+
+    void put(const std::string& key, std::vector<SabrParams> params) {
+        auto it = cacheMap_.find(key);
+        if (it != cacheMap_.end()) {
+            it->second.params = std::move(params);
+            lruList_.splice(lruList_.begin(), lruList_, it->second.lruIt);
+            return;
+        }
+
+        while (cacheMap_.size() >= maxEntries_ && !lruList_.empty()) {
+            cacheMap_.erase(lruList_.back());
+            lruList_.pop_back();
+        }
+
+        lruList_.push_front(key);
+        cacheMap_[key] = Slot{std::move(params), lruList_.begin()};
+    }
+
+    void clear() {
+        cacheMap_.clear();
+        lruList_.clear();
+    }
+
+    size_t size() const { return cacheMap_.size(); }
+
+    // --- Stats ---
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+    };
+
+    const Stats& stats() const { return stats_; }
+    void resetStats() { stats_ = Stats{}; }
+
+private:
+    struct Slot {
+        std::vector<SabrParams> params;
+        std::list<std::string>::iterator lruIt;
+    };
+
+    SabrCalibrationCache() {
+        const char* envMax = std::getenv("QUANTRA_SABR_CACHE_MAX_ENTRIES");
+        if (envMax) {
+            int val = std::atoi(envMax);
+            if (val > 0) maxEntries_ = static_cast<size_t>(val);
+        }
+    }
+
+    size_t maxEntries_ = 256;
+    std::unordered_map<std::string, Slot> cacheMap_;
+    std::list<std::string> lruList_; // front = most recent
+    Stats stats_;
+};
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_SABR_CALIBRATOR_H
@@ -9,6 +9,42 @@ using namespace QuantLib;
 
 namespace quantra {
 
+// =============================================================================
+// Bootstrap accuracy
+// =============================================================================
+
+double TermStructureParser::bootstrapTolerance(enums::BootstrapAccuracy accuracy)
+{
+    switch (accuracy) {
+    case enums::BootstrapAccuracy_Exact:
+        return 1.0e-15;
+    case enums::BootstrapAccuracy_Standard:
+        return 1.0e-12;
+    case enums::BootstrapAccuracy_Fast:
+        return 1.0e-8;
+    default:
+        QUANTRA_ERROR("Unsupported BootstrapAccuracy");
+    }
+    return 1.0e-15;
+}
+
+namespace {
+
+// LogCubic is global: its convergence loop cannot reliably reach 1e-15, so
+// the Exact tier keeps QuantLib's default accuracy there. Global curves never
+// warm start, so no seed or sink; the bootstrap is only there for the deadline.
+template <class Curve>
+typename Curve::bootstrap_type logCubicBootstrap(
+    const quantra::TermStructure* ts, double tolerance, Size maxEvaluations,
+    const std::shared_ptr<const BootstrapDeadline>& deadline)
+{
+    Real accuracy = ts->bootstrap_accuracy() == enums::BootstrapAccuracy_Exact
+        ? Null<Real>() : tolerance;
+    return typename Curve::bootstrap_type(nullptr, nullptr, accuracy, maxEvaluations, deadline);
+}
+
+} // namespace
+
 // =============================================================================
 // Legacy parse (backward compatible, no registries)
 // =============================================================================
@@ -118,11 +154,20 @@ std::shared_ptr<YieldTermStructure> TermStructureParser::parse(
 // =============================================================================
 // Build PiecewiseYieldCurve from helpers
 // =============================================================================
+// Local interpolators bootstrap through WarmStartBootstrap so a seed from a
+// previous solve of the same structure can skip the unchanged pillars; LogCubic
+// is global and always bootstraps from scratch, within the same deadline.
 std::shared_ptr<YieldTermStructure> TermStructureParser::buildCurve(
     const quantra::TermStructure* ts,
     std::vector<std::shared_ptr<RateHelper>>& instruments)
 {
-    double tolerance = 1.0e-15;
+    double tolerance = bootstrapTolerance(ts->bootstrap_accuracy());
+
+    if (ts->bootstrap_max_iterations() < 0)
+        QUANTRA_ERROR("bootstrap_max_iterations must be non-negative");
+    Size maxEvaluations = ts->bootstrap_max_iterations() > 0
+        ? static_cast<Size>(ts->bootstrap_max_iterations())
+        : MAX_FUNCTION_EVALUATIONS;
     
     Date ref;
     if (ts->reference_date()) {
@@ -137,17 +182,17 @@ std::shared_ptr<YieldTermStructure> TermStructureParser::buildCurve(
     case enums::Interpolator_BackwardFlat:
         switch (ts->bootstrap_trait()) {
         case enums::BootstrapTrait_Discount:
-            return std::make_shared<PiecewiseYieldCurve<Discount, BackwardFlat>>(
+            return std::make_shared<WarmStartCurve<Discount, BackwardFlat>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<Discount, BackwardFlat>::bootstrap_type(tolerance));
+                WarmStartCurve<Discount, BackwardFlat>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_ZeroRate:
-            return std::make_shared<PiecewiseYieldCurve<ZeroYield, BackwardFlat>>(
+            return std::make_shared<WarmStartCurve<ZeroYield, BackwardFlat>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<ZeroYield, BackwardFlat>::bootstrap_type(tolerance));
+                WarmStartCurve<ZeroYield, BackwardFlat>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_FwdRate:
-            return std::make_shared<PiecewiseYieldCurve<ForwardRate, BackwardFlat>>(
+            return std::make_shared<WarmStartCurve<ForwardRate, BackwardFlat>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<ForwardRate, BackwardFlat>::bootstrap_type(tolerance));
+                WarmStartCurve<ForwardRate, BackwardFlat>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         default:
             QUANTRA_ERROR("Unsupported BootstrapTrait for BackwardFlat");
         }
@@ -156,17 +201,17 @@ std::shared_ptr<YieldTermStructure> TermStructureParser::buildCurve(
     case enums::Interpolator_ForwardFlat:
         switch (ts->bootstrap_trait()) {
         case enums::BootstrapTrait_Discount:
-            return std::make_shared<PiecewiseYieldCurve<Discount, ForwardFlat>>(
+            return std::make_shared<WarmStartCurve<Discount, ForwardFlat>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<Discount, ForwardFlat>::bootstrap_type(tolerance));
+                WarmStartCurve<Discount, ForwardFlat>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_ZeroRate:
-            return std::make_shared<PiecewiseYieldCurve<ZeroYield, ForwardFlat>>(
+            return std::make_shared<WarmStartCurve<ZeroYield, ForwardFlat>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<ZeroYield, ForwardFlat>::bootstrap_type(tolerance));
+                WarmStartCurve<ZeroYield, ForwardFlat>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_FwdRate:
-            return std::make_shared<PiecewiseYieldCurve<ForwardRate, ForwardFlat>>(
+            return std::make_shared<WarmStartCurve<ForwardRate, ForwardFlat>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<ForwardRate, ForwardFlat>::bootstrap_type(tolerance));
+                WarmStartCurve<ForwardRate, ForwardFlat>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         default:
             QUANTRA_ERROR("Unsupported BootstrapTrait for ForwardFlat");
         }
@@ -175,17 +220,17 @@ std::shared_ptr<YieldTermStructure> TermStructureParser::buildCurve(
     case enums::Interpolator_Linear:
         switch (ts->bootstrap_trait()) {
         case enums::BootstrapTrait_Discount:
-            return std::make_shared<PiecewiseYieldCurve<Discount, Linear>>(
+            return std::make_shared<WarmStartCurve<Discount, Linear>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<Discount, Linear>::bootstrap_type(tolerance));
+                WarmStartCurve<Discount, Linear>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_ZeroRate:
-            return std::make_shared<PiecewiseYieldCurve<ZeroYield, Linear>>(
+            return std::make_shared<WarmStartCurve<ZeroYield, Linear>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<ZeroYield, Linear>::bootstrap_type(tolerance));
+                WarmStartCurve<ZeroYield, Linear>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_FwdRate:
-            return std::make_shared<PiecewiseYieldCurve<ForwardRate, Linear>>(
+            return std::make_shared<WarmStartCurve<ForwardRate, Linear>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<ForwardRate, Linear>::bootstrap_type(tolerance));
+                WarmStartCurve<ForwardRate, Linear>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         default:
             QUANTRA_ERROR("Unsupported BootstrapTrait for Linear");
         }
@@ -194,17 +239,17 @@ std::shared_ptr<YieldTermStructure> TermStructureParser::buildCurve(
     case enums::Interpolator_LogLinear:
         switch (ts->bootstrap_trait()) {
         case enums::BootstrapTrait_Discount:
-            return std::make_shared<PiecewiseYieldCurve<Discount, LogLinear>>(
+            return std::make_shared<WarmStartCurve<Discount, LogLinear>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<Discount, LogLinear>::bootstrap_type(tolerance));
+                WarmStartCurve<Discount, LogLinear>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_ZeroRate:
-            return std::make_shared<PiecewiseYieldCurve<ZeroYield, LogLinear>>(
+            return std::make_shared<WarmStartCurve<ZeroYield, LogLinear>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<ZeroYield, LogLinear>::bootstrap_type(tolerance));
+                WarmStartCurve<ZeroYield, LogLinear>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_FwdRate:
-            return std::make_shared<PiecewiseYieldCurve<ForwardRate, LogLinear>>(
+            return std::make_shared<WarmStartCurve<ForwardRate, LogLinear>>(
                 ref, instruments, dc,
-                PiecewiseYieldCurve<ForwardRate, LogLinear>::bootstrap_type(tolerance));
+                WarmStartCurve<ForwardRate, LogLinear>::bootstrap_type(warmSeed_, warmSink_, tolerance, maxEvaluations, deadline_));
         default:
             QUANTRA_ERROR("Unsupported BootstrapTrait for LogLinear");
         }
@@ -213,14 +258,17 @@ std::shared_ptr<YieldTermStructure> TermStructureParser::buildCurve(
     case enums::Interpolator_LogCubic:
         switch (ts->bootstrap_trait()) {
         case enums::BootstrapTrait_Discount:
-            return std::make_shared<PiecewiseYieldCurve<Discount, LogCubic>>(
-                ref, instruments, dc, MonotonicLogCubic());
+            return std::make_shared<WarmStartCurve<Discount, LogCubic>>(
+                ref, instruments, dc, MonotonicLogCubic(),
+                logCubicBootstrap<WarmStartCurve<Discount, LogCubic>>(ts, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_ZeroRate:
-            return std::make_shared<PiecewiseYieldCurve<ZeroYield, LogCubic>>(
-                ref, instruments, dc, MonotonicLogCubic());
+            return std::make_shared<WarmStartCurve<ZeroYield, LogCubic>>(
+                ref, instruments, dc, MonotonicLogCubic(),
+                logCubicBootstrap<WarmStartCurve<ZeroYield, LogCubic>>(ts, tolerance, maxEvaluations, deadline_));
         case enums::BootstrapTrait_FwdRate:
-            return std::make_shared<PiecewiseYieldCurve<ForwardRate, LogCubic>>(
-                ref, instruments, dc, MonotonicLogCubic());
+            return std::make_shared<WarmStartCurve<ForwardRate, LogCubic>>(
+                ref, instruments, dc, MonotonicLogCubic(),
+                logCubicBootstrap<WarmStartCurve<ForwardRate, LogCubic>>(ts, tolerance, maxEvaluations, deadline_));
         default:
             QUANTRA_ERROR("Unsupported BootstrapTrait for LogCubic");
         }
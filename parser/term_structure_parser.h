@@ -10,6 +10,7 @@
 
 #include "term_structure_generated.h"
 #include "term_structure_point_parser.h"
+#include "warm_start_bootstrap.h"
 #include "quote_registry.h"
 #include "curve_registry.h"
 #include "index_registry.h"
@@ -37,6 +38,29 @@ public:
         const IndexRegistry* indices,
         double bump = 0.0);
 
+    /**
+     * Seed the next parse() with a previous solve of the same curve structure
+     * and/or capture its solved nodes into `sink`. Only curves with local
+     * interpolators use either; pass nullptrs to reset.
+     */
+    void setWarmStart(
+        std::shared_ptr<const BootstrapSeed> seed,
+        std::shared_ptr<BootstrapSeed> sink) {
+        warmSeed_ = std::move(seed);
+        warmSink_ = std::move(sink);
+    }
+
+    /**
+     * Abort bootstraps of subsequent parse() calls with BootstrapTimeout once
+     * `deadline` has passed; nullptr to reset.
+     */
+    void setDeadline(std::shared_ptr<const BootstrapDeadline> deadline) {
+        deadline_ = std::move(deadline);
+    }
+
+    /// Solver tolerance of a bootstrap_accuracy tier.
+    static double bootstrapTolerance(quantra::enums::BootstrapAccuracy accuracy);
+
 private:
     std::shared_ptr<QuantLib::YieldTermStructure> buildCurve(
         const quantra::TermStructure* ts,
@@ -48,6 +72,10 @@ private:
         const std::vector<QuantLib::Rate>& zeroRates,
         QuantLib::Compounding compounding,
         QuantLib::Frequency frequency);
+
+    std::shared_ptr<const BootstrapSeed> warmSeed_;
+    std::shared_ptr<BootstrapSeed> warmSink_;
+    std::shared_ptr<const BootstrapDeadline> deadline_;
 };
 
 } // namespace quantra
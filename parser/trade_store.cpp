@@ -0,0 +1,142 @@
+#include "trade_store.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace quantra {
+
+namespace {
+
+/// Re-packs a table as the root of its own buffer.
+template <class Table>
+void pack(flatbuffers::FlatBufferBuilder& fbb, const Table* table) {
+    std::unique_ptr<typename Table::NativeTableType> native(table->UnPack());
+    fbb.Finish(Table::Pack(fbb, native.get()));
+}
+
+} // namespace
+
+const char* TradeStore::productName(Product product) {
+    switch (product) {
+        case Product::FixedRateBond: return "FixedRateBond";
+        case Product::VanillaSwap:   return "VanillaSwap";
+        case Product::CDS:           return "CDS";
+        case Product::CapFloor:      return "CapFloor";
+    }
+    return "Unknown";
+}
+
+void TradeStore::upsert(const quantra::StoredTrade* trade) {
+    if (!trade->id() || trade->id()->size() == 0) {
+        QUANTRA_ERROR("StoredTrade.id is required");
+    }
+    const std::string id = trade->id()->str();
+
+    const int products = (trade->fixed_rate_bond() != nullptr) + (trade->vanilla_swap() != nullptr) +
+                         (trade->cds() != nullptr) + (trade->cap_floor() != nullptr);
+    if (products != 1) {
+        QUANTRA_ERROR("StoredTrade '" + id + "' must set exactly one product");
+    }
+
+    flatbuffers::FlatBufferBuilder fbb;
+    Product product;
+    if (trade->fixed_rate_bond()) {
+        pack(fbb, trade->fixed_rate_bond());
+        product = Product::FixedRateBond;
+    } else if (trade->vanilla_swap()) {
+        pack(fbb, trade->vanilla_swap());
+        product = Product::VanillaSwap;
+    } else if (trade->cds()) {
+        pack(fbb, trade->cds());
+        product = Product::CDS;
+    } else {
+        pack(fbb, trade->cap_floor());
+        product = Product::CapFloor;
+    }
+
+    auto existing = rowById_.find(id);
+    if (existing != rowById_.end()) kill(existing->second);
+    const std::string book = trade->book_id() ? trade->book_id()->str() : std::string();
+    append(id, trade->book_id() ? &book : nullptr, product, fbb.GetBufferPointer(), fbb.GetSize());
+    compact();
+}
+
+size_t TradeStore::erase(const std::string& id) {
+    auto it = rowById_.find(id);
+    if (it == rowById_.end()) return 0;
+    kill(it->second);
+    compact();
+    return 1;
+}
+
+size_t TradeStore::eraseBook(const std::string& bookId) {
+    auto book = bookByName_.find(bookId);
+    if (book == bookByName_.end()) return 0;
+    size_t erased = 0;
+    for (uint32_t row = 0; row < ids_.size(); row++) {
+        if (live_[row] && books_[row] == book->second) {
+            kill(row);
+            erased++;
+        }
+    }
+    compact();
+    return erased;
+}
+
+void TradeStore::clear() {
+    ids_.clear();
+    books_.clear();
+    products_.clear();
+    offsets_.clear();
+    sizes_.clear();
+    live_.clear();
+    arena_.clear();
+    deadBytes_ = 0;
+    rowById_.clear();
+    bookNames_.clear();
+    bookByName_.clear();
+}
+
+void TradeStore::append(const std::string& id, const std::string* book, Product product,
+                        const uint8_t* data, size_t size) {
+    uint32_t bookIndex = kNoBook;
+    if (book) {
+        auto inserted = bookByName_.emplace(*book, static_cast<uint32_t>(bookNames_.size()));
+        if (inserted.second) bookNames_.push_back(*book);
+        bookIndex = inserted.first->second;
+    }
+
+    // Keep every table buffer aligned for GetRoot
+    const size_t offset = (arena_.size() + 15) & ~size_t(15);
+    arena_.resize(offset + size);
+    std::copy(data, data + size, arena_.begin() + offset);
+
+    const uint32_t row = static_cast<uint32_t>(ids_.size());
+    ids_.push_back(id);
+    books_.push_back(bookIndex);
+    products_.push_back(product);
+    offsets_.push_back(offset);
+    sizes_.push_back(static_cast<uint32_t>(size));
+    live_.push_back(1);
+    rowById_[id] = row;
+}
+
+void TradeStore::kill(uint32_t row) {
+    live_[row] = 0;
+    deadBytes_ += sizes_[row];
+    rowById_.erase(ids_[row]);
+}
+
+void TradeStore::compact() {
+    if (deadBytes_ * 2 <= arena_.size()) return;
+
+    TradeStore live;
+    for (uint32_t row = 0; row < ids_.size(); row++) {
+        if (!live_[row]) continue;
+        const std::string* book = books_[row] == kNoBook ? nullptr : &bookNames_[books_[row]];
+        live.append(ids_[row], book, products_[row], arena_.data() + offsets_[row], sizes_[row]);
+    }
+    *this = std::move(live);
+}
+
+} // namespace quantra
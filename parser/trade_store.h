@@ -0,0 +1,191 @@
+#ifndef QUANTRASERVER_TRADE_STORE_H
+#define QUANTRASERVER_TRADE_STORE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <exception>
+
+#include "stored_trade_generated.h"
+#include "error.h"
+
+namespace quantra {
+
+/**
+ * TradeStore - Worker-resident trades, stored once by id and priced by
+ * reference (PriceX.trade_id / PriceX.book_id) instead of being resent
+ * with every request.
+ *
+ * Columnar: one row per trade across parallel columns (id, book, product,
+ * offset/size into a byte arena). Each trade's product table is re-packed
+ * on upsert into its own flatbuffer in the arena, so lookups hand the
+ * parsers the same quantra::FixedRateBond* / VanillaSwap* / ... they get
+ * from an inline request. Replaced and deleted rows are tombstoned; the
+ * arena is compacted once more than half of it is dead.
+ *
+ * Table pointers stay valid until the next upsert or delete. Like the
+ * caches, the store is single-threaded: each worker is a single-threaded
+ * process and serves one call at a time. It is also per worker - behind a
+ * load balancer, upserts must reach every worker that prices the trades.
+ *
+ * Stored trades are parsed like inline ones, so with the instrument cache
+ * on (QUANTRA_INSTRUMENT_CACHE_ENABLED=1) their instruments stay
+ * constructed between calls as well.
+ */
+class TradeStore {
+public:
+    enum class Product : uint8_t { FixedRateBond, VanillaSwap, CDS, CapFloor };
+
+    /// One trade to price: the request entry carrying curves and settings,
+    /// and the trade table - inline, or from the store.
+    template <class Pricing, class Trade>
+    struct Item {
+        const Pricing* pricing;
+        const Trade* trade;
+        std::string tradeId;        // empty for inline trades
+        std::string error;          // resolveEach(): why the entry did not resolve (trade is null)
+        uint32_t entry = 0;         // position of the pricing entry in the request
+    };
+
+    static TradeStore& instance() {
+        static TradeStore inst;
+        return inst;
+    }
+
+    /// Stores the trade, replacing any with the same id. Throws when the
+    /// trade has no id or not exactly one product.
+    void upsert(const quantra::StoredTrade* trade);
+
+    /// Number of trades removed.
+    size_t erase(const std::string& id);
+    size_t eraseBook(const std::string& bookId);
+
+    void clear();
+    size_t size() const { return rowById_.size(); }
+
+    /// The stored trade's product table. Throws when the id is unknown or
+    /// holds another product.
+    template <class Trade>
+    const Trade* get(const std::string& id) const {
+        auto it = rowById_.find(id);
+        if (it == rowById_.end()) {
+            QUANTRA_ERROR("Unknown trade id: " + id);
+        }
+        if (products_[it->second] != productOf<Trade>()) {
+            QUANTRA_ERROR("Trade '" + id + "' is not a " + productName(productOf<Trade>()));
+        }
+        return table<Trade>(it->second);
+    }
+
+    /**
+     * Expands a request's pricing entries into the trades to price, in
+     * order: an entry with book_id yields every stored trade of the book
+     * of this product, one with trade_id the stored trade, and any other
+     * its inline trade (inlineTrade(entry)).
+     */
+    template <class Trade, class Pricing, class InlineTrade>
+    std::vector<Item<Pricing, Trade>> resolve(
+        const flatbuffers::Vector<flatbuffers::Offset<Pricing>>* pricings,
+        InlineTrade inlineTrade) const
+    {
+        std::vector<Item<Pricing, Trade>> items;
+        if (!pricings) return items;
+        items.reserve(pricings->size());
+        for (uint32_t i = 0; i < pricings->size(); i++) {
+            resolveEntry(pricings->Get(i), i, inlineTrade, items);
+        }
+        return items;
+    }
+
+    /**
+     * Like resolve(), but an entry whose trade_id or book_id does not
+     * resolve yields one item with a null trade and the reason in `error`,
+     * so handlers that report errors per result can fail just that entry.
+     */
+    template <class Trade, class Pricing, class InlineTrade>
+    std::vector<Item<Pricing, Trade>> resolveEach(
+        const flatbuffers::Vector<flatbuffers::Offset<Pricing>>* pricings,
+        InlineTrade inlineTrade) const
+    {
+        std::vector<Item<Pricing, Trade>> items;
+        if (!pricings) return items;
+        items.reserve(pricings->size());
+        for (uint32_t i = 0; i < pricings->size(); i++) {
+            auto p = pricings->Get(i);
+            try {
+                resolveEntry(p, i, inlineTrade, items);
+            } catch (const std::exception& e) {
+                Item<Pricing, Trade> failed{p, nullptr, std::string(), e.what(), i};
+                if (p->trade_id()) failed.tradeId = p->trade_id()->str();
+                items.push_back(std::move(failed));
+            }
+        }
+        return items;
+    }
+
+private:
+    static constexpr uint32_t kNoBook = UINT32_MAX;
+
+    TradeStore() = default;
+
+    template <class Trade> static Product productOf();
+    static const char* productName(Product product);
+
+    template <class Trade>
+    const Trade* table(uint32_t row) const {
+        return flatbuffers::GetRoot<Trade>(arena_.data() + offsets_[row]);
+    }
+
+    /// Appends the trades of one pricing entry; throws on an unknown
+    /// trade_id or book_id before appending any.
+    template <class Pricing, class Trade, class InlineTrade>
+    void resolveEntry(const Pricing* p, uint32_t entry, InlineTrade& inlineTrade,
+                      std::vector<Item<Pricing, Trade>>& items) const
+    {
+        if (p->book_id()) {
+            auto book = bookByName_.find(p->book_id()->str());
+            if (book == bookByName_.end()) {
+                QUANTRA_ERROR("Unknown book id: " + p->book_id()->str());
+            }
+            for (uint32_t row = 0; row < ids_.size(); row++) {
+                if (live_[row] && books_[row] == book->second && products_[row] == productOf<Trade>()) {
+                    items.push_back({p, table<Trade>(row), ids_[row], std::string(), entry});
+                }
+            }
+        } else if (p->trade_id()) {
+            items.push_back({p, get<Trade>(p->trade_id()->str()), p->trade_id()->str(), std::string(), entry});
+        } else {
+            items.push_back({p, inlineTrade(p), std::string(), std::string(), entry});
+        }
+    }
+
+    void append(const std::string& id, const std::string* book, Product product,
+                const uint8_t* data, size_t size);
+    void kill(uint32_t row);
+    void compact();
+
+    // Columns, one row per upsert (dead rows until compaction)
+    std::vector<std::string> ids_;
+    std::vector<uint32_t> books_;           // into bookNames_, kNoBook without
+    std::vector<Product> products_;
+    std::vector<uint64_t> offsets_;         // into arena_
+    std::vector<uint32_t> sizes_;
+    std::vector<uint8_t> live_;
+
+    std::vector<uint8_t> arena_;            // packed product tables, 16-byte aligned
+    size_t deadBytes_ = 0;
+
+    std::unordered_map<std::string, uint32_t> rowById_;     // live rows only
+    std::vector<std::string> bookNames_;
+    std::unordered_map<std::string, uint32_t> bookByName_;
+};
+
+template <> inline TradeStore::Product TradeStore::productOf<quantra::FixedRateBond>() { return Product::FixedRateBond; }
+template <> inline TradeStore::Product TradeStore::productOf<quantra::VanillaSwap>() { return Product::VanillaSwap; }
+template <> inline TradeStore::Product TradeStore::productOf<quantra::CDS>() { return Product::CDS; }
+template <> inline TradeStore::Product TradeStore::productOf<quantra::CapFloor>() { return Product::CapFloor; }
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_TRADE_STORE_H
@@ -1,4 +1,6 @@
 #include "vanilla_swap_parser.h"
+#include "instrument_cache.h"
+#include "instrument_cache_key.h"
 
 std::shared_ptr<QuantLib::VanillaSwap> VanillaSwapParser::parse(
     const quantra::VanillaSwap *swap,
@@ -29,6 +31,31 @@ std::shared_ptr<QuantLib::VanillaSwap> VanillaSwapParser::parse(
     if (fixedLeg->schedule() == NULL)
         QUANTRA_ERROR("VanillaSwap fixed_leg schedule not found");
 
+    auto floatingLeg = swap->floating_leg();
+    if (floatingLeg->schedule() == NULL)
+        QUANTRA_ERROR("VanillaSwap floating_leg schedule not found");
+
+    if (!floatingLeg->index() || !floatingLeg->index()->id())
+        QUANTRA_ERROR("VanillaSwap floating_leg index.id is required");
+
+    std::string indexId = floatingLeg->index()->id()->str();
+
+    // A cached swap owns its forwarding handle, relinked on every hit
+    InstrumentCache& cache = InstrumentCache::instance();
+    const bool cached = use_instrument_cache_ && cache.enabled() && !forwarding_term_structure_.empty();
+    std::string key;
+    InstrumentCache::Entry entry;
+    if (cached)
+    {
+        key = InstrumentKeyBuilder::vanillaSwap(swap, *indices.getIbor(indexId));
+        if (auto hit = cache.get(key))
+        {
+            hit->forwarding.linkTo(forwarding_term_structure_.currentLink());
+            return std::static_pointer_cast<QuantLib::VanillaSwap>(hit->instrument);
+        }
+        entry.forwarding.linkTo(forwarding_term_structure_.currentLink());
+    }
+
     ScheduleParser scheduleParser;
     auto fixedSchedule = scheduleParser.parse(fixedLeg->schedule());
 
@@ -37,13 +64,6 @@ std::shared_ptr<QuantLib::VanillaSwap> VanillaSwapParser::parse(
     DayCounter fixedDayCounter = DayCounterToQL(fixedLeg->day_counter());
 
     // Parse floating leg
-    auto floatingLeg = swap->floating_leg();
-    if (floatingLeg->schedule() == NULL)
-        QUANTRA_ERROR("VanillaSwap floating_leg schedule not found");
-
-    if (!floatingLeg->index() || !floatingLeg->index()->id())
-        QUANTRA_ERROR("VanillaSwap floating_leg index.id is required");
-
     auto floatingSchedule = scheduleParser.parse(floatingLeg->schedule());
 
     double floatingNotional = floatingLeg->notional();
@@ -51,8 +71,7 @@ std::shared_ptr<QuantLib::VanillaSwap> VanillaSwapParser::parse(
     DayCounter floatingDayCounter = DayCounterToQL(floatingLeg->day_counter());
 
     // Resolve index from registry and clone with forwarding curve
-    std::string indexId = floatingLeg->index()->id()->str();
-    auto iborIndex = indices.getIborWithCurve(indexId, forwarding_term_structure_);
+    auto iborIndex = indices.getIborWithCurve(indexId, cached ? entry.forwarding : forwarding_term_structure_);
 
     if (fixedNotional != floatingNotional) {
         std::cout << "Warning: Fixed and floating notionals differ. Using fixed notional." << std::endl;
@@ -70,6 +89,12 @@ std::shared_ptr<QuantLib::VanillaSwap> VanillaSwapParser::parse(
         floatingDayCounter
     );
 
+    if (cached)
+    {
+        entry.instrument = vanillaSwap;
+        cache.put(key, std::move(entry));
+    }
+
     return vanillaSwap;
 }
 
@@ -5,9 +5,12 @@
  */
 
 #include "vol_surface_parsers.h"
+#include "year_fractions.h"
+#include "sabr_calibrator.h"
 
 #include <ql/termstructures/volatility/swaption/swaptionvolmatrix.hpp>
 #include <ql/termstructures/volatility/interpolatedsmilesection.hpp>
+#include <ql/termstructures/volatility/sabr.hpp>
 #include <ql/math/interpolations/linearinterpolation.hpp>
 #include <algorithm>
 #include <cstdlib>
@@ -186,14 +189,42 @@ void validateTensor3D(const quantra::QuoteTensor3D* t, int n1, int n2, int n3, c
     }
 }
 
-double periodToTime(
+std::vector<double> periodsToTimes(
     const QuantLib::Date& ref,
     const QuantLib::Calendar& cal,
     QuantLib::BusinessDayConvention bdc,
     const QuantLib::DayCounter& dc,
-    const QuantLib::Period& p) {
-    QuantLib::Date d = cal.advance(ref, p, bdc);
-    return dc.yearFraction(ref, d);
+    const std::vector<QuantLib::Period>& periods) {
+    std::vector<QuantLib::Date> dates;
+    dates.reserve(periods.size());
+    for (const auto& p : periods) dates.push_back(cal.advance(ref, p, bdc));
+    return YearFractions::from(dc, ref, dates);
+}
+
+void bracket(const std::vector<double>& grid, double x, size_t& i0, size_t& i1, double& w) {
+    // v1 behavior: outside-grid values are flat-extended at nearest boundary node.
+    if (grid.empty()) {
+        i0 = i1 = 0;
+        w = 0.0;
+        return;
+    }
+    if (x <= grid.front()) {
+        i0 = i1 = 0;
+        w = 0.0;
+        return;
+    }
+    if (x >= grid.back()) {
+        i0 = i1 = grid.size() - 1;
+        w = 0.0;
+        return;
+    }
+    size_t hi = 1;
+    while (hi < grid.size() && grid[hi] < x) hi++;
+    size_t lo = hi - 1;
+    i0 = lo;
+    i1 = hi;
+    double x0 = grid[lo], x1 = grid[hi];
+    w = (x - x0) / (x1 - x0);
 }
 
 class SwaptionSmileCubeCustom : public QuantLib::SwaptionVolatilityStructure {
@@ -244,10 +275,8 @@ public:
         if (!atmForwards_.empty() && static_cast<int>(atmForwards_.size()) != nExp_ * nTen_) {
             QUANTRA_ERROR("SwaptionVolSmileCubeSpec atm_forwards matrix size mismatch");
         }
-        tExp_.reserve(expiries_.size());
-        tTen_.reserve(tenors_.size());
-        for (const auto& p : expiries_) tExp_.push_back(periodToTime(ref, cal, bdc, dc, p));
-        for (const auto& p : tenors_) tTen_.push_back(periodToTime(ref, cal, bdc, dc, p));
+        tExp_ = periodsToTimes(ref, cal, bdc, dc, expiries_);
+        tTen_ = periodsToTimes(ref, cal, bdc, dc, tenors_);
         maxSwapTenor_ = tenors_.empty() ? QuantLib::Period(0, QuantLib::Days) : tenors_.back();
         maxDate_ = ref;
         QuantLib::Date maxExerciseDate = ref;
@@ -340,32 +369,6 @@ private:
         return i * tenors_.size() + j;
     }
 
-    static void bracket(const std::vector<double>& grid, double x, size_t& i0, size_t& i1, double& w) {
-        // v1 behavior: outside-grid values are flat-extended at nearest boundary node.
-        if (grid.empty()) {
-            i0 = i1 = 0;
-            w = 0.0;
-            return;
-        }
-        if (x <= grid.front()) {
-            i0 = i1 = 0;
-            w = 0.0;
-            return;
-        }
-        if (x >= grid.back()) {
-            i0 = i1 = grid.size() - 1;
-            w = 0.0;
-            return;
-        }
-        size_t hi = 1;
-        while (hi < grid.size() && grid[hi] < x) hi++;
-        size_t lo = hi - 1;
-        i0 = lo;
-        i1 = hi;
-        double x0 = grid[lo], x1 = grid[hi];
-        w = (x - x0) / (x1 - x0);
-    }
-
     double nodeVolWithStrike(size_t i, size_t j, double strikeAbs) const {
         double axisX = strikeAbs;
         if (strikeKind_ == quantra::enums::SwaptionStrikeKind_SpreadFromATM) {
@@ -451,6 +454,156 @@ private:
     QuantLib::Rate maxStrike_ = 0.0;
     QuantLib::Period maxSwapTenor_;
 };
+
+/// SABR parameters and ATM forwards on the expiry x tenor grid. Shared by
+/// the cube and the smile sections it hands out.
+struct SabrNodeGrid {
+    QuantLib::VolatilityType volType = QuantLib::ShiftedLognormal;
+    double displacement = 0.0;
+    std::vector<double> tExp;
+    std::vector<double> tTen;
+    std::vector<double> atm;        // [exp][ten] flat, like the parameters
+    std::vector<double> alpha;
+    std::vector<double> beta;
+    std::vector<double> rho;
+    std::vector<double> nu;
+
+    size_t idx2d(size_t i, size_t j) const { return i * tTen.size() + j; }
+
+    double nodeVol(size_t i, size_t j, double strikeAbs) const {
+        const size_t n = idx2d(i, j);
+        double k = strikeAbs;
+        if (volType == QuantLib::ShiftedLognormal) {
+            // Lognormal SABR is undefined at or below -displacement; flat-extend just above it.
+            k = std::max(k, -displacement + 1.0e-6);
+        }
+        return QuantLib::shiftedSabrVolatility(
+            k, atm[n], std::max(tExp[i], 1.0e-8), alpha[n], beta[n], nu[n], rho[n], displacement, volType);
+    }
+
+    double bilinearAtm(double t, double len) const {
+        size_t e0, e1, t0, t1;
+        double we, wt;
+        bracket(tExp, t, e0, e1, we);
+        bracket(tTen, len, t0, t1, wt);
+        const double a0 = atm[idx2d(e0, t0)] * (1 - wt) + atm[idx2d(e0, t1)] * wt;
+        const double a1 = atm[idx2d(e1, t0)] * (1 - wt) + atm[idx2d(e1, t1)] * wt;
+        return a0 * (1 - we) + a1 * we;
+    }
+
+    /// Same total-variance scheme as SwaptionSmileCubeCustom::triLinear.
+    double vol(double t, double len, double strikeAbs) const {
+        size_t e0, e1, t0, t1;
+        double we, wt;
+        bracket(tExp, t, e0, e1, we);
+        bracket(tTen, len, t0, t1, wt);
+        const double eps = 1.0e-12;
+        const double tNode0 = std::max(tExp[e0], eps);
+        const double tNode1 = std::max(tExp[e1], eps);
+        const double tQuery = std::max(t, eps);
+
+        const double w00 = std::pow(nodeVol(e0, t0, strikeAbs), 2.0) * tNode0;
+        const double w01 = std::pow(nodeVol(e0, t1, strikeAbs), 2.0) * tNode0;
+        const double w10 = std::pow(nodeVol(e1, t0, strikeAbs), 2.0) * tNode1;
+        const double w11 = std::pow(nodeVol(e1, t1, strikeAbs), 2.0) * tNode1;
+
+        const double w0 = w00 * (1 - wt) + w01 * wt;
+        const double w1 = w10 * (1 - wt) + w11 * wt;
+        const double w = w0 * (1 - we) + w1 * we;
+        return std::sqrt(std::max(w, 0.0) / tQuery);
+    }
+};
+
+/// Smile of the SABR cube at a fixed (expiry, swap length).
+class SabrCubeSmileSection : public QuantLib::SmileSection {
+public:
+    SabrCubeSmileSection(std::shared_ptr<const SabrNodeGrid> grid,
+                         QuantLib::Time optionTime,
+                         QuantLib::Time swapLength,
+                         const QuantLib::DayCounter& dc)
+        : QuantLib::SmileSection(optionTime, dc, grid->volType, grid->displacement),
+          grid_(std::move(grid)),
+          swapLength_(swapLength) {}
+
+    QuantLib::Real minStrike() const override {
+        return grid_->volType == QuantLib::ShiftedLognormal ? -grid_->displacement : QL_MIN_REAL;
+    }
+    QuantLib::Real maxStrike() const override { return QL_MAX_REAL; }
+    QuantLib::Real atmLevel() const override { return grid_->bilinearAtm(exerciseTime(), swapLength_); }
+
+protected:
+    QuantLib::Volatility volatilityImpl(QuantLib::Rate strike) const override {
+        return grid_->vol(exerciseTime(), swapLength_, strike);
+    }
+
+private:
+    std::shared_ptr<const SabrNodeGrid> grid_;
+    QuantLib::Time swapLength_;
+};
+
+/**
+ * Swaption cube from per-node SABR parameters on server-computed ATM
+ * forwards. Each node's smile is the (shifted) SABR formula at its own
+ * forward and expiry; between nodes, total variance is interpolated as in
+ * SwaptionSmileCubeCustom, flat outside the grid.
+ */
+class SwaptionSabrCubeCustom : public QuantLib::SwaptionVolatilityStructure {
+public:
+    SwaptionSabrCubeCustom(
+        const QuantLib::Date& ref,
+        const QuantLib::Calendar& cal,
+        QuantLib::BusinessDayConvention bdc,
+        const QuantLib::DayCounter& dc,
+        const std::vector<QuantLib::Period>& expiries,
+        const std::vector<QuantLib::Period>& tenors,
+        std::shared_ptr<const SabrNodeGrid> grid)
+        : QuantLib::SwaptionVolatilityStructure(ref, cal, bdc, dc),
+          grid_(std::move(grid)) {
+        enableExtrapolation();
+        maxSwapTenor_ = tenors.empty() ? QuantLib::Period(0, QuantLib::Days) : tenors.back();
+        QuantLib::Date maxExerciseDate = ref;
+        for (const auto& p : expiries) {
+            QuantLib::Date d = cal.advance(ref, p, bdc);
+            if (d > maxExerciseDate) maxExerciseDate = d;
+        }
+        maxDate_ = maxExerciseDate;
+        if (maxSwapTenor_.length() > 0) {
+            QuantLib::Date end = cal.advance(maxExerciseDate, maxSwapTenor_, bdc);
+            if (end > maxDate_) maxDate_ = end;
+        }
+    }
+
+    QuantLib::VolatilityType volatilityType() const override { return grid_->volType; }
+    QuantLib::Date maxDate() const override { return maxDate_; }
+    QuantLib::Rate minStrike() const override {
+        return grid_->volType == QuantLib::ShiftedLognormal ? -grid_->displacement : QL_MIN_REAL;
+    }
+    QuantLib::Rate maxStrike() const override { return QL_MAX_REAL; }
+    const QuantLib::Period& maxSwapTenor() const override { return maxSwapTenor_; }
+    double atmForward(QuantLib::Time optionTime, QuantLib::Time swapLength) const {
+        return grid_->bilinearAtm(optionTime, swapLength);
+    }
+
+protected:
+    QuantLib::Volatility volatilityImpl(QuantLib::Time optionTime, QuantLib::Time swapLength, QuantLib::Rate strike) const override {
+        return grid_->vol(optionTime, swapLength, strike);
+    }
+
+    QuantLib::ext::shared_ptr<QuantLib::SmileSection> smileSectionImpl(
+        QuantLib::Time optionTime, QuantLib::Time swapLength) const override {
+        return QuantLib::ext::make_shared<SabrCubeSmileSection>(grid_, optionTime, swapLength, dayCounter());
+    }
+
+    QuantLib::Real shiftImpl(QuantLib::Time, QuantLib::Time) const override {
+        return grid_->volType == QuantLib::ShiftedLognormal ? grid_->displacement : 0.0;
+    }
+
+private:
+    std::shared_ptr<const SabrNodeGrid> grid_;
+    QuantLib::Date maxDate_;
+    QuantLib::Period maxSwapTenor_;
+};
+
 double resolveVolValue(
     double inlineValue,
     const flatbuffers::String* quoteId,
@@ -765,13 +918,147 @@ SwaptionVolEntry parseSwaptionVol(const quantra::VolSurfaceSpec* spec, const Quo
             }
             const auto* b = payload->base();
             validateIrVolBaseCommon(b, id);
-            QUANTRA_ERROR(
-                "SwaptionSabrParamsSpec requires forward-aware cube wiring (e.g. QuantLib SABR cube with swap indices); "
-                "pure surface construction without forward access is intentionally not supported for vol id: " + id);
+
+            if (!payload->expiries() || !payload->tenors()) {
+                QUANTRA_ERROR("SwaptionSabrParamsSpec grids missing for vol id: " + id);
+            }
+            int nExp = static_cast<int>(payload->expiries()->size());
+            int nTen = static_cast<int>(payload->tenors()->size());
+            if (nExp <= 0 || nTen <= 0) {
+                QUANTRA_ERROR("SwaptionSabrParamsSpec grids empty for vol id: " + id);
+            }
+
+            auto readParams = [&](const quantra::QuoteMatrix2D* m, const std::string& name,
+                                  bool (*valid)(double)) {
+                validateMatrix2D(m, nExp, nTen, id);
+                std::vector<double> out;
+                out.reserve(nExp * nTen);
+                for (int idx = 0; idx < nExp * nTen; ++idx) {
+                    double v = resolveMatrixValue(m, idx, quotes, id);
+                    if (!valid(v)) {
+                        QUANTRA_ERROR("SwaptionSabrParamsSpec " + name + " out of range for vol id: " + id);
+                    }
+                    out.push_back(v);
+                }
+                return out;
+            };
+
+            SwaptionVolEntry entry;
+            entry.sabrAlpha = readParams(payload->alpha(), "alpha", [](double v) { return v > 0.0; });
+            entry.sabrBeta = readParams(payload->beta(), "beta", [](double v) { return v >= 0.0 && v <= 1.0; });
+            entry.sabrRho = readParams(payload->rho(), "rho", [](double v) { return v > -1.0 && v < 1.0; });
+            entry.sabrNu = readParams(payload->nu(), "nu", [](double v) { return v >= 0.0; });
+
+            // The handle is deferred: finalizeSwaptionVolEntryForPricing computes
+            // the ATM forwards from swap_index_id and calls withSwaptionSabrAtm.
+            entry.qlVolType = toQlVolType(b->volatility_type());
+            entry.displacement = b->displacement();
+            entry.referenceDate = DateToQL(b->reference_date()->str());
+            entry.calendar = CalendarToQL(b->calendar());
+            entry.businessDayConvention = ConventionToQL(b->business_day_convention());
+            entry.dayCounter = DayCounterToQL(b->day_counter());
+            entry.volKind = quantra::enums::SwaptionVolKind_SabrParams;
+            entry.constantVol = std::numeric_limits<double>::quiet_NaN();
+            for (auto it = payload->expiries()->begin(); it != payload->expiries()->end(); ++it) {
+                entry.expiries.push_back(toQlPeriod(*it));
+            }
+            for (auto it = payload->tenors()->begin(); it != payload->tenors()->end(); ++it) {
+                entry.tenors.push_back(toQlPeriod(*it));
+            }
+            entry.swapIndexId = wrapperSwapIndexId;
+            entry.strikeKind = quantra::enums::SwaptionStrikeKind_SpreadFromATM;
+            entry.nExp = nExp;
+            entry.nTen = nTen;
+            return entry;
         }
 
-        case quantra::SwaptionVolPayload_SwaptionSabrCalibrateSpec:
-            QUANTRA_ERROR("SwaptionSabrCalibrateSpec not implemented yet for vol id: " + id);
+        case quantra::SwaptionVolPayload_SwaptionSabrCalibrateSpec: {
+            auto* payload = wrapper->payload_as_SwaptionSabrCalibrateSpec();
+            if (!payload || !payload->base()) {
+                QUANTRA_ERROR("SwaptionSabrCalibrateSpec base missing for vol id: " + id);
+            }
+            const auto* b = payload->base();
+            validateIrVolBaseCommon(b, id);
+
+            if (!payload->expiries() || !payload->tenors() || !payload->strikes()) {
+                QUANTRA_ERROR("SwaptionSabrCalibrateSpec grids missing for vol id: " + id);
+            }
+            int nExp = static_cast<int>(payload->expiries()->size());
+            int nTen = static_cast<int>(payload->tenors()->size());
+            int nStr = static_cast<int>(payload->strikes()->size());
+            if (nExp <= 0 || nTen <= 0 || nStr <= 0) {
+                QUANTRA_ERROR("SwaptionSabrCalibrateSpec grids empty for vol id: " + id);
+            }
+            double betaValue = payload->beta_value();
+            if (payload->beta_fixed() && !(betaValue >= 0.0 && betaValue <= 1.0)) {
+                QUANTRA_ERROR("SwaptionSabrCalibrateSpec beta_value must be in [0, 1] for vol id: " + id);
+            }
+
+            // Strikes are spreads from the server-computed ATM forward of each node
+            std::vector<double> strikes;
+            strikes.reserve(nStr);
+            for (auto it = payload->strikes()->begin(); it != payload->strikes()->end(); ++it) {
+                strikes.push_back(*it);
+            }
+            auto dup = std::adjacent_find(strikes.begin(), strikes.end(), [](double x, double y) { return x >= y; });
+            if (dup != strikes.end()) {
+                QUANTRA_ERROR("SwaptionSabrCalibrateSpec strikes must be strictly increasing for vol id: " + id);
+            }
+
+            const auto* t = payload->vols();
+            validateTensor3D(t, nExp, nTen, nStr, id);
+            int expected = nExp * nTen * nStr;
+            std::vector<double> vols;
+            vols.reserve(expected);
+            for (int idx = 0; idx < expected; idx++) {
+                double v = resolveTensorValue(t, idx, quotes, id);
+                if (v <= 0.0) {
+                    QUANTRA_ERROR("SwaptionSabrCalibrateSpec vol must be > 0 for vol id: " + id);
+                }
+                vols.push_back(v);
+            }
+            std::vector<double> weights;
+            if (const auto* w = payload->weights()) {
+                validateTensor3D(w, nExp, nTen, nStr, id);
+                weights.reserve(expected);
+                for (int idx = 0; idx < expected; idx++) {
+                    double v = w->values()->Get(idx);
+                    if (!(v >= 0.0)) {
+                        QUANTRA_ERROR("SwaptionSabrCalibrateSpec weights must be >= 0 for vol id: " + id);
+                    }
+                    weights.push_back(v);
+                }
+            }
+
+            // The handle is deferred: finalizeSwaptionVolEntryForPricing computes
+            // the ATM forwards and calls withSwaptionSabrAtm, which calibrates.
+            SwaptionVolEntry entry;
+            entry.qlVolType = toQlVolType(b->volatility_type());
+            entry.displacement = b->displacement();
+            entry.referenceDate = DateToQL(b->reference_date()->str());
+            entry.calendar = CalendarToQL(b->calendar());
+            entry.businessDayConvention = ConventionToQL(b->business_day_convention());
+            entry.dayCounter = DayCounterToQL(b->day_counter());
+            entry.volKind = quantra::enums::SwaptionVolKind_SabrCalibrate;
+            entry.constantVol = std::numeric_limits<double>::quiet_NaN();
+            for (auto it = payload->expiries()->begin(); it != payload->expiries()->end(); ++it) {
+                entry.expiries.push_back(toQlPeriod(*it));
+            }
+            for (auto it = payload->tenors()->begin(); it != payload->tenors()->end(); ++it) {
+                entry.tenors.push_back(toQlPeriod(*it));
+            }
+            entry.strikes = strikes;
+            entry.swapIndexId = wrapperSwapIndexId;
+            entry.strikeKind = quantra::enums::SwaptionStrikeKind_SpreadFromATM;
+            entry.volsFlat = vols;
+            entry.sabrWeights = weights;
+            entry.sabrBetaFixed = payload->beta_fixed();
+            entry.sabrBetaValue = betaValue;
+            entry.nExp = nExp;
+            entry.nTen = nTen;
+            entry.nStrikes = nStr;
+            return entry;
+        }
 
         default:
             QUANTRA_ERROR("Unknown SwaptionVolPayload type for vol id: " + id);
@@ -916,13 +1203,26 @@ SwaptionVolEntry bumpSwaptionVolEntry(const SwaptionVolEntry& base, double volBu
             return entry;
         }
 
-        case quantra::enums::SwaptionVolKind_SabrParams: {
-            // Placeholder semantics: for now we treat SABR risk as unsupported until
-            // forward-aware SABR cube wiring is implemented.
-            QUANTRA_ERROR("SABR bump semantics are placeholder-only; runtime bumping is not supported yet");
+        case quantra::enums::SwaptionVolKind_SabrParams:
+            QUANTRA_ERROR("Vol bump not supported for SabrParams swaption vols (bump the parameters instead)");
+
+        case quantra::enums::SwaptionVolKind_SabrCalibrate: {
+            // Bump the quotes; finalizeSwaptionVolEntryForPricing recalibrates on the bumped smile.
+            std::vector<double> vols = base.volsFlat;
+            for (auto& v : vols) {
+                v += volBump;
+                if (v <= 0.0) v = 1.0e-8;
+            }
+            entry.volsFlat = vols;
+            entry.atmForwardsFlat.clear();
+            entry.sabrAlpha.clear();
+            entry.sabrBeta.clear();
+            entry.sabrRho.clear();
+            entry.sabrNu.clear();
+            entry.handle = QuantLib::Handle<QuantLib::SwaptionVolatilityStructure>();
+            return entry;
         }
 
-        case quantra::enums::SwaptionVolKind_SabrCalibrate:
         default:
             QUANTRA_ERROR("Vol bump not supported for this swaption vol kind");
     }
@@ -967,4 +1267,84 @@ SwaptionVolEntry withSwaptionSmileCubeAtm(
     return out;
 }
 
+SwaptionVolEntry withSwaptionSabrAtm(
+    const SwaptionVolEntry& base,
+    const std::vector<double>& atmForwardsFlat) {
+    if (base.volKind != quantra::enums::SwaptionVolKind_SabrParams &&
+        base.volKind != quantra::enums::SwaptionVolKind_SabrCalibrate) {
+        return base;
+    }
+    const int nNodes = base.nExp * base.nTen;
+    if (base.nExp <= 0 || base.nTen <= 0) {
+        QUANTRA_ERROR("Invalid SABR cube dimensions while injecting ATM forwards");
+    }
+    if (static_cast<int>(atmForwardsFlat.size()) != nNodes) {
+        QUANTRA_ERROR("ATM forward matrix size mismatch while injecting ATM forwards");
+    }
+
+    auto grid = std::make_shared<SabrNodeGrid>();
+    grid->volType = base.qlVolType;
+    grid->displacement = base.displacement;
+    grid->tExp = periodsToTimes(base.referenceDate, base.calendar, base.businessDayConvention,
+                                base.dayCounter, base.expiries);
+    grid->tTen = periodsToTimes(base.referenceDate, base.calendar, base.businessDayConvention,
+                                base.dayCounter, base.tenors);
+    grid->atm = atmForwardsFlat;
+
+    SwaptionVolEntry out = base;
+    if (base.volKind == quantra::enums::SwaptionVolKind_SabrCalibrate) {
+        const int nStr = base.nStrikes;
+        if (nStr <= 0 || static_cast<int>(base.volsFlat.size()) != nNodes * nStr) {
+            QUANTRA_ERROR("Invalid SABR calibration quote dimensions");
+        }
+        std::vector<SabrSmile> smiles(nNodes);
+        for (int i = 0; i < base.nExp; i++) {
+            for (int j = 0; j < base.nTen; j++) {
+                const int n = i * base.nTen + j;
+                SabrSmile& smile = smiles[n];
+                smile.time = grid->tExp[i];
+                smile.forward = atmForwardsFlat[n];
+                for (int k = 0; k < nStr; k++) {
+                    smile.strikes.push_back(atmForwardsFlat[n] + base.strikes[k]);
+                    smile.vols.push_back(base.volsFlat[n * nStr + k]);
+                    if (!base.sabrWeights.empty()) smile.weights.push_back(base.sabrWeights[n * nStr + k]);
+                }
+            }
+        }
+        SabrCalibrator calibrator(base.qlVolType, base.displacement, base.sabrBetaValue, base.sabrBetaFixed);
+        const std::vector<SabrParams> params = calibrator.calibrate(smiles);
+        out.sabrAlpha.clear();
+        out.sabrBeta.clear();
+        out.sabrRho.clear();
+        out.sabrNu.clear();
+        for (const auto& p : params) {
+            out.sabrAlpha.push_back(p.alpha);
+            out.sabrBeta.push_back(p.beta);
+            out.sabrRho.push_back(p.rho);
+            out.sabrNu.push_back(p.nu);
+        }
+    }
+    if (static_cast<int>(out.sabrAlpha.size()) != nNodes || static_cast<int>(out.sabrBeta.size()) != nNodes ||
+        static_cast<int>(out.sabrRho.size()) != nNodes || static_cast<int>(out.sabrNu.size()) != nNodes) {
+        QUANTRA_ERROR("SABR parameter grid size mismatch");
+    }
+    grid->alpha = out.sabrAlpha;
+    grid->beta = out.sabrBeta;
+    grid->rho = out.sabrRho;
+    grid->nu = out.sabrNu;
+
+    auto qlVol = std::make_shared<SwaptionSabrCubeCustom>(
+        base.referenceDate,
+        base.calendar,
+        base.businessDayConvention,
+        base.dayCounter,
+        base.expiries,
+        base.tenors,
+        grid);
+
+    out.handle = QuantLib::Handle<QuantLib::SwaptionVolatilityStructure>(qlVol);
+    out.atmForwardsFlat = atmForwardsFlat;
+    return out;
+}
+
 } // namespace quantra
@@ -71,6 +71,9 @@ struct SwaptionVolEntry {
     std::vector<double> sabrBeta;
     std::vector<double> sabrRho;
     std::vector<double> sabrNu;
+    std::vector<double> sabrWeights;        // SabrCalibrate: per quote, empty = all 1
+    bool sabrBetaFixed = true;
+    double sabrBetaValue = 0.5;
     int nExp = 0;
     int nTen = 0;
     int nStrikes = 0;
@@ -115,6 +118,14 @@ SwaptionVolEntry withSwaptionSmileCubeAtm(
     const SwaptionVolEntry& base,
     const std::vector<double>& atmForwardsFlat);
 
+/**
+ * Build a SABR cube entry (SabrParams / SabrCalibrate) on server-computed
+ * ATM forwards. SabrCalibrate fits each node's smile first (SabrCalibrator).
+ */
+SwaptionVolEntry withSwaptionSabrAtm(
+    const SwaptionVolEntry& base,
+    const std::vector<double>& atmForwardsFlat);
+
 /**
  * Parse BlackVolSpec from FlatBuffers into QuantLib structure.
  */
@@ -0,0 +1,282 @@
+#ifndef QUANTRASERVER_WARM_START_BOOTSTRAP_H
+#define QUANTRASERVER_WARM_START_BOOTSTRAP_H
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <ql/math/solvers1d/brent.hpp>
+#include <ql/termstructures/bootstraperror.hpp>
+#include <ql/termstructures/bootstraphelper.hpp>
+#include <ql/termstructures/iterativebootstrap.hpp>
+#include <ql/termstructures/yield/piecewiseyieldcurve.hpp>
+
+namespace quantra {
+
+/**
+ * BootstrapSeed - Solved nodes of a previous bootstrap of the same curve
+ * structure (same helpers and conventions, possibly different quotes).
+ *
+ * dates/data are the curve nodes in trait units (DFs, zero or forward rates);
+ * quotes[j] is the quote that was matched at node j + 1.
+ */
+struct BootstrapSeed {
+    std::vector<QuantLib::Date> dates;
+    std::vector<QuantLib::Real> data;
+    std::vector<QuantLib::Real> quotes;
+    /// False when an input outside the quotes changed (e.g. a dependency
+    /// curve): every node is then re-solved, using the seed only as a guess.
+    bool reusePrefix = true;
+};
+
+/**
+ * BootstrapDeadline - Wall-clock limit on the curve bootstraps of a request.
+ */
+struct BootstrapDeadline {
+    std::chrono::steady_clock::time_point at;
+
+    bool expired() const { return std::chrono::steady_clock::now() >= at; }
+};
+
+/// Thrown by a bootstrap that runs into its BootstrapDeadline.
+class BootstrapTimeout : public std::runtime_error {
+public:
+    BootstrapTimeout() : std::runtime_error("bootstrap time budget exceeded") {}
+};
+
+/**
+ * DeadlineGuard - Deadline shared by a bootstrap and its DeadlineHelpers.
+ * The bootstrap disarms it once its first calculation is over.
+ */
+struct DeadlineGuard {
+    std::shared_ptr<const BootstrapDeadline> deadline;
+
+    bool expired() const { return deadline && deadline->expired(); }
+    void check() const {
+        if (expired()) throw BootstrapTimeout();
+    }
+};
+
+/**
+ * DeadlineHelper - Forwards to a rate helper, throwing BootstrapTimeout from
+ * impliedQuote() once the guard's deadline has passed. Every solver
+ * evaluation of a bootstrap goes through impliedQuote(), so this bounds
+ * QuantLib's own solvers as well.
+ */
+template <class TS>
+class DeadlineHelper : public QuantLib::BootstrapHelper<TS> {
+public:
+    DeadlineHelper(std::shared_ptr<QuantLib::BootstrapHelper<TS>> helper,
+                   std::shared_ptr<const DeadlineGuard> guard)
+        : QuantLib::BootstrapHelper<TS>(helper->quote()),
+          helper_(std::move(helper)), guard_(std::move(guard)) {
+        this->registerWith(helper_);
+    }
+
+    QuantLib::Real impliedQuote() const override {
+        guard_->check();
+        return helper_->impliedQuote();
+    }
+    void setTermStructure(TS* ts) override {
+        QuantLib::BootstrapHelper<TS>::setTermStructure(ts);
+        helper_->setTermStructure(ts);
+    }
+    QuantLib::Date earliestDate() const override { return helper_->earliestDate(); }
+    QuantLib::Date maturityDate() const override { return helper_->maturityDate(); }
+    QuantLib::Date latestRelevantDate() const override { return helper_->latestRelevantDate(); }
+    QuantLib::Date pillarDate() const override { return helper_->pillarDate(); }
+    QuantLib::Date latestDate() const override { return helper_->latestDate(); }
+    void accept(QuantLib::AcyclicVisitor& v) override { helper_->accept(v); }
+
+private:
+    std::shared_ptr<QuantLib::BootstrapHelper<TS>> helper_;
+    std::shared_ptr<const DeadlineGuard> guard_;
+};
+
+/**
+ * WarmStartBootstrap - Iterative bootstrap that starts from a previous solve.
+ *
+ * With local interpolators a node only depends on the helpers up to its own
+ * pillar, so nodes before the first changed quote are copied from the seed
+ * and the remaining ones are solved by Brent around their previous value.
+ * Re-bootstrap cost then scales with the changed tail, not the curve length.
+ *
+ * Falls back to QuantLib's IterativeBootstrap when there is no seed, the
+ * pillars differ from the seed, a helper's last relevant date is past its
+ * pillar, or the interpolator is global. If `sink` is set, every successful
+ * calculation writes the solved nodes to it for the next request.
+ *
+ * If `deadline` is set, the first calculation throws BootstrapTimeout once it
+ * has passed: up front, before falling back, and on every solver evaluation
+ * of either path (the curve's helpers are wrapped in DeadlineHelpers). Later
+ * calculations are unbounded.
+ */
+template <class Curve>
+class WarmStartBootstrap {
+    typedef typename Curve::traits_type Traits;
+    typedef typename Curve::interpolator_type Interpolator;
+
+public:
+    explicit WarmStartBootstrap(
+        std::shared_ptr<const BootstrapSeed> seed = nullptr,
+        std::shared_ptr<BootstrapSeed> sink = nullptr,
+        QuantLib::Real accuracy = 1.0e-12,
+        QuantLib::Size maxEvaluations = MAX_FUNCTION_EVALUATIONS,
+        std::shared_ptr<const BootstrapDeadline> deadline = nullptr)
+        : seed_(std::move(seed)), sink_(std::move(sink)),
+          accuracy_(accuracy), maxEvaluations_(maxEvaluations),
+          cold_(accuracy, QuantLib::Null<QuantLib::Real>(), QuantLib::Null<QuantLib::Real>(),
+                1, 2.0, 2.0, false, 10, maxEvaluations) {
+        if (deadline) {
+            guard_ = std::make_shared<DeadlineGuard>();
+            guard_->deadline = std::move(deadline);
+        }
+    }
+
+    void setup(Curve* ts) {
+        ts_ = ts;
+        // Wrapped before the curve registers with its helpers
+        if (guard_) {
+            for (auto& helper : ts_->instruments_) {
+                helper = std::make_shared<DeadlineHelper<QuantLib::YieldTermStructure>>(
+                    helper, guard_);
+            }
+        }
+        cold_.setup(ts);
+    }
+
+    void calculate() const {
+        // The seed and the deadline are only good for the first calculation;
+        // later ones (e.g. a moved evaluation date) go through the regular
+        // bootstrap.
+        auto seed = std::move(seed_);
+        seed_.reset();
+        auto guard = std::move(guard_);
+        guard_.reset();
+        try {
+            solve(seed.get(), guard.get());
+        } catch (...) {
+            if (guard) guard->deadline.reset();
+            throw;
+        }
+        if (guard) guard->deadline.reset();
+        record();
+    }
+
+private:
+    /// Initial bracket half-width around the previous node value.
+    static constexpr QuantLib::Real kStep = 1.0e-4;
+
+    void solve(const BootstrapSeed* seed, const DeadlineGuard* guard) const {
+        if (guard) guard->check();
+        if (seed && !Interpolator::global && calculateWarm(*seed))
+            return;
+        // A failed warm solve may have used up the budget
+        if (guard) guard->check();
+        try {
+            cold_.calculate();
+        } catch (const std::exception&) {
+            // IterativeBootstrap reports a helper's BootstrapTimeout as a
+            // failure at that pillar
+            if (guard && guard->expired()) throw BootstrapTimeout();
+            throw;
+        }
+    }
+
+    bool calculateWarm(const BootstrapSeed& seed) const {
+        auto& instruments = ts_->instruments_;
+        const QuantLib::Size n = instruments.size();
+        if (seed.dates.size() != n + 1 || seed.data.size() != n + 1 ||
+            seed.quotes.size() != n)
+            return false;
+
+        std::sort(instruments.begin(), instruments.end(),
+                  QuantLib::detail::BootstrapHelperSorter());
+
+        std::vector<QuantLib::Date> dates(n + 1);
+        dates[0] = Traits::initialDate(ts_);
+        if (dates[0] != seed.dates[0]) return false;
+        for (QuantLib::Size j = 0; j < n; ++j) {
+            const auto& helper = instruments[j];
+            if (!helper->quote()->isValid()) return false;
+            dates[j + 1] = helper->pillarDate();
+            if (dates[j + 1] != seed.dates[j + 1] ||
+                helper->latestRelevantDate() != dates[j + 1])
+                return false;
+        }
+
+        QuantLib::Size firstChanged = 0;
+        if (seed.reusePrefix) {
+            while (firstChanged < n &&
+                   instruments[firstChanged]->quote()->value() == seed.quotes[firstChanged])
+                ++firstChanged;
+        }
+
+        ts_->dates_ = dates;
+        ts_->times_.resize(n + 1);
+        for (QuantLib::Size i = 0; i <= n; ++i)
+            ts_->times_[i] = ts_->timeFromReference(dates[i]);
+        ts_->maxDate_ = dates.back();
+        ts_->data_ = seed.data;
+
+        for (auto& helper : instruments)
+            helper->setTermStructure(const_cast<Curve*>(ts_));
+
+        ts_->interpolation_ = ts_->interpolator_.interpolate(
+            ts_->times_.begin(), ts_->times_.end(), ts_->data_.begin());
+        ts_->interpolation_.update();
+
+        QuantLib::Brent solver;
+        solver.setMaxEvaluations(maxEvaluations_);
+        for (QuantLib::Size i = firstChanged + 1; i <= n; ++i) {
+            QuantLib::Real min = Traits::minValueAfter(i, ts_, true, 0);
+            QuantLib::Real max = Traits::maxValueAfter(i, ts_, true, 0);
+            QuantLib::Real guess = std::min(std::max(ts_->data_[i], min), max);
+            QuantLib::BootstrapError<Curve> error(ts_, instruments[i - 1], i);
+            solver.setLowerBound(min);
+            solver.setUpperBound(max);
+            try {
+                solver.solve(error, accuracy_, guess, kStep);
+            } catch (const BootstrapTimeout&) {
+                throw;
+            } catch (...) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void record() const {
+        if (!sink_) return;
+        const auto& instruments = ts_->instruments_;
+        if (ts_->dates_.size() != instruments.size() + 1) {
+            // Expired helpers were dropped; nothing reusable to record.
+            *sink_ = BootstrapSeed();
+            return;
+        }
+        sink_->dates = ts_->dates_;
+        sink_->data = ts_->data_;
+        sink_->quotes.clear();
+        for (const auto& helper : instruments)
+            sink_->quotes.push_back(helper->quote()->value());
+        sink_->reusePrefix = true;
+    }
+
+    Curve* ts_ = nullptr;
+    mutable std::shared_ptr<const BootstrapSeed> seed_;
+    std::shared_ptr<BootstrapSeed> sink_;
+    mutable std::shared_ptr<DeadlineGuard> guard_;
+    QuantLib::Real accuracy_;
+    QuantLib::Size maxEvaluations_;
+    QuantLib::IterativeBootstrap<Curve> cold_;
+};
+
+/// PiecewiseYieldCurve bootstrapped with WarmStartBootstrap.
+template <class Traits, class Interpolator>
+using WarmStartCurve = QuantLib::PiecewiseYieldCurve<Traits, Interpolator, WarmStartBootstrap>;
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_WARM_START_BOOTSTRAP_H
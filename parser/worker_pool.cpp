@@ -0,0 +1,61 @@
+#include "worker_pool.h"
+
+namespace quantra {
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& t : threads_) {
+        t.join();
+    }
+}
+
+void WorkerPool::run(size_t helpers, const std::function<void()>& work) {
+    std::lock_guard<std::mutex> serial(runMutex_);
+    if (helpers == 0) {
+        work();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (threads_.size() < helpers) {
+            threads_.emplace_back([this] { loop(); });
+        }
+        work_ = &work;
+        unclaimed_ = helpers;
+        running_ = helpers;
+        ++generation_;
+    }
+    wake_.notify_all();
+    work();
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return running_ == 0; });
+    work_ = nullptr;
+}
+
+size_t WorkerPool::threads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return threads_.size();
+}
+
+void WorkerPool::loop() {
+    // Each thread takes a run at most once; a run claims exactly `helpers`
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        wake_.wait(lock, [&] { return stop_ || (generation_ != seen && unclaimed_ > 0); });
+        if (stop_) return;
+        seen = generation_;
+        --unclaimed_;
+        const std::function<void()>* work = work_;
+        lock.unlock();
+        (*work)();
+        lock.lock();
+        if (--running_ == 0) done_.notify_one();
+    }
+}
+
+} // namespace quantra
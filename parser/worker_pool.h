@@ -0,0 +1,54 @@
+#ifndef QUANTRASERVER_WORKER_POOL_H
+#define QUANTRASERVER_WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace quantra {
+
+/**
+ * WorkerPool - Helper threads kept across calls, so parallel sections do
+ * not start threads per request.
+ *
+ * run() hands the same work function to the calling thread and to a number
+ * of helpers; the work itself splits the items (typically an atomic index
+ * over a vector). Threads are started on demand, the first time a run asks
+ * for more helpers than the pool has, and joined when the pool is destroyed.
+ * Runs are serialized; work must not call run() on the same pool.
+ */
+class WorkerPool {
+public:
+    WorkerPool() = default;
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// Runs `work` on the calling thread and on `helpers` pool threads;
+    /// returns once every one of them has finished. `work` must not throw.
+    void run(size_t helpers, const std::function<void()>& work);
+
+    size_t threads() const;
+
+private:
+    void loop();
+
+    std::vector<std::thread> threads_;
+    std::mutex runMutex_;
+    mutable std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void()>* work_ = nullptr;
+    uint64_t generation_ = 0;
+    size_t unclaimed_ = 0;
+    size_t running_ = 0;
+    bool stop_ = false;
+};
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_WORKER_POOL_H
@@ -0,0 +1,144 @@
+#include "year_fractions.h"
+
+#include <cstdlib>
+#include <string>
+
+#include "common.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+namespace {
+
+enum class Convention { Other, Actual360, Actual365Fixed, BondBasis, EurobondBasis, ActualActualISDA };
+
+Convention recognise(const DayCounter& dc) {
+    if (dc.empty()) return Convention::Other;
+    const std::string name = dc.name();
+    if (name == "Actual/360") return Convention::Actual360;
+    if (name == "Actual/365 (Fixed)") return Convention::Actual365Fixed;
+    if (name == "30/360 (Bond Basis)") return Convention::BondBasis;
+    if (name == "30E/360 (Eurobond Basis)") return Convention::EurobondBasis;
+    if (name == "Actual/Actual (ISDA)") return Convention::ActualActualISDA;
+    return Convention::Other;
+}
+
+bool batchEnabled() {
+    static const bool enabled = [] {
+        const char* env = std::getenv("QUANTRA_DAYCOUNT_BATCH");
+        return !(env && std::string(env) == "0");
+    }();
+    return enabled;
+}
+
+/// Actual/360 and Actual/365 (Fixed): no per-date branches, so the loop
+/// vectorizes.
+void actual(const std::vector<Date::serial_type>& s, const std::vector<Date::serial_type>& e,
+            Real basis, std::vector<Time>& out) {
+    const size_t n = s.size();
+    for (size_t k = 0; k < n; k++) {
+        out[k] = static_cast<Real>(e[k] - s[k]) / basis;
+    }
+}
+
+/// Thirty360::ISMA_Impl (Bond Basis) and Thirty360::EU_Impl (Eurobond Basis).
+void thirty360(const std::vector<Date::serial_type>& s, const std::vector<Date::serial_type>& e,
+               bool eurobond, std::vector<Time>& out) {
+    const size_t n = s.size();
+    for (size_t k = 0; k < n; k++) {
+        const Date d1(s[k]), d2(e[k]);
+        Day dd1 = d1.dayOfMonth(), dd2 = d2.dayOfMonth();
+        const Integer mm1 = d1.month(), mm2 = d2.month();
+        const Year yy1 = d1.year(), yy2 = d2.year();
+        if (dd1 == 31) dd1 = 30;
+        if (dd2 == 31 && (eurobond || dd1 == 30)) dd2 = 30;
+        const Date::serial_type days = 360 * (yy2 - yy1) + 30 * (mm2 - mm1) + (dd2 - dd1);
+        out[k] = days / 360.0;
+    }
+}
+
+/// ActualActual::ISDA_Impl.
+Time actualActualISDA(const Date& d1, const Date& d2) {
+    if (d1 == d2) return 0.0;
+    if (d1 > d2) return -actualActualISDA(d2, d1);
+    const Year y1 = d1.year(), y2 = d2.year();
+    const Real dib1 = Date::isLeap(y1) ? 366.0 : 365.0;
+    const Real dib2 = Date::isLeap(y2) ? 366.0 : 365.0;
+    Time sum = y2 - y1 - 1;
+    sum += daysBetween(d1, Date(1, January, y1 + 1)) / dib1;
+    sum += daysBetween(Date(1, January, y2), d2) / dib2;
+    return sum;
+}
+
+std::vector<Time> compute(Convention convention,
+                          const std::vector<Date::serial_type>& s,
+                          const std::vector<Date::serial_type>& e) {
+    std::vector<Time> out(s.size());
+    switch (convention) {
+    case Convention::Actual360:
+        actual(s, e, 360.0, out);
+        break;
+    case Convention::Actual365Fixed:
+        actual(s, e, 365.0, out);
+        break;
+    case Convention::BondBasis:
+        thirty360(s, e, false, out);
+        break;
+    case Convention::EurobondBasis:
+        thirty360(s, e, true, out);
+        break;
+    case Convention::ActualActualISDA:
+        for (size_t k = 0; k < s.size(); k++) out[k] = actualActualISDA(Date(s[k]), Date(e[k]));
+        break;
+    case Convention::Other:
+        break;
+    }
+    return out;
+}
+
+/// Serial numbers of the dates; false if one is the null date, which only
+/// dayCounter.yearFraction() handles.
+bool serials(const std::vector<Date>& dates, std::vector<Date::serial_type>& out) {
+    out.resize(dates.size());
+    for (size_t k = 0; k < dates.size(); k++) {
+        if (dates[k] == Date()) return false;
+        out[k] = dates[k].serialNumber();
+    }
+    return true;
+}
+
+} // namespace
+
+std::vector<Time> YearFractions::from(
+    const DayCounter& dayCounter,
+    const Date& start,
+    const std::vector<Date>& ends) {
+    const Convention convention = batchEnabled() ? recognise(dayCounter) : Convention::Other;
+    std::vector<Date::serial_type> e;
+    if (convention != Convention::Other && start != Date() && serials(ends, e)) {
+        return compute(convention, std::vector<Date::serial_type>(e.size(), start.serialNumber()), e);
+    }
+    std::vector<Time> out(ends.size());
+    for (size_t k = 0; k < ends.size(); k++) out[k] = dayCounter.yearFraction(start, ends[k]);
+    return out;
+}
+
+std::vector<Time> YearFractions::between(
+    const DayCounter& dayCounter,
+    const std::vector<Date>& starts,
+    const std::vector<Date>& ends) {
+    if (starts.size() != ends.size()) {
+        QUANTRA_ERROR("YearFractions::between needs as many start dates as end dates");
+    }
+    const Convention convention = batchEnabled() ? recognise(dayCounter) : Convention::Other;
+    std::vector<Date::serial_type> s, e;
+    if (convention != Convention::Other && serials(starts, s) && serials(ends, e)) {
+        return compute(convention, s, e);
+    }
+    std::vector<Time> out(ends.size());
+    for (size_t k = 0; k < ends.size(); k++) out[k] = dayCounter.yearFraction(starts[k], ends[k]);
+    return out;
+}
+
+} // namespace quantra
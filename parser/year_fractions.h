@@ -0,0 +1,48 @@
+#ifndef QUANTRASERVER_YEAR_FRACTIONS_H
+#define QUANTRASERVER_YEAR_FRACTIONS_H
+
+#include <vector>
+
+#include <ql/time/date.hpp>
+#include <ql/time/daycounter.hpp>
+
+namespace quantra {
+
+/**
+ * YearFractions - DayCounter::yearFraction over whole date arrays.
+ *
+ * DayCounter::yearFraction() dispatches through a virtual call per pair of
+ * dates. For the standard conventions the year fractions of a whole array
+ * are computed instead in flat loops over serial numbers, with QuantLib's
+ * own arithmetic so values are identical:
+ *
+ *   Actual/360, Actual/365 (Fixed)        (d2 - d1) / basis
+ *   30/360 (Bond Basis),
+ *   30E/360 (Eurobond Basis)              day-of-month adjusted 30/360 count
+ *   Actual/Actual (ISDA)                  calendar-year split
+ *
+ * The convention is recognised by DayCounter::name(); any other day
+ * counter (including the "inc" last-day variants) goes through
+ * yearFraction() per pair.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_DAYCOUNT_BATCH=0    Always use dayCounter.yearFraction()
+ */
+class YearFractions {
+public:
+    /// dayCounter.yearFraction(start, ends[i]) for every i.
+    static std::vector<QuantLib::Time> from(
+        const QuantLib::DayCounter& dayCounter,
+        const QuantLib::Date& start,
+        const std::vector<QuantLib::Date>& ends);
+
+    /// dayCounter.yearFraction(starts[i], ends[i]); the arrays have the same size.
+    static std::vector<QuantLib::Time> between(
+        const QuantLib::DayCounter& dayCounter,
+        const std::vector<QuantLib::Date>& starts,
+        const std::vector<QuantLib::Date>& ends);
+};
+
+} // namespace quantra
+
+#endif // QUANTRASERVER_YEAR_FRACTIONS_H
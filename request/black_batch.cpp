@@ -0,0 +1,143 @@
+#include "black_batch.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include <ql/pricingengines/bacheliercalculator.hpp>
+#include <ql/pricingengines/blackcalculator.hpp>
+#include <ql/pricingengines/blackformula.hpp>
+
+using namespace QuantLib;
+
+namespace quantra {
+
+namespace {
+
+const double kInvSqrt2 = 0.7071067811865475244;
+const double kInvSqrt2Pi = 0.3989422804014326779;
+
+inline double cumNormal(double x) { return 0.5 * std::erfc(-x * kInvSqrt2); }
+inline double normalDensity(double x) { return kInvSqrt2Pi * std::exp(-0.5 * x * x); }
+
+Option::Type typeOf(double omega) { return omega > 0.0 ? Option::Call : Option::Put; }
+
+} // namespace
+
+bool BlackBatch::enabled() {
+    static const bool enabled = [] {
+        const char* env = std::getenv("QUANTRA_OPTION_BATCH");
+        return !(env && std::string(env) == "0");
+    }();
+    return enabled;
+}
+
+size_t BlackBatch::add(Option::Type type, Model model,
+                       double strike, double forward, double stdDev, double discount,
+                       double displacement, double time) {
+    omega_.push_back(type == Option::Call ? 1.0 : -1.0);
+    model_.push_back(model);
+    strike_.push_back(strike);
+    forward_.push_back(forward);
+    stdDev_.push_back(stdDev);
+    discount_.push_back(discount);
+    displacement_.push_back(model == Model::Black ? displacement : 0.0);
+    time_.push_back(time);
+    return strike_.size() - 1;
+}
+
+bool BlackBatch::closedForm(size_t i) const {
+    if (!enabled() || !(stdDev_[i] >= QL_EPSILON) || !(discount_[i] > 0.0)) return false;
+    if (model_[i] == Model::Bachelier) return true;
+    return strike_[i] + displacement_[i] > 0.0 && forward_[i] + displacement_[i] > 0.0;
+}
+
+void BlackBatch::price() {
+    const size_t n = size();
+    value_.assign(n, 0.0);
+
+    for (size_t i = 0; i < n; i++) {
+        if (!closedForm(i)) {
+            evaluateWithQuantLib(i, false);
+            continue;
+        }
+        const double w = omega_[i], s = stdDev_[i], df = discount_[i];
+        if (model_[i] == Model::Black) {
+            const double f = forward_[i] + displacement_[i];
+            const double k = strike_[i] + displacement_[i];
+            const double d1 = std::log(f / k) / s + 0.5 * s;
+            const double d2 = d1 - s;
+            value_[i] = df * w * (f * cumNormal(w * d1) - k * cumNormal(w * d2));
+        } else {
+            const double d = (forward_[i] - strike_[i]) * w;
+            const double h = d / s;
+            value_[i] = df * (s * normalDensity(h) + d * cumNormal(h));
+        }
+    }
+}
+
+void BlackBatch::priceWithGreeks() {
+    const size_t n = size();
+    value_.assign(n, 0.0);
+    delta_.assign(n, 0.0);
+    gamma_.assign(n, 0.0);
+    vega_.assign(n, 0.0);
+    theta_.assign(n, 0.0);
+
+    for (size_t i = 0; i < n; i++) {
+        if (!closedForm(i) || !(time_[i] > 0.0)) {
+            evaluateWithQuantLib(i, true);
+            continue;
+        }
+        const double w = omega_[i], s = stdDev_[i], df = discount_[i], t = time_[i];
+        if (model_[i] == Model::Black) {
+            const double f = forward_[i] + displacement_[i];
+            const double k = strike_[i] + displacement_[i];
+            const double d1 = std::log(f / k) / s + 0.5 * s;
+            const double d2 = d1 - s;
+            const double nd1 = normalDensity(d1);
+            value_[i] = df * w * (f * cumNormal(w * d1) - k * cumNormal(w * d2));
+            delta_[i] = df * w * cumNormal(w * d1);
+            gamma_[i] = df * nd1 / (f * s);
+            vega_[i] = df * std::sqrt(t) * f * nd1;
+            // BlackCalculator::theta at spot == forward
+            theta_[i] = -(std::log(df) * value_[i] + 0.5 * s * s * f * f * gamma_[i]) / t;
+        } else {
+            const double d = (forward_[i] - strike_[i]) * w;
+            const double h = d / s;
+            const double nh = normalDensity(h);
+            value_[i] = df * (s * nh + d * cumNormal(h));
+            delta_[i] = df * w * cumNormal(h);
+            gamma_[i] = df * nh / s;
+            vega_[i] = df * std::sqrt(t) * nh;
+            BachelierCalculator calc(typeOf(w), strike_[i], forward_[i], s, df);
+            theta_[i] = calc.theta(forward_[i], t);
+        }
+    }
+}
+
+void BlackBatch::evaluateWithQuantLib(size_t i, bool greeks) {
+    const Option::Type type = typeOf(omega_[i]);
+    if (model_[i] == Model::Black) {
+        value_[i] = blackFormula(type, strike_[i], forward_[i], stdDev_[i], discount_[i], displacement_[i]);
+        if (greeks) {
+            const double f = forward_[i] + displacement_[i];
+            BlackCalculator calc(type, strike_[i] + displacement_[i], f, stdDev_[i], discount_[i]);
+            delta_[i] = calc.deltaForward();
+            gamma_[i] = calc.gammaForward();
+            vega_[i] = calc.vega(time_[i]);
+            theta_[i] = calc.theta(f, time_[i]);
+        }
+    } else {
+        value_[i] = bachelierBlackFormula(type, strike_[i], forward_[i], stdDev_[i], discount_[i]);
+        if (greeks) {
+            BachelierCalculator calc(type, strike_[i], forward_[i], stdDev_[i], discount_[i]);
+            delta_[i] = calc.deltaForward();
+            gamma_[i] = calc.gammaForward();
+            vega_[i] = calc.vega(time_[i]);
+            theta_[i] = calc.theta(forward_[i], time_[i]);
+        }
+    }
+}
+
+} // namespace quantra
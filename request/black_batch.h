@@ -0,0 +1,82 @@
+#ifndef QUANTRA_BLACK_BATCH_H
+#define QUANTRA_BLACK_BATCH_H
+
+/**
+ * Closed-form option batch (Black, shifted Black, Bachelier)
+ *
+ * Evaluates many options on a forward - caplets, floorlets, european
+ * swaptions - in flat loops over structure-of-arrays buffers (sign,
+ * strike, forward, stdDev, discount, displacement, time) instead of one
+ * blackFormula call or Black/BachelierCalculator object per option.
+ *
+ * Values follow blackFormula / bachelierBlackFormula; greeks follow
+ * BlackCalculator / BachelierCalculator (deltaForward, gammaForward,
+ * vega(time), theta(forward, time)), with the displacement added to
+ * strike and forward as the engines do. Entries outside the closed form's
+ * domain (stdDev == 0, non-positive shifted strike or forward, non-positive
+ * discount) go through QuantLib's formula or calculator, so edge cases and
+ * errors are QuantLib's. Bachelier theta always comes from
+ * BachelierCalculator.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_OPTION_BATCH=0    Evaluate every entry with QuantLib's formula
+ *                             or calculator (caps/floors: per-trade engines)
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <ql/option.hpp>
+
+namespace quantra {
+
+class BlackBatch {
+public:
+    enum class Model : uint8_t { Black, Bachelier };   // Black takes a displacement
+
+    static bool enabled();
+
+    /// Queues an option; returns its index. time (to expiry) is only used
+    /// by vega and theta.
+    size_t add(QuantLib::Option::Type type, Model model,
+               double strike, double forward, double stdDev, double discount,
+               double displacement = 0.0, double time = 0.0);
+
+    /// Values only.
+    void price();
+
+    /// Values and greeks.
+    void priceWithGreeks();
+
+    double value(size_t i) const { return value_[i]; }
+    double deltaForward(size_t i) const { return delta_[i]; }
+    double gammaForward(size_t i) const { return gamma_[i]; }
+    double vega(size_t i) const { return vega_[i]; }
+    double theta(size_t i) const { return theta_[i]; }
+    size_t size() const { return strike_.size(); }
+
+private:
+    bool closedForm(size_t i) const;
+    void evaluateWithQuantLib(size_t i, bool greeks);
+
+    // Inputs
+    std::vector<double> omega_;             // +1 call, -1 put
+    std::vector<Model> model_;
+    std::vector<double> strike_;
+    std::vector<double> forward_;
+    std::vector<double> stdDev_;
+    std::vector<double> discount_;
+    std::vector<double> displacement_;
+    std::vector<double> time_;
+
+    // Outputs
+    std::vector<double> value_;
+    std::vector<double> delta_;
+    std::vector<double> gamma_;
+    std::vector<double> vega_;
+    std::vector<double> theta_;
+};
+
+} // namespace quantra
+
+#endif // QUANTRA_BLACK_BATCH_H
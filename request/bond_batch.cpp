@@ -0,0 +1,166 @@
+#include "bond_batch.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+
+#include <ql/cashflows/coupon.hpp>
+#include <ql/pricingengines/bond/bondfunctions.hpp>
+#include <ql/pricingengines/bond/discountingbondengine.hpp>
+#include <ql/settings.hpp>
+
+#include "curve_sampler.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+namespace {
+
+bool batchEnabled() {
+    static const bool enabled = [] {
+        const char* env = std::getenv("QUANTRA_BOND_BATCH");
+        return !(env && std::string(env) == "0");
+    }();
+    return enabled;
+}
+
+/// Masked sum of amount * df over [begin, end), in cash-flow order as
+/// CashFlows::npv; masked-out flows add exact zeros.
+double maskedPv(const std::vector<double>& amounts, const std::vector<double>& dfs,
+                const std::vector<double>& mask, size_t begin, size_t end) {
+    double sum = 0.0;
+    for (size_t k = begin; k < end; k++) {
+        sum += amounts[k] * dfs[k] * mask[k];
+    }
+    return sum;
+}
+
+} // namespace
+
+size_t BondBatch::add(const std::shared_ptr<Bond>& bond,
+                      const std::shared_ptr<YieldTermStructure>& discountCurve,
+                      const Date& bpsDate) {
+    Entry entry;
+    entry.bond = bond;
+    entry.curve = discountCurve;
+    entry.valuationDate = discountCurve->referenceDate();
+    entry.bpsDate = bpsDate;
+
+    Result result;
+    result.settlementDate = bond->settlementDate();
+
+    entry.begin = dates_.size();
+    if (batchEnabled()) {
+        // DiscountingBondEngine without an explicit includeSettlementDateFlows
+        const bool includeRefDateFlows = Settings::instance().includeReferenceDateEvents();
+        for (const auto& cf : bond->cashflows()) {
+            const bool npv = !cf->hasOccurred(entry.valuationDate, includeRefDateFlows) &&
+                             !cf->tradingExCoupon(entry.valuationDate);
+            const bool settlement = !cf->hasOccurred(result.settlementDate, false) &&
+                                    !cf->tradingExCoupon(result.settlementDate);
+            const bool bps = bpsDate != Date() &&
+                             !cf->hasOccurred(bpsDate, false) && !cf->tradingExCoupon(bpsDate);
+            if (!npv && !settlement && !bps) continue;
+            auto coupon = std::dynamic_pointer_cast<Coupon>(cf);
+            dates_.push_back(cf->date().serialNumber());
+            amounts_.push_back(cf->amount());
+            inNpv_.push_back(npv ? 1.0 : 0.0);
+            inSettlement_.push_back(settlement ? 1.0 : 0.0);
+            inBps_.push_back(bps ? 1.0 : 0.0);
+            bpsWeights_.push_back(coupon ? coupon->nominal() * coupon->accrualPeriod() : 0.0);
+        }
+    }
+    entry.end = dates_.size();
+
+    bonds_.push_back(std::move(entry));
+    results_.push_back(result);
+    return bonds_.size() - 1;
+}
+
+void BondBatch::price() {
+    if (!batchEnabled()) {
+        priceWithEngine();
+        return;
+    }
+
+    // Bonds by discounting curve, in first-seen order
+    std::vector<const YieldTermStructure*> curveOrder;
+    std::unordered_map<const YieldTermStructure*, std::vector<size_t>> byCurve;
+    for (size_t i = 0; i < bonds_.size(); i++) {
+        auto& group = byCurve[bonds_[i].curve.get()];
+        if (group.empty()) curveOrder.push_back(bonds_[i].curve.get());
+        group.push_back(i);
+    }
+
+    dfs_.assign(dates_.size(), 0.0);
+    for (const YieldTermStructure* key : curveOrder) {
+        const std::vector<size_t>& group = byCurve[key];
+        const auto& curve = bonds_[group.front()].curve;
+
+        // One sorted evaluation over all dates the group needs
+        std::vector<Date::serial_type> serials;
+        for (size_t i : group) {
+            const Entry& e = bonds_[i];
+            serials.insert(serials.end(), dates_.begin() + e.begin, dates_.begin() + e.end);
+            serials.push_back(e.valuationDate.serialNumber());
+            serials.push_back(results_[i].settlementDate.serialNumber());
+            if (e.bpsDate != Date()) serials.push_back(e.bpsDate.serialNumber());
+        }
+        std::sort(serials.begin(), serials.end());
+        serials.erase(std::unique(serials.begin(), serials.end()), serials.end());
+
+        std::vector<Date> gridDates(serials.size());
+        for (size_t k = 0; k < serials.size(); k++) gridDates[k] = Date(serials[k]);
+        const std::vector<double> gridDfs = CurveSampler::discounts(curve, gridDates);
+        auto dfAt = [&](Date::serial_type s) {
+            return gridDfs[std::lower_bound(serials.begin(), serials.end(), s) - serials.begin()];
+        };
+
+        for (size_t i : group) {
+            const Entry& e = bonds_[i];
+            for (size_t k = e.begin; k < e.end; k++) dfs_[k] = dfAt(dates_[k]);
+
+            Result& r = results_[i];
+            const double npv = maskedPv(amounts_, dfs_, inNpv_, e.begin, e.end);
+            const double settlementPv = maskedPv(amounts_, dfs_, inSettlement_, e.begin, e.end);
+            r.npv = (e.begin == e.end) ? 0.0 : npv / dfAt(e.valuationDate.serialNumber());
+            const double settlementValue = (e.begin == e.end)
+                ? 0.0 : settlementPv / dfAt(r.settlementDate.serialNumber());
+
+            // Bond::dirtyPrice / cleanPrice / accruedAmount
+            const double notional = e.bond->notional(r.settlementDate);
+            r.dirtyPrice = (notional == 0.0) ? 0.0 : settlementValue * 100.0 / notional;
+            r.accruedAmount = e.bond->accruedAmount(r.settlementDate);
+            r.cleanPrice = r.dirtyPrice - r.accruedAmount;
+
+            // BondFunctions::bps: CashFlows::bps over the coupons, per 100 notional
+            if (e.bpsDate != Date()) {
+                const double bpsNotional = e.bond->notional(e.bpsDate);
+                if (bpsNotional == 0.0 || e.begin == e.end) {
+                    r.bps = BondFunctions::bps(*e.bond, *e.curve, e.bpsDate);
+                } else {
+                    const double sum = maskedPv(bpsWeights_, dfs_, inBps_, e.begin, e.end);
+                    r.bps = 1.0e-4 * sum / dfAt(e.bpsDate.serialNumber()) * 100.0 / bpsNotional;
+                }
+            }
+        }
+    }
+}
+
+void BondBatch::priceWithEngine() {
+    for (size_t i = 0; i < bonds_.size(); i++) {
+        const Entry& e = bonds_[i];
+        e.bond->setPricingEngine(std::make_shared<DiscountingBondEngine>(
+            Handle<YieldTermStructure>(e.curve)));
+        Result& r = results_[i];
+        r.npv = e.bond->NPV();
+        r.dirtyPrice = e.bond->dirtyPrice();
+        r.cleanPrice = e.bond->cleanPrice();
+        r.accruedAmount = e.bond->accruedAmount(r.settlementDate);
+        if (e.bpsDate != Date()) r.bps = BondFunctions::bps(*e.bond, *e.curve, e.bpsDate);
+    }
+}
+
+} // namespace quantra
@@ -0,0 +1,83 @@
+#ifndef QUANTRA_BOND_BATCH_H
+#define QUANTRA_BOND_BATCH_H
+
+/**
+ * Bond batch pricing
+ *
+ * Prices many bonds against their discounting curves without a
+ * DiscountingBondEngine per bond. Each bond's cash flows that count for
+ * its NPV or settlement value are copied into structure-of-arrays buffers
+ * (serial date, amount, two inclusion masks), the discount factors of each
+ * curve are evaluated once over the sorted, de-duplicated dates of all its
+ * bonds (CurveSampler), and NPV, dirty/clean price and accrued come from
+ * masked reductions over the buffers, in cash-flow order.
+ *
+ * The results follow DiscountingBondEngine and Bond::dirtyPrice/cleanPrice:
+ * NPV at the curve reference date, settlement value at the bond's
+ * settlement date, both with QuantLib's hasOccurred/tradingExCoupon rules.
+ * When asked for, the basis-point sensitivity (BondFunctions::bps) reuses
+ * the same discount factors, weighted by each coupon's nominal times
+ * accrual period.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_BOND_BATCH=0    Price each bond with a DiscountingBondEngine
+ */
+
+#include <memory>
+#include <vector>
+
+#include <ql/instruments/bond.hpp>
+#include <ql/termstructures/yieldtermstructure.hpp>
+
+namespace quantra {
+
+class BondBatch {
+public:
+    struct Result {
+        double npv = 0.0;
+        double dirtyPrice = 0.0;
+        double cleanPrice = 0.0;
+        double accruedAmount = 0.0;
+        double bps = 0.0;                   // only with a bps date
+        QuantLib::Date settlementDate;
+    };
+
+    /// Queues a bond; returns its index in results(). With a non-null
+    /// bpsDate, Result::bps is BondFunctions::bps at that date.
+    size_t add(const std::shared_ptr<QuantLib::Bond>& bond,
+               const std::shared_ptr<QuantLib::YieldTermStructure>& discountCurve,
+               const QuantLib::Date& bpsDate = QuantLib::Date());
+
+    /// Prices all queued bonds.
+    void price();
+
+    const Result& result(size_t i) const { return results_[i]; }
+    size_t size() const { return bonds_.size(); }
+
+private:
+    struct Entry {
+        std::shared_ptr<QuantLib::Bond> bond;
+        std::shared_ptr<QuantLib::YieldTermStructure> curve;
+        QuantLib::Date valuationDate;
+        QuantLib::Date bpsDate;
+        size_t begin = 0, end = 0;          // flow range in the buffers
+    };
+
+    void priceWithEngine();
+
+    std::vector<Entry> bonds_;
+    std::vector<Result> results_;
+
+    // Flow buffers, bonds back to back
+    std::vector<QuantLib::Date::serial_type> dates_;
+    std::vector<double> amounts_;
+    std::vector<double> inNpv_;           // 1.0 if the flow counts for the NPV
+    std::vector<double> inSettlement_;    // 1.0 if it counts at settlement
+    std::vector<double> inBps_;           // 1.0 if it counts at the bps date
+    std::vector<double> bpsWeights_;      // coupon nominal * accrual period
+    std::vector<double> dfs_;
+};
+
+} // namespace quantra
+
+#endif // QUANTRA_BOND_BATCH_H
@@ -0,0 +1,42 @@
+#ifndef QUANTRASERVER_BOND_YIELD_ANALYTICS_HANDLER_H
+#define QUANTRASERVER_BOND_YIELD_ANALYTICS_HANDLER_H
+
+#include "call_data_base.h"
+#include "product_registry.h"
+#include "bond_yield_analytics_request.h"
+#include "bond_yield_analytics_request_generated.h"
+#include "bond_yield_analytics_response_generated.h"
+
+using quantra::BondYieldAnalyticsRequest;
+using quantra::BondYieldAnalyticsResponse;
+using quantra::BondYieldAnalyticsResponseBuilder;
+
+class BondYieldAnalyticsData : public CallDataGeneric<
+    BondYieldAnalyticsRequest,
+    BondYieldAnalyticsRequestHandler,
+    BondYieldAnalyticsResponse,
+    BondYieldAnalyticsResponseBuilder>
+{
+public:
+    BondYieldAnalyticsData(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq)
+        : CallDataGeneric(service, cq)
+    {
+    }
+
+protected:
+    void RequestCall() override
+    {
+        service_->RequestBondYieldAnalytics(
+            &ctx_, &request_msg, &responder_, cq_, cq_, this);
+    }
+
+    void CreateService(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq) override
+    {
+        auto handler = new BondYieldAnalyticsData(service, cq);
+        handler->start();
+    }
+};
+
+REGISTER_PRODUCT(BondYieldAnalytics, BondYieldAnalyticsData);
+
+#endif // QUANTRASERVER_BOND_YIELD_ANALYTICS_HANDLER_H
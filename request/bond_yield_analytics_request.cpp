@@ -0,0 +1,122 @@
+#include "bond_yield_analytics_request.h"
+
+#include <sstream>
+
+#include "bond_yield_batch.h"
+#include "common.h"
+#include "common_parser.h"
+#include "error.h"
+#include "fixed_rate_bond_parser.h"
+
+using namespace QuantLib;
+using namespace quantra;
+
+namespace {
+
+struct Item {
+    std::shared_ptr<FixedRateBond> bond;
+    size_t yieldIndex = 0;      // in the batch, at the bond's settlement date
+    size_t riskIndex = 0;       // in the batch, at the risk date
+    std::string error;
+};
+
+} // namespace
+
+flatbuffers::Offset<BondYieldAnalyticsResponse> BondYieldAnalyticsRequestHandler::request(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+    const BondYieldAnalyticsRequest* request) const
+{
+    if (!request->as_of_date()) {
+        QUANTRA_ERROR("as_of_date is required");
+    }
+    Settings::instance().evaluationDate() = DateToQL(request->as_of_date()->str());
+    const Date riskDate = request->settlement_date()
+        ? DateToQL(request->settlement_date()->str()) : Date();
+
+    // Parse every bond and extract its flows into one batch
+    FixedRateBondParser bondParser;
+    YieldParser yieldParser;
+    BondYieldBatch analytics;
+    auto quotes = request->bonds();
+    std::vector<Item> items(quotes->size());
+    for (flatbuffers::uoffset_t i = 0; i < quotes->size(); i++) {
+        auto q = quotes->Get(i);
+        Item& item = items[i];
+        try {
+            item.bond = bondParser.parse(q->fixed_rate_bond());
+            auto yield = yieldParser.parse(q->yield());
+            BondYieldBatch::Convention convention{yield->day_counter, yield->compounding, yield->frequency};
+
+            const Date settlement = item.bond->settlementDate();
+            item.yieldIndex = analytics.add(item.bond, settlement, convention);
+            item.riskIndex = (riskDate == Date() || riskDate == settlement)
+                ? item.yieldIndex : analytics.add(item.bond, riskDate, convention);
+        } catch (const std::exception& e) {
+            item.error = e.what();
+            item.bond.reset();
+        }
+    }
+
+    std::vector<flatbuffers::Offset<BondYieldAnalyticsResult>> results;
+    results.reserve(items.size());
+    for (flatbuffers::uoffset_t i = 0; i < quotes->size(); i++) {
+        auto q = quotes->Get(i);
+        Item& item = items[i];
+
+        double cleanPrice = 0.0, dirtyPrice = 0.0, accruedAmount = 0.0, yield = 0.0, accruedDays = 0.0;
+        BondYieldBatch::Risk risk;
+        Date settlement;
+        if (item.bond) {
+            try {
+                settlement = analytics.settlementDate(item.yieldIndex);
+                accruedAmount = item.bond->accruedAmount(settlement);
+                if (q->quote_type() == BondQuoteType_Yield) {
+                    yield = q->yield_rate();
+                    dirtyPrice = analytics.dirtyPrice(item.yieldIndex, yield);
+                    cleanPrice = dirtyPrice - accruedAmount;
+                } else {
+                    cleanPrice = q->clean_price();
+                    yield = analytics.yield(item.yieldIndex, cleanPrice);
+                    dirtyPrice = cleanPrice + accruedAmount;
+                }
+                accruedDays = BondFunctions::accruedDays(*item.bond, settlement);
+                risk = analytics.risk(item.riskIndex, yield);
+            } catch (const std::exception& e) {
+                item.error = e.what();
+            }
+        }
+
+        if (!item.error.empty()) {
+            auto msg = builder->CreateString(item.error);
+            ErrorBuilder eb(*builder);
+            eb.add_error_message(msg);
+            auto err = eb.Finish();
+
+            BondYieldAnalyticsResultBuilder rb(*builder);
+            rb.add_error(err);
+            results.push_back(rb.Finish());
+            continue;
+        }
+
+        std::ostringstream os;
+        os << QuantLib::io::iso_date(settlement);
+        auto settlementStr = builder->CreateString(os.str());
+
+        BondYieldAnalyticsResultBuilder rb(*builder);
+        rb.add_clean_price(cleanPrice);
+        rb.add_dirty_price(dirtyPrice);
+        rb.add_accrued_amount(accruedAmount);
+        rb.add_yield(yield);
+        rb.add_accrued_days(accruedDays);
+        rb.add_macaulay_duration(risk.macaulayDuration);
+        rb.add_modified_duration(risk.modifiedDuration);
+        rb.add_convexity(risk.convexity);
+        rb.add_settlement_date(settlementStr);
+        results.push_back(rb.Finish());
+    }
+
+    auto resultsVec = builder->CreateVector(results);
+    BondYieldAnalyticsResponseBuilder response(*builder);
+    response.add_results(resultsVec);
+    return response.Finish();
+}
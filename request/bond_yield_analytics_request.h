@@ -0,0 +1,28 @@
+#ifndef QUANTRA_BOND_YIELD_ANALYTICS_REQUEST_H
+#define QUANTRA_BOND_YIELD_ANALYTICS_REQUEST_H
+
+#include <ql/quantlib.hpp>
+
+#include "flatbuffers/grpc.h"
+
+#include "bond_yield_analytics_request_generated.h"
+#include "bond_yield_analytics_response_generated.h"
+
+/**
+ * BondYieldAnalyticsRequestHandler - Price/yield conversion without curves.
+ *
+ * Each bond comes with a clean price or a yield under its own convention;
+ * the other one, the accrued, and duration/convexity at that yield are
+ * computed by BondYieldBatch over all bonds of the request. There is no
+ * Pricing block, so no curve is parsed or bootstrapped. A bond that fails
+ * (bad schedule, non-tradable at settlement, no yield for the price)
+ * carries its error in its own result.
+ */
+class BondYieldAnalyticsRequestHandler {
+public:
+    flatbuffers::Offset<quantra::BondYieldAnalyticsResponse> request(
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+        const quantra::BondYieldAnalyticsRequest* request) const;
+};
+
+#endif // QUANTRA_BOND_YIELD_ANALYTICS_REQUEST_H
@@ -0,0 +1,231 @@
+#include "bond_yield_batch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include <ql/cashflows/coupon.hpp>
+#include <ql/pricingengines/bond/bondfunctions.hpp>
+
+#include "bracketed_newton.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+namespace {
+
+bool batchEnabled() {
+    static const bool enabled = [] {
+        const char* env = std::getenv("QUANTRA_BOND_YIELD_BATCH");
+        return !(env && std::string(env) == "0");
+    }();
+    return enabled;
+}
+
+/// The discount time CashFlows accumulates from lastDate to the flow
+/// (getStepwiseDiscountTime in cashflows.cpp), reference periods included.
+Time stepwiseTime(const std::shared_ptr<CashFlow>& cf, const DayCounter& dc,
+                  const Date& npvDate, const Date& lastDate) {
+    const Date cashFlowDate = cf->date();
+    Date refStartDate, refEndDate;
+    auto coupon = std::dynamic_pointer_cast<Coupon>(cf);
+    if (coupon) {
+        refStartDate = coupon->referencePeriodStart();
+        refEndDate = coupon->referencePeriodEnd();
+    } else {
+        refStartDate = (lastDate == npvDate) ? cashFlowDate - 1 * Years : lastDate;
+        refEndDate = cashFlowDate;
+    }
+
+    if (coupon && lastDate != coupon->accrualStartDate()) {
+        const Time couponPeriod = dc.yearFraction(coupon->accrualStartDate(), cashFlowDate,
+                                                  refStartDate, refEndDate);
+        const Time accruedPeriod = dc.yearFraction(coupon->accrualStartDate(), lastDate,
+                                                   refStartDate, refEndDate);
+        return couponPeriod - accruedPeriod;
+    }
+    return dc.yearFraction(lastDate, cashFlowDate, refStartDate, refEndDate);
+}
+
+/// Whether a step of length t compounds simply under the convention.
+bool simpleStep(Compounding comp, Real freq, Time t) {
+    switch (comp) {
+    case Simple:
+        return true;
+    case SimpleThenCompounded:
+        return t <= 1.0 / freq;
+    case CompoundedThenSimple:
+        return t > 1.0 / freq;
+    default:
+        return false;
+    }
+}
+
+/// InterestRate::compoundFactor.
+Real compoundFactor(Rate r, Compounding comp, Real freq, Time t) {
+    if (comp == Continuous) return std::exp(r * t);
+    if (simpleStep(comp, freq, t)) return 1.0 + r * t;
+    return std::pow(1.0 + r / freq, freq * t);
+}
+
+/// d/dr of log(discountFactor(t)).
+Real logDiscountSlope(Rate r, Compounding comp, Real freq, Time t) {
+    if (comp == Continuous) return -t;
+    if (simpleStep(comp, freq, t)) return -t / (1.0 + r * t);
+    return -t / (1.0 + r / freq);
+}
+
+bool needsFrequency(Compounding comp) {
+    return comp == Compounded || comp == SimpleThenCompounded || comp == CompoundedThenSimple;
+}
+
+} // namespace
+
+size_t BondYieldBatch::add(const std::shared_ptr<Bond>& bond,
+                           const Date& settlementDate,
+                           const Convention& convention) {
+    Entry entry;
+    entry.bond = bond;
+    entry.settlementDate = (settlementDate == Date()) ? bond->settlementDate() : settlementDate;
+    entry.convention = convention;
+    entry.notional = bond->notional(entry.settlementDate);
+    entry.batched = batchEnabled() && entry.notional != 0.0 &&
+                    !(needsFrequency(convention.compounding) &&
+                      (convention.frequency == Once || convention.frequency == NoFrequency));
+
+    entry.begin = amounts_.size();
+    if (entry.batched) {
+        // CashFlows::npv/duration/convexity with npvDate = settlementDate
+        Date lastDate = entry.settlementDate;
+        Time t = 0.0;
+        for (const auto& cf : bond->cashflows()) {
+            if (cf->hasOccurred(entry.settlementDate, false)) continue;
+            const double amount = cf->tradingExCoupon(entry.settlementDate) ? 0.0 : cf->amount();
+            if (amount < 0.0) entry.batched = false;
+            const Time step = stepwiseTime(cf, convention.dayCounter, entry.settlementDate, lastDate);
+            t += step;
+            amounts_.push_back(amount);
+            steps_.push_back(step);
+            times_.push_back(t);
+            lastDate = cf->date();
+        }
+    }
+    entry.end = amounts_.size();
+
+    bonds_.push_back(std::move(entry));
+    return bonds_.size() - 1;
+}
+
+InterestRate BondYieldBatch::rate(const Entry& e, Rate y) const {
+    return InterestRate(y, e.convention.dayCounter, e.convention.compounding, e.convention.frequency);
+}
+
+void BondYieldBatch::npv(const Entry& e, Rate y, double& value, double& derivative) const {
+    const Compounding comp = e.convention.compounding;
+    const Real freq = e.convention.frequency;
+    double discount = 1.0, slope = 0.0;
+    value = 0.0;
+    derivative = 0.0;
+    for (size_t k = e.begin; k < e.end; k++) {
+        discount *= 1.0 / compoundFactor(y, comp, freq, steps_[k]);
+        slope += logDiscountSlope(y, comp, freq, steps_[k]);
+        value += amounts_[k] * discount;
+        derivative += amounts_[k] * discount * slope;
+    }
+}
+
+Rate BondYieldBatch::yield(size_t i, Real cleanPrice, Real accuracy,
+                           Size maxIterations, Rate guess) const {
+    const Entry& e = bonds_[i];
+    auto fallback = [&] {
+        return BondFunctions::yield(*e.bond, Bond::Price(cleanPrice, Bond::Price::Clean),
+                                    e.convention.dayCounter, e.convention.compounding,
+                                    e.convention.frequency, e.settlementDate,
+                                    accuracy, maxIterations, guess);
+    };
+    if (!e.batched || e.begin == e.end) return fallback();
+
+    // BondFunctions::yield target: dirty price in amount units
+    Real target = cleanPrice + e.bond->accruedAmount(e.settlementDate);
+    target /= 100.0 / e.notional;
+    if (!(target > 0.0)) return fallback();
+
+    // With non-negative flows the price falls monotonically in y. Below
+    // the floor some step's compound factor stops being positive.
+    const Compounding comp = e.convention.compounding;
+    const Real freq = e.convention.frequency;
+    Rate floor = -std::numeric_limits<Real>::infinity();
+    for (size_t k = e.begin; k < e.end; k++) {
+        if (comp == Continuous || steps_[k] <= 0.0) continue;
+        floor = std::max(floor, simpleStep(comp, freq, steps_[k]) ? -1.0 / steps_[k] : -freq);
+    }
+    if (!std::isfinite(floor)) floor = -1.0;
+
+    auto f = [&](Rate y, double& derivative) {
+        double value;
+        npv(e, y, value, derivative);
+        return value - target;
+    };
+    Rate y;
+    if (bracketedNewton(f, guess, floor, accuracy, maxIterations, y)) return y;
+    return fallback();
+}
+
+Real BondYieldBatch::dirtyPrice(size_t i, Rate y) const {
+    const Entry& e = bonds_[i];
+    if (!e.batched) return BondFunctions::dirtyPrice(*e.bond, rate(e, y), e.settlementDate);
+
+    double value, derivative;
+    npv(e, y, value, derivative);
+    return value * 100.0 / e.notional;
+}
+
+BondYieldBatch::Risk BondYieldBatch::risk(size_t i, Rate y) const {
+    const Entry& e = bonds_[i];
+    Risk risk;
+    if (!e.batched) {
+        const InterestRate r = rate(e, y);
+        risk.modifiedDuration = BondFunctions::duration(*e.bond, r, Duration::Modified, e.settlementDate);
+        risk.macaulayDuration = BondFunctions::duration(*e.bond, r, Duration::Macaulay, e.settlementDate);
+        risk.convexity = BondFunctions::convexity(*e.bond, r, e.settlementDate);
+        return risk;
+    }
+
+    // CashFlows::modifiedDuration and CashFlows::convexity in one pass
+    const Compounding comp = e.convention.compounding;
+    const Real N = e.convention.frequency;
+    double P = 0.0, dPdy = 0.0, d2Pdy2 = 0.0;
+    for (size_t k = e.begin; k < e.end; k++) {
+        const double c = amounts_[k];
+        const Time t = times_[k];
+        const DiscountFactor B = 1.0 / compoundFactor(y, comp, N, t);
+        P += c * B;
+        if (comp == Continuous) {
+            dPdy -= c * B * t;
+            d2Pdy2 += c * B * t * t;
+        } else if (simpleStep(comp, N, t)) {
+            dPdy -= c * B * B * t;
+            d2Pdy2 += c * 2.0 * B * B * B * t * t;
+        } else {
+            dPdy -= c * t * B / (1 + y / N);
+            d2Pdy2 += c * B * t * (N * t + 1) / (N * (1 + y / N) * (1 + y / N));
+        }
+    }
+    if (P != 0.0) {
+        risk.modifiedDuration = -dPdy / P;
+        risk.convexity = d2Pdy2 / P;
+    }
+    if (comp == Compounded) {
+        risk.macaulayDuration = (1.0 + y / N) * risk.modifiedDuration;
+    } else {
+        // QuantLib requires a compounded rate here
+        risk.macaulayDuration = BondFunctions::duration(*e.bond, rate(e, y), Duration::Macaulay,
+                                                        e.settlementDate);
+    }
+    return risk;
+}
+
+} // namespace quantra
@@ -0,0 +1,97 @@
+#ifndef QUANTRA_BOND_YIELD_BATCH_H
+#define QUANTRA_BOND_YIELD_BATCH_H
+
+/**
+ * Bond yield analytics in batch
+ *
+ * Yield, duration and convexity of many bonds from one extraction of their
+ * cash flows. add() walks a bond's leg once, applying QuantLib's
+ * hasOccurred/tradingExCoupon rules at the settlement date, and stores each
+ * remaining flow's amount and its stepwise discount time (the reference-
+ * period-aware year fractions CashFlows uses) in structure-of-arrays
+ * buffers shared by all bonds. Day counting happens there, once per flow;
+ * the solves below are pure arithmetic over the buffers.
+ *
+ *   yield()       safeguarded Newton on the dirty price with its analytic
+ *                 derivative, bracketed so every step stays in the rate's domain
+ *   dirtyPrice()  the price-yield relation itself, one pass
+ *   risk()        modified/Macaulay duration and convexity from a single pass
+ *
+ * All follow BondFunctions::yield/dirtyPrice/duration/convexity. Whatever
+ * the kernels do not cover - non-tradable bonds, negative flows, no
+ * bracket, no convergence, Macaulay duration of a non-compounded rate -
+ * goes through BondFunctions, so errors are QuantLib's.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_BOND_YIELD_BATCH=0    Use BondFunctions for every bond
+ */
+
+#include <memory>
+#include <vector>
+
+#include <ql/instruments/bond.hpp>
+#include <ql/time/daycounter.hpp>
+
+namespace quantra {
+
+class BondYieldBatch {
+public:
+    struct Convention {
+        QuantLib::DayCounter dayCounter;
+        QuantLib::Compounding compounding = QuantLib::Compounded;
+        QuantLib::Frequency frequency = QuantLib::Annual;
+    };
+
+    struct Risk {
+        double modifiedDuration = 0.0;
+        double macaulayDuration = 0.0;
+        double convexity = 0.0;
+    };
+
+    /// Queues a bond valued at settlementDate (null: the bond's own
+    /// settlement date) under a yield convention; returns its index.
+    size_t add(const std::shared_ptr<QuantLib::Bond>& bond,
+               const QuantLib::Date& settlementDate,
+               const Convention& convention);
+
+    /// BondFunctions::yield of bond i for a clean price per 100 notional.
+    QuantLib::Rate yield(size_t i, QuantLib::Real cleanPrice,
+                         QuantLib::Real accuracy = 1.0e-10,
+                         QuantLib::Size maxIterations = 100,
+                         QuantLib::Rate guess = 0.05) const;
+
+    /// BondFunctions::dirtyPrice of bond i at yield y, per 100 notional.
+    QuantLib::Real dirtyPrice(size_t i, QuantLib::Rate y) const;
+
+    /// BondFunctions::duration (both kinds) and convexity of bond i at y.
+    Risk risk(size_t i, QuantLib::Rate y) const;
+
+    const QuantLib::Date& settlementDate(size_t i) const { return bonds_[i].settlementDate; }
+    size_t size() const { return bonds_.size(); }
+
+private:
+    struct Entry {
+        std::shared_ptr<QuantLib::Bond> bond;
+        QuantLib::Date settlementDate;
+        Convention convention;
+        double notional = 0.0;
+        bool batched = false;               // false: BondFunctions only
+        size_t begin = 0, end = 0;          // flow range in the buffers
+    };
+
+    QuantLib::InterestRate rate(const Entry& e, QuantLib::Rate y) const;
+
+    /// CashFlows::npv at y and its derivative in y.
+    void npv(const Entry& e, QuantLib::Rate y, double& value, double& derivative) const;
+
+    std::vector<Entry> bonds_;
+
+    // Flow buffers, bonds back to back
+    std::vector<double> amounts_;           // zero for ex-coupon flows
+    std::vector<double> steps_;             // stepwise discount time from the previous flow
+    std::vector<double> times_;             // cumulative time from settlement
+};
+
+} // namespace quantra
+
+#endif // QUANTRA_BOND_YIELD_BATCH_H
@@ -45,4 +45,35 @@ public:
 
 REGISTER_PRODUCT(BootstrapCurves, BootstrapCurvesData);
 
+/**
+ * BootstrapCurvesStreamData - Server-streaming BootstrapCurves: one response
+ * message per query, written as each curve is sampled.
+ */
+class BootstrapCurvesStreamData : public StreamingCallDataGeneric<
+    BootstrapCurvesRequest,
+    BootstrapCurvesRequestHandler::Stream,
+    BootstrapCurvesResponse>
+{
+public:
+    BootstrapCurvesStreamData(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq)
+        : StreamingCallDataGeneric(service, cq)
+    {
+    }
+
+    void RequestCall() override
+    {
+        service_->RequestBootstrapCurvesStream(
+            &ctx_, &request_msg, &writer_,
+            cq_, cq_, this);
+    }
+
+    void CreateService(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq) override
+    {
+        auto handler = new BootstrapCurvesStreamData(service, cq);
+        handler->start();
+    }
+};
+
+REGISTER_PRODUCT(BootstrapCurvesStream, BootstrapCurvesStreamData);
+
 #endif
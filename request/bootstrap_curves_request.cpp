@@ -2,6 +2,11 @@
 
 #include <set>
 
+#include "business_day_calendar.h"
+#include "curve_sampler.h"
+#include "sample_encoding.h"
+#include "year_fractions.h"
+
 using namespace QuantLib;
 using namespace quantra;
 
@@ -24,8 +29,7 @@ const quantra::TermStructure* findCurveSpecById(
 
 } // namespace
 
-flatbuffers::Offset<BootstrapCurvesResponse> BootstrapCurvesRequestHandler::request(
-    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+BootstrapCurvesRequestHandler::Session BootstrapCurvesRequestHandler::prepare(
     const BootstrapCurvesRequest* request) const {
     if (!request || !request->pricing()) {
         QUANTRA_ERROR("BootstrapCurvesRequest.pricing is required");
@@ -34,148 +38,206 @@ flatbuffers::Offset<BootstrapCurvesResponse> BootstrapCurvesRequestHandler::requ
         QUANTRA_ERROR("BootstrapCurvesRequest.queries is required");
     }
 
-    PricingRegistry reg;
-    std::string pricingBuildError;
+    // Only the queried curves (and their dependencies) are bootstrapped.
+    PricingDemand demand;
+    for (flatbuffers::uoffset_t i = 0; i < request->queries()->size(); i++) {
+        const auto* query = request->queries()->Get(i);
+        if (query) demand.addCurve(query->curve_id());
+    }
+
+    Session session;
+    session.request = request;
     try {
         PricingRegistryBuilder regBuilder;
-        reg = regBuilder.build(request->pricing());
+        session.reg = regBuilder.build(request->pricing(), &demand);
     } catch (const std::exception& e) {
-        pricingBuildError = e.what();
+        session.pricingBuildError = e.what();
     }
-    const Date asOfDate = DateToQL(request->pricing()->as_of_date()->str());
+    session.asOfDate = DateToQL(request->pricing()->as_of_date()->str());
+    return session;
+}
+
+flatbuffers::Offset<BootstrapCurvesResponse> BootstrapCurvesRequestHandler::request(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+    const BootstrapCurvesRequest* request) const {
+    const Session session = prepare(request);
 
     std::vector<flatbuffers::Offset<BootstrapCurveResult>> results;
     auto querySpecs = request->queries();
     for (flatbuffers::uoffset_t i = 0; i < querySpecs->size(); i++) {
-        const auto* query = querySpecs->Get(i);
-        std::string curveId = (query && query->curve_id()) ? query->curve_id()->str() : "";
+        results.push_back(sampleQuery(builder, session, querySpecs->Get(i)));
+    }
 
-        try {
-            if (!pricingBuildError.empty()) {
-                QUANTRA_ERROR(pricingBuildError);
-            }
-            if (curveId.empty()) {
-                QUANTRA_ERROR("CurveQuerySpec.curve_id is required");
-            }
-            if (!query->grid()) {
-                QUANTRA_ERROR("CurveQuerySpec.grid is required for curve_id: " + curveId);
-            }
-            if (!query->measures() || query->measures()->size() == 0) {
-                QUANTRA_ERROR("CurveQuerySpec.measures is required for curve_id: " + curveId);
-            }
+    auto resultsVec = builder->CreateVector(results);
+    auto staleCurves = staleCurvesVector(*builder, session.reg);
+    BootstrapCurvesResponseBuilder responseBuilder(*builder);
+    responseBuilder.add_results(resultsVec);
+    responseBuilder.add_stale_curves(staleCurves);
+    return responseBuilder.Finish();
+}
 
-            auto regIt = reg.curves.find(curveId);
-            if (regIt == reg.curves.end() || !regIt->second || regIt->second->empty()) {
-                QUANTRA_ERROR("Curve id not found in PricingRegistry: " + curveId);
-            }
-            auto curve = regIt->second->currentLink();
-            if (!curve) {
-                QUANTRA_ERROR("Curve handle has no linked curve for id: " + curveId);
-            }
+BootstrapCurvesRequestHandler::Stream::Stream(const BootstrapCurvesRequest* request)
+    : session_(handler_.prepare(request)) {}
 
-            const auto* tsSpec = findCurveSpecById(request->pricing()->curves(), curveId);
-            if (!tsSpec) {
-                QUANTRA_ERROR("curve_id '" + curveId + "' not found in pricing.curves");
-            }
+bool BootstrapCurvesRequestHandler::Stream::done() const {
+    return next_ >= session_.request->queries()->size();
+}
 
-            const auto* options = query->options();
-            const bool allowExtrapolation = !options || options->allow_extrapolation();
-            if (allowExtrapolation) {
-                curve->enableExtrapolation();
-            } else {
-                curve->disableExtrapolation();
-            }
+flatbuffers::Offset<BootstrapCurvesResponse> BootstrapCurvesRequestHandler::Stream::next(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder) {
+    // Other calls run between messages; the curves' helpers observe the
+    // evaluation date, so put it back (only if changed, to keep them cached).
+    if (Settings::instance().evaluationDate() != session_.asOfDate) {
+        Settings::instance().evaluationDate() = session_.asOfDate;
+    }
+    const bool first = next_ == 0;
+    auto result = handler_.sampleQuery(builder, session_, session_.request->queries()->Get(next_++));
 
-            const Date referenceDate = curve->referenceDate();
-            const Calendar curveCalendar = getCalendarFromTermStructure(tsSpec);
-
-            std::vector<Date> gridDates;
-            const Calendar gridCalendar = getCalendarFromGrid(query->grid(), options, curveCalendar);
-            const BusinessDayConvention gridBdc = getBdcFromGrid(query->grid(), options);
-            if (query->grid()->grid_type() == DateGrid_TenorGrid) {
-                gridDates = buildTenorGrid(query->grid()->grid_as_TenorGrid(), referenceDate, curveCalendar);
-            } else if (query->grid()->grid_type() == DateGrid_RangeGrid) {
-                const int maxPoints = (options && options->max_points() > 0) ? options->max_points() : 50000;
-                gridDates = buildRangeGrid(query->grid()->grid_as_RangeGrid(), asOfDate, maxPoints);
-            } else {
-                QUANTRA_ERROR("DateGridSpec.grid is required for curve_id: " + curveId);
-            }
+    std::vector<flatbuffers::Offset<BootstrapCurveResult>> results = {result};
+    auto resultsVec = builder->CreateVector(results);
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> staleCurves;
+    if (first) staleCurves = staleCurvesVector(*builder, session_.reg);
+    BootstrapCurvesResponseBuilder responseBuilder(*builder);
+    responseBuilder.add_results(resultsVec);
+    responseBuilder.add_stale_curves(staleCurves);
+    return responseBuilder.Finish();
+}
+
+flatbuffers::Offset<BootstrapCurveResult> BootstrapCurvesRequestHandler::sampleQuery(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+    const Session& session,
+    const CurveQuerySpec* query) const {
+    std::string curveId = (query && query->curve_id()) ? query->curve_id()->str() : "";
+
+    try {
+        if (!session.pricingBuildError.empty()) {
+            QUANTRA_ERROR(session.pricingBuildError);
+        }
+        if (curveId.empty()) {
+            QUANTRA_ERROR("CurveQuerySpec.curve_id is required");
+        }
+        if (!query->grid()) {
+            QUANTRA_ERROR("CurveQuerySpec.grid is required for curve_id: " + curveId);
+        }
+        if (!query->measures() || query->measures()->size() == 0) {
+            QUANTRA_ERROR("CurveQuerySpec.measures is required for curve_id: " + curveId);
+        }
+
+        auto regIt = session.reg.curves.find(curveId);
+        if (regIt == session.reg.curves.end() || !regIt->second || regIt->second->empty()) {
+            QUANTRA_ERROR("Curve id not found in PricingRegistry: " + curveId);
+        }
+        auto curve = regIt->second->currentLink();
+        if (!curve) {
+            QUANTRA_ERROR("Curve handle has no linked curve for id: " + curveId);
+        }
+
+        const auto* tsSpec = findCurveSpecById(session.request->pricing()->curves(), curveId);
+        if (!tsSpec) {
+            QUANTRA_ERROR("curve_id '" + curveId + "' not found in pricing.curves");
+        }
+
+        const auto* options = query->options();
+        const bool allowExtrapolation = !options || options->allow_extrapolation();
+        if (allowExtrapolation) {
+            curve->enableExtrapolation();
+        } else {
+            curve->disableExtrapolation();
+        }
+
+        const Date referenceDate = curve->referenceDate();
+        const Calendar curveCalendar = getCalendarFromTermStructure(tsSpec);
+
+        std::vector<Date> gridDates;
+        const Calendar gridCalendar = getCalendarFromGrid(query->grid(), options, curveCalendar);
+        const BusinessDayConvention gridBdc = getBdcFromGrid(query->grid(), options);
+        if (query->grid()->grid_type() == DateGrid_TenorGrid) {
+            gridDates = buildTenorGrid(query->grid()->grid_as_TenorGrid(), referenceDate, curveCalendar);
+        } else if (query->grid()->grid_type() == DateGrid_RangeGrid) {
+            const int maxPoints = (options && options->max_points() > 0) ? options->max_points() : 50000;
+            gridDates = buildRangeGrid(query->grid()->grid_as_RangeGrid(), session.asOfDate, maxPoints);
+        } else {
+            QUANTRA_ERROR("DateGridSpec.grid is required for curve_id: " + curveId);
+        }
 
-            std::vector<flatbuffers::Offset<flatbuffers::String>> gridDateStrings;
+        const SampleEncoding encoding = SampleEncoding::from(options);
+        std::vector<flatbuffers::Offset<flatbuffers::String>> gridDateStrings;
+        if (!encoding.compactDates()) {
             for (const auto& d : gridDates) {
                 std::ostringstream os;
                 os << io::iso_date(d);
                 gridDateStrings.push_back(builder->CreateString(os.str()));
             }
-
-            std::vector<flatbuffers::Offset<CurveSeries>> seriesVector;
-            for (flatbuffers::uoffset_t m = 0; m < query->measures()->size(); m++) {
-                CurveMeasure measure = static_cast<CurveMeasure>(query->measures()->Get(m));
-                std::vector<double> values;
-
-                switch (measure) {
-                    case CurveMeasure_DF:
-                        values = computeDiscountFactors(curve, gridDates);
-                        break;
-                    case CurveMeasure_ZERO:
-                        values = computeZeroRates(curve, gridDates, query->zero());
-                        break;
-                    case CurveMeasure_FWD:
-                        values = computeForwardRates(
-                            curve, gridDates, query->fwd(), gridCalendar, gridBdc, curveCalendar);
-                        break;
-                    default:
-                        QUANTRA_ERROR("Unsupported CurveMeasure for curve_id: " + curveId);
-                }
-
-                auto valuesVec = builder->CreateVector(values);
-                CurveSeriesBuilder seriesBuilder(*builder);
-                seriesBuilder.add_measure(measure);
-                seriesBuilder.add_values(valuesVec);
-                seriesVector.push_back(seriesBuilder.Finish());
+        }
+        auto encodedGridDates = encodeDates(*builder, gridDates, encoding);
+
+        std::vector<flatbuffers::Offset<CurveSeries>> seriesVector;
+        for (flatbuffers::uoffset_t m = 0; m < query->measures()->size(); m++) {
+            CurveMeasure measure = static_cast<CurveMeasure>(query->measures()->Get(m));
+            std::vector<double> values;
+
+            switch (measure) {
+                case CurveMeasure_DF:
+                    values = computeDiscountFactors(curve, gridDates);
+                    break;
+                case CurveMeasure_ZERO:
+                    values = computeZeroRates(curve, gridDates, query->zero());
+                    break;
+                case CurveMeasure_FWD:
+                    values = computeForwardRates(
+                        curve, gridDates, query->fwd(), gridCalendar, gridBdc, curveCalendar);
+                    break;
+                default:
+                    QUANTRA_ERROR("Unsupported CurveMeasure for curve_id: " + curveId);
             }
 
-            std::vector<Date> pillarDates = extractPillarDatesFromHelpers(tsSpec, referenceDate);
-            std::vector<flatbuffers::Offset<flatbuffers::String>> pillarDateStrings;
-            for (const auto& d : pillarDates) {
-                std::ostringstream os;
-                os << io::iso_date(d);
-                pillarDateStrings.push_back(builder->CreateString(os.str()));
-            }
+            // values is required, so it stays present (empty) when encoded.
+            auto encodedValues = encodeValues(*builder, values, encoding);
+            if (!encodedValues.IsNull()) values.clear();
+            auto valuesVec = builder->CreateVector(values);
+            CurveSeriesBuilder seriesBuilder(*builder);
+            seriesBuilder.add_measure(measure);
+            seriesBuilder.add_values(valuesVec);
+            seriesBuilder.add_encoded_values(encodedValues);
+            seriesVector.push_back(seriesBuilder.Finish());
+        }
 
-            auto idStr = builder->CreateString(curveId);
-            std::ostringstream refDateOs;
-            refDateOs << io::iso_date(referenceDate);
-            auto refDateStr = builder->CreateString(refDateOs.str());
-            auto gridDatesVec = builder->CreateVector(gridDateStrings);
-            auto seriesVec = builder->CreateVector(seriesVector);
-            auto pillarDatesVec = builder->CreateVector(pillarDateStrings);
-
-            BootstrapCurveResultBuilder resultBuilder(*builder);
-            resultBuilder.add_id(idStr);
-            resultBuilder.add_reference_date(refDateStr);
-            resultBuilder.add_grid_dates(gridDatesVec);
-            resultBuilder.add_series(seriesVec);
-            resultBuilder.add_pillar_dates(pillarDatesVec);
-            results.push_back(resultBuilder.Finish());
-        } catch (const std::exception& e) {
-            auto idStr = builder->CreateString(curveId);
-            auto errorMsg = builder->CreateString(e.what());
-            ErrorBuilder errorBuilder(*builder);
-            errorBuilder.add_error_message(errorMsg);
-            auto error = errorBuilder.Finish();
-
-            BootstrapCurveResultBuilder resultBuilder(*builder);
-            resultBuilder.add_id(idStr);
-            resultBuilder.add_error(error);
-            results.push_back(resultBuilder.Finish());
+        std::vector<Date> pillarDates = extractPillarDatesFromHelpers(tsSpec, referenceDate);
+        std::vector<flatbuffers::Offset<flatbuffers::String>> pillarDateStrings;
+        for (const auto& d : pillarDates) {
+            std::ostringstream os;
+            os << io::iso_date(d);
+            pillarDateStrings.push_back(builder->CreateString(os.str()));
         }
-    }
 
-    auto resultsVec = builder->CreateVector(results);
-    BootstrapCurvesResponseBuilder responseBuilder(*builder);
-    responseBuilder.add_results(resultsVec);
-    return responseBuilder.Finish();
+        auto idStr = builder->CreateString(curveId);
+        std::ostringstream refDateOs;
+        refDateOs << io::iso_date(referenceDate);
+        auto refDateStr = builder->CreateString(refDateOs.str());
+        auto gridDatesVec = builder->CreateVector(gridDateStrings);
+        auto seriesVec = builder->CreateVector(seriesVector);
+        auto pillarDatesVec = builder->CreateVector(pillarDateStrings);
+
+        BootstrapCurveResultBuilder resultBuilder(*builder);
+        resultBuilder.add_id(idStr);
+        resultBuilder.add_reference_date(refDateStr);
+        resultBuilder.add_grid_dates(gridDatesVec);
+        resultBuilder.add_series(seriesVec);
+        resultBuilder.add_pillar_dates(pillarDatesVec);
+        resultBuilder.add_encoded_grid_dates(encodedGridDates);
+        return resultBuilder.Finish();
+    } catch (const std::exception& e) {
+        auto idStr = builder->CreateString(curveId);
+        auto errorMsg = builder->CreateString(e.what());
+        ErrorBuilder errorBuilder(*builder);
+        errorBuilder.add_error_message(errorMsg);
+        auto error = errorBuilder.Finish();
+
+        BootstrapCurveResultBuilder resultBuilder(*builder);
+        resultBuilder.add_id(idStr);
+        resultBuilder.add_error(error);
+        return resultBuilder.Finish();
+    }
 }
 
 Calendar BootstrapCurvesRequestHandler::getCalendarFromTermStructure(
@@ -324,6 +386,7 @@ std::vector<Date> BootstrapCurvesRequestHandler::buildTenorGrid(
         useCalendar = true;
     }
 
+    BusinessDayCalendar fastCalendar(calendar);
     for (flatbuffers::uoffset_t i = 0; i < tenors->size(); i++) {
         auto tenor = tenors->Get(i);
         int n = tenor->n();
@@ -333,7 +396,7 @@ std::vector<Date> BootstrapCurvesRequestHandler::buildTenorGrid(
             continue;
         }
         QuantLib::Period period(n, unit);
-        Date d = useCalendar ? calendar.advance(referenceDate, period, bdc) : referenceDate + period;
+        Date d = useCalendar ? fastCalendar.advance(referenceDate, period, bdc) : referenceDate + period;
         dates.push_back(d);
     }
 
@@ -359,10 +422,11 @@ std::vector<Date> BootstrapCurvesRequestHandler::buildRangeGrid(
         calendar = WeekendsOnly();
     }
 
+    BusinessDayCalendar fastCalendar(calendar);
     Date current = startDate;
     while (current <= endDate) {
         if (businessDaysOnly) {
-            if (calendar.isBusinessDay(current)) dates.push_back(current);
+            if (fastCalendar.isBusinessDay(current)) dates.push_back(current);
         } else {
             dates.push_back(current);
         }
@@ -372,7 +436,7 @@ std::vector<Date> BootstrapCurvesRequestHandler::buildRangeGrid(
         } else if (stepUnit == Weeks) {
             current = current + stepNumber * 7;
         } else {
-            current = calendar.advance(current, step, bdc);
+            current = fastCalendar.advance(current, step, bdc);
         }
 
         if (static_cast<int>(dates.size()) > maxPoints) {
@@ -386,10 +450,7 @@ std::vector<Date> BootstrapCurvesRequestHandler::buildRangeGrid(
 std::vector<double> BootstrapCurvesRequestHandler::computeDiscountFactors(
     const std::shared_ptr<YieldTermStructure>& curve,
     const std::vector<Date>& dates) const {
-    std::vector<double> values;
-    values.reserve(dates.size());
-    for (const auto& d : dates) values.push_back(curve->discount(d));
-    return values;
+    return CurveSampler::discounts(curve, dates);
 }
 
 std::vector<double> BootstrapCurvesRequestHandler::computeZeroRates(
@@ -405,12 +466,18 @@ std::vector<double> BootstrapCurvesRequestHandler::computeZeroRates(
         freq = FrequencyToQL(zeroQuery->frequency());
     }
 
+    // zeroRate(d) is the rate implied by 1 / discount(d) over [ref, d]
+    Date refDate = curve->referenceDate();
+    std::vector<Date> zeroDates;
+    zeroDates.reserve(dates.size());
+    for (const auto& d : dates) zeroDates.push_back((d <= refDate) ? refDate + 1 : d);
+    std::vector<double> dfs = CurveSampler::discounts(curve, zeroDates);
+    std::vector<Time> times = YearFractions::from(dc, refDate, zeroDates);
+
     std::vector<double> values;
     values.reserve(dates.size());
-    Date refDate = curve->referenceDate();
-    for (const auto& d : dates) {
-        Date dd = (d <= refDate) ? refDate + 1 : d;
-        InterestRate rate = curve->zeroRate(dd, dc, comp, freq);
+    for (size_t i = 0; i < zeroDates.size(); i++) {
+        InterestRate rate = InterestRate::impliedRate(1.0 / dfs[i], dc, comp, freq, times[i]);
         values.push_back(rate.rate());
     }
     return values;
@@ -447,11 +514,11 @@ std::vector<double> BootstrapCurvesRequestHandler::computeForwardRates(
         useGridCalendar = fwdQuery->use_grid_calendar_for_advance();
     }
 
-    Calendar calendar = useGridCalendar ? gridCalendar : curveCalendar;
+    BusinessDayCalendar calendar(useGridCalendar ? gridCalendar : curveCalendar);
     BusinessDayConvention bdc = useGridCalendar ? gridBdc : Following;
 
-    std::vector<double> values;
-    values.reserve(dates.size());
+    std::vector<Date> endDates;
+    endDates.reserve(dates.size());
     for (const auto& d : dates) {
         Date endDate;
         if (fwdType == ForwardType_Instantaneous) {
@@ -460,7 +527,18 @@ std::vector<double> BootstrapCurvesRequestHandler::computeForwardRates(
             endDate = calendar.advance(d, QuantLib::Period(tenorNumber, tenorUnit), bdc);
         }
         if (endDate <= d) endDate = d + 1;
-        InterestRate rate = curve->forwardRate(d, endDate, dc, comp, freq);
+        endDates.push_back(endDate);
+    }
+
+    // forwardRate(d1, d2) is the rate implied by discount(d1) / discount(d2)
+    std::vector<double> startDfs = CurveSampler::discounts(curve, dates);
+    std::vector<double> endDfs = CurveSampler::discounts(curve, endDates);
+    std::vector<Time> times = YearFractions::between(dc, dates, endDates);
+
+    std::vector<double> values;
+    values.reserve(dates.size());
+    for (size_t i = 0; i < dates.size(); i++) {
+        InterestRate rate = InterestRate::impliedRate(startDfs[i] / endDfs[i], dc, comp, freq, times[i]);
         values.push_back(rate.rate());
     }
     return values;
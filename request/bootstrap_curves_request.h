@@ -11,12 +11,30 @@
 #include "error.h"
 
 class BootstrapCurvesRequestHandler {
+    /// Registry and inputs shared by all queries of one request.
+    struct Session {
+        const quantra::BootstrapCurvesRequest* request = nullptr;
+        PricingRegistry reg;
+        std::string pricingBuildError;
+        QuantLib::Date asOfDate;
+    };
+
 public:
     flatbuffers::Offset<quantra::BootstrapCurvesResponse> request(
         std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
         const quantra::BootstrapCurvesRequest* request) const;
 
+    /// Streaming variant; see below.
+    class Stream;
+
 private:
+    Session prepare(const quantra::BootstrapCurvesRequest* request) const;
+
+    flatbuffers::Offset<quantra::BootstrapCurveResult> sampleQuery(
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+        const Session& session,
+        const quantra::CurveQuerySpec* query) const;
+
     std::vector<QuantLib::Date> buildTenorGrid(
         const quantra::TenorGrid* grid,
         const QuantLib::Date& referenceDate,
@@ -61,4 +79,27 @@ private:
         const QuantLib::Date& referenceDate) const;
 };
 
+/**
+ * Stream - BootstrapCurvesStream: one BootstrapCurvesResponse per query,
+ * in query order, each holding that query's result only.
+ *
+ * Curves are bootstrapped once when the stream is created; each next()
+ * then samples a single query, so only one result is held in memory at a
+ * time. stale_curves is set on the first message.
+ */
+class BootstrapCurvesRequestHandler::Stream {
+public:
+    explicit Stream(const quantra::BootstrapCurvesRequest* request);
+
+    bool done() const;
+
+    flatbuffers::Offset<quantra::BootstrapCurvesResponse> next(
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder);
+
+private:
+    BootstrapCurvesRequestHandler handler_;
+    Session session_;
+    flatbuffers::uoffset_t next_ = 0;
+};
+
 #endif
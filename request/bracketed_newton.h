@@ -0,0 +1,59 @@
+#ifndef QUANTRA_BRACKETED_NEWTON_H
+#define QUANTRA_BRACKETED_NEWTON_H
+
+#include <cmath>
+#include <cstddef>
+
+namespace quantra {
+
+/**
+ * Root of a strictly decreasing function on (floor, +inf) by Newton steps
+ * with an analytic derivative, kept inside a bisection bracket.
+ *
+ * f(x, derivative) returns the value at x and sets its derivative. The
+ * bracket is grown from guess +/- 0.01 (towards floor below, doubling
+ * above) until it holds a sign change; a Newton step that leaves it is
+ * replaced by bisection. Returns false when no bracket is found or the
+ * iteration does not reach the accuracy, so callers can fall back.
+ */
+template <class F>
+bool bracketedNewton(F f, double guess, double floor, double accuracy,
+                     std::size_t maxIterations, double& root) {
+    if (!(guess > floor)) return false;
+    double derivative = 0.0;
+
+    double lo = guess - 0.01;
+    if (!(lo > floor)) lo = 0.5 * (guess + floor);
+    double hi = guess + 0.01;
+    for (int n = 0; f(lo, derivative) <= 0.0; n++) {
+        if (n == 60) return false;
+        lo = 0.5 * (lo + floor);
+    }
+    for (int n = 0; f(hi, derivative) >= 0.0; n++) {
+        if (n == 60) return false;
+        hi = guess + 2.0 * (hi - guess);
+    }
+
+    double x = guess;
+    for (std::size_t n = 0; n < maxIterations; n++) {
+        const double fx = f(x, derivative);
+        if (fx == 0.0) {
+            root = x;
+            return true;
+        }
+        if (fx > 0.0) lo = x; else hi = x;
+
+        double next = (derivative != 0.0) ? x - fx / derivative : 0.5 * (lo + hi);
+        if (!(next > lo && next < hi)) next = 0.5 * (lo + hi);
+        if (std::fabs(next - x) < accuracy) {
+            root = next;
+            return true;
+        }
+        x = next;
+    }
+    return false;
+}
+
+} // namespace quantra
+
+#endif // QUANTRA_BRACKETED_NEWTON_H
@@ -24,6 +24,14 @@ class CallData
 public:
     virtual ~CallData() = default;
     virtual void Proceed() = 0;
+
+    /// Completion-queue entry point; `ok` is false when the operation failed
+    /// (e.g. a streaming client went away). Unary calls never expect that.
+    virtual void Proceed(bool ok)
+    {
+        GPR_ASSERT(ok);
+        Proceed();
+    }
 };
 
 /**
@@ -151,4 +159,123 @@ protected:
     CallStatus status_;
 };
 
+/**
+ * StreamingCallDataGeneric - Async machinery for server-streaming calls.
+ *
+ * Stream is the handler's per-call state: it is constructed from the request
+ * and yields one response per next() until done(). The next message is only
+ * built once the previous write has completed, so a call holds at most one
+ * response at a time and the client receives results as they are computed.
+ */
+template <class Message, class Stream, class Response>
+class StreamingCallDataGeneric : public CallData
+{
+public:
+    explicit StreamingCallDataGeneric(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq)
+        : service_(service), cq_(cq), writer_(&ctx_), status_(CREATE)
+    {
+    }
+
+    void start()
+    {
+        Proceed();
+    }
+
+    void Proceed() override
+    {
+        Proceed(true);
+    }
+
+    void Proceed(bool ok) override
+    {
+        if (status_ == CREATE)
+        {
+            status_ = PROCESS;
+            this->RequestCall();
+        }
+        else if (status_ == FINISH || !ok)
+        {
+            // Done, or the call was cancelled / the server is shutting down:
+            // nothing more can be written.
+            delete this;
+        }
+        else
+        {
+            if (status_ == PROCESS)
+            {
+                this->CreateService(service_, cq_);
+                status_ = WRITE;
+            }
+            WriteNext();
+        }
+    }
+
+    virtual void RequestCall() = 0;
+    virtual void CreateService(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq) = 0;
+
+protected:
+    void WriteNext()
+    {
+        try
+        {
+            if (!stream_)
+                stream_ = std::make_unique<Stream>(request_msg.GetRoot());
+            if (stream_->done())
+            {
+                status_ = FINISH;
+                writer_.Finish(grpc::Status::OK, this);
+                return;
+            }
+
+            std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder =
+                std::make_shared<flatbuffers::grpc::MessageBuilder>();
+            builder->Finish(stream_->next(builder));
+            reply_ = builder->ReleaseMessage<Response>();
+            assert(reply_.Verify());
+            writer_.Write(reply_, this);
+        }
+        catch (QuantLib::Error &e)
+        {
+            Fail("QuantLib error", e.what());
+        }
+        catch (QuantraError &e)
+        {
+            Fail("Quantra error", e.what());
+        }
+        catch (std::exception &e)
+        {
+            Fail("Unknown error", e.what());
+        }
+    }
+
+    /// Ends the stream with an error status; messages already written stand.
+    void Fail(const std::string &kind, const std::string &what)
+    {
+        std::string error_msg = kind + ": " + what;
+        std::cout << kind << ":  " << error_msg << std::endl;
+
+        status_ = FINISH;
+        writer_.Finish(grpc::Status(grpc::StatusCode::ABORTED, kind, error_msg), this);
+    }
+
+    QuantraServer::AsyncService *service_;
+    grpc::ServerCompletionQueue *cq_;
+    grpc::ServerContext ctx_;
+
+    flatbuffers::grpc::Message<Message> request_msg;
+    flatbuffers::grpc::Message<Response> reply_;
+    std::unique_ptr<Stream> stream_;
+
+    grpc::ServerAsyncWriter<flatbuffers::grpc::Message<Response>> writer_;
+
+    enum CallStatus
+    {
+        CREATE,
+        PROCESS,
+        WRITE,
+        FINISH
+    };
+    CallStatus status_;
+};
+
 #endif // QUANTRASERVER_CALL_DATA_BASE_H
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "cap_floor_batch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "curve_sampler.h"
+#include "engine_factory.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+size_t CapFloorBatch::add(const std::shared_ptr<CapFloor>& capFloor,
+                          const std::shared_ptr<YieldTermStructure>& discountCurve,
+                          const OptionletVolEntry& volEntry,
+                          const quantra::ModelSpec* model) {
+    EngineFactory engineFactory;
+
+    Trade trade;
+    trade.curve = discountCurve;
+    trade.begin = strikes_.size();
+    npvs_.push_back(0.0);
+
+    if (!BlackBatch::enabled()) {
+        capFloor->setPricingEngine(engineFactory.makeCapFloorEngine(
+            model, Handle<YieldTermStructure>(discountCurve), volEntry));
+        npvs_.back() = capFloor->NPV();
+        trade.end = trade.begin;
+        trades_.push_back(std::move(trade));
+        return trades_.size() - 1;
+    }
+
+    const BlackBatch::Model kind =
+        engineFactory.capFloorModelType(model, volEntry) == quantra::enums::IrModelType_Bachelier
+            ? BlackBatch::Model::Bachelier : BlackBatch::Model::Black;
+    const auto& vol = volEntry.handle;
+    const double displacement = (kind == BlackBatch::Model::Black) ? vol->displacement() : 0.0;
+
+    // The engines' view of the trade
+    CapFloor::arguments args;
+    capFloor->setupArguments(&args);
+
+    const Date today = vol->referenceDate();
+    const Date settlement = discountCurve->referenceDate();
+    for (Size i = 0; i < args.startDates.size(); i++) {
+        const Date paymentDate = args.endDates[i];
+        if (paymentDate <= settlement) continue;
+
+        const Date fixingDate = args.fixingDates[i];
+        const double accrualFactor = args.nominals[i] * args.gearings[i] * args.accrualTimes[i];
+        auto addOptionlet = [&](Option::Type type, double strike, double sign) {
+            types_.push_back(type);
+            models_.push_back(kind);
+            strikes_.push_back(strike);
+            forwards_.push_back(args.forwards[i]);
+            stdDevs_.push_back(fixingDate > today ? std::sqrt(vol->blackVariance(fixingDate, strike)) : 0.0);
+            displacements_.push_back(displacement);
+            accrualFactors_.push_back(accrualFactor);
+            signs_.push_back(sign);
+            paymentDates_.push_back(paymentDate);
+        };
+
+        if (args.type == CapFloor::Cap || args.type == CapFloor::Collar) {
+            addOptionlet(Option::Call, args.capRates[i], 1.0);
+        }
+        if (args.type == CapFloor::Floor || args.type == CapFloor::Collar) {
+            addOptionlet(Option::Put, args.floorRates[i], args.type == CapFloor::Floor ? 1.0 : -1.0);
+        }
+    }
+    trade.end = strikes_.size();
+
+    trades_.push_back(std::move(trade));
+    return trades_.size() - 1;
+}
+
+void CapFloorBatch::price() {
+    if (!BlackBatch::enabled()) return;
+
+    // Discount factors once per curve over the sorted payment dates of its trades
+    std::vector<double> dfs(paymentDates_.size(), 0.0);
+    std::vector<const YieldTermStructure*> curveOrder;
+    std::unordered_map<const YieldTermStructure*, std::vector<size_t>> byCurve;
+    for (size_t t = 0; t < trades_.size(); t++) {
+        auto& group = byCurve[trades_[t].curve.get()];
+        if (group.empty()) curveOrder.push_back(trades_[t].curve.get());
+        group.push_back(t);
+    }
+    for (const YieldTermStructure* key : curveOrder) {
+        const std::vector<size_t>& group = byCurve[key];
+
+        std::vector<Date> dates;
+        for (size_t t : group) {
+            dates.insert(dates.end(), paymentDates_.begin() + trades_[t].begin,
+                         paymentDates_.begin() + trades_[t].end);
+        }
+        std::sort(dates.begin(), dates.end());
+        dates.erase(std::unique(dates.begin(), dates.end()), dates.end());
+        const std::vector<double> gridDfs = CurveSampler::discounts(trades_[group.front()].curve, dates);
+
+        for (size_t t : group) {
+            for (size_t k = trades_[t].begin; k < trades_[t].end; k++) {
+                dfs[k] = gridDfs[std::lower_bound(dates.begin(), dates.end(), paymentDates_[k]) - dates.begin()];
+            }
+        }
+    }
+
+    BlackBatch optionlets;
+    for (size_t k = 0; k < strikes_.size(); k++) {
+        optionlets.add(types_[k], models_[k], strikes_[k], forwards_[k], stdDevs_[k],
+                       dfs[k] * accrualFactors_[k], displacements_[k]);
+    }
+    optionlets.price();
+
+    for (size_t t = 0; t < trades_.size(); t++) {
+        double npv = 0.0;
+        for (size_t k = trades_[t].begin; k < trades_[t].end; k++) {
+            npv += signs_[k] * optionlets.value(k);
+        }
+        npvs_[t] = npv;
+    }
+}
+
+} // namespace quantra
@@ -0,0 +1,77 @@
+#ifndef QUANTRA_CAP_FLOOR_BATCH_H
+#define QUANTRA_CAP_FLOOR_BATCH_H
+
+/**
+ * Cap/floor batch pricing
+ *
+ * Prices the caps, floors and collars of a request without a
+ * Black/BachelierCapFloorEngine per trade. Each trade's optionlets are
+ * read from the arguments QuantLib hands its engines (CapFloor::
+ * setupArguments: forward, strike, fixing and payment date, nominal *
+ * gearing * accrual) when the trade is added, so later relinks of a
+ * shared forwarding handle do not affect it. On price(), the discount
+ * factors of each curve are evaluated once over its payment dates
+ * (CurveSampler) and all optionlets of the request go through one
+ * BlackBatch; each trade's NPV is the sum of its optionlets in coupon
+ * order, as in the engines.
+ *
+ * Follows BlackCapFloorEngine / BachelierCapFloorEngine: optionlets paid
+ * on or before the discount curve's reference date are dropped, those
+ * fixed on or before the vol's reference date have zero stdDev, the
+ * displacement is the vol structure's.
+ *
+ * With QUANTRA_OPTION_BATCH=0 (see BlackBatch) each trade gets the
+ * EngineFactory engine and is priced when added.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <ql/instruments/capfloor.hpp>
+#include <ql/termstructures/yieldtermstructure.hpp>
+
+#include "black_batch.h"
+#include "model_generated.h"
+#include "vol_surface_parsers.h"
+
+namespace quantra {
+
+class CapFloorBatch {
+public:
+    /// Queues a trade; returns its index. Throws when the model does not
+    /// fit the vol (EngineFactory::capFloorModelType).
+    size_t add(const std::shared_ptr<QuantLib::CapFloor>& capFloor,
+               const std::shared_ptr<QuantLib::YieldTermStructure>& discountCurve,
+               const OptionletVolEntry& volEntry,
+               const quantra::ModelSpec* model);
+
+    /// Prices all queued trades.
+    void price();
+
+    double npv(size_t i) const { return npvs_[i]; }
+    size_t size() const { return trades_.size(); }
+
+private:
+    struct Trade {
+        std::shared_ptr<QuantLib::YieldTermStructure> curve;
+        size_t begin = 0, end = 0;          // optionlet range in the buffers
+    };
+
+    std::vector<Trade> trades_;
+    std::vector<double> npvs_;
+
+    // Optionlet buffers, trades back to back
+    std::vector<QuantLib::Option::Type> types_;
+    std::vector<BlackBatch::Model> models_;
+    std::vector<double> strikes_;
+    std::vector<double> forwards_;
+    std::vector<double> stdDevs_;
+    std::vector<double> displacements_;
+    std::vector<double> accrualFactors_;    // nominal * gearing * accrual time
+    std::vector<double> signs_;             // -1 for the floor leg of a collar
+    std::vector<QuantLib::Date> paymentDates_;
+};
+
+} // namespace quantra
+
+#endif // QUANTRA_CAP_FLOOR_BATCH_H
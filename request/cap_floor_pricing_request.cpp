@@ -1,10 +1,12 @@
 #include "cap_floor_pricing_request.h"
 #include <ql/cashflows/iborcoupon.hpp>
 
+#include "curve_cache.h"
 #include "pricing_registry.h"
 #include "vol_surface_parsers.h"
-#include "engine_factory.h"
+#include "cap_floor_batch.h"
 #include "cap_floor_parser.h"
+#include "trade_store.h"
 
 using namespace QuantLib;
 using namespace quantra;
@@ -13,19 +15,38 @@ flatbuffers::Offset<PriceCapFloorResponse> CapFloorPricingRequest::request(
     std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
     const PriceCapFloorRequest *request) const
 {
+    PricingDemand demand;
+    for (auto it = request->cap_floors()->begin(); it != request->cap_floors()->end(); it++)
+    {
+        demand.addCurve(it->discounting_curve());
+        demand.addCurve(it->forwarding_curve());
+        demand.addVol(it->volatility());
+    }
+
     PricingRegistryBuilder regBuilder;
-    PricingRegistry reg = regBuilder.build(request->pricing());
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand);
 
     CapFloorParser cap_floor_parser;
-    EngineFactory engineFactory;
 
     Date as_of_date = Settings::instance().evaluationDate();
 
-    auto cap_floor_pricings = request->cap_floors();
+    // Inline caps/floors, and stored ones referenced by trade or book id
+    auto cap_floor_pricings = TradeStore::instance().resolve<quantra::CapFloor>(
+        request->cap_floors(), [](const PriceCapFloor* p) { return p->cap_floor(); });
     std::vector<flatbuffers::Offset<CapFloorResponse>> cap_floors_vector;
 
-    for (auto it = cap_floor_pricings->begin(); it != cap_floor_pricings->end(); it++)
+    // Optionlets of all trades are priced together after the loop. ATM
+    // rates and details read the coupons, so they are taken per trade
+    // while its forwarding curve is linked.
+    CapFloorBatch batch;
+    std::vector<double> atm_rates;
+    std::vector<flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<CapFloorLet>>>> details;
+    atm_rates.reserve(cap_floor_pricings.size());
+    details.reserve(cap_floor_pricings.size());
+
+    for (const auto& item : cap_floor_pricings)
     {
+        auto it = item.pricing;
         auto dIt = reg.curves.find(it->discounting_curve()->str());
         if (dIt == reg.curves.end())
             QUANTRA_ERROR("Discounting curve not found: " + it->discounting_curve()->str());
@@ -43,23 +64,17 @@ flatbuffers::Offset<PriceCapFloorResponse> CapFloorPricingRequest::request(
             QUANTRA_ERROR("Model not found: " + it->model()->str());
 
         cap_floor_parser.linkForwardingTermStructure(fIt->second->currentLink());
-        auto capFloor = cap_floor_parser.parse(it->cap_floor(), reg.indices);
+        auto capFloor = cap_floor_parser.parse(item.trade, reg.indices);
 
-        Handle<YieldTermStructure> discountCurve(dIt->second->currentLink());
-        auto engine = engineFactory.makeCapFloorEngine(mIt->second, discountCurve, vIt->second);
-        capFloor->setPricingEngine(engine);
-
-        double npv = capFloor->NPV();
-        double atmRate = capFloor->atmRate(*dIt->second->currentLink());
-
-        std::cout << "CapFloor NPV: " << npv << ", ATM Rate: " << atmRate * 100 << "%" << std::endl;
+        batch.add(capFloor, dIt->second->currentLink(), vIt->second, mIt->second);
+        atm_rates.push_back(capFloor->atmRate(*dIt->second->currentLink()));
 
         std::vector<flatbuffers::Offset<CapFloorLet>> capfloorlets_vector;
 
         if (it->include_details())
         {
             const Leg& leg = capFloor->floatingLeg();
-            auto discountCurvePtr = dIt->second->currentLink();
+            CachedDiscounts discounts(dIt->second->currentLink());
 
             for (size_t i = 0; i < leg.size(); i++)
             {
@@ -77,7 +92,7 @@ flatbuffers::Offset<PriceCapFloorResponse> CapFloorPricingRequest::request(
                     auto accrual_end = builder->CreateString(os_end.str());
                     auto fixing_date = builder->CreateString(os_fixing.str());
 
-                    double discount = discountCurvePtr->discount(coupon->date());
+                    double discount = discounts(coupon->date());
 
                     CapFloorLetBuilder let_builder(*builder);
                     let_builder.add_payment_date(payment_date);
@@ -92,19 +107,36 @@ flatbuffers::Offset<PriceCapFloorResponse> CapFloorPricingRequest::request(
             }
         }
 
-        auto capfloorlets = builder->CreateVector(capfloorlets_vector);
+        details.push_back(builder->CreateVector(capfloorlets_vector));
+    }
+
+    batch.price();
+
+    for (size_t i = 0; i < cap_floor_pricings.size(); i++)
+    {
+        double npv = batch.npv(i);
+        double atmRate = atm_rates[i];
+
+        std::cout << "CapFloor NPV: " << npv << ", ATM Rate: " << atmRate * 100 << "%" << std::endl;
+
+        flatbuffers::Offset<flatbuffers::String> trade_id;
+        if (!cap_floor_pricings[i].tradeId.empty())
+            trade_id = builder->CreateString(cap_floor_pricings[i].tradeId);
 
         CapFloorResponseBuilder response(*builder);
         response.add_npv(npv);
         response.add_atm_rate(atmRate);
-        response.add_cap_floor_lets(capfloorlets);
+        response.add_cap_floor_lets(details[i]);
+        response.add_trade_id(trade_id);
 
         cap_floors_vector.push_back(response.Finish());
     }
 
     auto cap_floors = builder->CreateVector(cap_floors_vector);
+    auto staleCurves = staleCurvesVector(*builder, reg);
     PriceCapFloorResponseBuilder response_builder(*builder);
     response_builder.add_cap_floors(cap_floors);
+    response_builder.add_stale_curves(staleCurves);
 
     return response_builder.Finish();
 }
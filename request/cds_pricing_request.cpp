@@ -1,6 +1,7 @@
 #include "cds_pricing_request.h"
 
 #include "pricing_registry.h"
+#include "trade_store.h"
 #include "enums.h"
 
 #include <ql/pricingengines/credit/isdacdsengine.hpp>
@@ -13,19 +14,42 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
     const PriceCDSRequest *request) const
 {
     // Build registry (handles curves with dependency ordering via CurveBootstrapper)
+    PricingDemand demand;
+    for (auto it = request->cds_list()->begin(); it != request->cds_list()->end(); it++)
+        demand.addCurve(it->discounting_curve());
+
     PricingRegistryBuilder regBuilder;
-    PricingRegistry reg = regBuilder.build(request->pricing());
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand);
 
     CDSParser cds_parser;
     CreditCurveParser credit_curve_parser;
     Date as_of_date = Settings::instance().evaluationDate();
 
     // Process each CDS
-    auto cds_pricings = request->cds_list();
+    // Inline CDS, and stored ones referenced by trade or book id; an
+    // unknown id fails only its own entry
+    auto cds_pricings = TradeStore::instance().resolveEach<quantra::CDS>(
+        request->cds_list(), [](const PriceCDS* p) { return p->cds(); });
     std::vector<flatbuffers::Offset<CDSValues>> cds_vector;
 
-    for (auto it = cds_pricings->begin(); it != cds_pricings->end(); it++)
+    for (const auto& item : cds_pricings)
     {
+        auto it = item.pricing;
+        flatbuffers::Offset<flatbuffers::String> trade_id;
+        if (!item.tradeId.empty())
+            trade_id = builder->CreateString(item.tradeId);
+
+        if (!item.error.empty())
+        {
+            auto error_msg = builder->CreateString(item.error);
+            auto error = quantra::CreateError(*builder, error_msg);
+            CDSValuesBuilder response_builder(*builder);
+            response_builder.add_trade_id(trade_id);
+            response_builder.add_error(error);
+            cds_vector.push_back(response_builder.Finish());
+            continue;
+        }
+
         try
         {
             // Lookup discounting curve by ID
@@ -36,6 +60,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
                 auto error_msg = builder->CreateString("Discounting curve not found: " + it->discounting_curve()->str());
                 auto error = quantra::CreateError(*builder, error_msg);
                 CDSValuesBuilder response_builder(*builder);
+                response_builder.add_trade_id(trade_id);
                 response_builder.add_error(error);
                 cds_vector.push_back(response_builder.Finish());
                 continue;
@@ -46,6 +71,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
                 auto error_msg = builder->CreateString("credit_curve_id is required");
                 auto error = quantra::CreateError(*builder, error_msg);
                 CDSValuesBuilder response_builder(*builder);
+                response_builder.add_trade_id(trade_id);
                 response_builder.add_error(error);
                 cds_vector.push_back(response_builder.Finish());
                 continue;
@@ -56,6 +82,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
                 auto error_msg = builder->CreateString("Credit curve not found: " + it->credit_curve_id()->str());
                 auto error = quantra::CreateError(*builder, error_msg);
                 CDSValuesBuilder response_builder(*builder);
+                response_builder.add_trade_id(trade_id);
                 response_builder.add_error(error);
                 cds_vector.push_back(response_builder.Finish());
                 continue;
@@ -72,7 +99,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
             double recoveryRate = credit_curve_spec->recovery_rate();
 
             // Parse the CDS instrument
-            auto cds = cds_parser.parse(it->cds());
+            auto cds = cds_parser.parse(item.trade);
 
             // Set pricing engine
             std::shared_ptr<QuantLib::PricingEngine> engine;
@@ -80,6 +107,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
                 auto error_msg = builder->CreateString("model is required for CDS pricing");
                 auto error = quantra::CreateError(*builder, error_msg);
                 CDSValuesBuilder response_builder(*builder);
+                response_builder.add_trade_id(trade_id);
                 response_builder.add_error(error);
                 cds_vector.push_back(response_builder.Finish());
                 continue;
@@ -90,6 +118,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
                 auto error_msg = builder->CreateString("Model not found: " + it->model()->str());
                 auto error = quantra::CreateError(*builder, error_msg);
                 CDSValuesBuilder response_builder(*builder);
+                response_builder.add_trade_id(trade_id);
                 response_builder.add_error(error);
                 cds_vector.push_back(response_builder.Finish());
                 continue;
@@ -100,6 +129,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
                 auto error_msg = builder->CreateString("Model payload is not CdsModelSpec for model: " + it->model()->str());
                 auto error = quantra::CreateError(*builder, error_msg);
                 CDSValuesBuilder response_builder(*builder);
+                response_builder.add_trade_id(trade_id);
                 response_builder.add_error(error);
                 cds_vector.push_back(response_builder.Finish());
                 continue;
@@ -154,6 +184,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
 
             // Build response
             CDSValuesBuilder response_builder(*builder);
+            response_builder.add_trade_id(trade_id);
             response_builder.add_npv(npv);
             response_builder.add_fair_spread(fairSpread);
             response_builder.add_fair_upfront(fairUpfront);
@@ -168,6 +199,7 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
             auto error_msg = builder->CreateString(std::string("CDS pricing error: ") + e.what());
             auto error = quantra::CreateError(*builder, error_msg);
             CDSValuesBuilder response_builder(*builder);
+            response_builder.add_trade_id(trade_id);
             response_builder.add_error(error);
             cds_vector.push_back(response_builder.Finish());
         }
@@ -175,8 +207,10 @@ flatbuffers::Offset<PriceCDSResponse> CDSPricingRequest::request(
 
     // Build final response
     auto cds_list = builder->CreateVector(cds_vector);
+    auto staleCurves = staleCurvesVector(*builder, reg);
     PriceCDSResponseBuilder response_builder(*builder);
     response_builder.add_cds_list(cds_list);
+    response_builder.add_stale_curves(staleCurves);
 
     return response_builder.Finish();
 }
@@ -0,0 +1,42 @@
+#ifndef QUANTRASERVER_CURVE_RISK_HANDLER_H
+#define QUANTRASERVER_CURVE_RISK_HANDLER_H
+
+#include "call_data_base.h"
+#include "product_registry.h"
+#include "curve_risk_request.h"
+#include "curve_risk_request_generated.h"
+#include "curve_risk_response_generated.h"
+
+using quantra::ComputeCurveRiskRequest;
+using quantra::ComputeCurveRiskResponse;
+using quantra::ComputeCurveRiskResponseBuilder;
+
+class ComputeCurveRiskData : public CallDataGeneric<
+    ComputeCurveRiskRequest,
+    CurveRiskRequestHandler,
+    ComputeCurveRiskResponse,
+    ComputeCurveRiskResponseBuilder>
+{
+public:
+    ComputeCurveRiskData(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq)
+        : CallDataGeneric(service, cq)
+    {
+    }
+
+protected:
+    void RequestCall() override
+    {
+        service_->RequestComputeCurveRisk(
+            &ctx_, &request_msg, &responder_, cq_, cq_, this);
+    }
+
+    void CreateService(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq) override
+    {
+        auto handler = new ComputeCurveRiskData(service, cq);
+        handler->start();
+    }
+};
+
+REGISTER_PRODUCT(ComputeCurveRisk, ComputeCurveRiskData);
+
+#endif // QUANTRASERVER_CURVE_RISK_HANDLER_H
@@ -0,0 +1,558 @@
+#include "curve_risk_request.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <type_traits>
+
+#include "common_parser.h"
+#include "curve_serializer.h"
+#include "error.h"
+#include "fixed_rate_bond_parser.h"
+#include "fra_parser.h"
+#include "term_structure_point_parser.h"
+#include "trade_store.h"
+#include "vanilla_swap_parser.h"
+#include "warm_start_bootstrap.h"
+
+using namespace QuantLib;
+using namespace quantra;
+
+namespace {
+
+/// Relative step for the central differences against node DFs.
+constexpr double kNodeStep = 1.0e-6;
+/// Absolute step against zero or forward rate nodes.
+constexpr double kRateNodeStep = 1.0e-6;
+
+/// Reads a curve's nodes and rebuilds curves on moved ones.
+struct NodeModel {
+    /// Node values on `dates`; false if `curve` is not of this model.
+    std::function<bool(const std::shared_ptr<YieldTermStructure>& curve,
+                       const std::vector<Date>& dates, std::vector<double>& values)> extract;
+    std::function<std::shared_ptr<YieldTermStructure>(
+        const std::vector<Date>& dates, const std::vector<double>& values,
+        const DayCounter& dc)> build;
+    /// Zero or forward rate nodes: the node at the reference date follows
+    /// the first pillar, as in the bootstrap.
+    bool rates = false;
+};
+
+/// Nodes of the bootstrap trait, interpolated as PiecewiseYieldCurve does.
+template <class Traits, class Interpolator>
+NodeModel nodeModelOf(const Interpolator& interpolator) {
+    NodeModel m;
+    m.extract = [](const std::shared_ptr<YieldTermStructure>& curve,
+                   const std::vector<Date>& dates, std::vector<double>& values) {
+        auto piecewise = std::dynamic_pointer_cast<WarmStartCurve<Traits, Interpolator>>(curve);
+        if (!piecewise || piecewise->dates() != dates) return false;
+        values = piecewise->data();
+        return true;
+    };
+    m.build = [interpolator](const std::vector<Date>& dates, const std::vector<double>& values,
+                             const DayCounter& dc) -> std::shared_ptr<YieldTermStructure> {
+        return std::make_shared<typename Traits::template curve<Interpolator>::type>(
+            dates, values, dc, interpolator);
+    };
+    m.rates = !std::is_same<Traits, Discount>::value;
+    return m;
+}
+
+template <class Interpolator>
+NodeModel traitNodeModel(enums::BootstrapTrait trait, const Interpolator& interpolator = Interpolator()) {
+    switch (trait) {
+        case enums::BootstrapTrait_Discount: return nodeModelOf<Discount>(interpolator);
+        case enums::BootstrapTrait_ZeroRate: return nodeModelOf<ZeroYield>(interpolator);
+        case enums::BootstrapTrait_FwdRate: return nodeModelOf<ForwardRate>(interpolator);
+        default: QUANTRA_ERROR("Unsupported BootstrapTrait");
+    }
+    return NodeModel();
+}
+
+NodeModel traitNodeModel(const quantra::TermStructure* ts) {
+    switch (ts->interpolator()) {
+        case enums::Interpolator_BackwardFlat: return traitNodeModel<BackwardFlat>(ts->bootstrap_trait());
+        case enums::Interpolator_ForwardFlat: return traitNodeModel<ForwardFlat>(ts->bootstrap_trait());
+        case enums::Interpolator_Linear: return traitNodeModel<Linear>(ts->bootstrap_trait());
+        case enums::Interpolator_LogLinear: return traitNodeModel<LogLinear>(ts->bootstrap_trait());
+        case enums::Interpolator_LogCubic:
+            return traitNodeModel<LogCubic>(ts->bootstrap_trait(), MonotonicLogCubic());
+        default: QUANTRA_ERROR("Unsupported Interpolator");
+    }
+    return NodeModel();
+}
+
+/// DF nodes, interpolated like a curve reconstructed from the cache.
+NodeModel cachedNodeModel(enums::Interpolator interpolator) {
+    NodeModel m;
+    m.extract = [](const std::shared_ptr<YieldTermStructure>& curve,
+                   const std::vector<Date>& dates, std::vector<double>& values) {
+        values.clear();
+        for (const auto& d : dates)
+            values.push_back(curve->discount(d));
+        return true;
+    };
+    m.build = [interpolator](const std::vector<Date>& dates, const std::vector<double>& values,
+                             const DayCounter& dc) {
+        return CurveSerializer::reconstruct(dates, values, dc, interpolator);
+    };
+    return m;
+}
+
+/// A curve rebuilt on its pillar nodes so each node can be moved directly.
+struct RiskCurve {
+    std::string id;
+    const quantra::TermStructure* ts = nullptr;
+    Date referenceDate;
+    DayCounter dayCounter;
+    NodeModel model;
+    std::vector<Date> dates;          // dates[0] is the reference date
+    std::vector<double> values;       // node values in the model's units
+    std::shared_ptr<RelinkableHandle<YieldTermStructure>> nodes;
+    // Stable view over `nodes`: helpers keep a raw pointer to their own curve
+    // and trades bind shared_ptrs, so relinking `nodes` must not replace it.
+    std::shared_ptr<YieldTermStructure> view;
+    size_t offset = 0;                // first Jacobian column of this curve
+};
+
+struct RiskHelper {
+    std::shared_ptr<RateHelper> helper;
+    std::string quoteId;
+    std::string curveId;
+};
+
+struct RiskTrade {
+    CurveRiskTradeType type;
+    int index;
+    std::string tradeId;              // stored trades only
+    std::shared_ptr<Instrument> instrument;
+    std::string error;
+    double npv = 0.0;
+    std::vector<double> gradient;     // dNPV/dnode per node column (Jacobian)
+    std::map<std::string, double> dv01;
+};
+
+/// Trades plus the quote buckets to report, in first-appearance order.
+struct RiskResult {
+    std::vector<RiskTrade> trades;
+    std::vector<std::string> quoteOrder;
+    std::map<std::string, std::string> quoteCurve;
+    std::vector<std::string> staleCurves;
+
+    void addQuote(const std::string& quoteId, const std::string& curveId) {
+        if (quoteCurve.emplace(quoteId, curveId).second)
+            quoteOrder.push_back(quoteId);
+    }
+};
+
+/// Maps a trade's curve reference to the term structure it should price on.
+using CurveResolver = std::function<std::shared_ptr<YieldTermStructure>(
+    const flatbuffers::String* id, const char* role)>;
+
+const flatbuffers::String* pointQuoteId(const quantra::PointsWrapper* p) {
+    switch (p->point_type()) {
+        case Point_DepositHelper: return p->point_as_DepositHelper()->quote_id();
+        case Point_FRAHelper: return p->point_as_FRAHelper()->quote_id();
+        case Point_FutureHelper: return p->point_as_FutureHelper()->quote_id();
+        case Point_SwapHelper: return p->point_as_SwapHelper()->quote_id();
+        case Point_BondHelper: return p->point_as_BondHelper()->quote_id();
+        case Point_OISHelper: return p->point_as_OISHelper()->quote_id();
+        case Point_DatedOISHelper: return p->point_as_DatedOISHelper()->quote_id();
+        case Point_TenorBasisSwapHelper: return p->point_as_TenorBasisSwapHelper()->quote_id();
+        case Point_FxSwapHelper: return p->point_as_FxSwapHelper()->quote_id();
+        case Point_CrossCcyBasisHelper: return p->point_as_CrossCcyBasisHelper()->quote_id();
+        default: return nullptr;
+    }
+}
+
+void relink(RiskCurve& rc, std::vector<double> values) {
+    if (rc.model.rates) values[0] = values[1];
+    auto curve = rc.model.build(rc.dates, values, rc.dayCounter);
+    curve->enableExtrapolation();
+    rc.nodes->linkTo(curve);
+}
+
+const RiskCurve& findCurve(
+    const std::map<std::string, RiskCurve>& curves,
+    const flatbuffers::String* id,
+    const char* role) {
+    if (!id) QUANTRA_ERROR(std::string(role) + " curve is required");
+    auto it = curves.find(id->str());
+    if (it == curves.end())
+        QUANTRA_ERROR(std::string(role) + " curve not found: " + id->str());
+    return it->second;
+}
+
+/// Parse and price every trade once. Failed trades keep their error and no
+/// instrument; the instruments observe whatever `resolve` hands them. They
+/// all stay alive through the bumps, so the instrument cache is bypassed:
+/// identical trades on different curves must not share one instrument.
+std::vector<RiskTrade> buildTrades(
+    const ComputeCurveRiskRequest* request,
+    const PricingRegistry& reg,
+    const CurveResolver& resolve) {
+    std::vector<RiskTrade> trades;
+
+    auto addTrade = [&](CurveRiskTradeType type, int index, const std::string& tradeId,
+                        auto&& build) {
+        RiskTrade t;
+        t.type = type;
+        t.index = index;
+        t.tradeId = tradeId;
+        try {
+            t.instrument = build();
+            t.npv = t.instrument->NPV();
+        } catch (const std::exception& e) {
+            t.instrument.reset();
+            t.error = e.what();
+        }
+        trades.push_back(std::move(t));
+    };
+
+    // Inline trades, and stored ones referenced by trade or book id; an
+    // unknown id fails only its own entry
+    auto bonds = TradeStore::instance().resolveEach<quantra::FixedRateBond>(
+        request->bonds(), [](const PriceFixedRateBond* p) { return p->fixed_rate_bond(); });
+    for (const auto& item : bonds) {
+        auto b = item.pricing;
+        addTrade(CurveRiskTradeType_Bond, item.entry, item.tradeId, [&]() -> std::shared_ptr<Instrument> {
+            if (!item.error.empty()) QUANTRA_ERROR(item.error);
+            auto disc = resolve(b->discounting_curve(), "Discounting");
+            FixedRateBondParser parser;
+            parser.disableInstrumentCache();
+            auto bond = parser.parse(item.trade);
+            bond->setPricingEngine(std::make_shared<DiscountingBondEngine>(
+                Handle<YieldTermStructure>(disc)));
+            return bond;
+        });
+    }
+    auto swaps = TradeStore::instance().resolveEach<quantra::VanillaSwap>(
+        request->swaps(), [](const PriceVanillaSwap* p) { return p->vanilla_swap(); });
+    for (const auto& item : swaps) {
+        auto s = item.pricing;
+        addTrade(CurveRiskTradeType_Swap, item.entry, item.tradeId, [&]() -> std::shared_ptr<Instrument> {
+            if (!item.error.empty()) QUANTRA_ERROR(item.error);
+            auto disc = resolve(s->discounting_curve(), "Discounting");
+            auto fwd = resolve(s->forwarding_curve(), "Forwarding");
+            VanillaSwapParser parser;
+            parser.disableInstrumentCache();
+            parser.linkForwardingTermStructure(fwd);
+            auto swap = parser.parse(item.trade, reg.indices);
+            swap->setPricingEngine(std::make_shared<DiscountingSwapEngine>(
+                Handle<YieldTermStructure>(disc)));
+            return swap;
+        });
+    }
+    if (request->fras()) {
+        for (flatbuffers::uoffset_t i = 0; i < request->fras()->size(); i++) {
+            auto f = request->fras()->Get(i);
+            addTrade(CurveRiskTradeType_FRA, i, std::string(), [&]() -> std::shared_ptr<Instrument> {
+                auto disc = resolve(f->discounting_curve(), "Discounting");
+                auto fwd = resolve(f->forwarding_curve(), "Forwarding");
+                FRAParser parser;
+                parser.linkForwardingTermStructure(fwd);
+                parser.linkDiscountingTermStructure(disc);
+                return parser.parse(f->fra(), reg.indices);
+            });
+        }
+    }
+    return trades;
+}
+
+/// Key-rate risk from one bootstrap: dNPV/dquote = G * J^-1 on curve nodes.
+/// Node curves are rebuilt with the bootstrap trait and interpolator of their
+/// spec, so they price exactly like the bootstrapped curves; curves served
+/// from the serialized cache are DF curves already and are moved as such.
+RiskResult jacobianRisk(
+    const ComputeCurveRiskRequest* request,
+    const PricingDemand& demand) {
+    PricingRegistryBuilder regBuilder;
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand);
+
+    // -------------------------------------------------------------------------
+    // Node curves and helpers
+    // -------------------------------------------------------------------------
+    std::map<std::string, RiskCurve> curves;
+    std::vector<std::string> curveOrder;
+    CurveRegistry riskRegistry;
+
+    auto specs = request->pricing()->curves();
+    for (flatbuffers::uoffset_t i = 0; specs && i < specs->size(); i++) {
+        auto ts = specs->Get(i);
+        if (!ts->id() || !reg.curves.count(ts->id()->str())) continue;
+
+        std::string id = ts->id()->str();
+        RiskCurve rc;
+        rc.id = id;
+        rc.ts = ts;
+        rc.nodes = std::make_shared<RelinkableHandle<YieldTermStructure>>();
+        riskRegistry.put(id, *rc.nodes);
+        curveOrder.push_back(id);
+        curves.emplace(id, std::move(rc));
+    }
+
+    TermStructurePointParser pointParser;
+    std::vector<RiskHelper> helpers;
+
+    for (const auto& id : curveOrder) {
+        RiskCurve& rc = curves.at(id);
+        auto base = reg.curves.at(id)->currentLink();
+        rc.referenceDate = base->referenceDate();
+        rc.dayCounter = base->dayCounter();
+
+        auto points = rc.ts->points();
+        std::vector<Date> pillars;
+        for (flatbuffers::uoffset_t i = 0; i < points->size(); i++) {
+            auto p = points->Get(i);
+            if (p->point_type() == Point_ZeroRatePoint)
+                QUANTRA_ERROR("Curve risk needs bootstrapped curves; '" + id +
+                              "' is built from ZeroRatePoints");
+
+            RiskHelper rh;
+            rh.helper = pointParser.parse(p->point_type(), p->point(),
+                                          &reg.quoteRegistry, &riskRegistry, &reg.indices);
+            auto qid = pointQuoteId(p);
+            if (qid && qid->size() > 0) {
+                rh.quoteId = qid->str();
+            } else {
+                std::ostringstream os;
+                os << id << "[" << i << "]";
+                rh.quoteId = os.str();
+            }
+            rh.curveId = id;
+            pillars.push_back(rh.helper->pillarDate());
+            helpers.push_back(std::move(rh));
+        }
+
+        std::sort(pillars.begin(), pillars.end());
+        rc.dates.push_back(rc.referenceDate);
+        for (const auto& d : pillars) {
+            if (d <= rc.dates.back())
+                QUANTRA_ERROR("Curve '" + id + "' has two helpers on the same pillar date");
+            rc.dates.push_back(d);
+        }
+        rc.model = traitNodeModel(rc.ts);
+        if (!rc.model.extract(base, rc.dates, rc.values)) {
+            rc.model = cachedNodeModel(rc.ts->interpolator());
+            rc.model.extract(base, rc.dates, rc.values);
+        }
+        relink(rc, rc.values);
+
+        rc.view = std::make_shared<ImpliedTermStructure>(
+            Handle<YieldTermStructure>(*rc.nodes), rc.referenceDate);
+        rc.view->enableExtrapolation();
+    }
+
+    for (auto& rh : helpers)
+        rh.helper->setTermStructure(curves.at(rh.curveId).view.get());
+
+    size_t nNodes = 0;
+    for (const auto& id : curveOrder) {
+        curves.at(id).offset = nNodes;
+        nNodes += curves.at(id).dates.size() - 1;
+    }
+    if (nNodes != helpers.size())
+        QUANTRA_ERROR("Curve risk needs one helper per pillar");
+
+    // -------------------------------------------------------------------------
+    // Trades, priced off the node curves
+    // -------------------------------------------------------------------------
+    RiskResult result;
+    result.staleCurves = reg.staleCurves;
+    result.trades = buildTrades(request, reg,
+        [&](const flatbuffers::String* id, const char* role) {
+            return findCurve(curves, id, role).view;
+        });
+    auto& trades = result.trades;
+    for (auto& t : trades)
+        if (t.instrument) t.gradient.assign(nNodes, 0.0);
+
+    // -------------------------------------------------------------------------
+    // One pass over the nodes fills both J and every trade gradient
+    // -------------------------------------------------------------------------
+    Matrix jacobian(helpers.size(), nNodes, 0.0);
+    std::vector<double> up(helpers.size()), npvUp(trades.size());
+
+    for (const auto& id : curveOrder) {
+        RiskCurve& rc = curves.at(id);
+        for (size_t k = 1; k < rc.dates.size(); k++) {
+            size_t col = rc.offset + k - 1;
+            double h = rc.model.rates ? kRateNodeStep : kNodeStep * rc.values[k];
+            std::vector<double> bumped = rc.values;
+
+            bumped[k] = rc.values[k] + h;
+            relink(rc, bumped);
+            for (size_t r = 0; r < helpers.size(); r++)
+                up[r] = helpers[r].helper->impliedQuote();
+            for (size_t t = 0; t < trades.size(); t++)
+                if (trades[t].instrument) npvUp[t] = trades[t].instrument->NPV();
+
+            bumped[k] = rc.values[k] - h;
+            relink(rc, bumped);
+            for (size_t r = 0; r < helpers.size(); r++)
+                jacobian[r][col] = (up[r] - helpers[r].helper->impliedQuote()) / (2.0 * h);
+            for (size_t t = 0; t < trades.size(); t++)
+                if (trades[t].instrument)
+                    trades[t].gradient[col] =
+                        (npvUp[t] - trades[t].instrument->NPV()) / (2.0 * h);
+        }
+        relink(rc, rc.values);
+    }
+
+    // dnode/dquote = J^-1; the columns of J^-1 are indexed by helper.
+    Matrix nodeByQuote = nNodes > 0 ? inverse(jacobian) : Matrix();
+
+    // -------------------------------------------------------------------------
+    // Chain rule and aggregation per quote id
+    // -------------------------------------------------------------------------
+    double bumpSize = request->bump_size();
+
+    for (const auto& rh : helpers)
+        result.addQuote(rh.quoteId, rh.curveId);
+
+    for (auto& t : trades) {
+        if (!t.instrument) continue;
+        for (size_t r = 0; r < helpers.size(); r++) {
+            double s = 0.0;
+            for (size_t n = 0; n < nNodes; n++)
+                s += t.gradient[n] * nodeByQuote[n][r];
+            t.dv01[helpers[r].quoteId] += s * bumpSize;
+        }
+    }
+    return result;
+}
+
+/// Bump-and-revalue on live quotes: curves and trades are built once, then
+/// each quote is moved in place and QuantLib's observers re-bootstrap only
+/// the curves that depend on it.
+RiskResult bumpQuoteRisk(
+    const ComputeCurveRiskRequest* request,
+    const PricingDemand& demand) {
+    PricingRegistryBuilder regBuilder;
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand, true);
+
+    RiskResult result;
+    result.staleCurves = reg.staleCurves;
+    result.trades = buildTrades(request, reg,
+        [&](const flatbuffers::String* id, const char* role) {
+            if (!id) QUANTRA_ERROR(std::string(role) + " curve is required");
+            auto it = reg.curves.find(id->str());
+            if (it == reg.curves.end())
+                QUANTRA_ERROR(std::string(role) + " curve not found: " + id->str());
+            return it->second->currentLink();
+        });
+    auto& trades = result.trades;
+
+    // Every quote a built curve's helpers reference, in spec order.
+    auto specs = request->pricing()->curves();
+    for (flatbuffers::uoffset_t i = 0; specs && i < specs->size(); i++) {
+        auto ts = specs->Get(i);
+        if (!ts->id() || !reg.curves.count(ts->id()->str())) continue;
+        auto points = ts->points();
+        for (flatbuffers::uoffset_t j = 0; points && j < points->size(); j++) {
+            auto qid = pointQuoteId(points->Get(j));
+            if (qid && qid->size() > 0)
+                result.addQuote(qid->str(), ts->id()->str());
+        }
+    }
+
+    double h = request->bump_size();
+    if (h == 0.0) QUANTRA_ERROR("bump_size must be non-zero for BumpQuotes");
+
+    std::vector<double> npvUp(trades.size());
+    for (const auto& qid : result.quoteOrder) {
+        auto quote = reg.quoteRegistry.getQuote(qid);
+        double v = quote->value();
+
+        quote->setValue(v + h);
+        for (size_t t = 0; t < trades.size(); t++)
+            if (trades[t].instrument) npvUp[t] = trades[t].instrument->NPV();
+
+        quote->setValue(v - h);
+        for (size_t t = 0; t < trades.size(); t++)
+            if (trades[t].instrument)
+                trades[t].dv01[qid] = (npvUp[t] - trades[t].instrument->NPV()) / 2.0;
+
+        quote->setValue(v);
+    }
+    return result;
+}
+
+} // namespace
+
+flatbuffers::Offset<ComputeCurveRiskResponse> CurveRiskRequestHandler::request(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+    const ComputeCurveRiskRequest* request) const
+{
+    // Bootstrap once: only the curves the trades reference.
+    PricingDemand demand;
+    if (request->bonds())
+        for (auto it = request->bonds()->begin(); it != request->bonds()->end(); it++)
+            demand.addCurve(it->discounting_curve());
+    if (request->swaps())
+        for (auto it = request->swaps()->begin(); it != request->swaps()->end(); it++) {
+            demand.addCurve(it->discounting_curve());
+            demand.addCurve(it->forwarding_curve());
+        }
+    if (request->fras())
+        for (auto it = request->fras()->begin(); it != request->fras()->end(); it++) {
+            demand.addCurve(it->discounting_curve());
+            demand.addCurve(it->forwarding_curve());
+        }
+
+    RiskResult result = request->method() == CurveRiskMethod_BumpQuotes
+        ? bumpQuoteRisk(request, demand)
+        : jacobianRisk(request, demand);
+
+    std::vector<flatbuffers::Offset<TradeCurveRisk>> results;
+    for (auto& t : result.trades) {
+        flatbuffers::Offset<flatbuffers::String> tradeId;
+        if (!t.tradeId.empty())
+            tradeId = builder->CreateString(t.tradeId);
+
+        if (!t.instrument) {
+            auto msg = builder->CreateString(t.error);
+            ErrorBuilder eb(*builder);
+            eb.add_error_message(msg);
+            auto err = eb.Finish();
+
+            TradeCurveRiskBuilder tb(*builder);
+            tb.add_trade_type(t.type);
+            tb.add_index(t.index);
+            tb.add_error(err);
+            tb.add_trade_id(tradeId);
+            results.push_back(tb.Finish());
+            continue;
+        }
+
+        std::vector<flatbuffers::Offset<QuoteSensitivity>> buckets;
+        for (const auto& qid : result.quoteOrder) {
+            auto qidStr = builder->CreateString(qid);
+            auto curveStr = builder->CreateString(result.quoteCurve[qid]);
+            QuoteSensitivityBuilder qb(*builder);
+            qb.add_quote_id(qidStr);
+            qb.add_curve_id(curveStr);
+            qb.add_dv01(t.dv01[qid]);
+            buckets.push_back(qb.Finish());
+        }
+        auto bucketsVec = builder->CreateVector(buckets);
+
+        TradeCurveRiskBuilder tb(*builder);
+        tb.add_trade_type(t.type);
+        tb.add_index(t.index);
+        tb.add_npv(t.npv);
+        tb.add_buckets(bucketsVec);
+        tb.add_trade_id(tradeId);
+        results.push_back(tb.Finish());
+    }
+
+    auto resultsVec = builder->CreateVector(results);
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> staleCurves;
+    if (!result.staleCurves.empty())
+        staleCurves = builder->CreateVectorOfStrings(result.staleCurves);
+    ComputeCurveRiskResponseBuilder responseBuilder(*builder);
+    responseBuilder.add_trades(resultsVec);
+    responseBuilder.add_stale_curves(staleCurves);
+    return responseBuilder.Finish();
+}
@@ -0,0 +1,37 @@
+#ifndef QUANTRA_CURVE_RISK_REQUEST_H
+#define QUANTRA_CURVE_RISK_REQUEST_H
+
+#include <ql/quantlib.hpp>
+
+#include "flatbuffers/grpc.h"
+
+#include "curve_risk_request_generated.h"
+#include "curve_risk_response_generated.h"
+#include "pricing_registry.h"
+
+/**
+ * CurveRiskRequestHandler - Bucketed curve sensitivities per quote.
+ *
+ * Curves are bootstrapped once. Each curve is then replaced by a discount
+ * curve on its pillar nodes, and two finite-difference matrices are taken
+ * against the node DFs:
+ *
+ *   J[q][n] = d(implied quote q) / d(DF n)    (bootstrap Jacobian, once)
+ *   G[t][n] = d(NPV t) / d(DF n)              (once per trade)
+ *
+ * dNPV/dquote = G * J^-1, so full key-rate risk costs one bootstrap and one
+ * inversion rather than one re-bootstrap per quote.
+ *
+ * With method = BumpQuotes the curves are instead bootstrapped on the live
+ * registry quotes and the trades built once; each quote is then bumped in
+ * place and the trades repriced, with QuantLib's lazy recalculation
+ * re-bootstrapping only the curves that observe that quote.
+ */
+class CurveRiskRequestHandler {
+public:
+    flatbuffers::Offset<quantra::ComputeCurveRiskResponse> request(
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+        const quantra::ComputeCurveRiskRequest* request) const;
+};
+
+#endif // QUANTRA_CURVE_RISK_REQUEST_H
@@ -0,0 +1,42 @@
+#ifndef QUANTRASERVER_DELETE_TRADES_HANDLER_H
+#define QUANTRASERVER_DELETE_TRADES_HANDLER_H
+
+#include "call_data_base.h"
+#include "product_registry.h"
+#include "delete_trades_request.h"
+#include "delete_trades_request_generated.h"
+#include "delete_trades_response_generated.h"
+
+using quantra::DeleteTradesRequest;
+using quantra::DeleteTradesResponse;
+using quantra::DeleteTradesResponseBuilder;
+
+class DeleteTradesData : public CallDataGeneric<
+    DeleteTradesRequest,
+    DeleteTradesRequestHandler,
+    DeleteTradesResponse,
+    DeleteTradesResponseBuilder>
+{
+public:
+    DeleteTradesData(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq)
+        : CallDataGeneric(service, cq)
+    {
+    }
+
+protected:
+    void RequestCall() override
+    {
+        service_->RequestDeleteTrades(
+            &ctx_, &request_msg, &responder_, cq_, cq_, this);
+    }
+
+    void CreateService(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq) override
+    {
+        auto handler = new DeleteTradesData(service, cq);
+        handler->start();
+    }
+};
+
+REGISTER_PRODUCT(DeleteTrades, DeleteTradesData);
+
+#endif // QUANTRASERVER_DELETE_TRADES_HANDLER_H
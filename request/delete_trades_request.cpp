@@ -0,0 +1,25 @@
+#include "delete_trades_request.h"
+
+#include "trade_store.h"
+
+using namespace quantra;
+
+flatbuffers::Offset<DeleteTradesResponse> DeleteTradesRequestHandler::request(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+    const DeleteTradesRequest* request) const
+{
+    TradeStore& store = TradeStore::instance();
+
+    size_t deleted = 0;
+    if (request->trade_ids()) {
+        for (auto id : *request->trade_ids()) deleted += store.erase(id->str());
+    }
+    if (request->book_ids()) {
+        for (auto book : *request->book_ids()) deleted += store.eraseBook(book->str());
+    }
+
+    DeleteTradesResponseBuilder response(*builder);
+    response.add_deleted(static_cast<int>(deleted));
+    response.add_trade_count(static_cast<int>(store.size()));
+    return response.Finish();
+}
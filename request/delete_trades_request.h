@@ -0,0 +1,20 @@
+#ifndef QUANTRA_DELETE_TRADES_REQUEST_H
+#define QUANTRA_DELETE_TRADES_REQUEST_H
+
+#include "flatbuffers/grpc.h"
+
+#include "delete_trades_request_generated.h"
+#include "delete_trades_response_generated.h"
+
+/**
+ * DeleteTradesRequestHandler - Removes trades from the worker's
+ * TradeStore by id and by book. Unknown ids and books are ignored.
+ */
+class DeleteTradesRequestHandler {
+public:
+    flatbuffers::Offset<quantra::DeleteTradesResponse> request(
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+        const quantra::DeleteTradesRequest* request) const;
+};
+
+#endif // QUANTRA_DELETE_TRADES_REQUEST_H
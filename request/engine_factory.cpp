@@ -25,6 +25,20 @@ std::shared_ptr<QuantLib::PricingEngine> EngineFactory::makeCapFloorEngine(
     const quantra::ModelSpec* model,
     const QuantLib::Handle<QuantLib::YieldTermStructure>& discountCurve,
     const OptionletVolEntry& volEntry) const
+{
+    if (capFloorModelType(model, volEntry) == quantra::enums::IrModelType_Bachelier) {
+        return std::make_shared<QuantLib::BachelierCapFloorEngine>(
+            discountCurve, volEntry.handle);
+    }
+    // Black and ShiftedBlack
+    // Note: BlackCapFloorEngine reads displacement from the vol structure
+    return std::make_shared<QuantLib::BlackCapFloorEngine>(
+        discountCurve, volEntry.handle);
+}
+
+quantra::enums::IrModelType EngineFactory::capFloorModelType(
+    const quantra::ModelSpec* model,
+    const OptionletVolEntry& volEntry) const
 {
     // =========================================================================
     // Validate model
@@ -47,7 +61,7 @@ std::shared_ptr<QuantLib::PricingEngine> EngineFactory::makeCapFloorEngine(
     auto modelType = spec->model_type();
 
     // =========================================================================
-    // Validate model/vol compatibility and create engine
+    // Validate model/vol compatibility
     // =========================================================================
     switch (modelType) {
         case quantra::enums::IrModelType_Bachelier:
@@ -55,25 +69,21 @@ std::shared_ptr<QuantLib::PricingEngine> EngineFactory::makeCapFloorEngine(
                 QUANTRA_ERROR("Model '" + modelId + "': Bachelier requires Normal vols, "
                               "but vol has type ShiftedLognormal");
             }
-            return std::make_shared<QuantLib::BachelierCapFloorEngine>(
-                discountCurve, volEntry.handle);
+            return modelType;
 
         case quantra::enums::IrModelType_Black:
             if (volEntry.displacement != 0.0) {
                 QUANTRA_ERROR("Model '" + modelId + "': Black requires displacement=0, "
                               "but vol has displacement=" + std::to_string(volEntry.displacement));
             }
-            return std::make_shared<QuantLib::BlackCapFloorEngine>(
-                discountCurve, volEntry.handle);
+            return modelType;
 
         case quantra::enums::IrModelType_ShiftedBlack:
             if (volEntry.displacement <= 0.0) {
                 QUANTRA_ERROR("Model '" + modelId + "': ShiftedBlack requires displacement>0, "
                               "but vol has displacement=" + std::to_string(volEntry.displacement));
             }
-            // Note: BlackCapFloorEngine reads displacement from the vol structure
-            return std::make_shared<QuantLib::BlackCapFloorEngine>(
-                discountCurve, volEntry.handle);
+            return modelType;
 
         default:
             QUANTRA_ERROR("Model '" + modelId + "': Unknown IrModelType value " 
@@ -81,7 +91,7 @@ std::shared_ptr<QuantLib::PricingEngine> EngineFactory::makeCapFloorEngine(
     }
     
     // Unreachable - QUANTRA_ERROR throws, but some compilers warn without this
-    return nullptr;
+    return modelType;
 }
 
 std::shared_ptr<QuantLib::PricingEngine> EngineFactory::makeSwaptionEngine(
@@ -44,6 +44,16 @@ public:
         const QuantLib::Handle<QuantLib::YieldTermStructure>& discountCurve,
         const OptionletVolEntry& volEntry) const;
 
+    /**
+     * Validate a cap/floor model against its vol, as makeCapFloorEngine
+     * does, and return the model type - for pricing without an engine.
+     *
+     * @throws std::runtime_error if model/vol incompatible
+     */
+    quantra::enums::IrModelType capFloorModelType(
+        const quantra::ModelSpec* model,
+        const OptionletVolEntry& volEntry) const;
+
     /**
      * Create a swaption pricing engine.
      * 
@@ -1,6 +1,11 @@
 #include "fixed_rate_bond_pricing_request.h"
 
+#include "bond_batch.h"
+#include "bond_yield_batch.h"
+#include "curve_cache.h"
 #include "pricing_registry.h"
+#include "trade_store.h"
+#include "z_spread_batch.h"
 
 using namespace QuantLib;
 using namespace quantra;
@@ -10,8 +15,13 @@ flatbuffers::Offset<quantra::PriceFixedRateBondResponse> FixedRateBondPricingReq
     const quantra::PriceFixedRateBondRequest *request) const
 {
     // Build registry (handles curves with dependency ordering via CurveBootstrapper)
+    // Only the curves the bonds reference are bootstrapped.
+    PricingDemand demand;
+    for (auto it = request->bonds()->begin(); it != request->bonds()->end(); it++)
+        demand.addCurve(it->discounting_curve());
+
     PricingRegistryBuilder regBuilder;
-    PricingRegistry reg = regBuilder.build(request->pricing());
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand);
 
     FixedRateBondParser bond_parser;
 
@@ -22,11 +32,26 @@ flatbuffers::Offset<quantra::PriceFixedRateBondResponse> FixedRateBondPricingReq
     auto pricing = pricing_parser.parse(request->pricing());
     Date settlement_date = DateToQL(pricing->settlement_date);
 
-    auto bond_pricings = request->bonds();
+    // Inline bonds, and stored ones referenced by trade or book id
+    auto bond_pricings = TradeStore::instance().resolve<quantra::FixedRateBond>(
+        request->bonds(), [](const PriceFixedRateBond* p) { return p->fixed_rate_bond(); });
     std::vector<flatbuffers::Offset<quantra::FixedRateBondResponse>> bonds_vector;
 
-    for (auto it = bond_pricings->begin(); it != bond_pricings->end(); it++)
+    // Price all bonds in one batch per discounting curve; with details,
+    // yields and risk come from one batch over the same bonds, and quoted
+    // bonds' Z-spreads from one batch over the same curves
+    BondBatch batch;
+    BondYieldBatch analytics;
+    ZSpreadBatch spreads;
+    YieldParser yield_parser;
+    std::vector<std::shared_ptr<QuantLib::FixedRateBond>> parsed_bonds;
+    std::vector<size_t> yield_index, risk_index;
+    std::vector<int> spread_index;
+    parsed_bonds.reserve(bond_pricings.size());
+    spread_index.reserve(bond_pricings.size());
+    for (const auto& item : bond_pricings)
     {
+        auto it = item.pricing;
         auto term_structure = reg.curves.find(it->discounting_curve()->str());
 
         if (term_structure == reg.curves.end())
@@ -34,14 +59,57 @@ flatbuffers::Offset<quantra::PriceFixedRateBondResponse> FixedRateBondPricingReq
             QUANTRA_ERROR("Discounting curve not found: " + it->discounting_curve()->str());
         }
 
-        std::shared_ptr<QuantLib::FixedRateBond> bond = bond_parser.parse(it->fixed_rate_bond());
+        auto bond = bond_parser.parse(item.trade);
+        parsed_bonds.push_back(bond);
+
+        if (auto quote = it->z_spread_quote())
+        {
+            if (it->book_id())
+                QUANTRA_ERROR("z_spread_quote cannot be combined with book_id");
+
+            ZSpreadBatch::Quote q{quote->clean_price(), CompoundingToQL(quote->compounding()),
+                                  FrequencyToQL(quote->frequency())};
+            spread_index.push_back(static_cast<int>(spreads.add(bond, term_structure->second->currentLink(), q)));
+        }
+        else
+        {
+            spread_index.push_back(-1);
+        }
+
+        if (!reg.bondPricingDetails)
+        {
+            batch.add(bond, term_structure->second->currentLink());
+            continue;
+        }
+
+        // Duration, convexity and bps are taken at the pricing settlement
+        // date, the yield at the bond's own
+        auto yield_struct = yield_parser.parse(it->yield());
+        BondYieldBatch::Convention convention{yield_struct->day_counter, yield_struct->compounding,
+                                              yield_struct->frequency};
+        Date risk_date = (settlement_date == Date()) ? bond->settlementDate() : settlement_date;
+
+        batch.add(bond, term_structure->second->currentLink(), risk_date);
+        yield_index.push_back(analytics.add(bond, bond->settlementDate(), convention));
+        risk_index.push_back(risk_date == bond->settlementDate()
+                                 ? yield_index.back()
+                                 : analytics.add(bond, risk_date, convention));
+    }
+    batch.price();
+    spreads.solve();
+
+    for (size_t i = 0; i < bond_pricings.size(); i++)
+    {
+        auto it = bond_pricings[i].pricing;
+        auto term_structure = reg.curves.find(it->discounting_curve()->str());
+        const std::shared_ptr<QuantLib::FixedRateBond>& bond = parsed_bonds[i];
+        const BondBatch::Result& priced = batch.result(i);
         std::vector<flatbuffers::Offset<quantra::FlowsWrapper>> flows_vector;
-        std::shared_ptr<PricingEngine> bond_engine(new QuantLib::DiscountingBondEngine(*term_structure->second));
-        bond->setPricingEngine(bond_engine);
 
         if (reg.bondPricingFlows)
         {
             const Leg &cashflows = bond->cashflows();
+            CachedDiscounts discount(term_structure->second->currentLink());
 
             for (auto cf_it = cashflows.begin(); cf_it != cashflows.end(); ++cf_it)
             {
@@ -63,9 +131,9 @@ flatbuffers::Offset<quantra::PriceFixedRateBondResponse> FixedRateBondPricingReq
                         flow_interest_builder.add_accrual_start_date(accrual_start_date);
                         flow_interest_builder.add_accrual_end_date(accrual_end_date);
                         flow_interest_builder.add_rate(coupon->rate());
-                        flow_interest_builder.add_discount(term_structure->second->currentLink()->discount(coupon->date()));
-                        flow_interest_builder.add_price(coupon->amount() *
-                                                        term_structure->second->currentLink()->discount(coupon->date()));
+                        const double df = discount(coupon->date());
+                        flow_interest_builder.add_discount(df);
+                        flow_interest_builder.add_price(coupon->amount() * df);
                         auto flow_interest = flow_interest_builder.Finish();
 
                         auto flows_wrapper_builder = quantra::FlowsWrapperBuilder(*builder);
@@ -111,9 +179,9 @@ flatbuffers::Offset<quantra::PriceFixedRateBondResponse> FixedRateBondPricingReq
                         auto flow_notional_builder = FlowNotionalBuilder(*builder);
                         flow_notional_builder.add_amount(cashflow->amount());
                         flow_notional_builder.add_date(date);
-                        flow_notional_builder.add_discount(term_structure->second->currentLink()->discount(cashflow->date()));
-                        flow_notional_builder.add_price(cashflow->amount() *
-                                                        term_structure->second->currentLink()->discount(cashflow->date()));
+                        const double df = discount(cashflow->date());
+                        flow_notional_builder.add_discount(df);
+                        flow_notional_builder.add_price(cashflow->amount() * df);
                         auto flow_notional = flow_notional_builder.Finish();
 
                         auto flows_wrapper_builder = quantra::FlowsWrapperBuilder(*builder);
@@ -127,36 +195,38 @@ flatbuffers::Offset<quantra::PriceFixedRateBondResponse> FixedRateBondPricingReq
         }
 
         auto flows = builder->CreateVector(flows_vector);
+        flatbuffers::Offset<flatbuffers::String> trade_id;
+        if (!bond_pricings[i].tradeId.empty())
+            trade_id = builder->CreateString(bond_pricings[i].tradeId);
 
         FixedRateBondResponseBuilder response_builder(*builder);
 
         response_builder.add_flows(flows);
-        response_builder.add_npv(bond->NPV());
+        response_builder.add_trade_id(trade_id);
+        response_builder.add_npv(priced.npv);
+        if (spread_index[i] >= 0)
+            response_builder.add_z_spread(spreads.zSpread(spread_index[i]));
 
         if (reg.bondPricingDetails)
         {
-            YieldParser yield_parser;
-            auto yield_struct = yield_parser.parse(it->yield());
-
-            auto yield = bond->yield(yield_struct->day_counter, yield_struct->compounding,
-                                     yield_struct->frequency);
+            // Bond::yield() on the batch clean price
+            Rate yield = 0.0;
+            if (bond->notional(priced.settlementDate) != 0.0)
+            {
+                yield = analytics.yield(yield_index[i], priced.cleanPrice, 1.0e-8, 100, 0.05);
+            }
 
-            response_builder.add_clean_price(bond->cleanPrice());
-            response_builder.add_dirty_price(bond->dirtyPrice());
-            response_builder.add_accrued_amount(bond->accruedAmount());
+            response_builder.add_clean_price(priced.cleanPrice);
+            response_builder.add_dirty_price(priced.dirtyPrice);
+            response_builder.add_accrued_amount(priced.accruedAmount);
             response_builder.add_yield(yield);
             response_builder.add_accrued_days(BondFunctions::accruedDays(*bond));
 
-            InterestRate interest_rate(yield, DayCounterToQL(it->yield()->day_counter()),
-                                       CompoundingToQL(it->yield()->compounding()),
-                                       FrequencyToQL(it->yield()->frequency()));
-
-            response_builder.add_modified_duration(BondFunctions::duration(*bond, interest_rate,
-                                                                           Duration::Modified, settlement_date));
-            response_builder.add_macaulay_duration(BondFunctions::duration(*bond, interest_rate,
-                                                                           Duration::Macaulay, settlement_date));
-            response_builder.add_convexity(BondFunctions::convexity(*bond, interest_rate, settlement_date));
-            response_builder.add_bps(BondFunctions::bps(*bond, *term_structure->second->currentLink(), settlement_date));
+            const BondYieldBatch::Risk risk = analytics.risk(risk_index[i], yield);
+            response_builder.add_modified_duration(risk.modifiedDuration);
+            response_builder.add_macaulay_duration(risk.macaulayDuration);
+            response_builder.add_convexity(risk.convexity);
+            response_builder.add_bps(priced.bps);
         }
 
         auto bond_response = response_builder.Finish();
@@ -164,8 +234,10 @@ flatbuffers::Offset<quantra::PriceFixedRateBondResponse> FixedRateBondPricingReq
     }
 
     auto bonds = builder->CreateVector(bonds_vector);
+    auto staleCurves = staleCurvesVector(*builder, reg);
     PriceFixedRateBondResponseBuilder response_builder(*builder);
     response_builder.add_bonds(bonds);
+    response_builder.add_stale_curves(staleCurves);
 
     return response_builder.Finish();
 }
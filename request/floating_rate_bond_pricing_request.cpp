@@ -1,6 +1,8 @@
 #include "floating_rate_bond_pricing_request.h"
 
+#include "curve_cache.h"
 #include "pricing_registry.h"
+#include "z_spread_batch.h"
 
 using namespace QuantLib;
 using namespace quantra;
@@ -9,10 +11,16 @@ flatbuffers::Offset<quantra::PriceFloatingRateBondResponse> FloatingRateBondPric
     std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
     const quantra::PriceFloatingRateBondRequest *request) const
 {
+    PricingDemand demand;
+    for (auto it = request->bonds()->begin(); it != request->bonds()->end(); it++)
+    {
+        demand.addCurve(it->discounting_curve());
+        demand.addCurve(it->forecasting_curve());
+    }
+
     PricingRegistryBuilder regBuilder;
-    PricingRegistry reg = regBuilder.build(request->pricing());
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand);
 
-    FloatingRateBondParser bond_parser;
     PricerParser pricer_parser;
 
     Date as_of_date = Settings::instance().evaluationDate();
@@ -30,6 +38,15 @@ flatbuffers::Offset<quantra::PriceFloatingRateBondResponse> FloatingRateBondPric
     auto bond_pricings = request->bonds();
     std::vector<flatbuffers::Offset<quantra::FloatingRateBondResponse>> bonds_vector;
 
+    // Parse all bonds first so quoted bonds' Z-spreads are solved in one
+    // batch. Bonds outlive the loop, so each forecasting curve gets its own
+    // parser (and handle) rather than one handle relinked per bond.
+    std::map<std::string, FloatingRateBondParser> bond_parsers;
+    std::vector<std::shared_ptr<QuantLib::FloatingRateBond>> parsed_bonds;
+    std::vector<int> spread_index;
+    ZSpreadBatch spreads;
+    parsed_bonds.reserve(bond_pricings->size());
+    spread_index.reserve(bond_pricings->size());
     for (auto it = bond_pricings->begin(); it != bond_pricings->end(); it++)
     {
         auto discounting_term_structure = reg.curves.find(it->discounting_curve()->str());
@@ -44,19 +61,47 @@ flatbuffers::Offset<quantra::PriceFloatingRateBondResponse> FloatingRateBondPric
             QUANTRA_ERROR("Coupon pricer not found: " + it->coupon_pricer()->str());
 
         // Link forecasting curve and parse bond with IndexRegistry
-        bond_parser.linkForecastingTermStructure(forecasting_term_structure->second->currentLink());
-        std::shared_ptr<QuantLib::FloatingRateBond> bond = bond_parser.parse(it->floating_rate_bond(), reg.indices);
+        auto parser = bond_parsers.find(it->forecasting_curve()->str());
+        if (parser == bond_parsers.end())
+        {
+            parser = bond_parsers.emplace(std::piecewise_construct,
+                                          std::forward_as_tuple(it->forecasting_curve()->str()),
+                                          std::forward_as_tuple()).first;
+            parser->second.linkForecastingTermStructure(forecasting_term_structure->second->currentLink());
+        }
+        std::shared_ptr<QuantLib::FloatingRateBond> bond = parser->second.parse(it->floating_rate_bond(), reg.indices);
 
-        std::vector<flatbuffers::Offset<quantra::FlowsWrapper>> flows_vector;
         std::shared_ptr<PricingEngine> bond_engine(new QuantLib::DiscountingBondEngine(*discounting_term_structure->second));
         bond->setPricingEngine(bond_engine);
         setCouponPricer(bond->cashflows(), pricer->second);
+        parsed_bonds.push_back(bond);
+
+        if (auto quote = it->z_spread_quote())
+        {
+            ZSpreadBatch::Quote q{quote->clean_price(), CompoundingToQL(quote->compounding()),
+                                  FrequencyToQL(quote->frequency())};
+            spread_index.push_back(static_cast<int>(
+                spreads.add(bond, discounting_term_structure->second->currentLink(), q)));
+        }
+        else
+        {
+            spread_index.push_back(-1);
+        }
+    }
+    spreads.solve();
 
-        auto npv = bond->NPV();
+    for (flatbuffers::uoffset_t i = 0; i < bond_pricings->size(); i++)
+    {
+        auto it = bond_pricings->Get(i);
+        auto discounting_term_structure = reg.curves.find(it->discounting_curve()->str());
+        const std::shared_ptr<QuantLib::FloatingRateBond>& bond = parsed_bonds[i];
+
+        std::vector<flatbuffers::Offset<quantra::FlowsWrapper>> flows_vector;
 
         if (reg.bondPricingFlows)
         {
             const Leg &cashflows = bond->cashflows();
+            CachedDiscounts discount(discounting_term_structure->second->currentLink());
 
             for (auto cf_it = cashflows.begin(); cf_it != cashflows.end(); ++cf_it)
             {
@@ -79,9 +124,9 @@ flatbuffers::Offset<quantra::PriceFloatingRateBondResponse> FloatingRateBondPric
                         flow_interest_builder.add_accrual_start_date(accrual_start_date);
                         flow_interest_builder.add_accrual_end_date(accrual_end_date);
                         flow_interest_builder.add_rate(coupon->rate());
-                        flow_interest_builder.add_discount(discounting_term_structure->second->currentLink()->discount(coupon->date()));
-                        flow_interest_builder.add_price(coupon->amount() *
-                                                        discounting_term_structure->second->currentLink()->discount(coupon->date()));
+                        const double df = discount(coupon->date());
+                        flow_interest_builder.add_discount(df);
+                        flow_interest_builder.add_price(coupon->amount() * df);
                         auto flow_interest = flow_interest_builder.Finish();
 
                         auto flows_wrapper_builder = quantra::FlowsWrapperBuilder(*builder);
@@ -128,9 +173,9 @@ flatbuffers::Offset<quantra::PriceFloatingRateBondResponse> FloatingRateBondPric
                         auto flow_notional_builder = FlowNotionalBuilder(*builder);
                         flow_notional_builder.add_amount(cashflow->amount());
                         flow_notional_builder.add_date(date);
-                        flow_notional_builder.add_discount(discounting_term_structure->second->currentLink()->discount(cashflow->date()));
-                        flow_notional_builder.add_price(cashflow->amount() *
-                                                        discounting_term_structure->second->currentLink()->discount(cashflow->date()));
+                        const double df = discount(cashflow->date());
+                        flow_notional_builder.add_discount(df);
+                        flow_notional_builder.add_price(cashflow->amount() * df);
                         auto flow_notional = flow_notional_builder.Finish();
 
                         auto flows_wrapper_builder = quantra::FlowsWrapperBuilder(*builder);
@@ -149,6 +194,8 @@ flatbuffers::Offset<quantra::PriceFloatingRateBondResponse> FloatingRateBondPric
 
         response_builder.add_flows(flows);
         response_builder.add_npv(bond->NPV());
+        if (spread_index[i] >= 0)
+            response_builder.add_z_spread(spreads.zSpread(spread_index[i]));
 
         if (reg.bondPricingDetails)
         {
@@ -181,8 +228,10 @@ flatbuffers::Offset<quantra::PriceFloatingRateBondResponse> FloatingRateBondPric
     }
 
     auto bonds = builder->CreateVector(bonds_vector);
+    auto staleCurves = staleCurvesVector(*builder, reg);
     PriceFloatingRateBondResponseBuilder response_builder(*builder);
     response_builder.add_bonds(bonds);
+    response_builder.add_stale_curves(staleCurves);
 
     return response_builder.Finish();
 }
@@ -9,8 +9,15 @@ flatbuffers::Offset<PriceFRAResponse> FRAPricingRequest::request(
     std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
     const PriceFRARequest *request) const
 {
+    PricingDemand demand;
+    for (auto it = request->fras()->begin(); it != request->fras()->end(); it++)
+    {
+        demand.addCurve(it->discounting_curve());
+        demand.addCurve(it->forwarding_curve());
+    }
+
     PricingRegistryBuilder regBuilder;
-    PricingRegistry reg = regBuilder.build(request->pricing());
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand);
 
     FRAParser fra_parser;
 
@@ -49,8 +56,10 @@ flatbuffers::Offset<PriceFRAResponse> FRAPricingRequest::request(
     }
 
     auto fras = builder->CreateVector(fras_vector);
+    auto staleCurves = staleCurvesVector(*builder, reg);
     PriceFRAResponseBuilder response_builder(*builder);
     response_builder.add_fras(fras);
+    response_builder.add_stale_curves(staleCurves);
 
     return response_builder.Finish();
 }
@@ -0,0 +1,135 @@
+#include "sample_encoding.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "common.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+SampleEncoding SampleEncoding::from(const QueryOptions* options) {
+    SampleEncoding encoding;
+    if (!options) return encoding;
+    encoding.dates = options->date_encoding();
+    encoding.values = options->value_encoding();
+    encoding.quantum = options->value_quantum();
+    if (encoding.values == ValueEncoding_DeltaFixed &&
+        !(encoding.quantum > 0.0 && std::isfinite(encoding.quantum))) {
+        QUANTRA_ERROR("QueryOptions.value_quantum must be positive for DeltaFixed encoding");
+    }
+    return encoding;
+}
+
+flatbuffers::Offset<EncodedDates> encodeDates(
+    flatbuffers::FlatBufferBuilder& builder,
+    const std::vector<Date>& dates,
+    const SampleEncoding& encoding,
+    bool allowRange) {
+    if (!encoding.compactDates()) return 0;
+
+    if (encoding.dates == DateEncoding_Range && allowRange && dates.size() >= 2) {
+        const BigInteger step = dates[1] - dates[0];
+        bool even = step > 0;
+        for (size_t i = 2; even && i < dates.size(); i++) {
+            even = (dates[i] - dates[i - 1]) == step;
+        }
+        if (even) {
+            EncodedDatesBuilder b(builder);
+            b.add_encoding(DateEncoding_Range);
+            b.add_start(static_cast<int32_t>(dates[0].serialNumber()));
+            b.add_step_days(static_cast<int32_t>(step));
+            b.add_size(static_cast<int32_t>(dates.size()));
+            return b.Finish();
+        }
+    }
+
+    std::vector<int32_t> serials(dates.size());
+    for (size_t i = 0; i < dates.size(); i++) {
+        serials[i] = static_cast<int32_t>(dates[i].serialNumber());
+    }
+    auto serialsVec = builder.CreateVector(serials);
+    EncodedDatesBuilder b(builder);
+    b.add_encoding(DateEncoding_Serial);
+    b.add_serials(serialsVec);
+    return b.Finish();
+}
+
+flatbuffers::Offset<EncodedValues> encodeValues(
+    flatbuffers::FlatBufferBuilder& builder,
+    const std::vector<double>& values,
+    const SampleEncoding& encoding) {
+    if (encoding.values == ValueEncoding_Float32) {
+        std::vector<float> f32(values.begin(), values.end());
+        auto f32Vec = builder.CreateVector(f32);
+        EncodedValuesBuilder b(builder);
+        b.add_encoding(ValueEncoding_Float32);
+        b.add_f32(f32Vec);
+        return b.Finish();
+    }
+    if (encoding.values != ValueEncoding_DeltaFixed) return 0;
+
+    // Ticks are kept within +-2^53 so the decoded products stay exact
+    // multiples of the quantum.
+    constexpr double maxTicks = 9007199254740992.0;
+    std::vector<int32_t> deltas(values.size());
+    int64_t base = 0, previous = 0;
+    for (size_t i = 0; i < values.size(); i++) {
+        const double scaled = values[i] / encoding.quantum;
+        if (!std::isfinite(scaled) || std::fabs(scaled) > maxTicks) return 0;
+        const int64_t ticks = std::llround(scaled);
+        if (i == 0) {
+            base = ticks;
+        } else {
+            const int64_t delta = ticks - previous;
+            if (delta < std::numeric_limits<int32_t>::min() ||
+                delta > std::numeric_limits<int32_t>::max())
+                return 0;
+            deltas[i] = static_cast<int32_t>(delta);
+        }
+        previous = ticks;
+    }
+    auto deltasVec = builder.CreateVector(deltas);
+    EncodedValuesBuilder b(builder);
+    b.add_encoding(ValueEncoding_DeltaFixed);
+    b.add_base(base);
+    b.add_deltas(deltasVec);
+    b.add_quantum(encoding.quantum);
+    return b.Finish();
+}
+
+std::vector<Date> decodeDates(const EncodedDates* encoded) {
+    std::vector<Date> dates;
+    if (!encoded) return dates;
+    if (encoded->encoding() == DateEncoding_Range) {
+        dates.reserve(encoded->size());
+        for (int32_t i = 0; i < encoded->size(); i++) {
+            dates.push_back(Date(encoded->start() + i * encoded->step_days()));
+        }
+    } else if (encoded->serials()) {
+        dates.reserve(encoded->serials()->size());
+        for (auto s : *encoded->serials()) dates.push_back(Date(s));
+    }
+    return dates;
+}
+
+std::vector<double> decodeValues(const EncodedValues* encoded) {
+    std::vector<double> values;
+    if (!encoded) return values;
+    if (encoded->encoding() == ValueEncoding_DeltaFixed) {
+        if (!encoded->deltas()) return values;
+        values.reserve(encoded->deltas()->size());
+        int64_t ticks = encoded->base();
+        for (auto d : *encoded->deltas()) {
+            ticks += d;
+            values.push_back(static_cast<double>(ticks) * encoded->quantum());
+        }
+    } else if (encoded->f32()) {
+        values.assign(encoded->f32()->begin(), encoded->f32()->end());
+    }
+    return values;
+}
+
+} // namespace quantra
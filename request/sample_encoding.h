@@ -0,0 +1,59 @@
+#ifndef QUANTRA_SAMPLE_ENCODING_H
+#define QUANTRA_SAMPLE_ENCODING_H
+
+/**
+ * Sample encoding
+ *
+ * Writes the compact date/value forms of sampling responses (BootstrapCurves,
+ * SampleVolSurfaces) selected by QueryOptions.date_encoding/value_encoding.
+ *
+ *   Serial      int32 serial numbers instead of ISO strings
+ *   Range       start + step, when the dates are evenly spaced
+ *   Float32     [float] instead of [double]
+ *   DeltaFixed  int32 deltas of llround(value / quantum)
+ *
+ * The encode functions return a null offset when the plain field must be
+ * used instead (Iso / Float64 requested, or DeltaFixed not representable),
+ * so callers fill exactly one of the two fields.
+ */
+
+#include <vector>
+
+#include <ql/time/date.hpp>
+
+#include "flatbuffers/flatbuffers.h"
+#include "curve_query_generated.h"
+
+namespace quantra {
+
+/// Options of a sampling query; defaults match QueryOptions.
+struct SampleEncoding {
+    DateEncoding dates = DateEncoding_Iso;
+    ValueEncoding values = ValueEncoding_Float64;
+    double quantum = 1e-10;
+
+    static SampleEncoding from(const QueryOptions* options);
+
+    bool compactDates() const { return dates != DateEncoding_Iso; }
+};
+
+/// @param allowRange Use Range when the dates are evenly spaced; otherwise
+///                   (and for uneven dates) Range degrades to Serial.
+flatbuffers::Offset<EncodedDates> encodeDates(
+    flatbuffers::FlatBufferBuilder& builder,
+    const std::vector<QuantLib::Date>& dates,
+    const SampleEncoding& encoding,
+    bool allowRange = true);
+
+flatbuffers::Offset<EncodedValues> encodeValues(
+    flatbuffers::FlatBufferBuilder& builder,
+    const std::vector<double>& values,
+    const SampleEncoding& encoding);
+
+/// Inverse of encodeDates/encodeValues, for tests and in-process clients.
+std::vector<QuantLib::Date> decodeDates(const EncodedDates* encoded);
+std::vector<double> decodeValues(const EncodedValues* encoded);
+
+} // namespace quantra
+
+#endif // QUANTRA_SAMPLE_ENCODING_H
@@ -39,4 +39,35 @@ protected:
 
 REGISTER_PRODUCT(SampleVolSurfaces, SampleVolSurfacesData);
 
+/**
+ * SampleVolSurfacesStreamData - Server-streaming SampleVolSurfaces: one
+ * response message per query, written as each surface is sampled.
+ */
+class SampleVolSurfacesStreamData : public StreamingCallDataGeneric<
+    SampleVolSurfacesRequest,
+    SampleVolSurfacesRequestHandler::Stream,
+    SampleVolSurfacesResponse>
+{
+public:
+    SampleVolSurfacesStreamData(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq)
+        : StreamingCallDataGeneric(service, cq)
+    {
+    }
+
+protected:
+    void RequestCall() override
+    {
+        service_->RequestSampleVolSurfacesStream(
+            &ctx_, &request_msg, &writer_, cq_, cq_, this);
+    }
+
+    void CreateService(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq) override
+    {
+        auto handler = new SampleVolSurfacesStreamData(service, cq);
+        handler->start();
+    }
+};
+
+REGISTER_PRODUCT(SampleVolSurfacesStream, SampleVolSurfacesStreamData);
+
 #endif // QUANTRASERVER_SAMPLE_VOL_SURFACES_HANDLER_H
@@ -7,9 +7,12 @@
 #include <cctype>
 #include <cmath>
 
+#include "business_day_calendar.h"
 #include "common_parser.h"
 #include "error.h"
+#include "sample_encoding.h"
 #include "swaption_vol_runtime.h"
+#include "year_fractions.h"
 
 using namespace QuantLib;
 using namespace quantra;
@@ -92,7 +95,7 @@ std::vector<Date> buildDateGrid(
     std::vector<Date> dates;
     GridConventions gc = resolveGridConventions(
         gridSpec, options, fallbackCalendar, fallbackFbCalendar);
-    Calendar calendar = gc.qlCalendar;
+    BusinessDayCalendar calendar(gc.qlCalendar);
     BusinessDayConvention bdc = gc.qlBdc;
     int maxPoints = (options && options->max_points() > 0) ? options->max_points() : 50000;
 
@@ -209,8 +212,21 @@ std::string toIso(const Date& d) {
     return os.str();
 }
 
-double safeOptionTime(const DayCounter& dc, const Date& evalDate, const Date& expiry) {
-    return std::max(1.0e-8, dc.yearFraction(evalDate, expiry));
+/// ISO strings for a plain date field; empty when a compact encoding is used.
+std::vector<flatbuffers::Offset<flatbuffers::String>> isoDates(
+    flatbuffers::grpc::MessageBuilder& b, const std::vector<Date>& dates, const SampleEncoding& encoding) {
+    std::vector<flatbuffers::Offset<flatbuffers::String>> out;
+    if (encoding.compactDates()) return out;
+    out.reserve(dates.size());
+    for (const auto& d : dates) out.push_back(b.CreateString(toIso(d)));
+    return out;
+}
+
+std::vector<double> safeOptionTimes(
+    const DayCounter& dc, const Date& evalDate, const std::vector<Date>& expiries) {
+    std::vector<double> times = YearFractions::from(dc, evalDate, expiries);
+    for (auto& t : times) t = std::max(1.0e-8, t);
+    return times;
 }
 
 int resolveSelectorIndex(int idx, int size, const std::string& name, bool required) {
@@ -244,587 +260,653 @@ void checkPointBudget(int64_t points, const QueryOptions* options) {
 
 } // namespace
 
-flatbuffers::Offset<SampleVolSurfacesResponse> SampleVolSurfacesRequestHandler::request(
-    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+SampleVolSurfacesRequestHandler::Session SampleVolSurfacesRequestHandler::prepare(
     const SampleVolSurfacesRequest* request) const {
     if (!request || !request->pricing() || !request->queries()) {
         QUANTRA_ERROR("SampleVolSurfacesRequest.pricing and queries are required");
     }
 
-    PricingRegistry reg = PricingRegistryBuilder().build(request->pricing());
-    const Date asOf = DateToQL(request->pricing()->as_of_date()->str());
-    Settings::instance().evaluationDate() = asOf;
+    PricingDemand demand;
+    for (flatbuffers::uoffset_t qi = 0; qi < request->queries()->size(); ++qi) {
+        const auto* q = request->queries()->Get(qi);
+        if (!q) continue;
+        demand.addVol(q->vol_id());
+        demand.addCurve(q->discounting_curve_id());
+        demand.addCurve(q->forwarding_curve_id());
+    }
+
+    Session session;
+    session.request = request;
+    session.reg = PricingRegistryBuilder().build(request->pricing(), &demand);
+    session.asOf = DateToQL(request->pricing()->as_of_date()->str());
+    Settings::instance().evaluationDate() = session.asOf;
+    return session;
+}
+
+flatbuffers::Offset<SampleVolSurfacesResponse> SampleVolSurfacesRequestHandler::request(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+    const SampleVolSurfacesRequest* request) const {
+    const Session session = prepare(request);
 
     std::vector<flatbuffers::Offset<VolSurfaceSample>> results;
     for (flatbuffers::uoffset_t qi = 0; qi < request->queries()->size(); ++qi) {
-        const auto* q = request->queries()->Get(qi);
-        std::string volId = (q && q->vol_id()) ? q->vol_id()->str() : "";
+        results.push_back(sampleQuery(builder, session.reg, session.asOf, request->queries()->Get(qi)));
+    }
+
+    auto resultsVec = builder->CreateVector(results);
+    auto staleCurves = staleCurvesVector(*builder, session.reg);
+    SampleVolSurfacesResponseBuilder rb(*builder);
+    rb.add_results(resultsVec);
+    rb.add_stale_curves(staleCurves);
+    return rb.Finish();
+}
+
+SampleVolSurfacesRequestHandler::Stream::Stream(const SampleVolSurfacesRequest* request)
+    : session_(handler_.prepare(request)) {}
+
+bool SampleVolSurfacesRequestHandler::Stream::done() const {
+    return next_ >= session_.request->queries()->size();
+}
 
-        try {
-            if (volId.empty()) {
-                QUANTRA_ERROR("VolQuerySpec.vol_id is required");
+flatbuffers::Offset<SampleVolSurfacesResponse> SampleVolSurfacesRequestHandler::Stream::next(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder) {
+    // Other calls may have moved the evaluation date between messages.
+    if (Settings::instance().evaluationDate() != session_.asOf) {
+        Settings::instance().evaluationDate() = session_.asOf;
+    }
+    const bool first = next_ == 0;
+    auto result = handler_.sampleQuery(
+        builder, session_.reg, session_.asOf, session_.request->queries()->Get(next_++));
+
+    std::vector<flatbuffers::Offset<VolSurfaceSample>> results = {result};
+    auto resultsVec = builder->CreateVector(results);
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> staleCurves;
+    if (first) staleCurves = staleCurvesVector(*builder, session_.reg);
+    SampleVolSurfacesResponseBuilder rb(*builder);
+    rb.add_results(resultsVec);
+    rb.add_stale_curves(staleCurves);
+    return rb.Finish();
+}
+
+flatbuffers::Offset<VolSurfaceSample> SampleVolSurfacesRequestHandler::sampleQuery(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+    const PricingRegistry& reg,
+    const Date& asOf,
+    const VolQuerySpec* q) const {
+    std::string volId = (q && q->vol_id()) ? q->vol_id()->str() : "";
+
+    try {
+        if (volId.empty()) {
+            QUANTRA_ERROR("VolQuerySpec.vol_id is required");
+        }
+        if (!q->strike_grid() || !q->strike_grid()->strikes() || q->strike_grid()->strikes()->size() == 0) {
+            QUANTRA_ERROR("VolQuerySpec.strike_grid.strikes is required");
+        }
+
+        std::vector<Date> expiriesOut;
+        std::vector<flatbuffers::Offset<flatbuffers::String>> requestedExpiryGridOut;
+        std::vector<flatbuffers::Offset<quantra::Period>> tenorsOut;
+        std::vector<Date> effectiveSwapStartsOut;
+        std::vector<Date> effectiveSwapEndsOut;
+        std::vector<double> strikesOut;
+        std::vector<double> volsOut;
+        std::vector<double> atmLevelsOut;
+        ExpiryKind expiryKindOut = ExpiryKind_GridDate;
+        enums::VolatilityType volTypeOut = enums::VolatilityType_Lognormal;
+        enums::SwaptionStrikeKind canonicalStrikeKind = enums::SwaptionStrikeKind_Absolute;
+        VolStrikeAxis requestedStrikeAxis = q->strike_grid()->axis();
+        Date sampleReferenceDate = asOf;
+        enums::Calendar usedCalendar = enums::Calendar_NullCalendar;
+        enums::BusinessDayConvention usedBdc = enums::BusinessDayConvention_Following;
+        bool allowExtrapolationUsed = true;
+        int nExpOut = 0, nTenOut = 0, nStrOut = 0;
+
+        if (q->surface_type() == VolSurfaceType_Swaption) {
+            auto vIt = reg.swaptionVols.find(volId);
+            if (vIt == reg.swaptionVols.end()) {
+                QUANTRA_ERROR("Swaption vol not found: " + volId);
             }
-            if (!q->strike_grid() || !q->strike_grid()->strikes() || q->strike_grid()->strikes()->size() == 0) {
-                QUANTRA_ERROR("VolQuerySpec.strike_grid.strikes is required");
+            SwaptionVolEntry volEntry = vIt->second;
+            if (volEntry.referenceDate == Date()) {
+                QUANTRA_ERROR("Swaption vol has invalid referenceDate: " + volId);
             }
+            if (volEntry.referenceDate != asOf) {
+                std::ostringstream err;
+                err << "Strict mode: pricing.as_of_date (" << io::iso_date(asOf)
+                    << ") must equal swaption vol referenceDate ("
+                    << io::iso_date(volEntry.referenceDate) << ") for vol '" << volId << "'";
+                QUANTRA_ERROR(err.str());
+            }
+            if (!q->tenor_grid()) {
+                QUANTRA_ERROR("VolQuerySpec.tenor_grid is required for swaption sampling");
+            }
+            if (!q->expiry_grid()) {
+                QUANTRA_ERROR("VolQuerySpec.expiry_grid is required for swaption sampling");
+            }
+            canonicalStrikeKind = volEntry.strikeKind;
+            sampleReferenceDate = volEntry.referenceDate;
 
-            std::vector<flatbuffers::Offset<flatbuffers::String>> expiriesOut;
-            std::vector<flatbuffers::Offset<flatbuffers::String>> requestedExpiryGridOut;
-            std::vector<flatbuffers::Offset<quantra::Period>> tenorsOut;
-            std::vector<flatbuffers::Offset<flatbuffers::String>> effectiveSwapStartsOut;
-            std::vector<flatbuffers::Offset<flatbuffers::String>> effectiveSwapEndsOut;
-            std::vector<double> strikesOut;
-            std::vector<double> volsOut;
-            std::vector<double> atmLevelsOut;
-            ExpiryKind expiryKindOut = ExpiryKind_GridDate;
-            enums::VolatilityType volTypeOut = enums::VolatilityType_Lognormal;
-            enums::SwaptionStrikeKind canonicalStrikeKind = enums::SwaptionStrikeKind_Absolute;
-            VolStrikeAxis requestedStrikeAxis = q->strike_grid()->axis();
-            Date sampleReferenceDate = asOf;
-            enums::Calendar usedCalendar = enums::Calendar_NullCalendar;
-            enums::BusinessDayConvention usedBdc = enums::BusinessDayConvention_Following;
-            bool allowExtrapolationUsed = true;
-            int nExpOut = 0, nTenOut = 0, nStrOut = 0;
-
-            if (q->surface_type() == VolSurfaceType_Swaption) {
-                auto vIt = reg.swaptionVols.find(volId);
-                if (vIt == reg.swaptionVols.end()) {
-                    QUANTRA_ERROR("Swaption vol not found: " + volId);
-                }
-                SwaptionVolEntry volEntry = vIt->second;
-                if (volEntry.referenceDate == Date()) {
-                    QUANTRA_ERROR("Swaption vol has invalid referenceDate: " + volId);
+            const auto* options = q->options();
+            const bool allowExtrapolation = !options || options->allow_extrapolation();
+            allowExtrapolationUsed = allowExtrapolation;
+
+            if (volEntry.swapIndexId.empty()) {
+                QUANTRA_ERROR("Swaption surface is missing required swap_index_id");
+            }
+            std::string swapIndexId = volEntry.swapIndexId;
+            if (q->swap_index_id() && !q->swap_index_id()->str().empty()) {
+                swapIndexId = q->swap_index_id()->str();
+            }
+            if (volEntry.swapIndexId != swapIndexId) {
+                QUANTRA_ERROR("VolQuerySpec.swap_index_id does not match surface swap_index_id");
+            }
+            if (!reg.swapIndices.has(swapIndexId)) {
+                QUANTRA_ERROR("Missing swap index definition for id: " + swapIndexId);
+            }
+            const SwapIndexRuntime& sidx = reg.swapIndices.get(swapIndexId);
+            usedCalendar = sidx.fixedCalendarFb;
+            usedBdc = sidx.fixedBdcFb;
+            BusinessDayCalendar fixedCalendar(sidx.fixedCalendar);
+
+            std::vector<Date> rawExpiryGrid;
+            std::vector<Date> expiries;
+            if (q->expiry_grid()->grid_type() == DateGrid_TenorGrid) {
+                auto expPeriods = buildTenorPeriods(q->expiry_grid());
+                rawExpiryGrid.reserve(expPeriods.size());
+                expiries.reserve(expPeriods.size());
+                for (const auto& p : expPeriods) {
+                    Date gridDate = fixedCalendar.advance(volEntry.referenceDate, p, sidx.fixedBdc);
+                    rawExpiryGrid.push_back(gridDate);
+                    expiries.push_back(gridDate);
                 }
-                if (volEntry.referenceDate != asOf) {
-                    std::ostringstream err;
-                    err << "Strict mode: pricing.as_of_date (" << io::iso_date(asOf)
-                        << ") must equal swaption vol referenceDate ("
-                        << io::iso_date(volEntry.referenceDate) << ") for vol '" << volId << "'";
-                    QUANTRA_ERROR(err.str());
+            } else {
+                rawExpiryGrid = buildDateGrid(
+                    q->expiry_grid(), volEntry.referenceDate, asOf, options,
+                    sidx.fixedCalendar, sidx.fixedCalendarFb);
+                expiries.reserve(rawExpiryGrid.size());
+                for (const auto& d : rawExpiryGrid) {
+                    expiries.push_back(fixedCalendar.adjust(d, sidx.fixedBdc));
                 }
-                if (!q->tenor_grid()) {
-                    QUANTRA_ERROR("VolQuerySpec.tenor_grid is required for swaption sampling");
+            }
+            for (const auto& d : rawExpiryGrid) {
+                requestedExpiryGridOut.push_back(builder->CreateString(toIso(d)));
+            }
+            std::vector<QuantLib::Period> tenors = buildTenorPeriods(q->tenor_grid());
+            std::vector<double> strikes;
+            strikes.reserve(q->strike_grid()->strikes()->size());
+            for (flatbuffers::uoffset_t i = 0; i < q->strike_grid()->strikes()->size(); ++i) {
+                strikes.push_back(q->strike_grid()->strikes()->Get(i));
+            }
+            validateStrictlyIncreasingDates(expiries, "expiry_grid (after swap-index adjustment)");
+            validateStrictlyIncreasingStrikes(strikes);
+
+            VolStrikeAxis axis = requestedStrikeAxis;
+            if (volEntry.strikeKind == enums::SwaptionStrikeKind_Absolute &&
+                axis == VolStrikeAxis_SpreadFromATM) {
+                QUANTRA_ERROR("SpreadFromATM strike axis requested for Absolute-strike swaption vol");
+            }
+
+            if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
+                if (!q->discounting_curve_id() || q->discounting_curve_id()->str().empty() ||
+                    !q->forwarding_curve_id() || q->forwarding_curve_id()->str().empty()) {
+                    QUANTRA_ERROR(
+                        "SpreadFromATM swaption sampling requires discounting_curve_id and forwarding_curve_id");
                 }
-                if (!q->expiry_grid()) {
-                    QUANTRA_ERROR("VolQuerySpec.expiry_grid is required for swaption sampling");
+                auto dIt = reg.curves.find(q->discounting_curve_id()->str());
+                auto fIt = reg.curves.find(q->forwarding_curve_id()->str());
+                if (dIt == reg.curves.end() || fIt == reg.curves.end()) {
+                    QUANTRA_ERROR("Sampling curve ids not found for ATM computation");
                 }
-                canonicalStrikeKind = volEntry.strikeKind;
-                sampleReferenceDate = volEntry.referenceDate;
+                volEntry = finalizeSwaptionVolEntryForPricing(
+                    volEntry,
+                    nullptr,
+                    reg,
+                    Handle<YieldTermStructure>(dIt->second->currentLink()),
+                    Handle<YieldTermStructure>(fIt->second->currentLink()),
+                    false);
+            }
 
-                const auto* options = q->options();
-                const bool allowExtrapolation = !options || options->allow_extrapolation();
-                allowExtrapolationUsed = allowExtrapolation;
+            if (volEntry.handle.empty()) {
+                QUANTRA_ERROR("Swaption vol handle is empty");
+            }
+            if (allowExtrapolation) volEntry.handle->enableExtrapolation();
+            else volEntry.handle->disableExtrapolation();
+
+            int64_t nExp = static_cast<int64_t>(expiries.size());
+            int64_t nTen = static_cast<int64_t>(tenors.size());
+            int64_t nStr = static_cast<int64_t>(strikes.size());
+            VolOutputMode mode = q->output_mode();
+            if (mode == VolOutputMode_Cube) checkPointBudget(nExp * nTen * nStr, options);
+            else if (mode == VolOutputMode_SmileSlice) checkPointBudget(nStr, options);
+            else if (mode == VolOutputMode_TermSlice) checkPointBudget(nTen, options);
+            else if (mode == VolOutputMode_ExpirySlice) checkPointBudget(nExp, options);
+
+            const Date evalDate = Settings::instance().evaluationDate();
+            int expIdx = 0;
+            int tenIdx = 0;
+
+            std::vector<double> precomputedAtm;
+            struct SwaptionNodeDates {
+                Date exercise;
+                Date start;
+                Date end;
+            };
+
+            auto requireSelectors = [&](VolOutputMode m) {
+                if (m == VolOutputMode_SmileSlice) {
+                    expIdx = resolveSelectorIndex(q->slice_expiry_index(), static_cast<int>(expiries.size()), "slice_expiry_index", true);
+                    tenIdx = resolveSelectorIndex(q->slice_tenor_index(), static_cast<int>(tenors.size()), "slice_tenor_index", true);
+                } else if (m == VolOutputMode_TermSlice) {
+                    expIdx = resolveSelectorIndex(q->slice_expiry_index(), static_cast<int>(expiries.size()), "slice_expiry_index", true);
+                    if (!q->slice_strike_is_set()) {
+                        QUANTRA_ERROR("TermSlice requires slice_strike_is_set=true");
+                    }
+                    if (!std::isfinite(q->slice_strike())) {
+                        QUANTRA_ERROR("TermSlice requires finite slice_strike");
+                    }
+                } else if (m == VolOutputMode_ExpirySlice) {
+                    tenIdx = resolveSelectorIndex(q->slice_tenor_index(), static_cast<int>(tenors.size()), "slice_tenor_index", true);
+                    if (!q->slice_strike_is_set()) {
+                        QUANTRA_ERROR("ExpirySlice requires slice_strike_is_set=true");
+                    }
+                    if (!std::isfinite(q->slice_strike())) {
+                        QUANTRA_ERROR("ExpirySlice requires finite slice_strike");
+                    }
+                }
+            };
+            requireSelectors(mode);
 
-                if (volEntry.swapIndexId.empty()) {
-                    QUANTRA_ERROR("Swaption surface is missing required swap_index_id");
+            auto atmLookup = [&](int iExp, int iTen) -> double {
+                if (precomputedAtm.empty()) return std::numeric_limits<double>::quiet_NaN();
+                if (mode == VolOutputMode_Cube) {
+                    return precomputedAtm[static_cast<size_t>(iExp) * tenors.size() + static_cast<size_t>(iTen)];
                 }
-                std::string swapIndexId = volEntry.swapIndexId;
-                if (q->swap_index_id() && !q->swap_index_id()->str().empty()) {
-                    swapIndexId = q->swap_index_id()->str();
+                if (mode == VolOutputMode_SmileSlice) {
+                    return precomputedAtm[0];
                 }
-                if (volEntry.swapIndexId != swapIndexId) {
-                    QUANTRA_ERROR("VolQuerySpec.swap_index_id does not match surface swap_index_id");
+                if (mode == VolOutputMode_TermSlice) {
+                    return precomputedAtm[static_cast<size_t>(iTen)];
                 }
-                if (!reg.swapIndices.has(swapIndexId)) {
-                    QUANTRA_ERROR("Missing swap index definition for id: " + swapIndexId);
+                // ExpirySlice
+                return precomputedAtm[static_cast<size_t>(iExp)];
+            };
+
+            if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
+                if (!q->discounting_curve_id() || q->discounting_curve_id()->str().empty() ||
+                    !q->forwarding_curve_id() || q->forwarding_curve_id()->str().empty()) {
+                    QUANTRA_ERROR("SpreadFromATM requires discounting_curve_id/forwarding_curve_id");
                 }
-                const SwapIndexRuntime& sidx = reg.swapIndices.get(swapIndexId);
-                usedCalendar = sidx.fixedCalendarFb;
-                usedBdc = sidx.fixedBdcFb;
-
-                std::vector<Date> rawExpiryGrid;
-                std::vector<Date> expiries;
-                if (q->expiry_grid()->grid_type() == DateGrid_TenorGrid) {
-                    auto expPeriods = buildTenorPeriods(q->expiry_grid());
-                    rawExpiryGrid.reserve(expPeriods.size());
-                    expiries.reserve(expPeriods.size());
-                    for (const auto& p : expPeriods) {
-                        Date gridDate = sidx.fixedCalendar.advance(volEntry.referenceDate, p, sidx.fixedBdc);
-                        rawExpiryGrid.push_back(gridDate);
-                        expiries.push_back(gridDate);
-                    }
-                } else {
-                    rawExpiryGrid = buildDateGrid(
-                        q->expiry_grid(), volEntry.referenceDate, asOf, options,
-                        sidx.fixedCalendar, sidx.fixedCalendarFb);
-                    expiries.reserve(rawExpiryGrid.size());
-                    for (const auto& d : rawExpiryGrid) {
-                        expiries.push_back(sidx.fixedCalendar.adjust(d, sidx.fixedBdc));
-                    }
+                auto dIt = reg.curves.find(q->discounting_curve_id()->str());
+                auto fIt = reg.curves.find(q->forwarding_curve_id()->str());
+                if (dIt == reg.curves.end() || fIt == reg.curves.end()) {
+                    QUANTRA_ERROR("Sampling curve ids not found for ATM computation");
                 }
-                for (const auto& d : rawExpiryGrid) {
-                    requestedExpiryGridOut.push_back(builder->CreateString(toIso(d)));
+                std::vector<Date> atmExpiries;
+                std::vector<QuantLib::Period> atmTenors;
+                if (mode == VolOutputMode_Cube) {
+                    atmExpiries = expiries;
+                    atmTenors = tenors;
+                } else if (mode == VolOutputMode_SmileSlice) {
+                    atmExpiries = {expiries[static_cast<size_t>(expIdx)]};
+                    atmTenors = {tenors[static_cast<size_t>(tenIdx)]};
+                } else if (mode == VolOutputMode_TermSlice) {
+                    atmExpiries = {expiries[static_cast<size_t>(expIdx)]};
+                    atmTenors = tenors;
+                } else { // ExpirySlice
+                    atmExpiries = expiries;
+                    atmTenors = {tenors[static_cast<size_t>(tenIdx)]};
                 }
-                std::vector<QuantLib::Period> tenors = buildTenorPeriods(q->tenor_grid());
-                std::vector<double> strikes;
-                strikes.reserve(q->strike_grid()->strikes()->size());
-                for (flatbuffers::uoffset_t i = 0; i < q->strike_grid()->strikes()->size(); ++i) {
-                    strikes.push_back(q->strike_grid()->strikes()->Get(i));
+                precomputedAtm = computeServerAtmForwardsForExerciseDates(
+                    atmExpiries,
+                    atmTenors,
+                    sidx,
+                    reg.indices,
+                    Handle<YieldTermStructure>(dIt->second->currentLink()),
+                    Handle<YieldTermStructure>(fIt->second->currentLink()));
+                const size_t expectedAtm = atmExpiries.size() * atmTenors.size();
+                if (precomputedAtm.size() != expectedAtm) {
+                    QUANTRA_ERROR(
+                        "ATM matrix size mismatch: got " + std::to_string(precomputedAtm.size()) +
+                        ", expected " + std::to_string(expectedAtm));
                 }
-                validateStrictlyIncreasingDates(expiries, "expiry_grid (after swap-index adjustment)");
-                validateStrictlyIncreasingStrikes(strikes);
+            }
 
-                VolStrikeAxis axis = requestedStrikeAxis;
-                if (volEntry.strikeKind == enums::SwaptionStrikeKind_Absolute &&
-                    axis == VolStrikeAxis_SpreadFromATM) {
-                    QUANTRA_ERROR("SpreadFromATM strike axis requested for Absolute-strike swaption vol");
-                }
+            const std::vector<double> optionTimes = safeOptionTimes(volEntry.dayCounter, evalDate, expiries);
 
-                if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
-                    if (!q->discounting_curve_id() || q->discounting_curve_id()->str().empty() ||
-                        !q->forwarding_curve_id() || q->forwarding_curve_id()->str().empty()) {
-                        QUANTRA_ERROR(
-                            "SpreadFromATM swaption sampling requires discounting_curve_id and forwarding_curve_id");
-                    }
-                    auto dIt = reg.curves.find(q->discounting_curve_id()->str());
-                    auto fIt = reg.curves.find(q->forwarding_curve_id()->str());
-                    if (dIt == reg.curves.end() || fIt == reg.curves.end()) {
-                        QUANTRA_ERROR("Sampling curve ids not found for ATM computation");
-                    }
-                    volEntry = finalizeSwaptionVolEntryForPricing(
-                        volEntry,
-                        nullptr,
-                        reg,
-                        Handle<YieldTermStructure>(dIt->second->currentLink()),
-                        Handle<YieldTermStructure>(fIt->second->currentLink()),
-                        false);
-                }
-
-                if (volEntry.handle.empty()) {
-                    QUANTRA_ERROR("Swaption vol handle is empty");
+            auto computeSwaptionDates = [&](int iExp, int iTen) -> SwaptionNodeDates {
+                Date exercise = expiries[static_cast<size_t>(iExp)];
+                QuantLib::Period tenor = tenors[static_cast<size_t>(iTen)];
+                Date start = exercise;
+                if (sidx.spotDays > 0) {
+                    start = fixedCalendar.advance(exercise, sidx.spotDays, Days, sidx.fixedBdc);
                 }
-                if (allowExtrapolation) volEntry.handle->enableExtrapolation();
-                else volEntry.handle->disableExtrapolation();
-
-                int64_t nExp = static_cast<int64_t>(expiries.size());
-                int64_t nTen = static_cast<int64_t>(tenors.size());
-                int64_t nStr = static_cast<int64_t>(strikes.size());
-                VolOutputMode mode = q->output_mode();
-                if (mode == VolOutputMode_Cube) checkPointBudget(nExp * nTen * nStr, options);
-                else if (mode == VolOutputMode_SmileSlice) checkPointBudget(nStr, options);
-                else if (mode == VolOutputMode_TermSlice) checkPointBudget(nTen, options);
-                else if (mode == VolOutputMode_ExpirySlice) checkPointBudget(nExp, options);
-
-                const Date evalDate = Settings::instance().evaluationDate();
-                int expIdx = 0;
-                int tenIdx = 0;
-
-                std::vector<double> precomputedAtm;
-                struct SwaptionNodeDates {
-                    Date exercise;
-                    Date start;
-                    Date end;
-                };
-
-                auto requireSelectors = [&](VolOutputMode m) {
-                    if (m == VolOutputMode_SmileSlice) {
-                        expIdx = resolveSelectorIndex(q->slice_expiry_index(), static_cast<int>(expiries.size()), "slice_expiry_index", true);
-                        tenIdx = resolveSelectorIndex(q->slice_tenor_index(), static_cast<int>(tenors.size()), "slice_tenor_index", true);
-                    } else if (m == VolOutputMode_TermSlice) {
-                        expIdx = resolveSelectorIndex(q->slice_expiry_index(), static_cast<int>(expiries.size()), "slice_expiry_index", true);
-                        if (!q->slice_strike_is_set()) {
-                            QUANTRA_ERROR("TermSlice requires slice_strike_is_set=true");
-                        }
-                        if (!std::isfinite(q->slice_strike())) {
-                            QUANTRA_ERROR("TermSlice requires finite slice_strike");
-                        }
-                    } else if (m == VolOutputMode_ExpirySlice) {
-                        tenIdx = resolveSelectorIndex(q->slice_tenor_index(), static_cast<int>(tenors.size()), "slice_tenor_index", true);
-                        if (!q->slice_strike_is_set()) {
-                            QUANTRA_ERROR("ExpirySlice requires slice_strike_is_set=true");
-                        }
-                        if (!std::isfinite(q->slice_strike())) {
-                            QUANTRA_ERROR("ExpirySlice requires finite slice_strike");
-                        }
+                Date tentativeEnd = fixedCalendar.advance(start, tenor, sidx.fixedTermBdc);
+                QuantLib::Schedule fixedSchedule(
+                    start, tentativeEnd, QuantLib::Period(sidx.fixedFrequency), sidx.fixedCalendar,
+                    sidx.fixedBdc, sidx.fixedTermBdc, sidx.fixedDateRule, sidx.fixedEom);
+                return {exercise, start, fixedSchedule.endDate()};
+            };
+
+            // Validate tenor monotonicity using the same date-generation
+            // logic used by sampling across representative expiries.
+            if (!tenors.empty()) {
+                auto validateTenorMonotonicAtExpiry = [&](int iExp, const std::string& suffix) {
+                    std::vector<Date> tenorEnds;
+                    tenorEnds.reserve(tenors.size());
+                    for (size_t j = 0; j < tenors.size(); ++j) {
+                        auto d = computeSwaptionDates(iExp, static_cast<int>(j));
+                        tenorEnds.push_back(d.end);
                     }
+                    validateStrictlyIncreasingDates(tenorEnds, "tenor_grid" + suffix);
                 };
-                requireSelectors(mode);
+                validateTenorMonotonicAtExpiry(0, " (first expiry)");
+                if (expiries.size() > 1) {
+                    validateTenorMonotonicAtExpiry(static_cast<int>(expiries.size() - 1), " (last expiry)");
+                }
+            }
 
-                auto atmLookup = [&](int iExp, int iTen) -> double {
-                    if (precomputedAtm.empty()) return std::numeric_limits<double>::quiet_NaN();
-                    if (mode == VolOutputMode_Cube) {
-                        return precomputedAtm[static_cast<size_t>(iExp) * tenors.size() + static_cast<size_t>(iTen)];
-                    }
-                    if (mode == VolOutputMode_SmileSlice) {
-                        return precomputedAtm[0];
-                    }
-                    if (mode == VolOutputMode_TermSlice) {
-                        return precomputedAtm[static_cast<size_t>(iTen)];
-                    }
-                    // ExpirySlice
-                    return precomputedAtm[static_cast<size_t>(iExp)];
-                };
+            auto sampleVol = [&](int iExp, int iTen, double strikeInput, const SwaptionNodeDates& dates) -> double {
+                double optionTime = optionTimes[static_cast<size_t>(iExp)];
+                double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
+                double atm = std::numeric_limits<double>::quiet_NaN();
+                if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
+                    atm = atmLookup(iExp, iTen);
+                }
 
+                double absStrike = strikeInput;
+                double spread = strikeInput;
                 if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
-                    if (!q->discounting_curve_id() || q->discounting_curve_id()->str().empty() ||
-                        !q->forwarding_curve_id() || q->forwarding_curve_id()->str().empty()) {
-                        QUANTRA_ERROR("SpreadFromATM requires discounting_curve_id/forwarding_curve_id");
-                    }
-                    auto dIt = reg.curves.find(q->discounting_curve_id()->str());
-                    auto fIt = reg.curves.find(q->forwarding_curve_id()->str());
-                    if (dIt == reg.curves.end() || fIt == reg.curves.end()) {
-                        QUANTRA_ERROR("Sampling curve ids not found for ATM computation");
+                    if (axis == VolStrikeAxis_SpreadFromATM) {
+                        absStrike = atm + strikeInput;
+                        spread = strikeInput;
+                    } else {
+                        absStrike = strikeInput;
+                        spread = strikeInput - atm;
                     }
-                    std::vector<Date> atmExpiries;
-                    std::vector<QuantLib::Period> atmTenors;
-                    if (mode == VolOutputMode_Cube) {
-                        atmExpiries = expiries;
-                        atmTenors = tenors;
-                    } else if (mode == VolOutputMode_SmileSlice) {
-                        atmExpiries = {expiries[static_cast<size_t>(expIdx)]};
-                        atmTenors = {tenors[static_cast<size_t>(tenIdx)]};
-                    } else if (mode == VolOutputMode_TermSlice) {
-                        atmExpiries = {expiries[static_cast<size_t>(expIdx)]};
-                        atmTenors = tenors;
-                    } else { // ExpirySlice
-                        atmExpiries = expiries;
-                        atmTenors = {tenors[static_cast<size_t>(tenIdx)]};
+                    if (!allowExtrapolation && !volEntry.strikes.empty()) {
+                        if (spread < volEntry.strikes.front() || spread > volEntry.strikes.back()) {
+                            QUANTRA_ERROR("Strike/spread is outside smile cube strike support");
+                        }
                     }
-                    precomputedAtm = computeServerAtmForwardsForExerciseDates(
-                        atmExpiries,
-                        atmTenors,
-                        sidx,
-                        reg.indices,
-                        Handle<YieldTermStructure>(dIt->second->currentLink()),
-                        Handle<YieldTermStructure>(fIt->second->currentLink()));
-                    const size_t expectedAtm = atmExpiries.size() * atmTenors.size();
-                    if (precomputedAtm.size() != expectedAtm) {
-                        QUANTRA_ERROR(
-                            "ATM matrix size mismatch: got " + std::to_string(precomputedAtm.size()) +
-                            ", expected " + std::to_string(expectedAtm));
+                } else if (!allowExtrapolation && !volEntry.strikes.empty()) {
+                    if (absStrike < volEntry.strikes.front() || absStrike > volEntry.strikes.back()) {
+                        QUANTRA_ERROR("Strike is outside swaption vol strike support");
                     }
                 }
 
-                auto computeSwaptionDates = [&](int iExp, int iTen) -> SwaptionNodeDates {
-                    Date exercise = expiries[static_cast<size_t>(iExp)];
-                    QuantLib::Period tenor = tenors[static_cast<size_t>(iTen)];
-                    Date start = exercise;
-                    if (sidx.spotDays > 0) {
-                        start = sidx.fixedCalendar.advance(exercise, sidx.spotDays, Days, sidx.fixedBdc);
+                if (!allowExtrapolation && volEntry.volKind != enums::SwaptionVolKind_Constant) {
+                    if (!volEntry.expiries.empty()) {
+                        Date minExp = fixedCalendar.advance(
+                            volEntry.referenceDate, volEntry.expiries.front(), sidx.fixedBdc);
+                        Date maxExp = fixedCalendar.advance(
+                            volEntry.referenceDate, volEntry.expiries.back(), sidx.fixedBdc);
+                        if (dates.exercise < minExp || dates.exercise > maxExp) {
+                            QUANTRA_ERROR("Expiry is outside swaption vol support");
+                        }
                     }
-                    Date tentativeEnd = sidx.fixedCalendar.advance(start, tenor, sidx.fixedTermBdc);
+                }
+                return volEntry.handle->volatility(optionTime, swapLength, absStrike);
+            };
+
+            auto computeSwapLengthSupportBounds = [&](const SwaptionNodeDates& dates) -> std::pair<double, double> {
+                if (volEntry.tenors.empty()) {
+                    return {0.0, std::numeric_limits<double>::infinity()};
+                }
+                auto computeSwapLengthForSurfaceTenor = [&](const QuantLib::Period& surfaceTenor) {
+                    Date boundEnd = fixedCalendar.advance(dates.start, surfaceTenor, sidx.fixedTermBdc);
                     QuantLib::Schedule fixedSchedule(
-                        start, tentativeEnd, QuantLib::Period(sidx.fixedFrequency), sidx.fixedCalendar,
+                        dates.start, boundEnd, QuantLib::Period(sidx.fixedFrequency), sidx.fixedCalendar,
                         sidx.fixedBdc, sidx.fixedTermBdc, sidx.fixedDateRule, sidx.fixedEom);
-                    return {exercise, start, fixedSchedule.endDate()};
+                    Date end = fixedSchedule.endDate();
+                    return std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, end));
+                };
+                return {
+                    computeSwapLengthForSurfaceTenor(volEntry.tenors.front()),
+                    computeSwapLengthForSurfaceTenor(volEntry.tenors.back())
                 };
+            };
 
-                // Validate tenor monotonicity using the same date-generation
-                // logic used by sampling across representative expiries.
-                if (!tenors.empty()) {
-                    auto validateTenorMonotonicAtExpiry = [&](int iExp, const std::string& suffix) {
-                        std::vector<Date> tenorEnds;
-                        tenorEnds.reserve(tenors.size());
-                        for (size_t j = 0; j < tenors.size(); ++j) {
-                            auto d = computeSwaptionDates(iExp, static_cast<int>(j));
-                            tenorEnds.push_back(d.end);
-                        }
-                        validateStrictlyIncreasingDates(tenorEnds, "tenor_grid" + suffix);
-                    };
-                    validateTenorMonotonicAtExpiry(0, " (first expiry)");
-                    if (expiries.size() > 1) {
-                        validateTenorMonotonicAtExpiry(static_cast<int>(expiries.size() - 1), " (last expiry)");
-                    }
+            auto checkTenorSupport = [&](double swapLength, const std::pair<double, double>& bounds) {
+                const double eps = 1.0e-12;
+                if (swapLength < bounds.first - eps || swapLength > bounds.second + eps) {
+                    QUANTRA_ERROR("Tenor is outside swaption vol support");
                 }
+            };
 
-                auto sampleVol = [&](int iExp, int iTen, double strikeInput, const SwaptionNodeDates& dates) -> double {
-                    double optionTime = safeOptionTime(volEntry.dayCounter, evalDate, dates.exercise);
-                    double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
-                    double atm = std::numeric_limits<double>::quiet_NaN();
-                    if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
-                        atm = atmLookup(iExp, iTen);
-                    }
+            auto addExpiryLabel = [&](const Date& d) {
+                expiriesOut.push_back(d);
+            };
 
-                    double absStrike = strikeInput;
-                    double spread = strikeInput;
-                    if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
-                        if (axis == VolStrikeAxis_SpreadFromATM) {
-                            absStrike = atm + strikeInput;
-                            spread = strikeInput;
-                        } else {
-                            absStrike = strikeInput;
-                            spread = strikeInput - atm;
+            if (mode == VolOutputMode_Cube) {
+                for (size_t i = 0; i < expiries.size(); ++i) addExpiryLabel(expiries[i]);
+                for (size_t j = 0; j < tenors.size(); ++j) tenorsOut.push_back(toFbPeriod(*builder, tenors[j]));
+                strikesOut = strikes;
+                expiryKindOut = ExpiryKind_ExerciseDate;
+
+                for (size_t i = 0; i < expiries.size(); ++i) {
+                    for (size_t j = 0; j < tenors.size(); ++j) {
+                        auto dates = computeSwaptionDates(static_cast<int>(i), static_cast<int>(j));
+                        std::pair<double, double> tenorBounds;
+                        bool enforceTenorBounds = (!allowExtrapolation && volEntry.volKind != enums::SwaptionVolKind_Constant);
+                        if (enforceTenorBounds) {
+                            tenorBounds = computeSwapLengthSupportBounds(dates);
+                            double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
+                            checkTenorSupport(swapLength, tenorBounds);
                         }
-                        if (!allowExtrapolation && !volEntry.strikes.empty()) {
-                            if (spread < volEntry.strikes.front() || spread > volEntry.strikes.back()) {
-                                QUANTRA_ERROR("Strike/spread is outside smile cube strike support");
-                            }
+                        effectiveSwapStartsOut.push_back(dates.start);
+                        effectiveSwapEndsOut.push_back(dates.end);
+                        if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM &&
+                            !precomputedAtm.empty()) {
+                            atmLevelsOut.push_back(atmLookup(static_cast<int>(i), static_cast<int>(j)));
                         }
-                    } else if (!allowExtrapolation && !volEntry.strikes.empty()) {
-                        if (absStrike < volEntry.strikes.front() || absStrike > volEntry.strikes.back()) {
-                            QUANTRA_ERROR("Strike is outside swaption vol strike support");
+                        for (double strike : strikes) {
+                            volsOut.push_back(sampleVol(static_cast<int>(i), static_cast<int>(j), strike, dates));
                         }
                     }
-
+                }
+                nExpOut = static_cast<int>(expiries.size());
+                nTenOut = static_cast<int>(tenors.size());
+                nStrOut = static_cast<int>(strikes.size());
+            } else if (mode == VolOutputMode_SmileSlice) {
+                int i = expIdx;
+                int j = tenIdx;
+                addExpiryLabel(expiries[static_cast<size_t>(i)]);
+                tenorsOut.push_back(toFbPeriod(*builder, tenors[static_cast<size_t>(j)]));
+                strikesOut = strikes;
+                expiryKindOut = ExpiryKind_ExerciseDate;
+                auto dates = computeSwaptionDates(i, j);
+                std::pair<double, double> tenorBounds;
+                if (!allowExtrapolation && volEntry.volKind != enums::SwaptionVolKind_Constant) {
+                    tenorBounds = computeSwapLengthSupportBounds(dates);
+                    double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
+                    checkTenorSupport(swapLength, tenorBounds);
+                }
+                effectiveSwapStartsOut.push_back(dates.start);
+                effectiveSwapEndsOut.push_back(dates.end);
+                if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
+                    double atm = atmLookup(i, j);
+                    if (std::isfinite(atm)) atmLevelsOut.push_back(atm);
+                }
+                for (double strike : strikes) {
+                    volsOut.push_back(sampleVol(i, j, strike, dates));
+                }
+                nExpOut = 1; nTenOut = 1; nStrOut = static_cast<int>(strikes.size());
+            } else if (mode == VolOutputMode_TermSlice) {
+                int i = expIdx;
+                addExpiryLabel(expiries[static_cast<size_t>(i)]);
+                strikesOut.push_back(q->slice_strike());
+                expiryKindOut = ExpiryKind_ExerciseDate;
+                for (size_t j = 0; j < tenors.size(); ++j) {
+                    auto dates = computeSwaptionDates(i, static_cast<int>(j));
+                    std::pair<double, double> tenorBounds;
                     if (!allowExtrapolation && volEntry.volKind != enums::SwaptionVolKind_Constant) {
-                        if (!volEntry.expiries.empty()) {
-                            Date minExp = sidx.fixedCalendar.advance(
-                                volEntry.referenceDate, volEntry.expiries.front(), sidx.fixedBdc);
-                            Date maxExp = sidx.fixedCalendar.advance(
-                                volEntry.referenceDate, volEntry.expiries.back(), sidx.fixedBdc);
-                            if (dates.exercise < minExp || dates.exercise > maxExp) {
-                                QUANTRA_ERROR("Expiry is outside swaption vol support");
-                            }
-                        }
-                    }
-                    return volEntry.handle->volatility(optionTime, swapLength, absStrike);
-                };
-
-                auto computeSwapLengthSupportBounds = [&](const SwaptionNodeDates& dates) -> std::pair<double, double> {
-                    if (volEntry.tenors.empty()) {
-                        return {0.0, std::numeric_limits<double>::infinity()};
-                    }
-                    auto computeSwapLengthForSurfaceTenor = [&](const QuantLib::Period& surfaceTenor) {
-                        Date boundEnd = sidx.fixedCalendar.advance(dates.start, surfaceTenor, sidx.fixedTermBdc);
-                        QuantLib::Schedule fixedSchedule(
-                            dates.start, boundEnd, QuantLib::Period(sidx.fixedFrequency), sidx.fixedCalendar,
-                            sidx.fixedBdc, sidx.fixedTermBdc, sidx.fixedDateRule, sidx.fixedEom);
-                        Date end = fixedSchedule.endDate();
-                        return std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, end));
-                    };
-                    return {
-                        computeSwapLengthForSurfaceTenor(volEntry.tenors.front()),
-                        computeSwapLengthForSurfaceTenor(volEntry.tenors.back())
-                    };
-                };
-
-                auto checkTenorSupport = [&](double swapLength, const std::pair<double, double>& bounds) {
-                    const double eps = 1.0e-12;
-                    if (swapLength < bounds.first - eps || swapLength > bounds.second + eps) {
-                        QUANTRA_ERROR("Tenor is outside swaption vol support");
+                        tenorBounds = computeSwapLengthSupportBounds(dates);
+                        double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
+                        checkTenorSupport(swapLength, tenorBounds);
                     }
-                };
-
-                auto addExpiryLabel = [&](const Date& d) {
-                    expiriesOut.push_back(builder->CreateString(toIso(d)));
-                };
-
-                if (mode == VolOutputMode_Cube) {
-                    for (size_t i = 0; i < expiries.size(); ++i) addExpiryLabel(expiries[i]);
-                    for (size_t j = 0; j < tenors.size(); ++j) tenorsOut.push_back(toFbPeriod(*builder, tenors[j]));
-                    strikesOut = strikes;
-                    expiryKindOut = ExpiryKind_ExerciseDate;
-
-                    for (size_t i = 0; i < expiries.size(); ++i) {
-                        for (size_t j = 0; j < tenors.size(); ++j) {
-                            auto dates = computeSwaptionDates(static_cast<int>(i), static_cast<int>(j));
-                            std::pair<double, double> tenorBounds;
-                            bool enforceTenorBounds = (!allowExtrapolation && volEntry.volKind != enums::SwaptionVolKind_Constant);
-                            if (enforceTenorBounds) {
-                                tenorBounds = computeSwapLengthSupportBounds(dates);
-                                double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
-                                checkTenorSupport(swapLength, tenorBounds);
-                            }
-                            effectiveSwapStartsOut.push_back(builder->CreateString(toIso(dates.start)));
-                            effectiveSwapEndsOut.push_back(builder->CreateString(toIso(dates.end)));
-                            if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM &&
-                                !precomputedAtm.empty()) {
-                                atmLevelsOut.push_back(atmLookup(static_cast<int>(i), static_cast<int>(j)));
-                            }
-                            for (double strike : strikes) {
-                                volsOut.push_back(sampleVol(static_cast<int>(i), static_cast<int>(j), strike, dates));
-                            }
-                        }
+                    volsOut.push_back(sampleVol(i, static_cast<int>(j), q->slice_strike(), dates));
+                    tenorsOut.push_back(toFbPeriod(*builder, tenors[j]));
+                    effectiveSwapStartsOut.push_back(dates.start);
+                    effectiveSwapEndsOut.push_back(dates.end);
+                    if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
+                        double atm = atmLookup(i, static_cast<int>(j));
+                        if (std::isfinite(atm)) atmLevelsOut.push_back(atm);
                     }
-                    nExpOut = static_cast<int>(expiries.size());
-                    nTenOut = static_cast<int>(tenors.size());
-                    nStrOut = static_cast<int>(strikes.size());
-                } else if (mode == VolOutputMode_SmileSlice) {
-                    int i = expIdx;
-                    int j = tenIdx;
-                    addExpiryLabel(expiries[static_cast<size_t>(i)]);
-                    tenorsOut.push_back(toFbPeriod(*builder, tenors[static_cast<size_t>(j)]));
-                    strikesOut = strikes;
-                    expiryKindOut = ExpiryKind_ExerciseDate;
-                    auto dates = computeSwaptionDates(i, j);
+                }
+                nExpOut = 1; nTenOut = static_cast<int>(tenors.size()); nStrOut = 1;
+            } else if (mode == VolOutputMode_ExpirySlice) {
+                int j = tenIdx;
+                strikesOut.push_back(q->slice_strike());
+                tenorsOut.push_back(toFbPeriod(*builder, tenors[static_cast<size_t>(j)]));
+                expiryKindOut = ExpiryKind_ExerciseDate;
+                for (size_t i = 0; i < expiries.size(); ++i) {
+                    addExpiryLabel(expiries[i]);
+                    auto dates = computeSwaptionDates(static_cast<int>(i), j);
                     std::pair<double, double> tenorBounds;
                     if (!allowExtrapolation && volEntry.volKind != enums::SwaptionVolKind_Constant) {
                         tenorBounds = computeSwapLengthSupportBounds(dates);
                         double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
                         checkTenorSupport(swapLength, tenorBounds);
                     }
-                    effectiveSwapStartsOut.push_back(builder->CreateString(toIso(dates.start)));
-                    effectiveSwapEndsOut.push_back(builder->CreateString(toIso(dates.end)));
+                    volsOut.push_back(sampleVol(static_cast<int>(i), j, q->slice_strike(), dates));
+                    effectiveSwapStartsOut.push_back(dates.start);
+                    effectiveSwapEndsOut.push_back(dates.end);
                     if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
-                        double atm = atmLookup(i, j);
+                        double atm = atmLookup(static_cast<int>(i), j);
                         if (std::isfinite(atm)) atmLevelsOut.push_back(atm);
                     }
-                    for (double strike : strikes) {
-                        volsOut.push_back(sampleVol(i, j, strike, dates));
-                    }
-                    nExpOut = 1; nTenOut = 1; nStrOut = static_cast<int>(strikes.size());
-                } else if (mode == VolOutputMode_TermSlice) {
-                    int i = expIdx;
-                    addExpiryLabel(expiries[static_cast<size_t>(i)]);
-                    strikesOut.push_back(q->slice_strike());
-                    expiryKindOut = ExpiryKind_ExerciseDate;
-                    for (size_t j = 0; j < tenors.size(); ++j) {
-                        auto dates = computeSwaptionDates(i, static_cast<int>(j));
-                        std::pair<double, double> tenorBounds;
-                        if (!allowExtrapolation && volEntry.volKind != enums::SwaptionVolKind_Constant) {
-                            tenorBounds = computeSwapLengthSupportBounds(dates);
-                            double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
-                            checkTenorSupport(swapLength, tenorBounds);
-                        }
-                        volsOut.push_back(sampleVol(i, static_cast<int>(j), q->slice_strike(), dates));
-                        tenorsOut.push_back(toFbPeriod(*builder, tenors[j]));
-                        effectiveSwapStartsOut.push_back(builder->CreateString(toIso(dates.start)));
-                        effectiveSwapEndsOut.push_back(builder->CreateString(toIso(dates.end)));
-                        if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
-                            double atm = atmLookup(i, static_cast<int>(j));
-                            if (std::isfinite(atm)) atmLevelsOut.push_back(atm);
-                        }
-                    }
-                    nExpOut = 1; nTenOut = static_cast<int>(tenors.size()); nStrOut = 1;
-                } else if (mode == VolOutputMode_ExpirySlice) {
-                    int j = tenIdx;
-                    strikesOut.push_back(q->slice_strike());
-                    tenorsOut.push_back(toFbPeriod(*builder, tenors[static_cast<size_t>(j)]));
-                    expiryKindOut = ExpiryKind_ExerciseDate;
-                    for (size_t i = 0; i < expiries.size(); ++i) {
-                        addExpiryLabel(expiries[i]);
-                        auto dates = computeSwaptionDates(static_cast<int>(i), j);
-                        std::pair<double, double> tenorBounds;
-                        if (!allowExtrapolation && volEntry.volKind != enums::SwaptionVolKind_Constant) {
-                            tenorBounds = computeSwapLengthSupportBounds(dates);
-                            double swapLength = std::max(1.0e-8, volEntry.dayCounter.yearFraction(dates.start, dates.end));
-                            checkTenorSupport(swapLength, tenorBounds);
-                        }
-                        volsOut.push_back(sampleVol(static_cast<int>(i), j, q->slice_strike(), dates));
-                        effectiveSwapStartsOut.push_back(builder->CreateString(toIso(dates.start)));
-                        effectiveSwapEndsOut.push_back(builder->CreateString(toIso(dates.end)));
-                        if (volEntry.strikeKind == enums::SwaptionStrikeKind_SpreadFromATM) {
-                            double atm = atmLookup(static_cast<int>(i), j);
-                            if (std::isfinite(atm)) atmLevelsOut.push_back(atm);
-                        }
-                    }
-                    nExpOut = static_cast<int>(expiries.size()); nTenOut = 1; nStrOut = 1;
-                } else {
-                    QUANTRA_ERROR("Unsupported VolOutputMode");
                 }
+                nExpOut = static_cast<int>(expiries.size()); nTenOut = 1; nStrOut = 1;
+            } else {
+                QUANTRA_ERROR("Unsupported VolOutputMode");
+            }
 
-                volTypeOut = fromQlVolType(volEntry.qlVolType, volEntry.displacement);
-            } else if (q->surface_type() == VolSurfaceType_Optionlet) {
-                auto vIt = reg.optionletVols.find(volId);
-                if (vIt == reg.optionletVols.end()) {
-                    QUANTRA_ERROR("Optionlet vol not found: " + volId);
-                }
-                const OptionletVolEntry& volEntry = vIt->second;
-                if (volEntry.referenceDate != asOf) {
-                    std::ostringstream err;
-                    err << "Strict mode: pricing.as_of_date (" << io::iso_date(asOf)
-                        << ") must equal optionlet vol referenceDate ("
-                        << io::iso_date(volEntry.referenceDate) << ") for vol '" << volId << "'";
-                    QUANTRA_ERROR(err.str());
-                }
-                if (q->strike_grid()->axis() == VolStrikeAxis_SpreadFromATM) {
-                    QUANTRA_ERROR("Optionlet sampling supports AbsoluteStrike axis only");
-                }
-                if (q->output_mode() != VolOutputMode_Cube) {
-                    QUANTRA_ERROR("Optionlet sampling supports Cube output_mode only");
-                }
-                if (q->swap_index_id() && !q->swap_index_id()->str().empty()) {
-                    QUANTRA_ERROR("swap_index_id is not valid for optionlet sampling");
-                }
-                if (q->slice_expiry_index() >= 0 || q->slice_tenor_index() >= 0 || q->slice_strike_is_set()) {
-                    QUANTRA_ERROR("Optionlet query does not support slice selectors");
-                }
-                const auto* options = q->options();
-                const bool allowExtrapolation = !options || options->allow_extrapolation();
-                sampleReferenceDate = volEntry.referenceDate;
-                canonicalStrikeKind = enums::SwaptionStrikeKind_Absolute;
-                GridConventions gc = resolveGridConventions(
-                    q->expiry_grid(), options, volEntry.calendar, volEntry.calendarFb);
-                usedCalendar = gc.fbCalendar;
-                usedBdc = gc.fbBdc;
-                allowExtrapolationUsed = allowExtrapolation;
-                expiryKindOut = ExpiryKind_GridDate;
-                if (allowExtrapolation) volEntry.handle->enableExtrapolation();
-                else volEntry.handle->disableExtrapolation();
-                std::vector<Date> expiries = buildDateGrid(
-                    q->expiry_grid(), volEntry.referenceDate, asOf, options,
-                    volEntry.calendar, gc.fbCalendar);
-                validateStrictlyIncreasingDates(expiries, "expiry_grid");
-                for (size_t i = 0; i < expiries.size(); ++i) {
-                    expiriesOut.push_back(builder->CreateString(toIso(expiries[i])));
-                }
-                for (flatbuffers::uoffset_t i = 0; i < q->strike_grid()->strikes()->size(); ++i) {
-                    strikesOut.push_back(q->strike_grid()->strikes()->Get(i));
-                }
-                validateStrictlyIncreasingStrikes(strikesOut);
-                checkPointBudget(
-                    static_cast<int64_t>(expiries.size()) * static_cast<int64_t>(strikesOut.size()),
-                    options);
-                for (const auto& d : expiries) {
-                    for (double strike : strikesOut) {
-                        if (!allowExtrapolation && d > volEntry.handle->maxDate()) {
-                            QUANTRA_ERROR("Expiry is outside optionlet vol support");
-                        }
-                        if (!allowExtrapolation) {
-                            if (strike < volEntry.handle->minStrike() || strike > volEntry.handle->maxStrike()) {
-                                QUANTRA_ERROR("Strike is outside optionlet vol support");
-                            }
+            volTypeOut = fromQlVolType(volEntry.qlVolType, volEntry.displacement);
+        } else if (q->surface_type() == VolSurfaceType_Optionlet) {
+            auto vIt = reg.optionletVols.find(volId);
+            if (vIt == reg.optionletVols.end()) {
+                QUANTRA_ERROR("Optionlet vol not found: " + volId);
+            }
+            const OptionletVolEntry& volEntry = vIt->second;
+            if (volEntry.referenceDate != asOf) {
+                std::ostringstream err;
+                err << "Strict mode: pricing.as_of_date (" << io::iso_date(asOf)
+                    << ") must equal optionlet vol referenceDate ("
+                    << io::iso_date(volEntry.referenceDate) << ") for vol '" << volId << "'";
+                QUANTRA_ERROR(err.str());
+            }
+            if (q->strike_grid()->axis() == VolStrikeAxis_SpreadFromATM) {
+                QUANTRA_ERROR("Optionlet sampling supports AbsoluteStrike axis only");
+            }
+            if (q->output_mode() != VolOutputMode_Cube) {
+                QUANTRA_ERROR("Optionlet sampling supports Cube output_mode only");
+            }
+            if (q->swap_index_id() && !q->swap_index_id()->str().empty()) {
+                QUANTRA_ERROR("swap_index_id is not valid for optionlet sampling");
+            }
+            if (q->slice_expiry_index() >= 0 || q->slice_tenor_index() >= 0 || q->slice_strike_is_set()) {
+                QUANTRA_ERROR("Optionlet query does not support slice selectors");
+            }
+            const auto* options = q->options();
+            const bool allowExtrapolation = !options || options->allow_extrapolation();
+            sampleReferenceDate = volEntry.referenceDate;
+            canonicalStrikeKind = enums::SwaptionStrikeKind_Absolute;
+            GridConventions gc = resolveGridConventions(
+                q->expiry_grid(), options, volEntry.calendar, volEntry.calendarFb);
+            usedCalendar = gc.fbCalendar;
+            usedBdc = gc.fbBdc;
+            allowExtrapolationUsed = allowExtrapolation;
+            expiryKindOut = ExpiryKind_GridDate;
+            if (allowExtrapolation) volEntry.handle->enableExtrapolation();
+            else volEntry.handle->disableExtrapolation();
+            std::vector<Date> expiries = buildDateGrid(
+                q->expiry_grid(), volEntry.referenceDate, asOf, options,
+                volEntry.calendar, gc.fbCalendar);
+            validateStrictlyIncreasingDates(expiries, "expiry_grid");
+            for (size_t i = 0; i < expiries.size(); ++i) {
+                expiriesOut.push_back(expiries[i]);
+            }
+            for (flatbuffers::uoffset_t i = 0; i < q->strike_grid()->strikes()->size(); ++i) {
+                strikesOut.push_back(q->strike_grid()->strikes()->Get(i));
+            }
+            validateStrictlyIncreasingStrikes(strikesOut);
+            checkPointBudget(
+                static_cast<int64_t>(expiries.size()) * static_cast<int64_t>(strikesOut.size()),
+                options);
+            for (const auto& d : expiries) {
+                for (double strike : strikesOut) {
+                    if (!allowExtrapolation && d > volEntry.handle->maxDate()) {
+                        QUANTRA_ERROR("Expiry is outside optionlet vol support");
+                    }
+                    if (!allowExtrapolation) {
+                        if (strike < volEntry.handle->minStrike() || strike > volEntry.handle->maxStrike()) {
+                            QUANTRA_ERROR("Strike is outside optionlet vol support");
                         }
-                        volsOut.push_back(volEntry.handle->volatility(d, strike));
                     }
+                    volsOut.push_back(volEntry.handle->volatility(d, strike));
                 }
-                nExpOut = static_cast<int>(expiries.size());
-                nTenOut = 0;
-                nStrOut = static_cast<int>(strikesOut.size());
-                volTypeOut = fromQlVolType(volEntry.qlVolType, volEntry.displacement);
-            } else {
-                QUANTRA_ERROR("Unknown VolSurfaceType");
             }
-
-            auto volIdOffset = builder->CreateString(volId);
-            auto refDateOffset = builder->CreateString(toIso(sampleReferenceDate));
-            auto expiriesVec = builder->CreateVector(expiriesOut);
-            auto requestedExpiriesVec = builder->CreateVector(requestedExpiryGridOut);
-            auto tenorsVec = builder->CreateVector(tenorsOut);
-            auto effectiveStartsVec = builder->CreateVector(effectiveSwapStartsOut);
-            auto effectiveEndsVec = builder->CreateVector(effectiveSwapEndsOut);
-            auto strikesVec = builder->CreateVector(strikesOut);
-            auto volsVec = builder->CreateVector(volsOut);
-            auto atmVec = builder->CreateVector(atmLevelsOut);
-
-            VolSurfaceSampleBuilder out(*builder);
-            out.add_vol_id(volIdOffset);
-            out.add_reference_date(refDateOffset);
-            out.add_ql_vol_type(volTypeOut);
-            out.add_requested_strike_axis(requestedStrikeAxis);
-            out.add_canonical_strike_kind(canonicalStrikeKind);
-            out.add_allow_extrapolation_used(allowExtrapolationUsed);
-            out.add_calendar_used(usedCalendar);
-            out.add_business_day_convention_used(usedBdc);
-            out.add_expiry_kind(expiryKindOut);
-            out.add_expiries(expiriesVec);
-            out.add_requested_expiry_grid_points(requestedExpiriesVec);
-            out.add_tenors(tenorsVec);
-            out.add_effective_swap_starts(effectiveStartsVec);
-            out.add_effective_swap_ends(effectiveEndsVec);
-            out.add_strikes(strikesVec);
-            out.add_vols(volsVec);
-            out.add_n_expiries(nExpOut);
-            out.add_n_tenors(nTenOut);
-            out.add_n_strikes(nStrOut);
-            out.add_atm_levels(atmVec);
-            results.push_back(out.Finish());
-        } catch (const std::exception& e) {
-            auto volIdOffset = builder->CreateString(volId);
-            auto errMsg = builder->CreateString(e.what());
-            ErrorBuilder eb(*builder);
-            eb.add_error_message(errMsg);
-            auto errOffset = eb.Finish();
-
-            VolSurfaceSampleBuilder out(*builder);
-            out.add_vol_id(volIdOffset);
-            out.add_error(errOffset);
-            results.push_back(out.Finish());
+            nExpOut = static_cast<int>(expiries.size());
+            nTenOut = 0;
+            nStrOut = static_cast<int>(strikesOut.size());
+            volTypeOut = fromQlVolType(volEntry.qlVolType, volEntry.displacement);
+        } else {
+            QUANTRA_ERROR("Unknown VolSurfaceType");
         }
-    }
 
-    auto resultsVec = builder->CreateVector(results);
-    SampleVolSurfacesResponseBuilder rb(*builder);
-    rb.add_results(resultsVec);
-    return rb.Finish();
+        auto volIdOffset = builder->CreateString(volId);
+        auto refDateOffset = builder->CreateString(toIso(sampleReferenceDate));
+        const SampleEncoding encoding = SampleEncoding::from(q->options());
+        auto encodedExpiries = encodeDates(*builder, expiriesOut, encoding);
+        auto encodedSwapStarts = encodeDates(*builder, effectiveSwapStartsOut, encoding, false);
+        auto encodedSwapEnds = encodeDates(*builder, effectiveSwapEndsOut, encoding, false);
+        auto encodedVols = encodeValues(*builder, volsOut, encoding);
+        if (!encodedVols.IsNull()) volsOut.clear();
+        auto expiriesVec = builder->CreateVector(isoDates(*builder, expiriesOut, encoding));
+        auto requestedExpiriesVec = builder->CreateVector(requestedExpiryGridOut);
+        auto tenorsVec = builder->CreateVector(tenorsOut);
+        auto effectiveStartsVec = builder->CreateVector(isoDates(*builder, effectiveSwapStartsOut, encoding));
+        auto effectiveEndsVec = builder->CreateVector(isoDates(*builder, effectiveSwapEndsOut, encoding));
+        auto strikesVec = builder->CreateVector(strikesOut);
+        auto volsVec = builder->CreateVector(volsOut);
+        auto atmVec = builder->CreateVector(atmLevelsOut);
+
+        VolSurfaceSampleBuilder out(*builder);
+        out.add_vol_id(volIdOffset);
+        out.add_reference_date(refDateOffset);
+        out.add_ql_vol_type(volTypeOut);
+        out.add_requested_strike_axis(requestedStrikeAxis);
+        out.add_canonical_strike_kind(canonicalStrikeKind);
+        out.add_allow_extrapolation_used(allowExtrapolationUsed);
+        out.add_calendar_used(usedCalendar);
+        out.add_business_day_convention_used(usedBdc);
+        out.add_expiry_kind(expiryKindOut);
+        out.add_expiries(expiriesVec);
+        out.add_requested_expiry_grid_points(requestedExpiriesVec);
+        out.add_tenors(tenorsVec);
+        out.add_effective_swap_starts(effectiveStartsVec);
+        out.add_effective_swap_ends(effectiveEndsVec);
+        out.add_strikes(strikesVec);
+        out.add_vols(volsVec);
+        out.add_n_expiries(nExpOut);
+        out.add_n_tenors(nTenOut);
+        out.add_n_strikes(nStrOut);
+        out.add_atm_levels(atmVec);
+        out.add_encoded_expiries(encodedExpiries);
+        out.add_encoded_effective_swap_starts(encodedSwapStarts);
+        out.add_encoded_effective_swap_ends(encodedSwapEnds);
+        out.add_encoded_vols(encodedVols);
+        return out.Finish();
+    } catch (const std::exception& e) {
+        auto volIdOffset = builder->CreateString(volId);
+        auto errMsg = builder->CreateString(e.what());
+        ErrorBuilder eb(*builder);
+        eb.add_error_message(errMsg);
+        auto errOffset = eb.Finish();
+
+        VolSurfaceSampleBuilder out(*builder);
+        out.add_vol_id(volIdOffset);
+        out.add_error(errOffset);
+        return out.Finish();
+    }
 }
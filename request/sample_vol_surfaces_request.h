@@ -10,10 +10,52 @@
 #include "pricing_registry.h"
 
 class SampleVolSurfacesRequestHandler {
+    /// Registry and inputs shared by all queries of one request.
+    struct Session {
+        const quantra::SampleVolSurfacesRequest* request = nullptr;
+        PricingRegistry reg;
+        QuantLib::Date asOf;
+    };
+
 public:
     flatbuffers::Offset<quantra::SampleVolSurfacesResponse> request(
         std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
         const quantra::SampleVolSurfacesRequest* request) const;
+
+    /// Streaming variant; see below.
+    class Stream;
+
+private:
+    Session prepare(const quantra::SampleVolSurfacesRequest* request) const;
+
+    flatbuffers::Offset<quantra::VolSurfaceSample> sampleQuery(
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+        const PricingRegistry& reg,
+        const QuantLib::Date& asOf,
+        const quantra::VolQuerySpec* q) const;
+};
+
+/**
+ * Stream - SampleVolSurfacesStream: one SampleVolSurfacesResponse per query,
+ * in query order, each holding that query's VolSurfaceSample only.
+ *
+ * The registry is built once when the stream is created; each next() samples
+ * a single surface, so a request with many cubes never holds more than one
+ * in memory. stale_curves is set on the first message.
+ */
+class SampleVolSurfacesRequestHandler::Stream {
+public:
+    explicit Stream(const quantra::SampleVolSurfacesRequest* request);
+
+    bool done() const;
+
+    flatbuffers::Offset<quantra::SampleVolSurfacesResponse> next(
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder);
+
+private:
+    SampleVolSurfacesRequestHandler handler_;
+    Session session_;
+    flatbuffers::uoffset_t next_ = 0;
 };
 
 #endif // QUANTRA_SAMPLE_VOL_SURFACES_REQUEST_H
@@ -7,6 +7,7 @@
 #include "curve_bootstrapper.h"
 #include "index_registry_builder.h"
 #include "swaption_vol_runtime.h"
+#include "black_batch.h"
 
 #include <ql/settings.hpp>
 #include <ql/termstructures/volatility/swaption/swaptionconstantvol.hpp>
@@ -14,8 +15,6 @@
 #include <cmath>
 #include <ql/utilities/dataformatters.hpp>
 
-#include <ql/pricingengines/blackcalculator.hpp>
-#include <ql/pricingengines/bacheliercalculator.hpp>
 #include <ql/pricingengines/swap/discountingswapengine.hpp>
 #include <ql/instruments/overnightindexedswap.hpp>
 #include <ql/instruments/vanillaswap.hpp>
@@ -32,23 +31,151 @@ struct EvalDateGuard {
     ~EvalDateGuard() { QuantLib::Settings::instance().evaluationDate() = saved; }
 };
 
+/**
+ * Curves + indices for one rebump scenario (base, curve up/down, rolled).
+ * Built once per request and shared by every swaption in it.
+ */
+struct MarketScenario {
+    std::string name;                   // SwaptionVolFinalizer scenario key
+    std::unordered_map<std::string,
+        std::shared_ptr<RelinkableHandle<YieldTermStructure>>> curves;
+    IndexRegistry indices;
+};
+
+MarketScenario baseScenario(const PricingRegistry& reg) {
+    MarketScenario s;
+    s.name = "base";
+    for (const auto& kv : reg.curves) {
+        s.curves.emplace(kv.first, kv.second);
+    }
+    s.indices = reg.indices;
+    return s;
+}
+
+/// Re-bootstrap the demanded curves under the current evaluation date with a
+/// parallel bump.
+MarketScenario buildScenario(
+    const quantra::Pricing* pricing,
+    const PricingDemand& demand,
+    double curveBump,
+    const std::string& name) {
+    MarketScenario s;
+    s.name = name;
+    CurveBootstrapper bootstrapper;
+    auto booted = bootstrapper.bootstrapAll(
+        pricing->curves(),
+        pricing->quotes(),
+        pricing->indices(),
+        curveBump,
+        &demand.curves
+    );
+    s.curves = std::move(booted.handles);
+    IndexRegistryBuilder indexBuilder;
+    s.indices = indexBuilder.build(pricing->indices());
+    return s;
+}
+
+std::shared_ptr<YieldTermStructure> scenarioCurve(
+    const MarketScenario& scenario, const std::string& id, const char* role) {
+    auto it = scenario.curves.find(id);
+    if (it == scenario.curves.end())
+        QUANTRA_ERROR(std::string(role) + " curve not found (rebump): " + id);
+    return it->second->currentLink();
+}
+
+/// Per-trade state kept between the base pricing pass and the rebump passes.
+struct SwaptionTrade {
+    const PriceSwaption* trade = nullptr;
+    const quantra::ModelSpec* model = nullptr;
+    SwaptionVolEntry volEntry;
+
+    double npv = 0.0;
+    double impliedVol = 0.0;
+    double atmForward = 0.0;
+    double annuity = 0.0;
+    double delta = 0.0;
+    double vega = 0.0;
+    double gamma = 0.0;
+    double theta = 0.0;
+    double dv01 = 0.0;
+    double usedVolatility = 0.0;
+    double usedStrike = 0.0;
+    double usedAtmForward = -1.0;
+    double usedSpreadFromAtm = 0.0;
+    double usedCubeNodeAtm = -1.0;
+    int greeksIndex = -1;               // into the greeks batch
+    std::string usedExpiry;
+    std::string usedTenor;
+};
+
+double repriceInScenario(
+    const SwaptionTrade& t,
+    const MarketScenario& scenario,
+    SwaptionVolFinalizer& finalizer,
+    const EngineFactory& engineFactory,
+    double volBump,
+    bool forceAtmRecompute) {
+    const std::string discountId = t.trade->discounting_curve()->str();
+    const std::string forwardingId = t.trade->forwarding_curve()->str();
+    auto discount = scenarioCurve(scenario, discountId, "Discounting");
+    auto forwarding = scenarioCurve(scenario, forwardingId, "Forwarding");
+
+    SwaptionParser bumpParser;
+    bumpParser.linkForwardingTermStructure(forwarding);
+    auto bumpSwaption = bumpParser.parse(t.trade->swaption(), scenario.indices);
+
+    const SwaptionVolEntry& volEntryBumped = finalizer.finalize(
+        scenario.name,
+        t.trade->volatility()->str(),
+        t.volEntry,
+        volBump,
+        t.trade,
+        discountId,
+        Handle<YieldTermStructure>(discount),
+        forwardingId,
+        Handle<YieldTermStructure>(forwarding),
+        forceAtmRecompute);
+
+    Handle<YieldTermStructure> discountCurve(discount);
+    auto bumpEngine = engineFactory.makeSwaptionEngine(t.model, discountCurve, volEntryBumped);
+    bumpSwaption->setPricingEngine(bumpEngine);
+    return bumpSwaption->NPV();
+}
+
 } // namespace
 
 flatbuffers::Offset<PriceSwaptionResponse> SwaptionPricingRequest::request(
     std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
     const PriceSwaptionRequest *request) const
 {
+    PricingDemand demand;
+    for (auto it = request->swaptions()->begin(); it != request->swaptions()->end(); it++)
+    {
+        demand.addCurve(it->discounting_curve());
+        demand.addCurve(it->forwarding_curve());
+        demand.addVol(it->volatility());
+    }
+
     PricingRegistryBuilder regBuilder;
-    PricingRegistry reg = regBuilder.build(request->pricing());
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand);
     const Date asOf = DateToQL(request->pricing()->as_of_date()->str());
     Settings::instance().evaluationDate() = asOf;
 
     SwaptionParser swaption_parser;
     EngineFactory engineFactory;
+    // Swaptions sharing a vol and curves share its finalized entry (ATM grid, cube)
+    SwaptionVolFinalizer finalizer(reg);
 
     auto swaption_pricings = request->swaptions();
-    std::vector<flatbuffers::Offset<SwaptionResponse>> swaptions_vector;
+    std::vector<SwaptionTrade> trades;
+    trades.reserve(swaption_pricings->size());
+
+    // Analytic greeks of all trades, evaluated together after the base pass
+    BlackBatch greeks;
 
+    // ==========================================================================
+    // Base pricing pass
+    // ==========================================================================
     for (auto it = swaption_pricings->begin(); it != swaption_pricings->end(); it++)
     {
         auto dIt = reg.curves.find(it->discounting_curve()->str());
@@ -81,11 +208,15 @@ flatbuffers::Offset<PriceSwaptionResponse> SwaptionPricingRequest::request(
         swaption_parser.linkForwardingTermStructure(fIt->second->currentLink());
         auto swaption = swaption_parser.parse(it->swaption(), reg.indices);
 
-        SwaptionVolEntry volEntry = finalizeSwaptionVolEntryForPricing(
+        const SwaptionVolEntry& volEntry = finalizer.finalize(
+            "base",
+            it->volatility()->str(),
             vIt->second,
+            0.0,
             *it,
-            reg,
+            it->discounting_curve()->str(),
             Handle<YieldTermStructure>(dIt->second->currentLink()),
+            it->forwarding_curve()->str(),
             Handle<YieldTermStructure>(fIt->second->currentLink()),
             false);
 
@@ -93,9 +224,13 @@ flatbuffers::Offset<PriceSwaptionResponse> SwaptionPricingRequest::request(
         auto engine = engineFactory.makeSwaptionEngine(mIt->second, discountCurve, volEntry);
         swaption->setPricingEngine(engine);
 
-        double npv = swaption->NPV();
+        SwaptionTrade t;
+        t.trade = *it;
+        t.model = mIt->second;
+        t.volEntry = volEntry;
+        t.npv = swaption->NPV();
 
-        std::cout << "Swaption NPV: " << npv << std::endl;
+        std::cout << "Swaption NPV: " << t.npv << std::endl;
 
         auto getResultOrDefault = [&](const std::string& key, double fallback) {
             try {
@@ -105,123 +240,35 @@ flatbuffers::Offset<PriceSwaptionResponse> SwaptionPricingRequest::request(
             }
         };
 
-        double impliedVol =
+        t.impliedVol =
             (volEntry.volKind == quantra::enums::SwaptionVolKind_Constant)
                 ? volEntry.constantVol
                 : std::numeric_limits<double>::quiet_NaN();
-        double atmForward = 0.0;
-        double annuity = 0.0;
-        double delta = 0.0;
-        double vega = 0.0;
-        double gamma = 0.0;
-        double theta = 0.0;
-        double dv01 = 0.0;
-        double usedVolatility = 0.0;
-        double usedStrike = 0.0;
-        double usedAtmForward = -1.0;
-        double usedSpreadFromAtm = 0.0;
-        double usedCubeNodeAtm = -1.0;
-        std::string usedExpiry;
-        std::string usedTenor;
-        auto volKind = volEntry.volKind;
-        auto usedStrikeKind = volEntry.strikeKind;
-
-        auto priceWithRebump = [&](double curveBump, double volBump, int rollDays) {
-            EvalDateGuard evalGuard;
-            Date baseEval = asOf;
-            Date eval = baseEval + rollDays;
-            Settings::instance().evaluationDate() = eval;
-
-            // Theta/rebump semantics: we roll evaluationDate and re-bootstrap curves
-            // using the same input quotes under the rolled date.
-            CurveBootstrapper bootstrapper;
-            auto booted = bootstrapper.bootstrapAll(
-                request->pricing()->curves(),
-                request->pricing()->quotes(),
-                request->pricing()->indices(),
-                curveBump
-            );
-
-            auto dItB = booted.handles.find(it->discounting_curve()->str());
-            if (dItB == booted.handles.end())
-                QUANTRA_ERROR("Discounting curve not found (rebump): " + it->discounting_curve()->str());
-
-            auto fItB = booted.handles.find(it->forwarding_curve()->str());
-            if (fItB == booted.handles.end())
-                QUANTRA_ERROR("Forwarding curve not found (rebump): " + it->forwarding_curve()->str());
-
-            IndexRegistryBuilder indexBuilder;
-            IndexRegistry idx = indexBuilder.build(request->pricing()->indices());
-
-            SwaptionParser bumpParser;
-            bumpParser.linkForwardingTermStructure(fItB->second->currentLink());
-            auto bumpSwaption = bumpParser.parse(it->swaption(), idx);
-
-            SwaptionVolEntry volEntryBumped = bumpSwaptionVolEntry(volEntry, volBump);
-            const bool forceAtmRecompute = (curveBump != 0.0) || (rollDays != 0);
-            volEntryBumped = finalizeSwaptionVolEntryForPricing(
-                volEntryBumped,
-                *it,
-                reg,
-                Handle<YieldTermStructure>(dItB->second->currentLink()),
-                Handle<YieldTermStructure>(fItB->second->currentLink()),
-                forceAtmRecompute);
-
-            Handle<YieldTermStructure> discountCurve(dItB->second->currentLink());
-            auto bumpEngine = engineFactory.makeSwaptionEngine(mIt->second, discountCurve, volEntryBumped);
-            bumpSwaption->setPricingEngine(bumpEngine);
-            return bumpSwaption->NPV();
-        };
 
         if (reg.swaptionPricingDetails) {
-            impliedVol = getResultOrDefault("impliedVolatility", impliedVol);
-            atmForward = getResultOrDefault("atmForward", 0.0);
-            annuity = getResultOrDefault("annuity", 0.0);
+            t.impliedVol = getResultOrDefault("impliedVolatility", t.impliedVol);
+            t.atmForward = getResultOrDefault("atmForward", 0.0);
+            t.annuity = getResultOrDefault("annuity", 0.0);
 
             double strike = getResultOrDefault("strike", 0.0);
             double stdDev = getResultOrDefault("stdDev", 0.0);
             double timeToExpiry = getResultOrDefault("timeToExpiry", 0.0);
 
-            if (annuity != 0.0 && stdDev > 0.0 && timeToExpiry > 0.0) {
+            if (t.annuity != 0.0 && stdDev > 0.0 && timeToExpiry > 0.0) {
                 Option::Type optType =
                     (swaption->underlying()->type() == Swap::Payer) ? Option::Call : Option::Put;
 
                 if (volEntry.qlVolType == VolatilityType::Normal) {
-                    BachelierCalculator calc(optType, strike, atmForward, stdDev, annuity);
-                    delta = calc.deltaForward();
-                    vega = calc.vega(timeToExpiry);
-                    gamma = calc.gammaForward();
-                    theta = calc.theta(atmForward, timeToExpiry);
+                    t.greeksIndex = static_cast<int>(greeks.add(optType, BlackBatch::Model::Bachelier,
+                        strike, t.atmForward, stdDev, t.annuity, 0.0, timeToExpiry));
                 } else {
-                    double displacement = volEntry.displacement;
-                    BlackCalculator calc(optType, strike + displacement, atmForward + displacement, stdDev, annuity);
-                    delta = calc.deltaForward();
-                    vega = calc.vega(timeToExpiry);
-                    gamma = calc.gammaForward();
-                    theta = calc.theta(atmForward + displacement, timeToExpiry);
+                    t.greeksIndex = static_cast<int>(greeks.add(optType, BlackBatch::Model::Black,
+                        strike, t.atmForward, stdDev, t.annuity, volEntry.displacement, timeToExpiry));
                 }
             }
-
-            // DV01 as price change for a 1bp move in the swap rate
-            dv01 = delta * 1.0e-4;
-        }
-        if (!std::isfinite(impliedVol)) {
-            impliedVol = -1.0;
         }
-
-        if (reg.swaptionPricingRebump) {
-            const double bump = 1.0e-4; // 1bp
-            double npvUp = priceWithRebump(bump, 0.0, 0);
-            double npvDown = priceWithRebump(-bump, 0.0, 0);
-            dv01 = (npvUp - npvDown) / 2.0;
-            gamma = (npvUp - 2.0 * npv + npvDown);
-
-            double volUp = priceWithRebump(0.0, bump, 0);
-            double volDown = priceWithRebump(0.0, -bump, 0);
-            vega = (volUp - volDown) / 2.0;
-
-            double npvTomorrow = priceWithRebump(0.0, 0.0, 1);
-            theta = npvTomorrow - npv;
+        if (!std::isfinite(t.impliedVol)) {
+            t.impliedVol = -1.0;
         }
 
         // Debug: compute used vol for this trade
@@ -237,72 +284,147 @@ flatbuffers::Offset<PriceSwaptionResponse> SwaptionPricingRequest::request(
             Date endDate = swaption->underlying()->maturityDate();
             double swapLength = volDc.yearFraction(startDate, endDate);
 
-            usedStrike = getResultOrDefault("strike", 0.0);
-            if (usedStrike == 0.0) {
+            t.usedStrike = getResultOrDefault("strike", 0.0);
+            if (t.usedStrike == 0.0) {
                 if (auto vanilla = QuantLib::ext::dynamic_pointer_cast<QuantLib::VanillaSwap>(swaption->underlying())) {
-                    usedStrike = vanilla->fixedRate();
+                    t.usedStrike = vanilla->fixedRate();
                 } else if (auto ois = QuantLib::ext::dynamic_pointer_cast<QuantLib::OvernightIndexedSwap>(swaption->underlying())) {
-                    usedStrike = ois->fixedRate();
+                    t.usedStrike = ois->fixedRate();
                 }
             }
 
-            usedVolatility = volEntry.handle->volatility(optionTime, swapLength, usedStrike);
+            t.usedVolatility = volEntry.handle->volatility(optionTime, swapLength, t.usedStrike);
             const bool hasRealAtm = !volEntry.atmForwardsFlat.empty();
             try {
                 auto smile = volEntry.handle->smileSection(optionTime, swapLength);
                 if (smile && hasRealAtm) {
-                    usedAtmForward = smile->atmLevel();
-                    usedCubeNodeAtm = usedAtmForward;
+                    t.usedAtmForward = smile->atmLevel();
+                    t.usedCubeNodeAtm = t.usedAtmForward;
                 }
             } catch (...) {
-                usedAtmForward = -1.0;
-                usedCubeNodeAtm = -1.0;
+                t.usedAtmForward = -1.0;
+                t.usedCubeNodeAtm = -1.0;
             }
             if (volEntry.strikeKind == quantra::enums::SwaptionStrikeKind_SpreadFromATM &&
-                usedCubeNodeAtm >= 0.0) {
-                usedSpreadFromAtm = usedStrike - usedCubeNodeAtm;
+                t.usedCubeNodeAtm >= 0.0) {
+                t.usedSpreadFromAtm = t.usedStrike - t.usedCubeNodeAtm;
             }
 
             std::ostringstream expOs;
             expOs << QuantLib::io::iso_date(exerciseDate);
-            usedExpiry = expOs.str();
+            t.usedExpiry = expOs.str();
 
             std::ostringstream tenOs;
             tenOs << QuantLib::io::iso_date(startDate) << "->" << QuantLib::io::iso_date(endDate);
-            usedTenor = tenOs.str();
+            t.usedTenor = tenOs.str();
         } catch (...) {
             // best-effort debug, ignore failures
         }
 
-        auto usedExpiryOffset = builder->CreateString(usedExpiry);
-        auto usedTenorOffset = builder->CreateString(usedTenor);
+        trades.push_back(std::move(t));
+    }
+
+    if (reg.swaptionPricingDetails) {
+        greeks.priceWithGreeks();
+        for (auto& t : trades) {
+            if (t.greeksIndex >= 0) {
+                t.delta = greeks.deltaForward(t.greeksIndex);
+                t.vega = greeks.vega(t.greeksIndex);
+                t.gamma = greeks.gammaForward(t.greeksIndex);
+                t.theta = greeks.theta(t.greeksIndex);
+            }
+
+            // DV01 as price change for a 1bp move in the swap rate
+            t.dv01 = t.delta * 1.0e-4;
+        }
+    }
+
+    // ==========================================================================
+    // Rebump passes (Bloomberg-style curve/vol/theta risk)
+    //
+    // Every trade sees the same +/-1bp curve bump and +1 day roll, so each
+    // scenario is bootstrapped once per request and every swaption is
+    // repriced against the prebuilt handles. Passes run scenario by scenario
+    // so the evaluation date only moves once (for the rolled scenario).
+    // ==========================================================================
+    if (reg.swaptionPricingRebump && !trades.empty()) {
+        const double bump = 1.0e-4; // 1bp
+        const auto* pricing = request->pricing();
+
+        const MarketScenario base = baseScenario(reg);
+        std::vector<double> npvUp(trades.size()), npvDown(trades.size());
+        {
+            const MarketScenario up = buildScenario(pricing, demand, bump, "curve+1bp");
+            for (size_t i = 0; i < trades.size(); i++) {
+                npvUp[i] = repriceInScenario(trades[i], up, finalizer, engineFactory, 0.0, true);
+            }
+        }
+        {
+            const MarketScenario down = buildScenario(pricing, demand, -bump, "curve-1bp");
+            for (size_t i = 0; i < trades.size(); i++) {
+                npvDown[i] = repriceInScenario(trades[i], down, finalizer, engineFactory, 0.0, true);
+            }
+        }
+        for (size_t i = 0; i < trades.size(); i++) {
+            auto& t = trades[i];
+            t.dv01 = (npvUp[i] - npvDown[i]) / 2.0;
+            t.gamma = (npvUp[i] - 2.0 * t.npv + npvDown[i]);
+
+            double volUp = repriceInScenario(t, base, finalizer, engineFactory, bump, false);
+            double volDown = repriceInScenario(t, base, finalizer, engineFactory, -bump, false);
+            t.vega = (volUp - volDown) / 2.0;
+        }
+
+        // Theta/rebump semantics: we roll evaluationDate and re-bootstrap curves
+        // using the same input quotes under the rolled date.
+        {
+            EvalDateGuard evalGuard;
+            Settings::instance().evaluationDate() = asOf + 1;
+            const MarketScenario rolled = buildScenario(pricing, demand, 0.0, "rolled");
+            for (auto& t : trades) {
+                double npvTomorrow = repriceInScenario(t, rolled, finalizer, engineFactory, 0.0, true);
+                t.theta = npvTomorrow - t.npv;
+            }
+        }
+    }
+
+    // ==========================================================================
+    // Build response
+    // ==========================================================================
+    std::vector<flatbuffers::Offset<SwaptionResponse>> swaptions_vector;
+    swaptions_vector.reserve(trades.size());
+    for (const auto& t : trades) {
+        auto usedExpiryOffset = builder->CreateString(t.usedExpiry);
+        auto usedTenorOffset = builder->CreateString(t.usedTenor);
 
         SwaptionResponseBuilder response_builder(*builder);
-        response_builder.add_npv(npv);
-        response_builder.add_implied_volatility(impliedVol);
-        response_builder.add_atm_forward(atmForward);
-        response_builder.add_annuity(annuity);
-        response_builder.add_delta(delta);
-        response_builder.add_vega(vega);
-        response_builder.add_gamma(gamma);
-        response_builder.add_theta(theta);
-        response_builder.add_dv01(dv01);
-        response_builder.add_used_volatility(usedVolatility);
+        response_builder.add_npv(t.npv);
+        response_builder.add_implied_volatility(t.impliedVol);
+        response_builder.add_atm_forward(t.atmForward);
+        response_builder.add_annuity(t.annuity);
+        response_builder.add_delta(t.delta);
+        response_builder.add_vega(t.vega);
+        response_builder.add_gamma(t.gamma);
+        response_builder.add_theta(t.theta);
+        response_builder.add_dv01(t.dv01);
+        response_builder.add_used_volatility(t.usedVolatility);
         response_builder.add_used_option_expiry(usedExpiryOffset);
         response_builder.add_used_swap_tenor(usedTenorOffset);
-        response_builder.add_used_strike(usedStrike);
-        response_builder.add_used_atm_forward(usedAtmForward);
-        response_builder.add_used_strike_kind(usedStrikeKind);
-        response_builder.add_used_spread_from_atm(usedSpreadFromAtm);
-        response_builder.add_used_cube_node_atm(usedCubeNodeAtm);
-        response_builder.add_vol_kind(volKind);
+        response_builder.add_used_strike(t.usedStrike);
+        response_builder.add_used_atm_forward(t.usedAtmForward);
+        response_builder.add_used_strike_kind(t.volEntry.strikeKind);
+        response_builder.add_used_spread_from_atm(t.usedSpreadFromAtm);
+        response_builder.add_used_cube_node_atm(t.usedCubeNodeAtm);
+        response_builder.add_vol_kind(t.volEntry.volKind);
 
         swaptions_vector.push_back(response_builder.Finish());
     }
 
     auto swaptions = builder->CreateVector(swaptions_vector);
+    auto staleCurves = staleCurvesVector(*builder, reg);
     PriceSwaptionResponseBuilder response_builder(*builder);
     response_builder.add_swaptions(swaptions);
+    response_builder.add_stale_curves(staleCurves);
 
     return response_builder.Finish();
 }
@@ -1,10 +1,21 @@
 #include "swaption_vol_runtime.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+
+#include <ql/cashflows/iborcoupon.hpp>
 #include <ql/instruments/overnightindexedswap.hpp>
 #include <ql/instruments/vanillaswap.hpp>
 #include <ql/pricingengines/swap/discountingswapengine.hpp>
+#include <ql/settings.hpp>
+#include <ql/time/schedule.hpp>
 #include <ql/utilities/dataformatters.hpp>
 
+#include "curve_sampler.h"
+
 namespace {
 
 std::string getTradeFloatingIndexId(const quantra::PriceSwaption* p) {
@@ -62,6 +73,374 @@ bool getTradeExerciseAndStartDates(
 
 namespace quantra {
 
+namespace {
+
+bool analyticAtmEnabled() {
+    static const bool enabled = [] {
+        const char* env = std::getenv("QUANTRA_ANALYTIC_ATM");
+        return !(env && std::string(env) == "0");
+    }();
+    return enabled;
+}
+
+/// Negative when verification is off.
+double analyticAtmVerifyTolerance() {
+    static const double tolerance = [] {
+        const char* env = std::getenv("QUANTRA_ANALYTIC_ATM_VERIFY");
+        return env ? std::atof(env) : -1.0;
+    }();
+    return tolerance;
+}
+
+/// Reference period of coupon i, as FixedRateLeg (floating=false) and
+/// IborLeg (floating=true) set it for irregular first and last periods.
+void referencePeriod(const QuantLib::Schedule& s, QuantLib::Size i, bool floating,
+                     QuantLib::Date& refStart, QuantLib::Date& refEnd) {
+    const QuantLib::Size n = s.size() - 1;
+    refStart = s.date(i);
+    refEnd = s.date(i + 1);
+    if (i == 0 && !s.isRegular(1)) {
+        refStart = s.calendar().adjust(s.date(1) - s.tenor(), s.businessDayConvention());
+    }
+    if (i == n - 1 && (floating || n > 1) && !s.isRegular(n)) {
+        refEnd = s.calendar().adjust(s.date(i) + s.tenor(), s.businessDayConvention());
+    }
+}
+
+/// Discount factors of `curve` at `dates` (any order, repeats allowed),
+/// evaluated once per distinct date.
+std::vector<double> discountsAt(const std::shared_ptr<QuantLib::YieldTermStructure>& curve,
+                                const std::vector<QuantLib::Date>& dates) {
+    std::vector<QuantLib::Date> grid = dates;
+    std::sort(grid.begin(), grid.end());
+    grid.erase(std::unique(grid.begin(), grid.end()), grid.end());
+    const std::vector<double> gridDfs = CurveSampler::discounts(curve, grid);
+
+    std::vector<double> out(dates.size());
+    for (size_t k = 0; k < dates.size(); k++) {
+        out[k] = gridDfs[std::lower_bound(grid.begin(), grid.end(), dates[k]) - grid.begin()];
+    }
+    return out;
+}
+
+/**
+ * ATM forward grid of a swap index: the fair rate of the index's swap
+ * starting on each start date, for every tenor, row-major by start.
+ *
+ * Instead of a VanillaSwap / OvernightIndexedSwap and a DiscountingSwapEngine
+ * per node, every node's coupons are laid out from its schedules (fixed leg:
+ * payment date and accrual; Ibor leg: accrual and the coupon's forecast
+ * period, at-par or indexed as IborCoupon::Settings says; OIS leg: accrual
+ * start and end, compounding telescoping to DF(start) / DF(end)). All
+ * payment dates of the grid are then discounted in one CurveSampler call,
+ * all forecast dates in one call on the forwarding curve, and each node's
+ * rate is float-leg PV / fixed-leg annuity, which is what fairRate()
+ * computes from the engine's leg NPV and BPS.
+ *
+ * A node goes through the swap instrument when its coupons need past or
+ * today's fixings, an OIS accrual date is not a fixing-calendar business
+ * day (the coupon's value dates would move), or the index has no
+ * forwarding curve.
+ */
+class AtmForwardGrid {
+public:
+    AtmForwardGrid(const quantra::SwapIndexRuntime& sidx,
+                   const quantra::IndexRegistry& indices,
+                   const QuantLib::Handle<QuantLib::YieldTermStructure>& discountCurve,
+                   const QuantLib::Handle<QuantLib::YieldTermStructure>& forwardingCurve)
+        : sidx_(sidx), discountCurve_(discountCurve) {
+        if (sidx_.kind == quantra::SwapIndexKind_OisSwapIndex) {
+            on_ = indices.getOvernightWithCurve(sidx_.floatIndexId, forwardingCurve);
+        } else {
+            ibor_ = indices.getIborWithCurve(sidx_.floatIndexId, forwardingCurve);
+            floatTenor_ = sidx_.floatTenor.length() > 0 ? sidx_.floatTenor : ibor_->tenor();
+        }
+    }
+
+    std::vector<double> fairRates(const std::vector<QuantLib::Date>& starts,
+                                  const std::vector<QuantLib::Period>& tenors) {
+        const size_t nNodes = starts.size() * tenors.size();
+        std::vector<Node> nodes;
+        nodes.reserve(nNodes);
+
+        const QuantLib::Handle<QuantLib::YieldTermStructure> forecastCurve =
+            on_ ? on_->forwardingTermStructure() : ibor_->forwardingTermStructure();
+        const bool analytic = analyticAtmEnabled() && !forecastCurve.empty() && !discountCurve_.empty();
+
+        for (const auto& start : starts) {
+            // Each tenor gets its own schedules: with backward generation, an
+            // adjusted end date or a stub, a shorter tenor's dates are not a
+            // prefix of a longer tenor's. Only the discount and forecast
+            // lookups below are shared across the grid.
+            for (const auto& tenor : tenors) {
+                QuantLib::Date tentativeEnd = sidx_.fixedCalendar.advance(start, tenor, sidx_.fixedTermBdc);
+                Node node;
+                node.fixedSchedule = QuantLib::Schedule(
+                    start, tentativeEnd, QuantLib::Period(sidx_.fixedFrequency), sidx_.fixedCalendar,
+                    sidx_.fixedBdc, sidx_.fixedTermBdc, sidx_.fixedDateRule, sidx_.fixedEom);
+                node.fixedBegin = fixedPay_.size();
+                node.floatBegin = floatPay_.size();
+                node.analytic = analytic && layOut(node);
+                if (!node.analytic) {
+                    truncate(node);
+                }
+                node.fixedEnd = fixedPay_.size();
+                node.floatEnd = floatPay_.size();
+                nodes.push_back(std::move(node));
+            }
+        }
+
+        // Every distinct date of the grid is evaluated once per curve
+        std::vector<double> fixedDfs, floatDfs, forecastStartDfs, forecastEndDfs;
+        if (analytic) {
+            std::vector<QuantLib::Date> payDates = fixedPay_;
+            payDates.insert(payDates.end(), floatPay_.begin(), floatPay_.end());
+            const std::vector<double> payDfs = discountsAt(discountCurve_.currentLink(), payDates);
+            fixedDfs.assign(payDfs.begin(), payDfs.begin() + fixedPay_.size());
+            floatDfs.assign(payDfs.begin() + fixedPay_.size(), payDfs.end());
+
+            std::vector<QuantLib::Date> forecastDates = forecastStart_;
+            forecastDates.insert(forecastDates.end(), forecastEnd_.begin(), forecastEnd_.end());
+            const std::vector<double> forecastDfs = discountsAt(forecastCurve.currentLink(), forecastDates);
+            forecastStartDfs.assign(forecastDfs.begin(), forecastDfs.begin() + forecastStart_.size());
+            forecastEndDfs.assign(forecastDfs.begin() + forecastStart_.size(), forecastDfs.end());
+        }
+
+        const double tolerance = analyticAtmVerifyTolerance();
+        std::vector<double> atms;
+        atms.reserve(nNodes);
+        for (const Node& node : nodes) {
+            if (!node.analytic) {
+                atms.push_back(swapFairRate(node.fixedSchedule));
+                continue;
+            }
+            double annuity = 0.0;
+            for (size_t k = node.fixedBegin; k < node.fixedEnd; k++) {
+                annuity += fixedAccrual_[k] * fixedDfs[k];
+            }
+            double floatNpv = 0.0;
+            for (size_t k = node.floatBegin; k < node.floatEnd; k++) {
+                const double growth = forecastStartDfs[k] / forecastEndDfs[k] - 1.0;
+                // Ibor: forecast rate * accrual; OIS: compounded rate * accrual == growth
+                const double amount = on_ ? growth : (growth / forecastSpan_[k]) * floatAccrual_[k];
+                floatNpv += amount * floatDfs[k];
+            }
+            const double atm = floatNpv / annuity;
+            if (tolerance >= 0.0) {
+                const double expected = swapFairRate(node.fixedSchedule);
+                if (std::fabs(atm - expected) > tolerance) {
+                    std::ostringstream err;
+                    err << "Analytic ATM forward differs from swap fair rate for start "
+                        << QuantLib::io::iso_date(node.fixedSchedule.startDate()) << ", maturity "
+                        << QuantLib::io::iso_date(node.fixedSchedule.endDate()) << ": "
+                        << atm << " vs " << expected;
+                    QUANTRA_ERROR(err.str());
+                }
+            }
+            atms.push_back(atm);
+        }
+        return atms;
+    }
+
+private:
+    struct Node {
+        QuantLib::Schedule fixedSchedule;
+        size_t fixedBegin = 0, fixedEnd = 0;    // coupon ranges in the buffers
+        size_t floatBegin = 0, floatEnd = 0;
+        bool analytic = false;
+    };
+
+    /// Appends the node's coupons; false when the node needs the swap instrument.
+    bool layOut(const Node& node) {
+        const QuantLib::Date today = QuantLib::Settings::instance().evaluationDate();
+        const QuantLib::Date settlement = discountCurve_->referenceDate();
+        const QuantLib::Schedule& fixed = node.fixedSchedule;
+        // VanillaSwap pays both legs with the float schedule's convention; OIS adjusts Following
+        const QuantLib::BusinessDayConvention payBdc = on_ ? QuantLib::Following : sidx_.floatBdc;
+
+        QuantLib::Date refStart, refEnd;
+        for (QuantLib::Size i = 0; i + 1 < fixed.size(); i++) {
+            referencePeriod(fixed, i, false, refStart, refEnd);
+            const QuantLib::Date pay = fixed.calendar().adjust(fixed.date(i + 1), payBdc);
+            if (pay <= settlement) return false;
+            fixedPay_.push_back(pay);
+            fixedAccrual_.push_back(
+                sidx_.fixedDayCounter.yearFraction(fixed.date(i), fixed.date(i + 1), refStart, refEnd));
+        }
+
+        if (on_) {
+            const QuantLib::Calendar& fixingCalendar = on_->fixingCalendar();
+            for (QuantLib::Size i = 0; i + 1 < fixed.size(); i++) {
+                const QuantLib::Date& start = fixed.date(i);
+                const QuantLib::Date& end = fixed.date(i + 1);
+                if (start <= today || !fixingCalendar.isBusinessDay(start) || !fixingCalendar.isBusinessDay(end)) {
+                    return false;
+                }
+                floatPay_.push_back(fixed.calendar().adjust(end, payBdc));
+                floatAccrual_.push_back(0.0);
+                forecastStart_.push_back(start);
+                forecastEnd_.push_back(end);
+                forecastSpan_.push_back(0.0);
+            }
+            return true;
+        }
+
+        const QuantLib::Schedule floating(
+            fixed.startDate(), fixed.endDate(), floatTenor_, sidx_.floatCalendar,
+            sidx_.floatBdc, sidx_.floatTermBdc, sidx_.floatDateRule, sidx_.floatEom);
+        const QuantLib::Calendar& fixingCalendar = ibor_->fixingCalendar();
+        const QuantLib::Integer fixingDays = static_cast<QuantLib::Integer>(ibor_->fixingDays());
+        const bool parCoupons = QuantLib::IborCoupon::Settings::instance().usingAtParCoupons();
+        for (QuantLib::Size i = 0; i + 1 < floating.size(); i++) {
+            const QuantLib::Date& start = floating.date(i);
+            const QuantLib::Date& end = floating.date(i + 1);
+            const QuantLib::Date pay = floating.calendar().adjust(end, payBdc);
+            const QuantLib::Date fixingDate =
+                fixingCalendar.advance(start, -fixingDays, QuantLib::Days, QuantLib::Preceding);
+            if (fixingDate <= today || pay <= settlement) return false;
+
+            // IborCouponPricer::initializeCachedData
+            const QuantLib::Date valueDate = fixingCalendar.advance(fixingDate, fixingDays, QuantLib::Days);
+            QuantLib::Date forecastEnd;
+            if (parCoupons) {
+                const QuantLib::Date nextFixingDate = fixingCalendar.advance(end, -fixingDays, QuantLib::Days);
+                forecastEnd = std::max(fixingCalendar.advance(nextFixingDate, fixingDays, QuantLib::Days),
+                                       valueDate + 1);
+            } else {
+                forecastEnd = ibor_->maturityDate(valueDate);
+            }
+
+            referencePeriod(floating, i, true, refStart, refEnd);
+            floatPay_.push_back(pay);
+            floatAccrual_.push_back(ibor_->dayCounter().yearFraction(start, end, refStart, refEnd));
+            forecastStart_.push_back(valueDate);
+            forecastEnd_.push_back(forecastEnd);
+            forecastSpan_.push_back(ibor_->dayCounter().yearFraction(valueDate, forecastEnd));
+        }
+        return true;
+    }
+
+    void truncate(const Node& node) {
+        fixedPay_.resize(node.fixedBegin);
+        fixedAccrual_.resize(node.fixedBegin);
+        floatPay_.resize(node.floatBegin);
+        floatAccrual_.resize(node.floatBegin);
+        forecastStart_.resize(node.floatBegin);
+        forecastEnd_.resize(node.floatBegin);
+        forecastSpan_.resize(node.floatBegin);
+    }
+
+    /// The index's swap on the node's fixed schedule, priced by DiscountingSwapEngine.
+    double swapFairRate(const QuantLib::Schedule& fixedSchedule) const {
+        auto engine = std::make_shared<QuantLib::DiscountingSwapEngine>(discountCurve_);
+        if (on_) {
+            auto ois = std::make_shared<QuantLib::OvernightIndexedSwap>(
+                QuantLib::Swap::Payer, 1.0, fixedSchedule, 0.0, sidx_.fixedDayCounter, on_);
+            ois->setPricingEngine(engine);
+            return ois->fairRate();
+        }
+        QuantLib::Schedule floatSchedule(
+            fixedSchedule.startDate(), fixedSchedule.endDate(), floatTenor_, sidx_.floatCalendar,
+            sidx_.floatBdc, sidx_.floatTermBdc, sidx_.floatDateRule, sidx_.floatEom);
+        auto swap = std::make_shared<QuantLib::VanillaSwap>(
+            QuantLib::VanillaSwap::Payer, 1.0, fixedSchedule, 0.0, sidx_.fixedDayCounter,
+            floatSchedule, ibor_, 0.0, ibor_->dayCounter());
+        swap->setPricingEngine(engine);
+        return swap->fairRate();
+    }
+
+    const quantra::SwapIndexRuntime& sidx_;
+    QuantLib::Handle<QuantLib::YieldTermStructure> discountCurve_;
+    std::shared_ptr<QuantLib::OvernightIndex> on_;
+    std::shared_ptr<QuantLib::IborIndex> ibor_;
+    QuantLib::Period floatTenor_;
+
+    // Coupon buffers, nodes back to back
+    std::vector<QuantLib::Date> fixedPay_;
+    std::vector<double> fixedAccrual_;
+    std::vector<QuantLib::Date> floatPay_;
+    std::vector<double> floatAccrual_;
+    std::vector<QuantLib::Date> forecastStart_;     // Ibor value date / OIS accrual start
+    std::vector<QuantLib::Date> forecastEnd_;
+    std::vector<double> forecastSpan_;              // Ibor forecast period (index day count)
+};
+
+bool isSabrCube(const SwaptionVolEntry& raw) {
+    return raw.volKind == quantra::enums::SwaptionVolKind_SabrParams ||
+           raw.volKind == quantra::enums::SwaptionVolKind_SabrCalibrate;
+}
+
+/// True for vols that sit on server-computed ATM forwards: SpreadFromATM
+/// smile cubes and SABR cubes (always).
+bool usesServerAtm(const SwaptionVolEntry& raw) {
+    if (!isSabrCube(raw) && (raw.volKind != quantra::enums::SwaptionVolKind_SmileCube3D ||
+                  raw.strikeKind != quantra::enums::SwaptionStrikeKind_SpreadFromATM)) {
+        return false;
+    }
+    if (raw.referenceDate == QuantLib::Date()) {
+        QUANTRA_ERROR("SpreadFromATM smile cube requires a valid vol referenceDate");
+    }
+    if (raw.swapIndexId.empty()) {
+        QUANTRA_ERROR("SpreadFromATM smile cube requires swap_index_id");
+    }
+    return true;
+}
+
+/// True when finalizeSwaptionVolEntryForPricing computes the ATM forwards of
+/// `entry` on the server, which is also when trades are checked against the
+/// swap index: client ATM forwards are used as given unless a recompute is
+/// forced and external ATMs are not allowed.
+bool computesServerAtm(const SwaptionVolEntry& entry, bool forceRecomputeAtm) {
+    if (!usesServerAtm(entry)) {
+        return false;
+    }
+    if (entry.atmForwardsFlat.empty()) {
+        return true;
+    }
+    return forceRecomputeAtm && !entry.allowExternalAtm;
+}
+
+const quantra::SwapIndexRuntime& swapIndexOf(const SwaptionVolEntry& raw, const PricingRegistry& reg) {
+    if (!reg.swapIndices.has(raw.swapIndexId)) {
+        QUANTRA_ERROR("Missing swap index definition for id: " + raw.swapIndexId);
+    }
+    return reg.swapIndices.get(raw.swapIndexId);
+}
+
+/// The trade must float on the swap index's index and start spot_days after exercise.
+void checkTradeConventions(const SwaptionVolEntry& raw,
+                           const quantra::SwapIndexRuntime& sidx,
+                           const quantra::PriceSwaption* trade) {
+    std::string tradeIndexId = getTradeFloatingIndexId(trade);
+    if (!tradeIndexId.empty() && tradeIndexId != sidx.floatIndexId) {
+        QUANTRA_ERROR(
+            "Swap index '" + raw.swapIndexId + "' float_index_id '" + sidx.floatIndexId +
+            "' does not match swaption floating index '" + tradeIndexId + "'");
+    }
+
+    QuantLib::Date tradeExerciseDate, tradeStartDate;
+    if (getTradeExerciseAndStartDates(trade, tradeExerciseDate, tradeStartDate)) {
+        QuantLib::Date tradeExerciseAdjusted = sidx.fixedCalendar.adjust(tradeExerciseDate, sidx.fixedBdc);
+        QuantLib::Date expectedStart = sidx.fixedCalendar.advance(
+            tradeExerciseAdjusted, sidx.spotDays, QuantLib::Days, sidx.fixedBdc);
+        QuantLib::Date tradeStartAdjusted = sidx.fixedCalendar.adjust(tradeStartDate, sidx.fixedBdc);
+        if (expectedStart != tradeStartAdjusted) {
+            std::ostringstream err;
+            err << "Swap index '" << raw.swapIndexId
+                << "' spot_days mismatch against trade start convention: expected start "
+                << QuantLib::io::iso_date(expectedStart) << " from exercise "
+                << QuantLib::io::iso_date(tradeExerciseDate)
+                << " (adjusted: " << QuantLib::io::iso_date(tradeExerciseAdjusted) << ")"
+                << " with spot_days=" << sidx.spotDays
+                << ", but trade start is " << QuantLib::io::iso_date(tradeStartDate)
+                << " (adjusted: " << QuantLib::io::iso_date(tradeStartAdjusted) << ")";
+            QUANTRA_ERROR(err.str());
+        }
+    }
+}
+
+} // namespace
+
 std::vector<double> computeServerAtmForwards(
     const quantra::SwaptionVolEntry& volEntry,
     const quantra::SwapIndexRuntime& sidx,
@@ -71,45 +450,22 @@ std::vector<double> computeServerAtmForwards(
     if (volEntry.nExp <= 0 || volEntry.nTen <= 0) {
         QUANTRA_ERROR("Invalid smile cube dimensions for ATM computation");
     }
-    std::vector<double> atms;
-    atms.reserve(volEntry.nExp * volEntry.nTen);
 
     const QuantLib::Date anchorDate = volEntry.referenceDate;
+    std::vector<QuantLib::Date> starts;
+    starts.reserve(volEntry.nExp);
     for (int i = 0; i < volEntry.nExp; ++i) {
         QuantLib::Date exercise = sidx.fixedCalendar.advance(anchorDate, volEntry.expiries[i], sidx.fixedBdc);
         QuantLib::Date start = exercise;
         if (sidx.spotDays > 0) {
             start = sidx.fixedCalendar.advance(exercise, sidx.spotDays, QuantLib::Days, sidx.fixedBdc);
         }
-        for (int j = 0; j < volEntry.nTen; ++j) {
-            QuantLib::Date tentativeEnd = sidx.fixedCalendar.advance(start, volEntry.tenors[j], sidx.fixedTermBdc);
-            QuantLib::Schedule fixedSchedule(
-                start, tentativeEnd, QuantLib::Period(sidx.fixedFrequency), sidx.fixedCalendar,
-                sidx.fixedBdc, sidx.fixedTermBdc, sidx.fixedDateRule, sidx.fixedEom);
-            QuantLib::Date maturity = fixedSchedule.endDate();
-            double atm = 0.0;
-
-            if (sidx.kind == quantra::SwapIndexKind_OisSwapIndex) {
-                auto on = indices.getOvernightWithCurve(sidx.floatIndexId, forwardingCurve);
-                auto ois = std::make_shared<QuantLib::OvernightIndexedSwap>(
-                    QuantLib::Swap::Payer, 1.0, fixedSchedule, 0.0, sidx.fixedDayCounter, on);
-                ois->setPricingEngine(std::make_shared<QuantLib::DiscountingSwapEngine>(discountCurve));
-                atm = ois->fairRate();
-            } else {
-                auto ibor = indices.getIborWithCurve(sidx.floatIndexId, forwardingCurve);
-                QuantLib::Period floatTenor = sidx.floatTenor.length() > 0 ? sidx.floatTenor : ibor->tenor();
-                QuantLib::Schedule floatSchedule(
-                    start, maturity, floatTenor, sidx.floatCalendar,
-                    sidx.floatBdc, sidx.floatTermBdc, sidx.floatDateRule, sidx.floatEom);
-                auto swap = std::make_shared<QuantLib::VanillaSwap>(
-                    QuantLib::VanillaSwap::Payer, 1.0, fixedSchedule, 0.0, sidx.fixedDayCounter,
-                    floatSchedule, ibor, 0.0, ibor->dayCounter());
-                swap->setPricingEngine(std::make_shared<QuantLib::DiscountingSwapEngine>(discountCurve));
-                atm = swap->fairRate();
-            }
-            atms.push_back(atm);
-        }
+        starts.push_back(start);
     }
+    const std::vector<QuantLib::Period> tenors(volEntry.tenors.begin(), volEntry.tenors.begin() + volEntry.nTen);
+
+    AtmForwardGrid grid(sidx, indices, discountCurve, forwardingCurve);
+    std::vector<double> atms = grid.fairRates(starts, tenors);
     if (static_cast<int>(atms.size()) != volEntry.nExp * volEntry.nTen) {
         QUANTRA_ERROR("Computed ATM matrix size mismatch for swaption smile cube");
     }
@@ -126,44 +482,20 @@ std::vector<double> computeServerAtmForwardsForExerciseDates(
     if (exerciseDates.empty() || tenors.empty()) {
         QUANTRA_ERROR("Invalid exerciseDates/tenors for ATM computation");
     }
-    std::vector<double> atms;
-    atms.reserve(exerciseDates.size() * tenors.size());
 
+    std::vector<QuantLib::Date> starts;
+    starts.reserve(exerciseDates.size());
     for (const auto& exerciseRaw : exerciseDates) {
         QuantLib::Date exercise = sidx.fixedCalendar.adjust(exerciseRaw, sidx.fixedBdc);
         QuantLib::Date start = exercise;
         if (sidx.spotDays > 0) {
             start = sidx.fixedCalendar.advance(exercise, sidx.spotDays, QuantLib::Days, sidx.fixedBdc);
         }
-        for (const auto& tenor : tenors) {
-            QuantLib::Date tentativeEnd = sidx.fixedCalendar.advance(start, tenor, sidx.fixedTermBdc);
-            QuantLib::Schedule fixedSchedule(
-                start, tentativeEnd, QuantLib::Period(sidx.fixedFrequency), sidx.fixedCalendar,
-                sidx.fixedBdc, sidx.fixedTermBdc, sidx.fixedDateRule, sidx.fixedEom);
-            QuantLib::Date maturity = fixedSchedule.endDate();
-            double atm = 0.0;
-
-            if (sidx.kind == quantra::SwapIndexKind_OisSwapIndex) {
-                auto on = indices.getOvernightWithCurve(sidx.floatIndexId, forwardingCurve);
-                auto ois = std::make_shared<QuantLib::OvernightIndexedSwap>(
-                    QuantLib::Swap::Payer, 1.0, fixedSchedule, 0.0, sidx.fixedDayCounter, on);
-                ois->setPricingEngine(std::make_shared<QuantLib::DiscountingSwapEngine>(discountCurve));
-                atm = ois->fairRate();
-            } else {
-                auto ibor = indices.getIborWithCurve(sidx.floatIndexId, forwardingCurve);
-                QuantLib::Period floatTenor = sidx.floatTenor.length() > 0 ? sidx.floatTenor : ibor->tenor();
-                QuantLib::Schedule floatSchedule(
-                    start, maturity, floatTenor, sidx.floatCalendar,
-                    sidx.floatBdc, sidx.floatTermBdc, sidx.floatDateRule, sidx.floatEom);
-                auto swap = std::make_shared<QuantLib::VanillaSwap>(
-                    QuantLib::VanillaSwap::Payer, 1.0, fixedSchedule, 0.0, sidx.fixedDayCounter,
-                    floatSchedule, ibor, 0.0, ibor->dayCounter());
-                swap->setPricingEngine(std::make_shared<QuantLib::DiscountingSwapEngine>(discountCurve));
-                atm = swap->fairRate();
-            }
-            atms.push_back(atm);
-        }
+        starts.push_back(start);
     }
+
+    AtmForwardGrid grid(sidx, indices, discountCurve, forwardingCurve);
+    std::vector<double> atms = grid.fairRates(starts, tenors);
     const size_t expected = exerciseDates.size() * tenors.size();
     if (atms.size() != expected) {
         QUANTRA_ERROR("Computed ATM matrix size mismatch for exercise-date based smile cube");
@@ -178,59 +510,55 @@ SwaptionVolEntry finalizeSwaptionVolEntryForPricing(
     const QuantLib::Handle<QuantLib::YieldTermStructure>& discountCurve,
     const QuantLib::Handle<QuantLib::YieldTermStructure>& forwardingCurve,
     bool forceRecomputeAtm) {
-    if (raw.volKind != quantra::enums::SwaptionVolKind_SmileCube3D ||
-        raw.strikeKind != quantra::enums::SwaptionStrikeKind_SpreadFromATM) {
-        return raw;
-    }
-    if (raw.referenceDate == QuantLib::Date()) {
-        QUANTRA_ERROR("SpreadFromATM smile cube requires a valid vol referenceDate");
-    }
-    if (raw.swapIndexId.empty()) {
-        QUANTRA_ERROR("SpreadFromATM smile cube requires swap_index_id");
-    }
-    if (raw.allowExternalAtm && !raw.atmForwardsFlat.empty()) {
-        return raw;
-    }
-    if (!forceRecomputeAtm && !raw.atmForwardsFlat.empty()) {
+    if (!computesServerAtm(raw, forceRecomputeAtm)) {
         return raw;
     }
 
-    if (!reg.swapIndices.has(raw.swapIndexId)) {
-        QUANTRA_ERROR("Missing swap index definition for id: " + raw.swapIndexId);
-    }
-    const auto& sidx = reg.swapIndices.get(raw.swapIndexId);
+    const auto& sidx = swapIndexOf(raw, reg);
     if (trade != nullptr) {
-        std::string tradeIndexId = getTradeFloatingIndexId(trade);
-        if (!tradeIndexId.empty() && tradeIndexId != sidx.floatIndexId) {
-            QUANTRA_ERROR(
-                "Swap index '" + raw.swapIndexId + "' float_index_id '" + sidx.floatIndexId +
-                "' does not match swaption floating index '" + tradeIndexId + "'");
-        }
-
-        QuantLib::Date tradeExerciseDate, tradeStartDate;
-        if (getTradeExerciseAndStartDates(trade, tradeExerciseDate, tradeStartDate)) {
-            QuantLib::Date tradeExerciseAdjusted = sidx.fixedCalendar.adjust(tradeExerciseDate, sidx.fixedBdc);
-            QuantLib::Date expectedStart = sidx.fixedCalendar.advance(
-                tradeExerciseAdjusted, sidx.spotDays, QuantLib::Days, sidx.fixedBdc);
-            QuantLib::Date tradeStartAdjusted = sidx.fixedCalendar.adjust(tradeStartDate, sidx.fixedBdc);
-            if (expectedStart != tradeStartAdjusted) {
-                std::ostringstream err;
-                err << "Swap index '" << raw.swapIndexId
-                    << "' spot_days mismatch against trade start convention: expected start "
-                    << QuantLib::io::iso_date(expectedStart) << " from exercise "
-                    << QuantLib::io::iso_date(tradeExerciseDate)
-                    << " (adjusted: " << QuantLib::io::iso_date(tradeExerciseAdjusted) << ")"
-                    << " with spot_days=" << sidx.spotDays
-                    << ", but trade start is " << QuantLib::io::iso_date(tradeStartDate)
-                    << " (adjusted: " << QuantLib::io::iso_date(tradeStartAdjusted) << ")";
-                QUANTRA_ERROR(err.str());
-            }
-        }
+        checkTradeConventions(raw, sidx, trade);
     }
 
     auto atms = computeServerAtmForwards(
         raw, sidx, reg.indices, discountCurve, forwardingCurve);
-    return withSwaptionSmileCubeAtm(raw, atms);
+    return isSabrCube(raw) ? withSwaptionSabrAtm(raw, atms) : withSwaptionSmileCubeAtm(raw, atms);
+}
+
+const SwaptionVolEntry& SwaptionVolFinalizer::finalize(
+    const std::string& scenario,
+    const std::string& volId,
+    const SwaptionVolEntry& raw,
+    double volBump,
+    const quantra::PriceSwaption* trade,
+    const std::string& discountCurveId,
+    const QuantLib::Handle<QuantLib::YieldTermStructure>& discountCurve,
+    const std::string& forwardingCurveId,
+    const QuantLib::Handle<QuantLib::YieldTermStructure>& forwardingCurve,
+    bool forceRecomputeAtm) {
+    std::ostringstream key;
+    key << scenario << '\n' << volId << '\n' << discountCurveId << '\n' << forwardingCurveId << '\n'
+        << std::setprecision(17) << volBump << '\n' << forceRecomputeAtm;
+
+    // Trade conventions differ per trade, so they are checked on every call
+    auto it = entries_.find(key.str());
+    if (it != entries_.end()) {
+        hits_++;
+        if (trade != nullptr && it->second.serverAtm) {
+            checkTradeConventions(raw, swapIndexOf(raw, reg_), trade);
+        }
+        return it->second.entry;
+    }
+
+    // Decided on the bumped entry: a SabrCalibrate bump drops client ATMs
+    SwaptionVolEntry bumped = bumpSwaptionVolEntry(raw, volBump);
+    Finalized finalized;
+    finalized.serverAtm = computesServerAtm(bumped, forceRecomputeAtm);
+    if (trade != nullptr && finalized.serverAtm) {
+        checkTradeConventions(bumped, swapIndexOf(bumped, reg_), trade);
+    }
+    finalized.entry = finalizeSwaptionVolEntryForPricing(
+        bumped, nullptr, reg_, discountCurve, forwardingCurve, forceRecomputeAtm);
+    return entries_.emplace(key.str(), std::move(finalized)).first->second.entry;
 }
 
 } // namespace quantra
@@ -1,6 +1,8 @@
 #ifndef QUANTRA_SWAPTION_VOL_RUNTIME_H
 #define QUANTRA_SWAPTION_VOL_RUNTIME_H
 
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <ql/handle.hpp>
@@ -12,6 +14,21 @@
 
 namespace quantra {
 
+/**
+ * Server-side ATM forward grids: the fair rate of the swap index's swap
+ * for every expiry x tenor node, row-major by expiry.
+ *
+ * Rates are float-leg PV over fixed-leg annuity, laid out from each node's
+ * schedules with all payment and forecast dates of the grid discounted in
+ * one pass per curve; nodes that need historical fixings are priced with
+ * the swap instrument and DiscountingSwapEngine instead.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_ANALYTIC_ATM=0              Price every node with the swap instrument
+ *   QUANTRA_ANALYTIC_ATM_VERIFY=<tol>   Check every analytic rate against the
+ *                                       swap's fairRate(); error if the
+ *                                       difference exceeds tol
+ */
 std::vector<double> computeServerAtmForwards(
     const quantra::SwaptionVolEntry& volEntry,
     const quantra::SwapIndexRuntime& sidx,
@@ -27,6 +44,49 @@ SwaptionVolEntry finalizeSwaptionVolEntryForPricing(
     const QuantLib::Handle<QuantLib::YieldTermStructure>& forwardingCurve,
     bool forceRecomputeAtm);
 
+/**
+ * SwaptionVolFinalizer - finalizeSwaptionVolEntryForPricing (after an
+ * optional bumpSwaptionVolEntry) memoized for one request.
+ *
+ * Entries are keyed by (scenario, vol id, discounting curve id, forwarding
+ * curve id, vol bump), so the ATM grid and cube of a smile-cube or SABR vol
+ * are built once per scenario however many swaptions share them. Scenario
+ * names must be unique per set of curve handles (e.g. "base", "curve+1bp").
+ * Whenever the entry's ATM forwards are computed on the server, each trade
+ * is still checked against the swap index conventions on every call, as
+ * finalizeSwaptionVolEntryForPricing would.
+ */
+class SwaptionVolFinalizer {
+public:
+    explicit SwaptionVolFinalizer(const PricingRegistry& reg) : reg_(reg) {}
+
+    /// The returned entry lives as long as the finalizer.
+    const SwaptionVolEntry& finalize(
+        const std::string& scenario,
+        const std::string& volId,
+        const SwaptionVolEntry& raw,
+        double volBump,
+        const quantra::PriceSwaption* trade,
+        const std::string& discountCurveId,
+        const QuantLib::Handle<QuantLib::YieldTermStructure>& discountCurve,
+        const std::string& forwardingCurveId,
+        const QuantLib::Handle<QuantLib::YieldTermStructure>& forwardingCurve,
+        bool forceRecomputeAtm);
+
+    size_t size() const { return entries_.size(); }
+    size_t hits() const { return hits_; }
+
+private:
+    struct Finalized {
+        SwaptionVolEntry entry;
+        bool serverAtm = false;   // ATM forwards computed here; trades are checked
+    };
+
+    const PricingRegistry& reg_;
+    std::unordered_map<std::string, Finalized> entries_;
+    size_t hits_ = 0;
+};
+
 std::vector<double> computeServerAtmForwardsForExerciseDates(
     const std::vector<QuantLib::Date>& exerciseDates,
     const std::vector<QuantLib::Period>& tenors,
@@ -0,0 +1,42 @@
+#ifndef QUANTRASERVER_UPSERT_TRADES_HANDLER_H
+#define QUANTRASERVER_UPSERT_TRADES_HANDLER_H
+
+#include "call_data_base.h"
+#include "product_registry.h"
+#include "upsert_trades_request.h"
+#include "upsert_trades_request_generated.h"
+#include "upsert_trades_response_generated.h"
+
+using quantra::UpsertTradesRequest;
+using quantra::UpsertTradesResponse;
+using quantra::UpsertTradesResponseBuilder;
+
+class UpsertTradesData : public CallDataGeneric<
+    UpsertTradesRequest,
+    UpsertTradesRequestHandler,
+    UpsertTradesResponse,
+    UpsertTradesResponseBuilder>
+{
+public:
+    UpsertTradesData(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq)
+        : CallDataGeneric(service, cq)
+    {
+    }
+
+protected:
+    void RequestCall() override
+    {
+        service_->RequestUpsertTrades(
+            &ctx_, &request_msg, &responder_, cq_, cq_, this);
+    }
+
+    void CreateService(QuantraServer::AsyncService *service, grpc::ServerCompletionQueue *cq) override
+    {
+        auto handler = new UpsertTradesData(service, cq);
+        handler->start();
+    }
+};
+
+REGISTER_PRODUCT(UpsertTrades, UpsertTradesData);
+
+#endif // QUANTRASERVER_UPSERT_TRADES_HANDLER_H
@@ -0,0 +1,39 @@
+#include "upsert_trades_request.h"
+
+#include "trade_store.h"
+
+using namespace quantra;
+
+flatbuffers::Offset<UpsertTradesResponse> UpsertTradesRequestHandler::request(
+    std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+    const UpsertTradesRequest* request) const
+{
+    TradeStore& store = TradeStore::instance();
+
+    int stored = 0;
+    std::vector<flatbuffers::Offset<RejectedTrade>> rejected;
+    for (auto trade : *request->trades()) {
+        try {
+            store.upsert(trade);
+            stored++;
+        } catch (const std::exception& e) {
+            auto id = builder->CreateString(trade->id() ? trade->id()->str() : std::string());
+            auto msg = builder->CreateString(e.what());
+            ErrorBuilder eb(*builder);
+            eb.add_error_message(msg);
+            auto err = eb.Finish();
+
+            RejectedTradeBuilder rb(*builder);
+            rb.add_id(id);
+            rb.add_error(err);
+            rejected.push_back(rb.Finish());
+        }
+    }
+
+    auto rejectedVec = builder->CreateVector(rejected);
+    UpsertTradesResponseBuilder response(*builder);
+    response.add_stored(stored);
+    response.add_rejected(rejectedVec);
+    response.add_trade_count(static_cast<int>(store.size()));
+    return response.Finish();
+}
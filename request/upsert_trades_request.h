@@ -0,0 +1,23 @@
+#ifndef QUANTRA_UPSERT_TRADES_REQUEST_H
+#define QUANTRA_UPSERT_TRADES_REQUEST_H
+
+#include "flatbuffers/grpc.h"
+
+#include "upsert_trades_request_generated.h"
+#include "upsert_trades_response_generated.h"
+
+/**
+ * UpsertTradesRequestHandler - Stores trades in the worker's TradeStore.
+ *
+ * Trades are stored by id, replacing earlier versions; Price* requests
+ * then reference them through trade_id or book_id. A trade that cannot
+ * be stored is reported in `rejected` and does not stop the others.
+ */
+class UpsertTradesRequestHandler {
+public:
+    flatbuffers::Offset<quantra::UpsertTradesResponse> request(
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> builder,
+        const quantra::UpsertTradesRequest* request) const;
+};
+
+#endif // QUANTRA_UPSERT_TRADES_REQUEST_H
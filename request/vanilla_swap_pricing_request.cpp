@@ -1,6 +1,8 @@
 #include "vanilla_swap_pricing_request.h"
 
+#include "curve_cache.h"
 #include "pricing_registry.h"
+#include "trade_store.h"
 
 using namespace QuantLib;
 using namespace quantra;
@@ -10,8 +12,15 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
     const PriceVanillaSwapRequest *request) const
 {
     // Build registry (handles curves with dependency ordering via CurveBootstrapper)
+    PricingDemand demand;
+    for (auto it = request->swaps()->begin(); it != request->swaps()->end(); it++)
+    {
+        demand.addCurve(it->discounting_curve());
+        demand.addCurve(it->forwarding_curve());
+    }
+
     PricingRegistryBuilder regBuilder;
-    PricingRegistry reg = regBuilder.build(request->pricing());
+    PricingRegistry reg = regBuilder.build(request->pricing(), &demand);
 
     VanillaSwapParser swap_parser;
     Date as_of_date = Settings::instance().evaluationDate();
@@ -20,11 +29,15 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
     bool include_flows = request->include_flows();
 
     // Process each swap
-    auto swap_pricings = request->swaps();
+    // Inline swaps, and stored ones referenced by trade or book id
+    auto swap_pricings = TradeStore::instance().resolve<quantra::VanillaSwap>(
+        request->swaps(), [](const PriceVanillaSwap* p) { return p->vanilla_swap(); });
     std::vector<flatbuffers::Offset<VanillaSwapResponse>> swaps_vector;
 
-    for (auto it = swap_pricings->begin(); it != swap_pricings->end(); it++)
+    for (const auto& item : swap_pricings)
     {
+        auto it = item.pricing;
+
         // Get discounting curve
         auto discounting_curve_it = reg.curves.find(it->discounting_curve()->str());
         if (discounting_curve_it == reg.curves.end())
@@ -41,7 +54,7 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
 
         // Link forwarding curve to parser and parse swap
         swap_parser.linkForwardingTermStructure(forwarding_curve_it->second->currentLink());
-        auto swap = swap_parser.parse(it->vanilla_swap(), reg.indices);
+        auto swap = swap_parser.parse(item.trade, reg.indices);
 
         // Set pricing engine
         auto engine = std::make_shared<DiscountingSwapEngine>(*discounting_curve_it->second);
@@ -64,7 +77,7 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
 
         if (include_flows)
         {
-            auto discountCurve = discounting_curve_it->second->currentLink();
+            CachedDiscounts discounts(discounting_curve_it->second->currentLink());
 
             // Fixed leg flows
             const Leg& fixedLeg = swap->fixedLeg();
@@ -82,7 +95,7 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
                     auto accrual_start = builder->CreateString(os_start.str());
                     auto accrual_end = builder->CreateString(os_end.str());
 
-                    double discount = discountCurve->discount(coupon->date());
+                    double discount = discounts(coupon->date());
                     double pv = coupon->amount() * discount;
 
                     SwapLegFlowBuilder flow_builder(*builder);
@@ -116,7 +129,7 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
                     auto accrual_end = builder->CreateString(os_end.str());
                     auto fixing_date = builder->CreateString(os_fixing.str());
 
-                    double discount = discountCurve->discount(coupon->date());
+                    double discount = discounts(coupon->date());
                     double pv = coupon->amount() * discount;
 
                     SwapLegFlowBuilder flow_builder(*builder);
@@ -137,6 +150,9 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
 
         auto fixed_leg_flows = builder->CreateVector(fixed_leg_flows_vector);
         auto floating_leg_flows = builder->CreateVector(floating_leg_flows_vector);
+        flatbuffers::Offset<flatbuffers::String> trade_id;
+        if (!item.tradeId.empty())
+            trade_id = builder->CreateString(item.tradeId);
 
         // Build swap response
         VanillaSwapResponseBuilder swap_response_builder(*builder);
@@ -147,6 +163,7 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
         swap_response_builder.add_floating_leg_bps(floatingLegBPS);
         swap_response_builder.add_fixed_leg_npv(fixedLegNPV);
         swap_response_builder.add_floating_leg_npv(floatingLegNPV);
+        swap_response_builder.add_trade_id(trade_id);
 
         if (include_flows)
         {
@@ -159,8 +176,10 @@ flatbuffers::Offset<PriceVanillaSwapResponse> VanillaSwapPricingRequest::request
 
     // Build final response
     auto swaps = builder->CreateVector(swaps_vector);
+    auto staleCurves = staleCurvesVector(*builder, reg);
     PriceVanillaSwapResponseBuilder response_builder(*builder);
     response_builder.add_swaps(swaps);
+    response_builder.add_stale_curves(staleCurves);
 
     return response_builder.Finish();
 }
@@ -0,0 +1,221 @@
+#include "z_spread_batch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+#include <ql/pricingengines/bond/bondfunctions.hpp>
+
+#include "bracketed_newton.h"
+#include "curve_sampler.h"
+#include "year_fractions.h"
+
+using namespace QuantLib;
+
+namespace quantra {
+
+namespace {
+
+bool batchEnabled() {
+    static const bool enabled = [] {
+        const char* env = std::getenv("QUANTRA_ZSPREAD_BATCH");
+        return !(env && std::string(env) == "0");
+    }();
+    return enabled;
+}
+
+/// Whether InterestRate compounds simply over t under the convention.
+bool simpleAt(Compounding comp, Real freq, Time t) {
+    switch (comp) {
+    case Simple:
+        return true;
+    case SimpleThenCompounded:
+        return t <= 1.0 / freq;
+    case CompoundedThenSimple:
+        return t > 1.0 / freq;
+    default:
+        return false;
+    }
+}
+
+/// One curve node under a spread: the curve's zero rate at the node
+/// (YieldTermStructure::zeroRate), and the spreaded discount factor and
+/// its log-derivative in the spread (ZeroSpreadedTermStructure).
+struct Node {
+    double rate = 0.0;
+    Time t = 0.0;
+
+    Node(double df, Time time, Compounding comp, Real freq) : t(time) {
+        if (t == 0.0) return;
+        const Real compound = 1.0 / df;
+        if (comp == Continuous) rate = std::log(compound) / t;
+        else if (simpleAt(comp, freq, t)) rate = (compound - 1.0) / t;
+        else rate = (std::pow(compound, 1.0 / (freq * t)) - 1.0) * freq;
+    }
+
+    double discount(Spread s, Compounding comp, Real freq, double& slope) const {
+        if (t == 0.0) {
+            slope = 0.0;
+            return 1.0;
+        }
+        const Rate r = rate + s;
+        if (comp == Continuous) {
+            slope = -t;
+            return std::exp(-r * t);
+        }
+        if (simpleAt(comp, freq, t)) {
+            slope = -t / (1.0 + r * t);
+            return 1.0 / (1.0 + r * t);
+        }
+        slope = -t / (1.0 + r / freq);
+        return 1.0 / std::pow(1.0 + r / freq, freq * t);
+    }
+
+    /// Spreads at or below this leave the node's compound factor non-positive.
+    Spread floor(Compounding comp, Real freq) const {
+        if (t == 0.0 || comp == Continuous) return -std::numeric_limits<Real>::infinity();
+        return simpleAt(comp, freq, t) ? -1.0 / t - rate : -freq - rate;
+    }
+};
+
+} // namespace
+
+size_t ZSpreadBatch::add(const std::shared_ptr<Bond>& bond,
+                         const std::shared_ptr<YieldTermStructure>& discountCurve,
+                         const Quote& quote) {
+    Entry entry;
+    entry.bond = bond;
+    entry.curve = discountCurve;
+    entry.quote = quote;
+    entry.settlementDate = bond->settlementDate();
+
+    const bool needsFrequency = quote.compounding != Continuous && quote.compounding != Simple;
+    entry.batched = batchEnabled() &&
+                    bond->notional(entry.settlementDate) != 0.0 &&
+                    entry.settlementDate >= discountCurve->referenceDate() &&
+                    !(needsFrequency && (quote.frequency == Once || quote.frequency == NoFrequency));
+
+    entry.begin = dates_.size();
+    if (entry.batched) {
+        // CashFlows::npv at settlement, includeSettlementDateFlows = false
+        for (const auto& cf : bond->cashflows()) {
+            if (cf->hasOccurred(entry.settlementDate, false) || cf->tradingExCoupon(entry.settlementDate))
+                continue;
+            if (cf->amount() < 0.0) entry.batched = false;
+            dates_.push_back(cf->date().serialNumber());
+            amounts_.push_back(cf->amount());
+        }
+    }
+    entry.end = dates_.size();
+
+    bonds_.push_back(std::move(entry));
+    spreads_.push_back(0.0);
+    return bonds_.size() - 1;
+}
+
+void ZSpreadBatch::solve(Real accuracy, Size maxIterations, Spread guess) {
+    // Bonds by discounting curve, in first-seen order
+    std::vector<const YieldTermStructure*> curveOrder;
+    std::unordered_map<const YieldTermStructure*, std::vector<size_t>> byCurve;
+    for (size_t i = 0; i < bonds_.size(); i++) {
+        if (!bonds_[i].batched) continue;
+        auto& group = byCurve[bonds_[i].curve.get()];
+        if (group.empty()) curveOrder.push_back(bonds_[i].curve.get());
+        group.push_back(i);
+    }
+
+    dfs_.assign(dates_.size(), 0.0);
+    times_.assign(dates_.size(), 0.0);
+    settlementDfs_.assign(bonds_.size(), 1.0);
+    settlementTimes_.assign(bonds_.size(), 0.0);
+    for (const YieldTermStructure* key : curveOrder) {
+        const std::vector<size_t>& group = byCurve[key];
+        const auto& curve = bonds_[group.front()].curve;
+
+        // One sorted evaluation over all dates the group needs
+        std::vector<Date::serial_type> serials;
+        for (size_t i : group) {
+            const Entry& e = bonds_[i];
+            serials.insert(serials.end(), dates_.begin() + e.begin, dates_.begin() + e.end);
+            serials.push_back(e.settlementDate.serialNumber());
+        }
+        std::sort(serials.begin(), serials.end());
+        serials.erase(std::unique(serials.begin(), serials.end()), serials.end());
+
+        std::vector<Date> gridDates(serials.size());
+        for (size_t k = 0; k < serials.size(); k++) gridDates[k] = Date(serials[k]);
+        const std::vector<double> gridDfs = CurveSampler::discounts(curve, gridDates);
+        const std::vector<Time> gridTimes =
+            YearFractions::from(curve->dayCounter(), curve->referenceDate(), gridDates);
+        auto at = [&](Date::serial_type s) {
+            return std::lower_bound(serials.begin(), serials.end(), s) - serials.begin();
+        };
+
+        for (size_t i : group) {
+            const Entry& e = bonds_[i];
+            for (size_t k = e.begin; k < e.end; k++) {
+                const auto j = at(dates_[k]);
+                dfs_[k] = gridDfs[j];
+                times_[k] = gridTimes[j];
+            }
+            const auto j = at(e.settlementDate.serialNumber());
+            settlementDfs_[i] = gridDfs[j];
+            settlementTimes_[i] = gridTimes[j];
+        }
+    }
+
+    for (size_t i = 0; i < bonds_.size(); i++) {
+        spreads_[i] = solveOne(i, accuracy, maxIterations, guess);
+    }
+}
+
+Spread ZSpreadBatch::solveOne(size_t i, Real accuracy, Size maxIterations, Spread guess) const {
+    const Entry& e = bonds_[i];
+    auto fallback = [&] {
+        return BondFunctions::zSpread(*e.bond, Bond::Price(e.quote.cleanPrice, Bond::Price::Clean),
+                                      e.curve, e.curve->dayCounter(), e.quote.compounding,
+                                      e.quote.frequency, e.settlementDate, accuracy, maxIterations, guess);
+    };
+    if (!e.batched || e.begin == e.end) return fallback();
+
+    // BondFunctions::zSpread target: dirty price in amount units
+    Real target = e.quote.cleanPrice + e.bond->accruedAmount(e.settlementDate);
+    target /= 100.0 / e.bond->notional(e.settlementDate);
+    if (!(target > 0.0)) return fallback();
+
+    const Compounding comp = e.quote.compounding;
+    const Real freq = e.quote.frequency;
+    const Node settlement(settlementDfs_[i], settlementTimes_[i], comp, freq);
+    std::vector<Node> nodes;
+    nodes.reserve(e.end - e.begin);
+    Spread floor = settlement.floor(comp, freq);
+    for (size_t k = e.begin; k < e.end; k++) {
+        nodes.emplace_back(dfs_[k], times_[k], comp, freq);
+        floor = std::max(floor, nodes.back().floor(comp, freq));
+    }
+    if (!std::isfinite(floor)) floor = -1.0;
+
+    // Later flows are discounted over longer times, so the price falls
+    // monotonically in the spread
+    auto f = [&](Spread s, double& derivative) {
+        double settlementSlope, slope;
+        const double settlementDf = settlement.discount(s, comp, freq, settlementSlope);
+        double value = 0.0;
+        derivative = 0.0;
+        for (size_t k = 0; k < nodes.size(); k++) {
+            const double pv = amounts_[e.begin + k] * nodes[k].discount(s, comp, freq, slope);
+            value += pv;
+            derivative += pv * (slope - settlementSlope);
+        }
+        derivative /= settlementDf;
+        return value / settlementDf - target;
+    };
+    Spread s;
+    if (bracketedNewton(f, guess, floor, accuracy, maxIterations, s)) return s;
+    return fallback();
+}
+
+} // namespace quantra
@@ -0,0 +1,82 @@
+#ifndef QUANTRA_Z_SPREAD_BATCH_H
+#define QUANTRA_Z_SPREAD_BATCH_H
+
+/**
+ * Z-spreads of many bonds over their discounting curves
+ *
+ * The Z-spread is the constant spread s over the curve's zero rates (the
+ * curve's day counter, the quote's compounding) at which the bond's flows
+ * after settlement reprice to its market dirty price at settlement - what
+ * BondFunctions::zSpread solves through a ZeroSpreadedTermStructure.
+ *
+ * Instead of a Brent solve re-discounting the leg through the spreaded
+ * curve, each curve's discount factors and times are evaluated once over
+ * the sorted dates of all its bonds (CurveSampler, YearFractions), turned
+ * into per-flow zero rates, and each bond is solved by bracketed Newton
+ * with the analytic derivative over those arrays. Non-tradable bonds,
+ * negative flows, settlement before the curve's reference date and
+ * failed solves go through BondFunctions::zSpread, so errors are
+ * QuantLib's.
+ *
+ * Configuration via environment variables:
+ *   QUANTRA_ZSPREAD_BATCH=0    Use BondFunctions::zSpread for every bond
+ */
+
+#include <memory>
+#include <vector>
+
+#include <ql/instruments/bond.hpp>
+#include <ql/termstructures/yieldtermstructure.hpp>
+
+namespace quantra {
+
+class ZSpreadBatch {
+public:
+    struct Quote {
+        double cleanPrice = 0.0;            // per 100 notional
+        QuantLib::Compounding compounding = QuantLib::Continuous;
+        QuantLib::Frequency frequency = QuantLib::Annual;
+    };
+
+    /// Queues a bond quoted at its settlement date; returns its index.
+    size_t add(const std::shared_ptr<QuantLib::Bond>& bond,
+               const std::shared_ptr<QuantLib::YieldTermStructure>& discountCurve,
+               const Quote& quote);
+
+    /// Solves all queued bonds.
+    void solve(QuantLib::Real accuracy = 1.0e-10,
+               QuantLib::Size maxIterations = 100,
+               QuantLib::Spread guess = 0.0);
+
+    QuantLib::Spread zSpread(size_t i) const { return spreads_[i]; }
+    size_t size() const { return bonds_.size(); }
+
+private:
+    struct Entry {
+        std::shared_ptr<QuantLib::Bond> bond;
+        std::shared_ptr<QuantLib::YieldTermStructure> curve;
+        Quote quote;
+        QuantLib::Date settlementDate;
+        bool batched = false;
+        size_t begin = 0, end = 0;          // flow range in the buffers
+    };
+
+    QuantLib::Spread solveOne(size_t i, QuantLib::Real accuracy,
+                              QuantLib::Size maxIterations, QuantLib::Spread guess) const;
+
+    std::vector<Entry> bonds_;
+    std::vector<QuantLib::Spread> spreads_;
+
+    // Flows counted at settlement, bonds back to back
+    std::vector<QuantLib::Date::serial_type> dates_;
+    std::vector<double> amounts_;
+    std::vector<double> dfs_;
+    std::vector<double> times_;
+    // Per bond, the settlement date's discount factor and time
+    std::vector<double> settlementDfs_;
+    std::vector<double> settlementTimes_;
+};
+
+} // namespace quantra
+
+#endif // QUANTRA_Z_SPREAD_BATCH_H
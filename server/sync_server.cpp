@@ -13,6 +13,10 @@
 #include "cds_handler.h"
 #include "bootstrap_curves_handler.h"
 #include "sample_vol_surfaces_handler.h"
+#include "curve_risk_handler.h"
+#include "bond_yield_analytics_handler.h"
+#include "upsert_trades_handler.h"
+#include "delete_trades_handler.h"
 
 #include <grpcpp/grpcpp.h>
 #include <iostream>
@@ -74,8 +78,7 @@ private:
         while (true)
         {
             GPR_ASSERT(cq_->Next(&tag, &ok));
-            GPR_ASSERT(ok);
-            static_cast<CallData *>(tag)->Proceed();
+            static_cast<CallData *>(tag)->Proceed(ok);
         }
     }
 
@@ -5,9 +5,13 @@ Quantra Curve Cache Benchmark
 Modes:
     bond  - 1 curve, 8 helpers (3 deposits + 5 bonds)
     swap  - 2 EUR curves, 24 helpers, OIS dep chain
+
+--tiers runs the same market set once per bootstrap_accuracy tier and reports
+latency and NPV error against Exact. Run it against a server with the curve
+cache disabled, otherwise every request after the first is a cache hit.
 """
 
-import json, time, argparse, statistics, requests
+import copy, json, time, argparse, statistics, requests
 
 # --- BOND: 1 curve, 8 helpers (3 deposits + 5 bonds) ---
 BOND_REQUEST = {
@@ -112,12 +116,13 @@ MODES = {
 # Benchmark runner
 # =============================================================================
 
-def run_benchmark(url: str, mode: str, n_requests: int = 100, warmup: int = 3) -> dict:
+def run_benchmark(url: str, mode: str, n_requests: int = 100, warmup: int = 3,
+                  payload_obj: dict = None) -> dict:
     cfg = MODES[mode]
     session = requests.Session()
     session.headers.update({"Content-Type": "application/json"})
     endpoint = f"{url.rstrip('/')}/{cfg['endpoint']}"
-    payload = json.dumps(cfg["payload"])
+    payload = json.dumps(payload_obj if payload_obj is not None else cfg["payload"])
 
     try:
         r = session.get(f"{url.rstrip('/')}/health", timeout=5)
@@ -188,6 +193,51 @@ def print_results(tag: str, results: dict):
     print(f"{'='*60}")
 
 
+# =============================================================================
+# Bootstrap accuracy tiers
+# =============================================================================
+
+TIERS = ["Exact", "Standard", "Fast"]
+
+
+def with_accuracy(payload: dict, tier: str, max_iterations: int) -> dict:
+    out = copy.deepcopy(payload)
+    for curve in out["pricing"]["curves"]:
+        curve["bootstrap_accuracy"] = tier
+        if max_iterations:
+            curve["bootstrap_max_iterations"] = max_iterations
+    return out
+
+
+def run_tiers(url: str, mode: str, n_requests: int, warmup: int, max_iterations: int) -> list:
+    cfg = MODES[mode]
+    rows = []
+    for tier in TIERS:
+        print(f"\n--- tier {tier} ---")
+        payload = with_accuracy(cfg["payload"], tier, max_iterations)
+        results = run_benchmark(url, mode, n_requests, warmup, payload)
+        if not results:
+            return rows
+        rows.append({"tier": tier,
+                     "mean_ms": results["mean_ms"],
+                     "median_ms": results["median_ms"],
+                     "p95_ms": results["p95_ms"],
+                     "npv": cfg["npv_path"](results["result_sample"])})
+
+    exact = rows[0]["npv"]
+    print(f"\n{'='*60}")
+    print(f"  Bootstrap accuracy tiers ({mode}, max_iterations={max_iterations or 'default'})")
+    print(f"{'='*60}")
+    print(f"  {'tier':<10}{'mean ms':>10}{'median ms':>12}{'p95 ms':>10}{'|NPV - Exact|':>18}")
+    for row in rows:
+        err = abs(row["npv"] - exact) if row["npv"] is not None and exact is not None else float("nan")
+        row["npv_error"] = err
+        print(f"  {row['tier']:<10}{row['mean_ms']:>10.2f}{row['median_ms']:>12.2f}"
+              f"{row['p95_ms']:>10.2f}{err:>18.3e}")
+    print(f"{'='*60}")
+    return rows
+
+
 def main():
     parser = argparse.ArgumentParser(description="Quantra curve cache benchmark")
     parser.add_argument("--url", default="http://localhost:8080")
@@ -196,8 +246,22 @@ def main():
     parser.add_argument("--warmup", type=int, default=5)
     parser.add_argument("--mode", choices=list(MODES.keys()), default="bond",
                         help="bond=1 curve/8 helpers, swap=EUR multicurve 24 helpers")
+    parser.add_argument("--tiers", action="store_true",
+                        help="compare bootstrap_accuracy tiers (run with the curve cache disabled)")
+    parser.add_argument("--max-iterations", type=int, default=0,
+                        help="bootstrap_max_iterations for --tiers (0 = QuantLib default)")
     args = parser.parse_args()
 
+    if args.tiers:
+        print(f"\n--- {args.tag}: accuracy tiers ({args.url}) ---")
+        rows = run_tiers(args.url, args.mode, args.n, args.warmup, args.max_iterations)
+        if rows:
+            outfile = f"bench_{args.tag.replace(' ', '_')}_tiers.json"
+            with open(outfile, 'w') as f:
+                json.dump({"tag": args.tag, "mode": args.mode, "tiers": rows}, f, indent=2)
+            print(f"\n  Raw data saved to: {outfile}")
+        return
+
     print(f"\n--- {args.tag} ({args.url}) ---")
     results = run_benchmark(args.url, args.mode, args.n, args.warmup)
     if results:
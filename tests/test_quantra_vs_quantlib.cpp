@@ -15,6 +15,10 @@
 #include <ql/quantlib.hpp>
 #include <iostream>
 #include <iomanip>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <array>
 
 #include "fixed_rate_bond_pricing_request.h"
 #include "vanilla_swap_pricing_request.h"
@@ -24,7 +28,30 @@
 #include "cds_pricing_request.h"
 #include "bootstrap_curves_request.h"
 #include "sample_vol_surfaces_request.h"
+#include "curve_risk_request.h"
+#include "bond_yield_analytics_request.h"
 #include "vol_surface_parsers.h"
+#include "curve_bootstrapper.h"
+#include "term_structure_parser.h"
+#include "curve_sampler.h"
+#include "sample_encoding.h"
+#include "business_day_calendar.h"
+#include "year_fractions.h"
+#include "curve_cache.h"
+#include "curve_cache_key.h"
+#include "instrument_cache.h"
+#include "instrument_cache_key.h"
+#include "bond_batch.h"
+#include "bond_yield_batch.h"
+#include "z_spread_batch.h"
+#include "trade_store.h"
+#include "upsert_trades_request.h"
+#include "delete_trades_request.h"
+#include "black_batch.h"
+#include "cap_floor_batch.h"
+#include "sabr_calibrator.h"
+#include "swaption_vol_runtime.h"
+#include "worker_pool.h"
 
 #include "price_fixed_rate_bond_request_generated.h"
 #include "fixed_rate_bond_response_generated.h"
@@ -45,6 +72,14 @@
 #include "bootstrap_curves_response_generated.h"
 #include "sample_vol_surfaces_request_generated.h"
 #include "sample_vol_surfaces_response_generated.h"
+#include "curve_risk_request_generated.h"
+#include "curve_risk_response_generated.h"
+#include "bond_yield_analytics_request_generated.h"
+#include "bond_yield_analytics_response_generated.h"
+#include "upsert_trades_request_generated.h"
+#include "upsert_trades_response_generated.h"
+#include "delete_trades_request_generated.h"
+#include "delete_trades_response_generated.h"
 #include "vol_query_generated.h"
 #include "index_generated.h"
 #include "swap_index_generated.h"
@@ -735,6 +770,118 @@ protected:
         return msBuilder.Finish();
     }
 
+    /// The 1Y quarterly 4% bond of runDepositCurveRisk.
+    flatbuffers::Offset<quantra::FixedRateBond> buildDepositRiskBond(flatbuffers::FlatBufferBuilder& b) {
+        auto eff = b.CreateString("2025-01-15");
+        auto term = b.CreateString("2026-01-15");
+        quantra::ScheduleBuilder sb(b);
+        sb.add_effective_date(eff);
+        sb.add_termination_date(term);
+        sb.add_calendar(quantra::enums::Calendar_TARGET);
+        sb.add_frequency(quantra::enums::Frequency_Quarterly);
+        sb.add_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        sb.add_termination_date_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        sb.add_date_generation_rule(quantra::enums::DateGenerationRule_Backward);
+        sb.add_end_of_month(false);
+        auto schedule = sb.Finish();
+
+        auto idate = b.CreateString("2025-01-15");
+        quantra::FixedRateBondBuilder bb(b);
+        bb.add_settlement_days(0);
+        bb.add_face_amount(100.0);
+        bb.add_schedule(schedule);
+        bb.add_rate(0.04);
+        bb.add_accrual_day_counter(quantra::enums::DayCounter_ActualActual);
+        bb.add_issue_date(idate);
+        bb.add_redemption(100.0);
+        bb.add_payment_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        return bb.Finish();
+    }
+
+    /// ComputeCurveRisk of a 1Y quarterly bond on a curve of deposits quoted
+    /// by id at flatRate_. `addBonds` appends further entries on "discount".
+    const quantra::ComputeCurveRiskResponse* runDepositCurveRisk(
+        const std::vector<std::pair<std::string, int>>& deposits,
+        quantra::CurveRiskMethod method,
+        std::shared_ptr<flatbuffers::grpc::MessageBuilder> respB,
+        quantra::enums::BootstrapTrait trait = quantra::enums::BootstrapTrait_Discount,
+        quantra::enums::Interpolator interpolator = quantra::enums::Interpolator_LogLinear,
+        const std::function<void(flatbuffers::grpc::MessageBuilder&,
+                                 std::vector<flatbuffers::Offset<quantra::PriceFixedRateBond>>&)>& addBonds = {}) {
+        flatbuffers::grpc::MessageBuilder b;
+
+        std::vector<flatbuffers::Offset<quantra::QuoteSpec>> quoteVec;
+        std::vector<flatbuffers::Offset<quantra::PointsWrapper>> points;
+        for (const auto& d : deposits) {
+            auto id = b.CreateString(d.first);
+            quantra::QuoteSpecBuilder qb(b);
+            qb.add_id(id);
+            qb.add_kind(quantra::QuoteKind_Rate);
+            qb.add_value(flatRate_);
+            qb.add_quote_type(quantra::QuoteType_Curve);
+            quoteVec.push_back(qb.Finish());
+
+            auto tenor = buildPeriod(b, d.second, quantra::enums::TimeUnit_Months);
+            auto qid = b.CreateString(d.first);
+            quantra::DepositHelperBuilder dep(b);
+            dep.add_quote_id(qid);
+            dep.add_tenor(tenor);
+            dep.add_fixing_days(2);
+            dep.add_calendar(quantra::enums::Calendar_TARGET);
+            dep.add_business_day_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            dep.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+            auto depOff = dep.Finish();
+            quantra::PointsWrapperBuilder pw(b);
+            pw.add_point_type(quantra::Point_DepositHelper);
+            pw.add_point(depOff.Union());
+            points.push_back(pw.Finish());
+        }
+        auto quotes = b.CreateVector(quoteVec);
+        auto pointsVec = b.CreateVector(points);
+        auto cid = b.CreateString("discount");
+        auto ref = b.CreateString("2025-01-15");
+        quantra::TermStructureBuilder tsb(b);
+        tsb.add_id(cid);
+        tsb.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+        tsb.add_interpolator(interpolator);
+        tsb.add_bootstrap_trait(trait);
+        tsb.add_reference_date(ref);
+        tsb.add_points(pointsVec);
+        auto ts = tsb.Finish();
+        auto curves = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{ts});
+
+        auto indices = buildIndicesVector(b);
+        auto asof = b.CreateString("2025-01-15");
+        quantra::PricingBuilder pb(b);
+        pb.add_as_of_date(asof);
+        pb.add_settlement_date(asof);
+        pb.add_indices(indices);
+        pb.add_curves(curves);
+        pb.add_quotes(quotes);
+        auto pricing = pb.Finish();
+
+        auto bond = buildDepositRiskBond(b);
+
+        auto dc = b.CreateString("discount");
+        quantra::PriceFixedRateBondBuilder pfb(b);
+        pfb.add_fixed_rate_bond(bond);
+        pfb.add_discounting_curve(dc);
+        std::vector<flatbuffers::Offset<quantra::PriceFixedRateBond>> entries{pfb.Finish()};
+        if (addBonds) addBonds(b, entries);
+        auto bonds = b.CreateVector(entries);
+
+        quantra::ComputeCurveRiskRequestBuilder rb(b);
+        rb.add_pricing(pricing);
+        rb.add_bonds(bonds);
+        rb.add_method(method);
+        b.Finish(rb.Finish());
+
+        CurveRiskRequestHandler handler;
+        auto resp = handler.request(respB, flatbuffers::GetRoot<quantra::ComputeCurveRiskRequest>(b.GetBufferPointer()));
+        respB->Finish(resp);
+        return flatbuffers::GetRoot<quantra::ComputeCurveRiskResponse>(respB->GetBufferPointer());
+    }
+
     QuantLib::Date evaluationDate_;
     double flatRate_;
     std::shared_ptr<QuantLib::YieldTermStructure> bootstrappedCurve_;
@@ -821,6 +968,834 @@ TEST_F(QuantraComparisonTest, FixedRateBond_NPVMatches) {
     EXPECT_NEAR(qlNPV, qNPV, 0.01);
 }
 
+TEST_F(QuantraComparisonTest, FixedRateBond_BatchMatchesEngine) {
+    std::cout << "\n--- Test: Bond batch pricing vs DiscountingBondEngine ---\n";
+
+    auto flat = std::make_shared<QuantLib::FlatForward>(
+        evaluationDate_, 0.041, QuantLib::Actual365Fixed(), QuantLib::Compounded, QuantLib::Semiannual);
+    std::vector<std::shared_ptr<QuantLib::YieldTermStructure>> curves = {bootstrappedCurve_, flat};
+
+    struct Spec { QuantLib::Date issue, maturity; QuantLib::Frequency freq; double coupon; int exDays; };
+    std::vector<Spec> specs = {
+        {QuantLib::Date(15, QuantLib::January, 2024), QuantLib::Date(15, QuantLib::January, 2029), QuantLib::Annual, 0.05, 0},
+        {QuantLib::Date(3, QuantLib::March, 2023), QuantLib::Date(3, QuantLib::September, 2032), QuantLib::Semiannual, 0.0325, 0},
+        {QuantLib::Date(20, QuantLib::November, 2024), QuantLib::Date(17, QuantLib::February, 2030), QuantLib::Quarterly, 0.045, 0},
+        // Coupon on 17 Jan 2025 is inside the ex-coupon period at settlement
+        {QuantLib::Date(17, QuantLib::January, 2022), QuantLib::Date(17, QuantLib::January, 2031), QuantLib::Semiannual, 0.04, 7},
+        // Matured before the evaluation date
+        {QuantLib::Date(1, QuantLib::June, 2019), QuantLib::Date(1, QuantLib::June, 2024), QuantLib::Annual, 0.02, 0},
+    };
+
+    std::vector<std::shared_ptr<QuantLib::Bond>> batchBonds, engineBonds;
+    BondBatch batch;
+    for (size_t n = 0; n < 3; n++) {
+        for (size_t j = 0; j < specs.size(); j++) {
+            const Spec& sp = specs[j];
+            QuantLib::Schedule sch(sp.issue, sp.maturity, QuantLib::Period(sp.freq), QuantLib::TARGET(),
+                QuantLib::Unadjusted, QuantLib::Unadjusted, QuantLib::DateGeneration::Backward, false);
+            auto make = [&]() {
+                return std::make_shared<QuantLib::FixedRateBond>(
+                    2, 100.0, sch, std::vector<QuantLib::Rate>(1, sp.coupon + 0.001 * n),
+                    QuantLib::ActualActual(QuantLib::ActualActual::ISMA), QuantLib::Following, 100.0,
+                    sp.issue, QuantLib::Calendar(), QuantLib::Period(sp.exDays, QuantLib::Days));
+            };
+            auto curve = curves[(n + j) % curves.size()];
+            batchBonds.push_back(make());
+            batch.add(batchBonds.back(), curve);
+            engineBonds.push_back(make());
+            engineBonds.back()->setPricingEngine(std::make_shared<QuantLib::DiscountingBondEngine>(
+                QuantLib::Handle<QuantLib::YieldTermStructure>(curve)));
+        }
+    }
+    batch.price();
+
+    for (size_t i = 0; i < engineBonds.size(); i++) {
+        const auto& r = batch.result(i);
+        EXPECT_NEAR(r.npv, engineBonds[i]->NPV(), 1e-10) << i;
+        EXPECT_NEAR(r.dirtyPrice, engineBonds[i]->dirtyPrice(), 1e-10) << i;
+        EXPECT_NEAR(r.cleanPrice, engineBonds[i]->cleanPrice(), 1e-10) << i;
+        EXPECT_NEAR(r.accruedAmount, engineBonds[i]->accruedAmount(), 1e-12) << i;
+        EXPECT_EQ(r.settlementDate, engineBonds[i]->settlementDate()) << i;
+    }
+}
+
+TEST_F(QuantraComparisonTest, FixedRateBond_YieldBatchMatchesBondFunctions) {
+    std::cout << "\n--- Test: Bond yield batch vs BondFunctions ---\n";
+
+    struct Spec { QuantLib::Date issue, maturity; QuantLib::Frequency freq; double coupon; int exDays; };
+    std::vector<Spec> specs = {
+        {QuantLib::Date(15, QuantLib::January, 2024), QuantLib::Date(15, QuantLib::January, 2029), QuantLib::Annual, 0.05, 0},
+        {QuantLib::Date(3, QuantLib::March, 2023), QuantLib::Date(3, QuantLib::September, 2032), QuantLib::Semiannual, 0.0325, 0},
+        {QuantLib::Date(20, QuantLib::November, 2024), QuantLib::Date(17, QuantLib::February, 2030), QuantLib::Quarterly, 0.045, 0},
+        {QuantLib::Date(17, QuantLib::January, 2022), QuantLib::Date(17, QuantLib::January, 2031), QuantLib::Semiannual, 0.04, 7},
+    };
+    std::vector<BondYieldBatch::Convention> conventions = {
+        {QuantLib::ActualActual(QuantLib::ActualActual::ISMA), QuantLib::Compounded, QuantLib::Semiannual},
+        {QuantLib::Thirty360(QuantLib::Thirty360::BondBasis), QuantLib::Compounded, QuantLib::Annual},
+        {QuantLib::Actual365Fixed(), QuantLib::Continuous, QuantLib::Annual},
+        {QuantLib::Actual360(), QuantLib::SimpleThenCompounded, QuantLib::Quarterly},
+    };
+
+    BondYieldBatch analytics;
+    BondBatch batch;
+    for (const Spec& sp : specs) {
+        QuantLib::Schedule sch(sp.issue, sp.maturity, QuantLib::Period(sp.freq), QuantLib::TARGET(),
+            QuantLib::Unadjusted, QuantLib::Unadjusted, QuantLib::DateGeneration::Backward, false);
+        auto bond = std::make_shared<QuantLib::FixedRateBond>(
+            2, 100.0, sch, std::vector<QuantLib::Rate>(1, sp.coupon),
+            QuantLib::ActualActual(QuantLib::ActualActual::ISMA), QuantLib::Following, 100.0,
+            sp.issue, QuantLib::Calendar(), QuantLib::Period(sp.exDays, QuantLib::Days));
+        bond->setPricingEngine(std::make_shared<QuantLib::DiscountingBondEngine>(discountHandle_));
+        const double clean = bond->cleanPrice();
+
+        const size_t b = batch.add(bond, bootstrappedCurve_, evaluationDate_);
+        batch.price();
+        EXPECT_NEAR(batch.result(b).bps, QuantLib::BondFunctions::bps(*bond, *bootstrappedCurve_, evaluationDate_), 1e-12);
+
+        for (const auto& c : conventions) {
+            const size_t iy = analytics.add(bond, bond->settlementDate(), c);
+            const size_t ir = analytics.add(bond, evaluationDate_, c);
+
+            const double y = analytics.yield(iy, clean);
+            const double qlY = QuantLib::BondFunctions::yield(*bond, QuantLib::Bond::Price(clean, QuantLib::Bond::Price::Clean),
+                c.dayCounter, c.compounding, c.frequency, bond->settlementDate(), 1.0e-10, 100, 0.05);
+            EXPECT_NEAR(y, qlY, 1e-9);
+
+            // Macaulay duration needs a compounded rate, as in QuantLib
+            if (c.compounding != QuantLib::Compounded) {
+                EXPECT_THROW(analytics.risk(ir, qlY), QuantLib::Error);
+                continue;
+            }
+            const QuantLib::InterestRate rate(qlY, c.dayCounter, c.compounding, c.frequency);
+            const auto risk = analytics.risk(ir, qlY);
+            EXPECT_NEAR(risk.modifiedDuration,
+                QuantLib::BondFunctions::duration(*bond, rate, QuantLib::Duration::Modified, evaluationDate_), 1e-10);
+            EXPECT_NEAR(risk.macaulayDuration,
+                QuantLib::BondFunctions::duration(*bond, rate, QuantLib::Duration::Macaulay, evaluationDate_), 1e-10);
+            EXPECT_NEAR(risk.convexity, QuantLib::BondFunctions::convexity(*bond, rate, evaluationDate_), 1e-9);
+        }
+    }
+}
+
+TEST_F(QuantraComparisonTest, BondYieldAnalytics_MatchesBondFunctions) {
+    std::cout << "\n--- Test: BondYieldAnalytics vs BondFunctions ---\n";
+
+    flatbuffers::grpc::MessageBuilder b;
+    auto makeBond = [&](const char* issue, const char* maturity) {
+        auto eff = b.CreateString(issue);
+        auto term = b.CreateString(maturity);
+        quantra::ScheduleBuilder sb(b);
+        sb.add_effective_date(eff);
+        sb.add_termination_date(term);
+        sb.add_calendar(quantra::enums::Calendar_TARGET);
+        sb.add_frequency(quantra::enums::Frequency_Annual);
+        sb.add_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        sb.add_termination_date_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        sb.add_date_generation_rule(quantra::enums::DateGenerationRule_Backward);
+        sb.add_end_of_month(false);
+        auto schedule = sb.Finish();
+
+        auto idate = b.CreateString(issue);
+        quantra::FixedRateBondBuilder bb(b);
+        bb.add_settlement_days(2);
+        bb.add_face_amount(100.0);
+        bb.add_schedule(schedule);
+        bb.add_rate(0.05);
+        bb.add_accrual_day_counter(quantra::enums::DayCounter_ActualActual);
+        bb.add_issue_date(idate);
+        bb.add_redemption(100.0);
+        bb.add_payment_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        return bb.Finish();
+    };
+    auto makeQuote = [&](flatbuffers::Offset<quantra::FixedRateBond> bond, quantra::BondQuoteType type, double value) {
+        auto yield = buildYield(b);
+        quantra::BondYieldQuoteBuilder qb(b);
+        qb.add_fixed_rate_bond(bond);
+        qb.add_yield(yield);
+        qb.add_quote_type(type);
+        if (type == quantra::BondQuoteType_CleanPrice) qb.add_clean_price(value);
+        else qb.add_yield_rate(value);
+        return qb.Finish();
+    };
+
+    std::vector<flatbuffers::Offset<quantra::BondYieldQuote>> quotes = {
+        makeQuote(makeBond("2024-01-15", "2029-01-15"), quantra::BondQuoteType_CleanPrice, 101.25),
+        makeQuote(makeBond("2024-01-15", "2029-01-15"), quantra::BondQuoteType_Yield, 0.0425),
+        // Matured: not tradable at settlement
+        makeQuote(makeBond("2019-06-01", "2024-06-01"), quantra::BondQuoteType_CleanPrice, 100.0),
+    };
+    auto quotesVec = b.CreateVector(quotes);
+    auto asof = b.CreateString("2025-01-15");
+    quantra::BondYieldAnalyticsRequestBuilder rb(b);
+    rb.add_as_of_date(asof);
+    rb.add_settlement_date(asof);
+    rb.add_bonds(quotesVec);
+    b.Finish(rb.Finish());
+
+    BondYieldAnalyticsRequestHandler handler;
+    auto respB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+    auto resp = handler.request(respB, flatbuffers::GetRoot<quantra::BondYieldAnalyticsRequest>(b.GetBufferPointer()));
+    respB->Finish(resp);
+    auto response = flatbuffers::GetRoot<quantra::BondYieldAnalyticsResponse>(respB->GetBufferPointer());
+    ASSERT_EQ(response->results()->size(), 3u);
+
+    // QuantLib reference
+    QuantLib::Schedule sch(QuantLib::Date(15, QuantLib::January, 2024), QuantLib::Date(15, QuantLib::January, 2029),
+        QuantLib::Period(QuantLib::Annual), QuantLib::TARGET(), QuantLib::Unadjusted, QuantLib::Unadjusted,
+        QuantLib::DateGeneration::Backward, false);
+    QuantLib::FixedRateBond qlBond(2, 100.0, sch, std::vector<QuantLib::Rate>(1, 0.05),
+        QuantLib::ActualActual(QuantLib::ActualActual::ISDA), QuantLib::Unadjusted, 100.0,
+        QuantLib::Date(15, QuantLib::January, 2024));
+    const QuantLib::DayCounter dc = QuantLib::Actual360();
+    const QuantLib::Date settlement = qlBond.settlementDate();
+
+    auto price = response->results()->Get(0);
+    ASSERT_EQ(price->error(), nullptr);
+    const double qlYield = QuantLib::BondFunctions::yield(qlBond,
+        QuantLib::Bond::Price(101.25, QuantLib::Bond::Price::Clean), dc, QuantLib::Compounded, QuantLib::Annual,
+        settlement, 1.0e-10, 100, 0.05);
+    EXPECT_NEAR(price->yield(), qlYield, 1e-9);
+    EXPECT_NEAR(price->accrued_amount(), qlBond.accruedAmount(settlement), 1e-12);
+    EXPECT_NEAR(price->dirty_price(), 101.25 + qlBond.accruedAmount(settlement), 1e-12);
+
+    const QuantLib::InterestRate rate(price->yield(), dc, QuantLib::Compounded, QuantLib::Annual);
+    EXPECT_NEAR(price->modified_duration(),
+        QuantLib::BondFunctions::duration(qlBond, rate, QuantLib::Duration::Modified, evaluationDate_), 1e-10);
+    EXPECT_NEAR(price->macaulay_duration(),
+        QuantLib::BondFunctions::duration(qlBond, rate, QuantLib::Duration::Macaulay, evaluationDate_), 1e-10);
+    EXPECT_NEAR(price->convexity(), QuantLib::BondFunctions::convexity(qlBond, rate, evaluationDate_), 1e-9);
+
+    auto fromYield = response->results()->Get(1);
+    ASSERT_EQ(fromYield->error(), nullptr);
+    const QuantLib::InterestRate quoted(0.0425, dc, QuantLib::Compounded, QuantLib::Annual);
+    EXPECT_NEAR(fromYield->clean_price(), QuantLib::BondFunctions::cleanPrice(qlBond, quoted, settlement), 1e-10);
+    EXPECT_NEAR(fromYield->dirty_price(), QuantLib::BondFunctions::dirtyPrice(qlBond, quoted, settlement), 1e-10);
+    EXPECT_EQ(fromYield->settlement_date()->str(), "2025-01-17");
+
+    EXPECT_NE(response->results()->Get(2)->error(), nullptr);
+}
+
+TEST_F(QuantraComparisonTest, FixedRateBond_ZSpreadBatchMatchesBondFunctions) {
+    std::cout << "\n--- Test: Z-spread batch vs BondFunctions ---\n";
+
+    struct Spec { QuantLib::Date issue, maturity; QuantLib::Frequency freq; double coupon; double clean; };
+    std::vector<Spec> specs = {
+        {QuantLib::Date(15, QuantLib::January, 2024), QuantLib::Date(15, QuantLib::January, 2029), QuantLib::Annual, 0.05, 101.5},
+        {QuantLib::Date(3, QuantLib::March, 2023), QuantLib::Date(3, QuantLib::September, 2032), QuantLib::Semiannual, 0.0325, 94.0},
+        {QuantLib::Date(20, QuantLib::November, 2024), QuantLib::Date(17, QuantLib::February, 2030), QuantLib::Quarterly, 0.045, 99.75},
+    };
+    std::vector<ZSpreadBatch::Quote> conventions = {
+        {0.0, QuantLib::Continuous, QuantLib::Annual},
+        {0.0, QuantLib::Compounded, QuantLib::Semiannual},
+        {0.0, QuantLib::Simple, QuantLib::Annual},
+    };
+
+    ZSpreadBatch spreads;
+    std::vector<std::shared_ptr<QuantLib::FixedRateBond>> bonds;
+    std::vector<ZSpreadBatch::Quote> quotes;
+    for (const Spec& sp : specs) {
+        QuantLib::Schedule sch(sp.issue, sp.maturity, QuantLib::Period(sp.freq), QuantLib::TARGET(),
+            QuantLib::Unadjusted, QuantLib::Unadjusted, QuantLib::DateGeneration::Backward, false);
+        auto bond = std::make_shared<QuantLib::FixedRateBond>(
+            2, 100.0, sch, std::vector<QuantLib::Rate>(1, sp.coupon),
+            QuantLib::ActualActual(QuantLib::ActualActual::ISMA), QuantLib::Following, 100.0, sp.issue);
+        for (ZSpreadBatch::Quote q : conventions) {
+            q.cleanPrice = sp.clean;
+            spreads.add(bond, bootstrappedCurve_, q);
+            bonds.push_back(bond);
+            quotes.push_back(q);
+        }
+    }
+    spreads.solve();
+
+    for (size_t i = 0; i < spreads.size(); i++) {
+        const auto& q = quotes[i];
+        const double qlSpread = QuantLib::BondFunctions::zSpread(*bonds[i],
+            QuantLib::Bond::Price(q.cleanPrice, QuantLib::Bond::Price::Clean), bootstrappedCurve_,
+            bootstrappedCurve_->dayCounter(), q.compounding, q.frequency, bonds[i]->settlementDate(),
+            1.0e-10, 100, 0.0);
+        EXPECT_NEAR(spreads.zSpread(i), qlSpread, 1e-9);
+    }
+}
+
+TEST_F(QuantraComparisonTest, InstrumentCache_KeysOnTradeContent) {
+    std::cout << "\n--- Test: Instrument cache keys ---\n";
+
+    // Same trade, fields written in a different order into different buffers
+    auto buildBond = [](flatbuffers::FlatBufferBuilder& b, double rate, bool reversed) {
+        auto eff = b.CreateString("2024-01-15");
+        auto term = b.CreateString("2029-01-15");
+        quantra::ScheduleBuilder sb(b);
+        sb.add_effective_date(eff);
+        sb.add_termination_date(term);
+        sb.add_calendar(quantra::enums::Calendar_TARGET);
+        sb.add_frequency(quantra::enums::Frequency_Annual);
+        sb.add_date_generation_rule(quantra::enums::DateGenerationRule_Backward);
+        auto schedule = sb.Finish();
+        auto issue = b.CreateString("2024-01-15");
+        quantra::FixedRateBondBuilder bb(b);
+        if (reversed) {
+            bb.add_schedule(schedule);
+            bb.add_issue_date(issue);
+            bb.add_rate(rate);
+            bb.add_face_amount(100.0);
+            bb.add_settlement_days(2);
+        } else {
+            bb.add_settlement_days(2);
+            bb.add_face_amount(100.0);
+            bb.add_rate(rate);
+            bb.add_issue_date(issue);
+            bb.add_schedule(schedule);
+        }
+        b.Finish(bb.Finish());
+        return flatbuffers::GetRoot<quantra::FixedRateBond>(b.GetBufferPointer());
+    };
+
+    flatbuffers::FlatBufferBuilder b1, b2, b3;
+    const std::string k1 = InstrumentKeyBuilder::fixedRateBond(buildBond(b1, 0.05, false));
+    const std::string k2 = InstrumentKeyBuilder::fixedRateBond(buildBond(b2, 0.05, true));
+    const std::string k3 = InstrumentKeyBuilder::fixedRateBond(buildBond(b3, 0.0501, false));
+    EXPECT_EQ(k1, k2);
+    EXPECT_NE(k1, k3);
+    EXPECT_EQ(k1.rfind("ins:v1:frb:", 0), 0u);
+
+    // A hit hands back the same instrument; relinking its handle moves its
+    // floating leg onto the new curve
+    InstrumentCache& cache = InstrumentCache::instance();
+    cache.clear();
+    QuantLib::RelinkableHandle<QuantLib::YieldTermStructure> forwarding;
+    auto index = std::make_shared<QuantLib::Euribor6M>(forwarding);
+    QuantLib::Schedule sch(QuantLib::Date(15, QuantLib::January, 2025), QuantLib::Date(15, QuantLib::January, 2030),
+        QuantLib::Period(QuantLib::Semiannual), QuantLib::TARGET(), QuantLib::ModifiedFollowing,
+        QuantLib::ModifiedFollowing, QuantLib::DateGeneration::Forward, false);
+    auto swap = std::make_shared<QuantLib::VanillaSwap>(QuantLib::VanillaSwap::Payer, 1.0e6, sch, 0.03,
+        QuantLib::Thirty360(QuantLib::Thirty360::BondBasis), sch, index, 0.0, QuantLib::Actual360());
+    swap->setPricingEngine(std::make_shared<QuantLib::DiscountingSwapEngine>(discountHandle_));
+    forwarding.linkTo(bootstrappedCurve_);
+    cache.put(k1, InstrumentCache::Entry{swap, forwarding});
+    const double npv = swap->NPV();
+
+    InstrumentCache::Entry* hit = cache.get(k1);
+    ASSERT_NE(hit, nullptr);
+    EXPECT_EQ(hit->instrument, swap);
+    auto shifted = std::make_shared<QuantLib::ZeroSpreadedTermStructure>(
+        discountHandle_, QuantLib::Handle<QuantLib::Quote>(std::make_shared<QuantLib::SimpleQuote>(0.001)));
+    hit->forwarding.linkTo(shifted);
+    EXPECT_GT(swap->NPV(), npv);
+    EXPECT_EQ(cache.get(k3), nullptr);
+    cache.clear();
+}
+
+TEST_F(QuantraComparisonTest, TradeStore_PriceByIdMatchesInline) {
+    std::cout << "\n--- Test: Stored trades priced by id and book ---\n";
+
+    auto buildBond = [](flatbuffers::FlatBufferBuilder& b, double rate) {
+        auto eff = b.CreateString("2024-01-15");
+        auto term = b.CreateString("2029-01-15");
+        quantra::ScheduleBuilder sb(b);
+        sb.add_effective_date(eff);
+        sb.add_termination_date(term);
+        sb.add_calendar(quantra::enums::Calendar_TARGET);
+        sb.add_frequency(quantra::enums::Frequency_Annual);
+        sb.add_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        sb.add_termination_date_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        sb.add_date_generation_rule(quantra::enums::DateGenerationRule_Backward);
+        auto schedule = sb.Finish();
+        auto issue = b.CreateString("2024-01-15");
+        quantra::FixedRateBondBuilder bb(b);
+        bb.add_settlement_days(2);
+        bb.add_face_amount(100.0);
+        bb.add_schedule(schedule);
+        bb.add_rate(rate);
+        bb.add_accrual_day_counter(quantra::enums::DayCounter_ActualActual);
+        bb.add_issue_date(issue);
+        bb.add_redemption(100.0);
+        bb.add_payment_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+        return bb.Finish();
+    };
+
+    TradeStore& store = TradeStore::instance();
+    store.clear();
+
+    // Upsert two bonds into one book; a trade without a product is rejected
+    {
+        flatbuffers::grpc::MessageBuilder b;
+        std::vector<flatbuffers::Offset<quantra::StoredTrade>> trades;
+        const double rates[] = {0.04, 0.05};
+        for (int i = 0; i < 2; i++) {
+            auto bond = buildBond(b, rates[i]);
+            auto id = b.CreateString("BOND-" + std::to_string(i));
+            auto book = b.CreateString("BOOK-A");
+            quantra::StoredTradeBuilder tb(b);
+            tb.add_id(id);
+            tb.add_book_id(book);
+            tb.add_fixed_rate_bond(bond);
+            trades.push_back(tb.Finish());
+        }
+        auto emptyId = b.CreateString("EMPTY");
+        quantra::StoredTradeBuilder eb(b);
+        eb.add_id(emptyId);
+        trades.push_back(eb.Finish());
+        auto tradesVec = b.CreateVector(trades);
+        quantra::UpsertTradesRequestBuilder rb(b);
+        rb.add_trades(tradesVec);
+        b.Finish(rb.Finish());
+
+        UpsertTradesRequestHandler handler;
+        auto respB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        respB->Finish(handler.request(respB, flatbuffers::GetRoot<quantra::UpsertTradesRequest>(b.GetBufferPointer())));
+        auto resp = flatbuffers::GetRoot<quantra::UpsertTradesResponse>(respB->GetBufferPointer());
+        EXPECT_EQ(resp->stored(), 2);
+        ASSERT_EQ(resp->rejected()->size(), 1u);
+        EXPECT_EQ(resp->rejected()->Get(0)->id()->str(), "EMPTY");
+        EXPECT_EQ(resp->trade_count(), 2);
+    }
+    EXPECT_EQ(store.get<quantra::FixedRateBond>("BOND-1")->rate(), 0.05);
+    EXPECT_THROW(store.get<quantra::VanillaSwap>("BOND-1"), std::exception);
+
+    // Price inline, by trade id and by book in one request
+    auto price = [&]() {
+        flatbuffers::grpc::MessageBuilder b;
+        auto ts = buildCurve(b, "discount");
+        auto curves = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{ts});
+        auto indices = buildIndicesVector(b);
+        auto asof = b.CreateString("2025-01-15");
+        quantra::PricingBuilder pb(b);
+        pb.add_as_of_date(asof);
+        pb.add_settlement_date(asof);
+        pb.add_indices(indices);
+        pb.add_curves(curves);
+        auto pricing = pb.Finish();
+
+        std::vector<flatbuffers::Offset<quantra::PriceFixedRateBond>> entries;
+        {
+            auto bond = buildBond(b, 0.05);
+            auto dc = b.CreateString("discount");
+            quantra::PriceFixedRateBondBuilder pfb(b);
+            pfb.add_fixed_rate_bond(bond);
+            pfb.add_discounting_curve(dc);
+            entries.push_back(pfb.Finish());
+        }
+        {
+            auto id = b.CreateString("BOND-1");
+            auto dc = b.CreateString("discount");
+            quantra::PriceFixedRateBondBuilder pfb(b);
+            pfb.add_trade_id(id);
+            pfb.add_discounting_curve(dc);
+            entries.push_back(pfb.Finish());
+        }
+        {
+            auto book = b.CreateString("BOOK-A");
+            auto dc = b.CreateString("discount");
+            quantra::PriceFixedRateBondBuilder pfb(b);
+            pfb.add_book_id(book);
+            pfb.add_discounting_curve(dc);
+            entries.push_back(pfb.Finish());
+        }
+        auto bonds = b.CreateVector(entries);
+        quantra::PriceFixedRateBondRequestBuilder rb(b);
+        rb.add_pricing(pricing);
+        rb.add_bonds(bonds);
+        b.Finish(rb.Finish());
+
+        FixedRateBondPricingRequest req;
+        auto respB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        respB->Finish(req.request(respB, flatbuffers::GetRoot<quantra::PriceFixedRateBondRequest>(b.GetBufferPointer())));
+        std::vector<std::pair<std::string, double>> out;
+        for (auto r : *flatbuffers::GetRoot<quantra::PriceFixedRateBondResponse>(respB->GetBufferPointer())->bonds()) {
+            out.emplace_back(r->trade_id() ? r->trade_id()->str() : std::string(), r->npv());
+        }
+        return out;
+    };
+
+    auto priced = price();
+    ASSERT_EQ(priced.size(), 4u);
+    EXPECT_EQ(priced[0].first, "");
+    EXPECT_EQ(priced[1].first, "BOND-1");
+    EXPECT_EQ(priced[2].first, "BOND-0");
+    EXPECT_EQ(priced[3].first, "BOND-1");
+    EXPECT_NEAR(priced[1].second, priced[0].second, 1e-12);
+    EXPECT_NEAR(priced[3].second, priced[0].second, 1e-12);
+    EXPECT_LT(priced[2].second, priced[0].second);
+
+    // Delete the book; a reference to a deleted trade is an error
+    {
+        flatbuffers::grpc::MessageBuilder b;
+        auto books = b.CreateVectorOfStrings(std::vector<std::string>{"BOOK-A"});
+        quantra::DeleteTradesRequestBuilder rb(b);
+        rb.add_book_ids(books);
+        b.Finish(rb.Finish());
+
+        DeleteTradesRequestHandler handler;
+        auto respB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        respB->Finish(handler.request(respB, flatbuffers::GetRoot<quantra::DeleteTradesRequest>(b.GetBufferPointer())));
+        auto resp = flatbuffers::GetRoot<quantra::DeleteTradesResponse>(respB->GetBufferPointer());
+        EXPECT_EQ(resp->deleted(), 2);
+        EXPECT_EQ(resp->trade_count(), 0);
+    }
+    EXPECT_THROW(price(), std::exception);
+    store.clear();
+}
+
+TEST_F(QuantraComparisonTest, OptionBatch_MatchesEnginesAndCalculators) {
+    std::cout << "\n--- Test: Batched Black/Bachelier kernels vs QuantLib ---\n";
+
+    // Caps, floors and collars against the cap/floor engines
+    QuantLib::Date start = evaluationDate_ + 2, end = start + QuantLib::Period(10, QuantLib::Years);
+    QuantLib::Schedule sch(start, end, QuantLib::Period(QuantLib::Quarterly), QuantLib::TARGET(),
+        QuantLib::ModifiedFollowing, QuantLib::ModifiedFollowing, QuantLib::DateGeneration::Forward, false);
+    auto idx = std::make_shared<QuantLib::Euribor3M>(forwardHandle_);
+    QuantLib::Leg leg = QuantLib::IborLeg(sch, idx).withNotionals(1.0e6)
+        .withPaymentDayCounter(QuantLib::Actual360()).withFixingDays(2);
+    std::vector<std::shared_ptr<QuantLib::CapFloor>> trades = {
+        std::make_shared<QuantLib::Cap>(leg, std::vector<QuantLib::Rate>(1, 0.03)),
+        std::make_shared<QuantLib::Floor>(leg, std::vector<QuantLib::Rate>(1, 0.025)),
+        std::make_shared<QuantLib::Collar>(leg, std::vector<QuantLib::Rate>(1, 0.035),
+                                           std::vector<QuantLib::Rate>(1, 0.02)),
+    };
+
+    auto makeVol = [&](double vol, QuantLib::VolatilityType type, double displacement) {
+        OptionletVolEntry entry;
+        entry.handle = QuantLib::Handle<QuantLib::OptionletVolatilityStructure>(
+            std::make_shared<QuantLib::ConstantOptionletVolatility>(evaluationDate_, QuantLib::TARGET(),
+                QuantLib::ModifiedFollowing, vol, QuantLib::Actual365Fixed(), type, displacement));
+        entry.qlVolType = type;
+        entry.displacement = displacement;
+        entry.constantVol = vol;
+        entry.referenceDate = evaluationDate_;
+        return entry;
+    };
+    const OptionletVolEntry shifted = makeVol(0.18, QuantLib::ShiftedLognormal, 0.01);
+    const OptionletVolEntry normal = makeVol(0.0085, QuantLib::Normal, 0.0);
+
+    flatbuffers::grpc::MessageBuilder b;
+    auto shiftedModel = flatbuffers::GetTemporaryPointer(b,
+        buildCapFloorModel(b, "shifted", quantra::enums::IrModelType_ShiftedBlack));
+    auto normalModel = flatbuffers::GetTemporaryPointer(b,
+        buildCapFloorModel(b, "normal", quantra::enums::IrModelType_Bachelier));
+
+    CapFloorBatch batch;
+    std::vector<double> expected;
+    for (const auto& trade : trades) {
+        trade->setPricingEngine(std::make_shared<QuantLib::BlackCapFloorEngine>(discountHandle_, shifted.handle));
+        expected.push_back(trade->NPV());
+        batch.add(trade, discountHandle_.currentLink(), shifted, shiftedModel);
+
+        trade->setPricingEngine(std::make_shared<QuantLib::BachelierCapFloorEngine>(discountHandle_, normal.handle));
+        expected.push_back(trade->NPV());
+        batch.add(trade, discountHandle_.currentLink(), normal, normalModel);
+    }
+    batch.price();
+    ASSERT_EQ(batch.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_NEAR(batch.npv(i), expected[i], 1e-8 * std::max(1.0, std::abs(expected[i])));
+    }
+    EXPECT_THROW(batch.add(trades[0], discountHandle_.currentLink(), normal, shiftedModel), std::exception);
+
+    // Swaption greeks against Black/BachelierCalculator
+    struct Case { QuantLib::Option::Type type; double strike, forward, stdDev, annuity, displacement, time; };
+    const std::vector<Case> cases = {
+        {QuantLib::Option::Call, 0.030, 0.032, 0.20, 4.2, 0.00, 2.0},
+        {QuantLib::Option::Put, 0.030, 0.032, 0.35, 4.2, 0.00, 5.0},
+        {QuantLib::Option::Call, -0.002, 0.001, 0.15, 7.9, 0.02, 1.0},
+        {QuantLib::Option::Put, 0.001, 0.001, 0.00, 7.9, 0.02, 1.0},   // zero stdDev: QuantLib path
+    };
+    BlackBatch black, bachelier;
+    for (const auto& c : cases) {
+        black.add(c.type, BlackBatch::Model::Black, c.strike, c.forward, c.stdDev, c.annuity, c.displacement, c.time);
+        bachelier.add(c.type, BlackBatch::Model::Bachelier, c.strike, c.forward, c.stdDev * 0.05, c.annuity, 0.0, c.time);
+    }
+    black.priceWithGreeks();
+    bachelier.priceWithGreeks();
+    for (size_t i = 0; i < cases.size(); i++) {
+        const Case& c = cases[i];
+        const double f = c.forward + c.displacement;
+        QuantLib::BlackCalculator bc(c.type, c.strike + c.displacement, f, c.stdDev, c.annuity);
+        EXPECT_NEAR(black.value(i), QuantLib::blackFormula(c.type, c.strike, c.forward, c.stdDev,
+                                                           c.annuity, c.displacement), 1e-12);
+        EXPECT_NEAR(black.deltaForward(i), bc.deltaForward(), 1e-12);
+        EXPECT_NEAR(black.gammaForward(i), bc.gammaForward(), 1e-9);
+        EXPECT_NEAR(black.vega(i), bc.vega(c.time), 1e-12);
+        EXPECT_NEAR(black.theta(i), bc.theta(f, c.time), 1e-12);
+
+        QuantLib::BachelierCalculator nc(c.type, c.strike, c.forward, c.stdDev * 0.05, c.annuity);
+        EXPECT_NEAR(bachelier.value(i), QuantLib::bachelierBlackFormula(c.type, c.strike, c.forward,
+                                                                        c.stdDev * 0.05, c.annuity), 1e-12);
+        EXPECT_NEAR(bachelier.deltaForward(i), nc.deltaForward(), 1e-12);
+        EXPECT_NEAR(bachelier.gammaForward(i), nc.gammaForward(), 1e-8);
+        EXPECT_NEAR(bachelier.vega(i), nc.vega(c.time), 1e-12);
+        EXPECT_NEAR(bachelier.theta(i), nc.theta(c.forward, c.time), 1e-12);
+    }
+}
+
+TEST_F(QuantraComparisonTest, SabrCalibration_RecoversParamsAndCaches) {
+    std::cout << "\n--- Test: SABR swaption cube calibration ---\n";
+
+    const double shift = 0.01, beta = 0.5;
+    const std::vector<double> spreads = {-0.01, -0.005, -0.0025, 0.0, 0.0025, 0.005, 0.01};
+    struct Node { double time, forward, alpha, rho, nu; };
+
+    // Smiles quoted off known parameters, spreads over each node's ATM
+    SwaptionVolEntry entry;
+    entry.qlVolType = QuantLib::ShiftedLognormal;
+    entry.displacement = shift;
+    entry.referenceDate = evaluationDate_;
+    entry.calendar = QuantLib::TARGET();
+    entry.businessDayConvention = QuantLib::ModifiedFollowing;
+    entry.dayCounter = QuantLib::Actual365Fixed();
+    entry.volKind = quantra::enums::SwaptionVolKind_SabrCalibrate;
+    entry.strikeKind = quantra::enums::SwaptionStrikeKind_SpreadFromATM;
+    entry.swapIndexId = "EUR_SWAP";
+    entry.expiries = {QuantLib::Period(1, QuantLib::Years), QuantLib::Period(5, QuantLib::Years)};
+    entry.tenors = {QuantLib::Period(10, QuantLib::Years)};
+    entry.strikes = spreads;
+    entry.sabrBetaFixed = true;
+    entry.sabrBetaValue = beta;
+    entry.nExp = 2;
+    entry.nTen = 1;
+    entry.nStrikes = static_cast<int>(spreads.size());
+
+    std::vector<Node> nodes;
+    std::vector<double> atms;
+    for (size_t i = 0; i < entry.expiries.size(); i++) {
+        const QuantLib::Date d = entry.calendar.advance(evaluationDate_, entry.expiries[i], entry.businessDayConvention);
+        const double t = entry.dayCounter.yearFraction(evaluationDate_, d);
+        nodes.push_back(i == 0 ? Node{t, 0.025, 0.045, -0.25, 0.45} : Node{t, 0.031, 0.038, -0.1, 0.3});
+        atms.push_back(nodes.back().forward);
+    }
+    std::vector<SabrSmile> smiles;
+    for (const Node& n : nodes) {
+        SabrSmile smile;
+        smile.time = n.time;
+        smile.forward = n.forward;
+        for (double s : spreads) {
+            smile.strikes.push_back(n.forward + s);
+            smile.vols.push_back(QuantLib::shiftedSabrVolatility(n.forward + s, n.forward, n.time,
+                                                                 n.alpha, beta, n.nu, n.rho, shift));
+            entry.volsFlat.push_back(smile.vols.back());
+        }
+        smiles.push_back(smile);
+    }
+
+    SabrCalibrationCache::instance().clear();
+    SabrCalibrationCache::instance().resetStats();
+    SabrCalibrator calibrator(QuantLib::ShiftedLognormal, shift, beta, true);
+    const std::vector<SabrParams> params = calibrator.calibrate(smiles);
+    ASSERT_EQ(params.size(), nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        EXPECT_NEAR(params[i].alpha, nodes[i].alpha, 1e-4);
+        EXPECT_NEAR(params[i].rho, nodes[i].rho, 1e-3);
+        EXPECT_NEAR(params[i].nu, nodes[i].nu, 1e-3);
+        EXPECT_DOUBLE_EQ(params[i].beta, beta);
+        EXPECT_LT(params[i].rmsError, 1e-6);
+    }
+
+    // The cube reprices the node quotes; a rebuild on the same ATMs hits the cache
+    SwaptionVolEntry cube = withSwaptionSabrAtm(entry, atms);
+    const uint64_t hits = SabrCalibrationCache::instance().stats().hits;
+    withSwaptionSabrAtm(entry, atms);
+    EXPECT_EQ(SabrCalibrationCache::instance().stats().hits, hits + 1);
+    ASSERT_FALSE(cube.handle.empty());
+    const double tenorTime = entry.dayCounter.yearFraction(evaluationDate_,
+        entry.calendar.advance(evaluationDate_, entry.tenors[0], entry.businessDayConvention));
+    for (size_t i = 0; i < nodes.size(); i++) {
+        EXPECT_NEAR(cube.sabrAlpha[i], params[i].alpha, 1e-8);
+        for (size_t k = 0; k < spreads.size(); k++) {
+            EXPECT_NEAR(cube.handle->volatility(nodes[i].time, tenorTime, atms[i] + spreads[k]),
+                        smiles[i].vols[k], 1e-6);
+        }
+        EXPECT_NEAR(cube.handle->smileSection(nodes[i].time, tenorTime)->atmLevel(), atms[i], 1e-15);
+    }
+    EXPECT_NEAR(cube.handle->shift(nodes[0].time, tenorTime), shift, 1e-15);
+
+    // Bumped quotes leave the handle to be rebuilt on recalibration
+    SwaptionVolEntry bumped = bumpSwaptionVolEntry(cube, 0.001);
+    EXPECT_TRUE(bumped.handle.empty());
+    EXPECT_TRUE(bumped.atmForwardsFlat.empty());
+}
+
+TEST_F(QuantraComparisonTest, AtmForwardGrid_MatchesSwapFairRates) {
+    std::cout << "\n--- Test: Analytic ATM forward grid vs swap fair rates ---\n";
+
+    IndexRegistry indices;
+    indices.put("EUR6M", std::make_shared<QuantLib::Euribor6M>());
+    indices.put("ESTR", std::make_shared<QuantLib::Estr>());
+
+    SwapIndexRuntime ibor;
+    ibor.spotDays = 2;
+    ibor.floatIndexId = "EUR6M";
+    SwapIndexRuntime ois = ibor;
+    ois.kind = quantra::SwapIndexKind_OisSwapIndex;
+    ois.floatIndexId = "ESTR";
+    ois.fixedDayCounter = QuantLib::Actual360();
+
+    // Today's exercise needs today's Euribor fixing and goes through the swap
+    const std::vector<QuantLib::Date> exercises = {
+        evaluationDate_, evaluationDate_ + 7,
+        evaluationDate_ + QuantLib::Period(1, QuantLib::Years),
+        evaluationDate_ + QuantLib::Period(3, QuantLib::Years)};
+    const std::vector<QuantLib::Period> tenors = {
+        QuantLib::Period(1, QuantLib::Years), QuantLib::Period(2, QuantLib::Years),
+        QuantLib::Period(5, QuantLib::Years)};
+
+    for (const SwapIndexRuntime* sidx : {&ibor, &ois}) {
+        const std::vector<double> atms = computeServerAtmForwardsForExerciseDates(
+            exercises, tenors, *sidx, indices, discountHandle_, forwardHandle_);
+        ASSERT_EQ(atms.size(), exercises.size() * tenors.size());
+
+        for (size_t i = 0; i < exercises.size(); i++) {
+            QuantLib::Date exercise = sidx->fixedCalendar.adjust(exercises[i], sidx->fixedBdc);
+            QuantLib::Date start = sidx->fixedCalendar.advance(exercise, sidx->spotDays, QuantLib::Days, sidx->fixedBdc);
+            for (size_t j = 0; j < tenors.size(); j++) {
+                QuantLib::Schedule fixedSch(start, sidx->fixedCalendar.advance(start, tenors[j], sidx->fixedTermBdc),
+                    QuantLib::Period(sidx->fixedFrequency), sidx->fixedCalendar, sidx->fixedBdc,
+                    sidx->fixedTermBdc, sidx->fixedDateRule, sidx->fixedEom);
+                double expected = 0.0;
+                if (sidx == &ois) {
+                    QuantLib::OvernightIndexedSwap swap(QuantLib::Swap::Payer, 1.0, fixedSch, 0.0,
+                        sidx->fixedDayCounter, std::make_shared<QuantLib::Estr>(forwardHandle_));
+                    swap.setPricingEngine(std::make_shared<QuantLib::DiscountingSwapEngine>(discountHandle_));
+                    expected = swap.fairRate();
+                } else {
+                    QuantLib::Schedule floatSch(start, fixedSch.endDate(), sidx->floatTenor, sidx->floatCalendar,
+                        sidx->floatBdc, sidx->floatTermBdc, sidx->floatDateRule, sidx->floatEom);
+                    auto euribor = std::make_shared<QuantLib::Euribor6M>(forwardHandle_);
+                    QuantLib::VanillaSwap swap(QuantLib::VanillaSwap::Payer, 1.0, fixedSch, 0.0,
+                        sidx->fixedDayCounter, floatSch, euribor, 0.0, euribor->dayCounter());
+                    swap.setPricingEngine(std::make_shared<QuantLib::DiscountingSwapEngine>(discountHandle_));
+                    expected = swap.fairRate();
+                }
+                EXPECT_NEAR(atms[i * tenors.size() + j], expected, 1e-12);
+            }
+        }
+    }
+}
+
+TEST_F(QuantraComparisonTest, SwaptionVolFinalizer_SharesEntriesPerScenario) {
+    std::cout << "\n--- Test: Memoized swaption vol finalization ---\n";
+
+    PricingRegistry reg;
+    reg.indices.put("EUR6M", std::make_shared<QuantLib::Euribor6M>());
+    SwapIndexRuntime sidx;
+    sidx.spotDays = 2;
+    sidx.floatIndexId = "EUR6M";
+    reg.swapIndices.add("EUR_SWAP", sidx);
+
+    SwaptionVolEntry cube;
+    cube.qlVolType = QuantLib::Normal;
+    cube.displacement = 0.0;
+    cube.referenceDate = evaluationDate_;
+    cube.calendar = QuantLib::TARGET();
+    cube.businessDayConvention = QuantLib::ModifiedFollowing;
+    cube.dayCounter = QuantLib::Actual365Fixed();
+    cube.volKind = quantra::enums::SwaptionVolKind_SmileCube3D;
+    cube.strikeKind = quantra::enums::SwaptionStrikeKind_SpreadFromATM;
+    cube.swapIndexId = "EUR_SWAP";
+    cube.expiries = {QuantLib::Period(1, QuantLib::Years), QuantLib::Period(2, QuantLib::Years)};
+    cube.tenors = {QuantLib::Period(5, QuantLib::Years)};
+    cube.strikes = {-0.01, 0.0, 0.01};
+    cube.volsFlat = {0.0095, 0.0085, 0.0090, 0.0092, 0.0083, 0.0088};
+    cube.nExp = 2;
+    cube.nTen = 1;
+    cube.nStrikes = 3;
+
+    SwaptionVolFinalizer finalizer(reg);
+    auto finalize = [&](const std::string& scenario, double volBump) -> const SwaptionVolEntry& {
+        return finalizer.finalize(scenario, "cube", cube, volBump, nullptr,
+                                  "disc", discountHandle_, "fwd", forwardHandle_, false);
+    };
+
+    const SwaptionVolEntry& first = finalize("base", 0.0);
+    const SwaptionVolEntry& second = finalize("base", 0.0);
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(finalizer.size(), 1u);
+    EXPECT_EQ(finalizer.hits(), 1u);
+    ASSERT_FALSE(first.handle.empty());
+    EXPECT_EQ(first.atmForwardsFlat,
+              computeServerAtmForwards(cube, sidx, reg.indices, discountHandle_, forwardHandle_));
+
+    // A vol bump or another scenario is a separate entry, equal to the unmemoized result
+    const SwaptionVolEntry& bumped = finalize("base", 1.0e-4);
+    const SwaptionVolEntry direct = finalizeSwaptionVolEntryForPricing(
+        bumpSwaptionVolEntry(cube, 1.0e-4), nullptr, reg, discountHandle_, forwardHandle_, false);
+    EXPECT_NE(&bumped, &first);
+    EXPECT_NEAR(bumped.handle->volatility(1.5, 5.0, first.atmForwardsFlat[0]),
+                direct.handle->volatility(1.5, 5.0, first.atmForwardsFlat[0]), 1e-15);
+    finalize("curve+1bp", 0.0);
+    EXPECT_EQ(finalizer.size(), 3u);
+    EXPECT_EQ(finalizer.hits(), 1u);
+}
+
+TEST_F(QuantraComparisonTest, SwaptionVolFinalizer_ChecksTradesOnlyForServerAtm) {
+    std::cout << "\n--- Test: Trade conventions only checked against server ATMs ---\n";
+
+    PricingRegistry reg;
+    reg.indices.put("EUR6M", std::make_shared<QuantLib::Euribor6M>());
+    SwapIndexRuntime sidx;
+    sidx.spotDays = 2;
+    sidx.floatIndexId = "EUR6M";
+    reg.swapIndices.add("EUR_SWAP", sidx);
+
+    SwaptionVolEntry cube;
+    cube.qlVolType = QuantLib::Normal;
+    cube.displacement = 0.0;
+    cube.referenceDate = evaluationDate_;
+    cube.calendar = QuantLib::TARGET();
+    cube.businessDayConvention = QuantLib::ModifiedFollowing;
+    cube.dayCounter = QuantLib::Actual365Fixed();
+    cube.volKind = quantra::enums::SwaptionVolKind_SmileCube3D;
+    cube.strikeKind = quantra::enums::SwaptionStrikeKind_SpreadFromATM;
+    cube.swapIndexId = "EUR_SWAP";
+    cube.expiries = {QuantLib::Period(1, QuantLib::Years), QuantLib::Period(2, QuantLib::Years)};
+    cube.tenors = {QuantLib::Period(5, QuantLib::Years)};
+    cube.strikes = {-0.01, 0.0, 0.01};
+    cube.volsFlat = {0.0095, 0.0085, 0.0090, 0.0092, 0.0083, 0.0088};
+    cube.nExp = 2;
+    cube.nTen = 1;
+    cube.nStrikes = 3;
+
+    // Client ATM forwards, not flagged as external
+    SwaptionVolEntry clientAtm = withSwaptionSmileCubeAtm(cube, {0.031, 0.032});
+    clientAtm.allowExternalAtm = false;
+
+    // A swaption floating on another index than the swap index
+    flatbuffers::grpc::MessageBuilder b;
+    auto idx = buildIndexRef(b, "USD_SOFR");
+    quantra::SwapFloatingLegBuilder flb(b);
+    flb.add_index(idx);
+    auto floating = flb.Finish();
+    quantra::VanillaSwapBuilder vsb(b);
+    vsb.add_floating_leg(floating);
+    auto swap = vsb.Finish();
+    quantra::SwaptionBuilder swb(b);
+    swb.add_underlying_type(quantra::SwaptionUnderlying_VanillaSwap);
+    swb.add_underlying(swap.Union());
+    auto swaption = swb.Finish();
+    quantra::PriceSwaptionBuilder psb(b);
+    psb.add_swaption(swaption);
+    b.Finish(psb.Finish());
+    auto trade = flatbuffers::GetRoot<quantra::PriceSwaption>(b.GetBufferPointer());
+
+    SwaptionVolFinalizer finalizer(reg);
+    auto finalize = [&](const SwaptionVolEntry& raw, const std::string& volId, bool force) {
+        return &finalizer.finalize("base", volId, raw, 0.0, trade,
+                                   "disc", discountHandle_, "fwd", forwardHandle_, force);
+    };
+
+    // Client ATMs are used as given, without checking the trade
+    const SwaptionVolEntry* asGiven = nullptr;
+    EXPECT_NO_THROW(asGiven = finalize(clientAtm, "client", false));
+    EXPECT_EQ(asGiven->atmForwardsFlat, clientAtm.atmForwardsFlat);
+
+    // Server-computed ATMs check the trade, on a miss and on a hit
+    EXPECT_THROW(finalize(clientAtm, "client", true), QuantraError);
+    EXPECT_THROW(finalize(cube, "server", false), QuantraError);
+    finalizer.finalize("base", "server", cube, 0.0, nullptr,
+                       "disc", discountHandle_, "fwd", forwardHandle_, false);
+    EXPECT_THROW(finalize(cube, "server", false), QuantraError);
+    EXPECT_EQ(finalizer.hits(), 1u);
+}
+
 // ======================== VANILLA SWAP ========================
 TEST_F(QuantraComparisonTest, VanillaSwap_NPVMatches) {
     std::cout << "\n=== Vanilla Swap ===" << std::endl;
@@ -1225,6 +2200,133 @@ TEST_F(QuantraComparisonTest, Swaption_NPVMatches) {
     EXPECT_NEAR(qlNPV, qNPV, 0.01);
 }
 
+TEST_F(QuantraComparisonTest, Swaption_RebumpSharesScenariosAcrossTrades) {
+    std::cout << "\n--- Test: Swaption rebump scenarios built once per request ---\n";
+
+    // Payer swaptions 1Yx5Y and 2Yx5Y with the given strikes, rebump on
+    struct Spec { double strike; int expiryYear; };
+    auto price = [&](const std::vector<Spec>& specs) {
+        flatbuffers::grpc::MessageBuilder b;
+        auto ts = buildCurve(b, "discount");
+        auto curves = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{ts});
+        auto volSurface = buildSwaptionVolSurface(b, "swaption_vol", 0.20);
+        auto vols = b.CreateVector(std::vector<flatbuffers::Offset<quantra::VolSurfaceSpec>>{volSurface});
+        auto model = buildSwaptionModel(b, "black_swaption_model", quantra::enums::IrModelType_Black);
+        auto models = b.CreateVector(std::vector<flatbuffers::Offset<quantra::ModelSpec>>{model});
+        auto indices = buildIndicesVector(b);
+        auto asof = b.CreateString("2025-01-15");
+        quantra::PricingBuilder pb(b);
+        pb.add_as_of_date(asof);
+        pb.add_indices(indices);
+        pb.add_curves(curves);
+        pb.add_vol_surfaces(vols);
+        pb.add_models(models);
+        pb.add_swaption_pricing_rebump(true);
+        auto pricing = pb.Finish();
+
+        auto schedule = [&](int startYear, quantra::enums::Frequency frequency) {
+            auto eff = b.CreateString(std::to_string(startYear) + "-01-17");
+            auto term = b.CreateString(std::to_string(startYear + 5) + "-01-17");
+            quantra::ScheduleBuilder sb(b);
+            sb.add_effective_date(eff);
+            sb.add_termination_date(term);
+            sb.add_calendar(quantra::enums::Calendar_TARGET);
+            sb.add_frequency(frequency);
+            sb.add_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            sb.add_termination_date_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            sb.add_date_generation_rule(quantra::enums::DateGenerationRule_Forward);
+            return sb.Finish();
+        };
+        std::vector<flatbuffers::Offset<quantra::PriceSwaption>> entries;
+        for (const auto& spec : specs) {
+            auto fixedSch = schedule(spec.expiryYear, quantra::enums::Frequency_Annual);
+            quantra::SwapFixedLegBuilder flb(b);
+            flb.add_notional(1.0e6);
+            flb.add_schedule(fixedSch);
+            flb.add_rate(spec.strike);
+            flb.add_day_counter(quantra::enums::DayCounter_Thirty360);
+            flb.add_payment_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            auto fixedLeg = flb.Finish();
+            auto floatSch = schedule(spec.expiryYear, quantra::enums::Frequency_Semiannual);
+            auto idx6m = buildIndexRef(b, "EUR_6M");
+            quantra::SwapFloatingLegBuilder flgb(b);
+            flgb.add_notional(1.0e6);
+            flgb.add_schedule(floatSch);
+            flgb.add_index(idx6m);
+            flgb.add_day_counter(quantra::enums::DayCounter_Actual360);
+            flgb.add_payment_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            auto floatLeg = flgb.Finish();
+            quantra::VanillaSwapBuilder vsb(b);
+            vsb.add_swap_type(quantra::enums::SwapType_Payer);
+            vsb.add_fixed_leg(fixedLeg);
+            vsb.add_floating_leg(floatLeg);
+            auto uswap = vsb.Finish();
+
+            auto exd = b.CreateString(std::to_string(spec.expiryYear) + "-01-15");
+            quantra::SwaptionBuilder swb(b);
+            swb.add_underlying_swap(uswap);
+            swb.add_exercise_date(exd);
+            swb.add_exercise_type(quantra::enums::ExerciseType_European);
+            swb.add_settlement_type(quantra::enums::SettlementType_Physical);
+            auto swaption = swb.Finish();
+
+            auto dc = b.CreateString("discount");
+            auto volId = b.CreateString("swaption_vol");
+            auto modelId = b.CreateString("black_swaption_model");
+            quantra::PriceSwaptionBuilder psb(b);
+            psb.add_swaption(swaption);
+            psb.add_discounting_curve(dc);
+            psb.add_forwarding_curve(dc);
+            psb.add_volatility(volId);
+            psb.add_model(modelId);
+            entries.push_back(psb.Finish());
+        }
+        auto swaptions = b.CreateVector(entries);
+        quantra::PriceSwaptionRequestBuilder rb(b);
+        rb.add_pricing(pricing);
+        rb.add_swaptions(swaptions);
+        b.Finish(rb.Finish());
+
+        SwaptionPricingRequest req;
+        auto respB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        respB->Finish(req.request(respB, flatbuffers::GetRoot<quantra::PriceSwaptionRequest>(b.GetBufferPointer())));
+        std::vector<std::array<double, 5>> out;
+        for (auto r : *flatbuffers::GetRoot<quantra::PriceSwaptionResponse>(respB->GetBufferPointer())->swaptions())
+            out.push_back({r->npv(), r->dv01(), r->gamma(), r->vega(), r->theta()});
+        return out;
+    };
+
+    const std::vector<Spec> specs = {{0.03, 2026}, {0.04, 2027}};
+
+    // Base, +1bp, -1bp and the rolled date: one bootstrap each for the
+    // request, however many swaptions it holds
+    CurveCache& cache = CurveCache::instance();
+    const bool wasEnabled = cache.enabled();
+    cache.setEnabled(true);
+    cache.backend().clear();
+    cache.resetStats();
+    auto together = price(specs);
+    EXPECT_EQ(cache.stats().l1_hits + cache.stats().l1_misses, 4u);
+    EXPECT_EQ(cache.stats().bootstraps, 4u);
+    cache.backend().clear();
+    cache.resetStats();
+    cache.setEnabled(wasEnabled);
+
+    // Each trade's risk equals the rebump of that trade on its own
+    ASSERT_EQ(together.size(), specs.size());
+    const char* names[] = {"npv", "dv01", "gamma", "vega", "theta"};
+    for (size_t i = 0; i < specs.size(); i++) {
+        auto alone = price({specs[i]});
+        ASSERT_EQ(alone.size(), 1u);
+        for (size_t k = 0; k < 5; k++) {
+            EXPECT_NEAR(together[i][k], alone[0][k], 1e-9) << "swaption " << i << " " << names[k];
+        }
+        EXPECT_NE(together[i][1], 0.0);
+        EXPECT_NE(together[i][3], 0.0);
+        EXPECT_NE(together[i][4], 0.0);
+    }
+}
+
 TEST_F(QuantraComparisonTest, Swaption_ATMMatrix_NPVMatches) {
     std::cout << "\n=== Swaption (ATM Matrix) ===" << std::endl;
     double notional = 1000000.0, strike = 0.035;
@@ -2379,6 +3481,88 @@ TEST_F(QuantraComparisonTest, CDS_NPVMatches) {
     EXPECT_NEAR(qlFair, qFair, 1e-6);
 }
 
+TEST_F(QuantraComparisonTest, CDS_UnknownStoredTradeFailsOnlyItsEntry) {
+    std::cout << "\n--- Test: PriceCDS reports unknown trade and book ids per result ---\n";
+    TradeStore& store = TradeStore::instance();
+    store.clear();
+    {
+        flatbuffers::FlatBufferBuilder b;
+        auto eff = b.CreateString("2025-01-15");
+        auto term = b.CreateString("2030-01-15");
+        quantra::ScheduleBuilder sb(b);
+        sb.add_effective_date(eff);
+        sb.add_termination_date(term);
+        sb.add_calendar(quantra::enums::Calendar_TARGET);
+        sb.add_frequency(quantra::enums::Frequency_Quarterly);
+        sb.add_date_generation_rule(quantra::enums::DateGenerationRule_TwentiethIMM);
+        auto schedule = sb.Finish();
+        quantra::CDSBuilder cdsb(b);
+        cdsb.add_side(quantra::enums::ProtectionSide_Buyer);
+        cdsb.add_notional(1.0e7);
+        cdsb.add_running_coupon(0.01);
+        cdsb.add_schedule(schedule);
+        auto cds = cdsb.Finish();
+        auto id = b.CreateString("CDS-1");
+        quantra::StoredTradeBuilder tb(b);
+        tb.add_id(id);
+        tb.add_cds(cds);
+        b.Finish(tb.Finish());
+        store.upsert(flatbuffers::GetRoot<quantra::StoredTrade>(b.GetBufferPointer()));
+    }
+
+    // The stored CDS resolves and fails later for its missing credit curve;
+    // the unknown trade and book fail on their own entries
+    flatbuffers::grpc::MessageBuilder b;
+    auto ts = buildCurve(b, "discount");
+    auto curves = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{ts});
+    auto indices = buildIndicesVector(b);
+    auto asof = b.CreateString("2025-01-15");
+    quantra::PricingBuilder pb(b);
+    pb.add_as_of_date(asof);
+    pb.add_settlement_date(asof);
+    pb.add_indices(indices);
+    pb.add_curves(curves);
+    auto pricing = pb.Finish();
+
+    std::vector<flatbuffers::Offset<quantra::PriceCDS>> entries;
+    const std::vector<std::pair<bool, std::string>> refs = {
+        {false, "CDS-1"}, {false, "MISSING-CDS"}, {true, "MISSING-BOOK"}};
+    for (const auto& ref : refs) {
+        auto id = b.CreateString(ref.second);
+        auto dc = b.CreateString("discount");
+        quantra::PriceCDSBuilder pcdsb(b);
+        if (ref.first) pcdsb.add_book_id(id);
+        else pcdsb.add_trade_id(id);
+        pcdsb.add_discounting_curve(dc);
+        entries.push_back(pcdsb.Finish());
+    }
+    auto cdss = b.CreateVector(entries);
+    quantra::PriceCDSRequestBuilder rb(b);
+    rb.add_pricing(pricing);
+    rb.add_cds_list(cdss);
+    b.Finish(rb.Finish());
+
+    CDSPricingRequest req;
+    auto respB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+    ASSERT_NO_THROW({
+        respB->Finish(req.request(respB, flatbuffers::GetRoot<quantra::PriceCDSRequest>(b.GetBufferPointer())));
+    });
+    auto results = flatbuffers::GetRoot<quantra::PriceCDSResponse>(respB->GetBufferPointer())->cds_list();
+    ASSERT_EQ(results->size(), 3u);
+    std::vector<std::string> errors;
+    for (auto r : *results) {
+        ASSERT_NE(r->error(), nullptr);
+        errors.push_back(r->error()->error_message()->str());
+    }
+    EXPECT_EQ(results->Get(0)->trade_id()->str(), "CDS-1");
+    EXPECT_NE(errors[0].find("credit_curve_id"), std::string::npos);
+    EXPECT_EQ(results->Get(1)->trade_id()->str(), "MISSING-CDS");
+    EXPECT_NE(errors[1].find("Unknown trade id: MISSING-CDS"), std::string::npos);
+    EXPECT_EQ(results->Get(2)->trade_id(), nullptr);
+    EXPECT_NE(errors[2].find("Unknown book id: MISSING-BOOK"), std::string::npos);
+    store.clear();
+}
+
 // =============================================================================
 // BootstrapCurves Tests
 // =============================================================================
@@ -2643,6 +3827,1149 @@ TEST_F(QuantraComparisonTest, BootstrapCurves_PillarDates) {
     EXPECT_GE(result->pillar_dates()->size(), 6u);
 }
 
+TEST_F(QuantraComparisonTest, CurveBootstrapper_DependencyLevels) {
+    // USD: SOFR <- LIBOR3M, EUR: ESTR <- EUR6M <- EUR12M, GBP: SONIA standalone.
+    std::unordered_map<std::string, std::vector<std::string>> deps = {
+        {"SOFR", {}},
+        {"USD_3M", {"SOFR"}},
+        {"ESTR", {}},
+        {"EUR_6M", {"ESTR"}},
+        {"EUR_12M", {"ESTR", "EUR_6M"}},
+        {"SONIA", {}},
+    };
+
+    auto levels = CurveBootstrapper::dependencyLevels(deps);
+    ASSERT_EQ(levels.size(), 3u);
+    EXPECT_EQ(levels[0], (std::vector<std::string>{"ESTR", "SOFR", "SONIA"}));
+    EXPECT_EQ(levels[1], (std::vector<std::string>{"EUR_6M", "USD_3M"}));
+    EXPECT_EQ(levels[2], (std::vector<std::string>{"EUR_12M"}));
+
+    deps["ESTR"] = {"EUR_12M"};
+    EXPECT_THROW(CurveBootstrapper::dependencyLevels(deps), std::exception);
+}
+
+TEST_F(QuantraComparisonTest, CurveCache_BumpedScenariosKeyedApart) {
+    std::cout << "\n--- Test: Curve cache keys and hits of bumped scenarios ---\n";
+    flatbuffers::grpc::MessageBuilder b;
+    auto curvesVec = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{
+        buildCurve(b, "discount")});
+    auto indices = buildIndicesVector(b);
+    auto asOf = b.CreateString("2025-01-15");
+    quantra::PricingBuilder pb(b);
+    pb.add_as_of_date(asOf);
+    pb.add_indices(indices);
+    pb.add_curves(curvesVec);
+    b.Finish(pb.Finish());
+    auto pricing = flatbuffers::GetRoot<quantra::Pricing>(b.GetBufferPointer());
+
+    // The base key carries no bump; each bump gets its own key
+    const auto* ts = pricing->curves()->Get(0);
+    const KeyContext ctx = KeyContext::build(pricing->quotes(), pricing->indices());
+    const std::map<std::string, std::string> noDeps;
+    const std::string base = CurveKeyBuilder::compute("2025-01-15", ts, ctx, noDeps);
+    const std::string up = CurveKeyBuilder::compute("2025-01-15", ts, ctx, noDeps, 1.0e-4);
+    const std::string down = CurveKeyBuilder::compute("2025-01-15", ts, ctx, noDeps, -1.0e-4);
+    EXPECT_EQ(CurveKeyBuilder::compute("2025-01-15", ts, ctx, noDeps, 0.0), base);
+    EXPECT_EQ(CurveKeyBuilder::compute("2025-01-15", ts, ctx, noDeps, -0.0), base);
+    EXPECT_NE(up, base);
+    EXPECT_NE(down, base);
+    EXPECT_NE(up, down);
+    EXPECT_NE(CurveKeyBuilder::computeStructure("2025-01-15", ts, ctx, 1.0e-4),
+              CurveKeyBuilder::computeStructure("2025-01-15", ts, ctx));
+
+    // A repeated bumped bootstrap is served from L1; the base and the other
+    // bump are not
+    CurveCache& cache = CurveCache::instance();
+    const bool wasEnabled = cache.enabled();
+    cache.setEnabled(true);
+    cache.backend().clear();
+    cache.resetStats();
+
+    CurveBootstrapper bootstrapper;
+    auto bumped = bootstrapper.bootstrapAll(pricing->curves(), nullptr, pricing->indices(), 1.0e-4);
+    EXPECT_EQ(cache.stats().l1_misses, 1u);
+    EXPECT_EQ(cache.stats().bootstraps, 1u);
+    auto again = bootstrapper.bootstrapAll(pricing->curves(), nullptr, pricing->indices(), 1.0e-4);
+    EXPECT_EQ(cache.stats().l1_hits, 1u);
+    EXPECT_EQ(cache.stats().bootstraps, 1u);
+    EXPECT_EQ(again.handles.at("discount")->currentLink(), bumped.handles.at("discount")->currentLink());
+
+    auto unbumped = bootstrapper.bootstrapAll(pricing->curves(), nullptr, pricing->indices());
+    auto bumpedDown = bootstrapper.bootstrapAll(pricing->curves(), nullptr, pricing->indices(), -1.0e-4);
+    EXPECT_EQ(cache.stats().l1_hits, 1u);
+    EXPECT_EQ(cache.stats().bootstraps, 3u);
+    const QuantLib::Date d = evaluationDate_ + 5 * QuantLib::Years;
+    const double dfUp = bumped.handles.at("discount")->currentLink()->discount(d);
+    const double dfBase = unbumped.handles.at("discount")->currentLink()->discount(d);
+    const double dfDown = bumpedDown.handles.at("discount")->currentLink()->discount(d);
+    EXPECT_LT(dfUp, dfBase);
+    EXPECT_GT(dfDown, dfBase);
+
+    cache.backend().clear();
+    cache.resetStats();
+    cache.setEnabled(wasEnabled);
+}
+
+TEST_F(QuantraComparisonTest, CurveBootstrapper_ParallelLevelsMatchSequential) {
+    std::cout << "\n--- Test: Parallel level bootstrap vs sequential ---\n";
+    // Level 0 holds a single curve, which both curves of level 1 discount on.
+    flatbuffers::grpc::MessageBuilder b;
+    auto dependent = [&](const std::string& id, double rate) {
+        std::vector<flatbuffers::Offset<quantra::PointsWrapper>> points;
+        for (int months : {6, 12}) {
+            auto tenor = buildPeriod(b, months, quantra::enums::TimeUnit_Months);
+            quantra::DepositHelperBuilder dep(b);
+            dep.add_rate(rate);
+            dep.add_tenor(tenor);
+            dep.add_fixing_days(2);
+            dep.add_calendar(quantra::enums::Calendar_TARGET);
+            dep.add_business_day_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            dep.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+            auto depOff = dep.Finish();
+            quantra::PointsWrapperBuilder pw(b);
+            pw.add_point_type(quantra::Point_DepositHelper);
+            pw.add_point(depOff.Union());
+            points.push_back(pw.Finish());
+        }
+        auto discountId = b.CreateString("discount");
+        quantra::CurveRefBuilder crb(b);
+        crb.add_id(discountId);
+        auto curveRef = crb.Finish();
+        quantra::HelperDependenciesBuilder hdb(b);
+        hdb.add_discount_curve(curveRef);
+        auto deps = hdb.Finish();
+        auto floatIdx = buildIndexRef(b, "EUR_6M");
+        auto tenor = buildPeriod(b, 5, quantra::enums::TimeUnit_Years);
+        quantra::SwapHelperBuilder sw(b);
+        sw.add_rate(rate);
+        sw.add_tenor(tenor);
+        sw.add_calendar(quantra::enums::Calendar_TARGET);
+        sw.add_sw_fixed_leg_frequency(quantra::enums::Frequency_Annual);
+        sw.add_sw_fixed_leg_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+        sw.add_sw_fixed_leg_day_counter(quantra::enums::DayCounter_Thirty360);
+        sw.add_float_index(floatIdx);
+        sw.add_deps(deps);
+        auto swOff = sw.Finish();
+        quantra::PointsWrapperBuilder pw(b);
+        pw.add_point_type(quantra::Point_SwapHelper);
+        pw.add_point(swOff.Union());
+        points.push_back(pw.Finish());
+
+        auto pointsVec = b.CreateVector(points);
+        auto cid = b.CreateString(id);
+        auto ref = b.CreateString("2025-01-15");
+        quantra::TermStructureBuilder tsb(b);
+        tsb.add_id(cid);
+        tsb.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+        tsb.add_interpolator(quantra::enums::Interpolator_LogLinear);
+        tsb.add_bootstrap_trait(quantra::enums::BootstrapTrait_Discount);
+        tsb.add_reference_date(ref);
+        tsb.add_points(pointsVec);
+        return tsb.Finish();
+    };
+
+    auto curvesVec = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{
+        buildCurve(b, "discount"),
+        dependent("fwd_a", flatRate_ + 0.001),
+        dependent("fwd_b", flatRate_ + 0.002)});
+    auto indices = buildIndicesVector(b);
+    auto asOf = b.CreateString("2025-01-15");
+    quantra::PricingBuilder pb(b);
+    pb.add_as_of_date(asOf);
+    pb.add_indices(indices);
+    pb.add_curves(curvesVec);
+    b.Finish(pb.Finish());
+    auto pricing = flatbuffers::GetRoot<quantra::Pricing>(b.GetBufferPointer());
+
+    CurveBootstrapper sequential;
+    sequential.setThreads(1);
+    auto expected = sequential.bootstrapAll(pricing->curves(), nullptr, pricing->indices());
+
+    CurveBootstrapper parallel;
+    parallel.setThreads(4);
+    for (int run = 0; run < 10; run++) {
+        auto booted = parallel.bootstrapAll(pricing->curves(), nullptr, pricing->indices());
+        for (const std::string id : {"discount", "fwd_a", "fwd_b"}) {
+            const auto& curve = booted.handles.at(id)->currentLink();
+            const auto& reference = expected.handles.at(id)->currentLink();
+            for (int years = 1; years <= 5; years++) {
+                QuantLib::Date d = evaluationDate_ + years * QuantLib::Years;
+                EXPECT_NEAR(curve->discount(d), reference->discount(d), 1e-15) << id << " " << d;
+            }
+        }
+    }
+}
+
+TEST_F(QuantraComparisonTest, WorkerPool_ReusesThreadsAcrossRuns) {
+    std::cout << "\n--- Test: Worker pool runs and thread reuse ---\n";
+    WorkerPool pool;
+    std::atomic<int> calls{0};
+    std::function<void()> work = [&]() { calls++; };
+
+    pool.run(3, work);
+    EXPECT_EQ(calls.load(), 4);
+    EXPECT_EQ(pool.threads(), 3u);
+
+    // Fewer helpers reuse the running threads; more start only the missing
+    calls = 0;
+    pool.run(2, work);
+    EXPECT_EQ(calls.load(), 3);
+    EXPECT_EQ(pool.threads(), 3u);
+    calls = 0;
+    pool.run(4, work);
+    EXPECT_EQ(calls.load(), 5);
+    EXPECT_EQ(pool.threads(), 4u);
+
+    calls = 0;
+    pool.run(0, work);
+    EXPECT_EQ(calls.load(), 1);
+}
+
+TEST_F(QuantraComparisonTest, CurveSampler_MatchesPerDateDiscount) {
+    std::cout << "\n--- Test: Batch curve sampling vs per-date discount ---\n";
+    std::vector<QuantLib::Date> grid;
+    for (QuantLib::Date d = evaluationDate_; d <= evaluationDate_ + 12 * QuantLib::Years; d++)
+        grid.push_back(d);
+
+    std::vector<QuantLib::Date> nodeDates = {
+        evaluationDate_, evaluationDate_ + 1 * QuantLib::Years,
+        evaluationDate_ + 5 * QuantLib::Years, evaluationDate_ + 20 * QuantLib::Years};
+    std::vector<QuantLib::Rate> zeros = {0.02, 0.025, 0.031, 0.035};
+    std::vector<std::shared_ptr<QuantLib::YieldTermStructure>> curves = {
+        bootstrappedCurve_,
+        std::make_shared<QuantLib::InterpolatedZeroCurve<QuantLib::Linear>>(
+            nodeDates, zeros, QuantLib::Actual365Fixed()),
+        std::make_shared<QuantLib::InterpolatedDiscountCurve<QuantLib::BackwardFlat>>(
+            nodeDates, std::vector<QuantLib::Real>{1.0, 0.98, 0.86, 0.5}, QuantLib::Actual365Fixed())};
+
+    for (const auto& curve : curves) {
+        curve->enableExtrapolation();   // the bootstrapped curve ends at 10Y
+        auto values = CurveSampler::discounts(curve, grid);
+        ASSERT_EQ(values.size(), grid.size());
+        for (size_t i = 0; i < grid.size(); i++) {
+            EXPECT_NEAR(values[i], curve->discount(grid[i]), 1e-15) << grid[i];
+        }
+    }
+}
+
+TEST_F(QuantraComparisonTest, SampleEncoding_RoundTrip) {
+    std::cout << "\n--- Test: Compact date/value encodings round trip ---\n";
+    std::vector<QuantLib::Date> daily, uneven;
+    std::vector<double> dfs;
+    for (int i = 0; i < 3650; i++) {
+        daily.push_back(evaluationDate_ + i);
+        dfs.push_back(bootstrappedCurve_->discount(daily.back()));
+    }
+    for (int m = 1; m <= 120; m++) uneven.push_back(evaluationDate_ + m * QuantLib::Months);
+
+    quantra::SampleEncoding enc;
+    enc.dates = quantra::DateEncoding_Range;
+    enc.values = quantra::ValueEncoding_DeltaFixed;
+    enc.quantum = 1e-12;
+
+    flatbuffers::FlatBufferBuilder b;
+    auto range = quantra::encodeDates(b, daily, enc);
+    auto serial = quantra::encodeDates(b, uneven, enc);
+    auto fixed = quantra::encodeValues(b, dfs, enc);
+    enc.values = quantra::ValueEncoding_Float32;
+    auto f32 = quantra::encodeValues(b, dfs, enc);
+    enc.values = quantra::ValueEncoding_DeltaFixed;
+    auto overflow = quantra::encodeValues(b, {0.0, 1.0}, enc);   // 1e12 ticks
+    EXPECT_TRUE(overflow.IsNull());
+
+    auto get = [&b](auto off) {
+        return flatbuffers::GetTemporaryPointer(b, off);
+    };
+    EXPECT_EQ(get(range)->encoding(), quantra::DateEncoding_Range);
+    EXPECT_EQ(get(serial)->encoding(), quantra::DateEncoding_Serial);
+    EXPECT_EQ(quantra::decodeDates(get(range)), daily);
+    EXPECT_EQ(quantra::decodeDates(get(serial)), uneven);
+
+    auto fixedBack = quantra::decodeValues(get(fixed));
+    auto f32Back = quantra::decodeValues(get(f32));
+    ASSERT_EQ(fixedBack.size(), dfs.size());
+    ASSERT_EQ(f32Back.size(), dfs.size());
+    for (size_t i = 0; i < dfs.size(); i++) {
+        EXPECT_NEAR(fixedBack[i], dfs[i], 1e-12);
+        EXPECT_NEAR(f32Back[i], dfs[i], 1e-7);
+    }
+}
+
+TEST_F(QuantraComparisonTest, BusinessDayCalendar_MatchesQuantLib) {
+    std::cout << "\n--- Test: Business-day bitmap vs QuantLib calendar ---\n";
+
+    std::vector<QuantLib::Calendar> calendars = {
+        QuantLib::UnitedStates(QuantLib::UnitedStates::GovernmentBond),
+        QuantLib::TARGET(),
+        QuantLib::UnitedKingdom(QuantLib::UnitedKingdom::Exchange),
+        QuantLib::JointCalendar(QuantLib::TARGET(),
+                                QuantLib::UnitedStates(QuantLib::UnitedStates::Settlement)),
+    };
+    std::vector<QuantLib::BusinessDayConvention> conventions = {
+        QuantLib::Unadjusted, QuantLib::Following, QuantLib::ModifiedFollowing,
+        QuantLib::Preceding, QuantLib::ModifiedPreceding,
+        QuantLib::HalfMonthModifiedFollowing, QuantLib::Nearest,
+    };
+    std::vector<QuantLib::Period> periods = {
+        1 * QuantLib::Days, -3 * QuantLib::Days, 30 * QuantLib::Days, 2 * QuantLib::Weeks,
+        1 * QuantLib::Months, 6 * QuantLib::Months, 10 * QuantLib::Years,
+    };
+
+    for (const auto& calendar : calendars) {
+        BusinessDayCalendar fast(calendar);
+        // Includes the ends of the default horizon, where lookups fall back
+        for (QuantLib::Date d(20, QuantLib::December, 1989);
+             d <= QuantLib::Date(10, QuantLib::January, 1991); d++) {
+            ASSERT_EQ(fast.isBusinessDay(d), calendar.isBusinessDay(d)) << calendar.name() << " " << d;
+        }
+        for (QuantLib::Date d(1, QuantLib::January, 2024);
+             d <= QuantLib::Date(31, QuantLib::December, 2026); d++) {
+            ASSERT_EQ(fast.isBusinessDay(d), calendar.isBusinessDay(d)) << calendar.name() << " " << d;
+            for (auto c : conventions) {
+                ASSERT_EQ(fast.adjust(d, c), calendar.adjust(d, c))
+                    << calendar.name() << " " << d << " " << c;
+                for (const auto& p : periods) {
+                    ASSERT_EQ(fast.advance(d, p, c), calendar.advance(d, p, c))
+                        << calendar.name() << " " << d << " " << p << " " << c;
+                }
+            }
+            ASSERT_EQ(fast.advance(d, 1, QuantLib::Months, QuantLib::Following, true),
+                      calendar.advance(d, 1, QuantLib::Months, QuantLib::Following, true)) << d;
+        }
+        for (QuantLib::Date d(15, QuantLib::December, 2100);
+             d <= QuantLib::Date(15, QuantLib::January, 2101); d++) {
+            ASSERT_EQ(fast.advance(d, 5, QuantLib::Days), calendar.advance(d, 5, QuantLib::Days))
+                << calendar.name() << " " << d;
+            ASSERT_EQ(fast.adjust(d, QuantLib::Nearest), calendar.adjust(d, QuantLib::Nearest))
+                << calendar.name() << " " << d;
+        }
+    }
+}
+
+TEST_F(QuantraComparisonTest, YearFractions_MatchQuantLib) {
+    std::cout << "\n--- Test: Batch year fractions vs DayCounter::yearFraction ---\n";
+
+    std::vector<QuantLib::DayCounter> dayCounters = {
+        QuantLib::Actual360(),
+        QuantLib::Actual365Fixed(),
+        QuantLib::Thirty360(QuantLib::Thirty360::BondBasis),
+        QuantLib::Thirty360(QuantLib::Thirty360::European),
+        QuantLib::ActualActual(QuantLib::ActualActual::ISDA),
+        QuantLib::Actual360(true),      // not batched
+        QuantLib::SimpleDayCounter(),   // not batched
+    };
+
+    // Month ends, February 28/29 and year boundaries in both directions
+    std::vector<QuantLib::Date> dates;
+    for (QuantLib::Date d(25, QuantLib::December, 2023); d <= QuantLib::Date(5, QuantLib::March, 2025); d += 3)
+        dates.push_back(d);
+    dates.push_back(QuantLib::Date(31, QuantLib::January, 2030));
+    dates.push_back(QuantLib::Date(29, QuantLib::February, 2028));
+    dates.push_back(QuantLib::Date(30, QuantLib::June, 2020));
+
+    std::vector<QuantLib::Date> starts(dates.rbegin(), dates.rend());
+    for (const auto& dc : dayCounters) {
+        for (const auto& start : {evaluationDate_, QuantLib::Date(31, QuantLib::August, 2024)}) {
+            auto fromStart = YearFractions::from(dc, start, dates);
+            ASSERT_EQ(fromStart.size(), dates.size());
+            for (size_t i = 0; i < dates.size(); i++) {
+                EXPECT_EQ(fromStart[i], dc.yearFraction(start, dates[i]))
+                    << dc.name() << " " << start << " " << dates[i];
+            }
+        }
+        auto between = YearFractions::between(dc, starts, dates);
+        for (size_t i = 0; i < dates.size(); i++) {
+            EXPECT_EQ(between[i], dc.yearFraction(starts[i], dates[i]))
+                << dc.name() << " " << starts[i] << " " << dates[i];
+        }
+    }
+}
+
+TEST_F(QuantraComparisonTest, CurveCache_DiscountTableMatchesCurve) {
+    std::cout << "\n--- Test: Dense DF table of a hot cached curve ---\n";
+
+    DiscountTableConfig tables;
+    tables.enabled = true;
+    tables.minHits = 2;
+    InProcessCurveCache cache(10, tables);
+    cache.putL1("hot", bootstrappedCurve_);
+
+    cache.getL1("hot");
+    EXPECT_EQ(cache.discountTable(bootstrappedCurve_.get()), nullptr);
+    cache.getL1("hot");
+    auto table = cache.discountTable(bootstrappedCurve_.get());
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(cache.tableBytesL1(), table->bytes());
+    EXPECT_EQ(table->referenceDate(), bootstrappedCurve_->referenceDate());
+
+    const QuantLib::Date maxDate = bootstrappedCurve_->maxDate();
+    EXPECT_FALSE(table->covers(bootstrappedCurve_->referenceDate() - 1));
+    EXPECT_FALSE(table->covers(maxDate + 1));
+    for (QuantLib::Date d = bootstrappedCurve_->referenceDate(); d <= maxDate; d++) {
+        ASSERT_TRUE(table->covers(d));
+        ASSERT_EQ(table->discount(d), bootstrappedCurve_->discount(d)) << d;
+    }
+
+    // Eviction releases the table's memory
+    InProcessCurveCache single(1, tables);
+    single.putL1("hot", bootstrappedCurve_);
+    single.getL1("hot");
+    single.getL1("hot");
+    EXPECT_GT(single.tableBytesL1(), 0u);
+    single.putL1("other", std::make_shared<QuantLib::FlatForward>(
+        evaluationDate_, 0.03, QuantLib::Actual365Fixed()));
+    EXPECT_EQ(single.discountTable(bootstrappedCurve_.get()), nullptr);
+    EXPECT_EQ(single.tableBytesL1(), 0u);
+
+    // A table that does not fit the memory budget is not built
+    tables.maxBytes = 1024;
+    InProcessCurveCache small(10, tables);
+    small.putL1("hot", bootstrappedCurve_);
+    small.getL1("hot");
+    small.getL1("hot");
+    EXPECT_EQ(small.discountTable(bootstrappedCurve_.get()), nullptr);
+    EXPECT_EQ(small.tableBytesL1(), 0u);
+
+    // ...and does not evict the tables that do fit
+    auto shortCurve = std::make_shared<QuantLib::InterpolatedDiscountCurve<QuantLib::LogLinear>>(
+        std::vector<QuantLib::Date>{evaluationDate_, evaluationDate_ + 1 * QuantLib::Years},
+        std::vector<QuantLib::Real>{1.0, 0.97}, QuantLib::Actual365Fixed());
+    tables.maxBytes = 8192;   // a 1Y table fits, a 10Y one does not
+    InProcessCurveCache mixed(10, tables);
+    mixed.putL1("short", shortCurve);
+    mixed.getL1("short");
+    mixed.getL1("short");
+    ASSERT_NE(mixed.discountTable(shortCurve.get()), nullptr);
+    const size_t shortBytes = mixed.tableBytesL1();
+    mixed.putL1("hot", bootstrappedCurve_);
+    mixed.getL1("hot");
+    mixed.getL1("hot");
+    EXPECT_EQ(mixed.discountTable(bootstrappedCurve_.get()), nullptr);
+    EXPECT_NE(mixed.discountTable(shortCurve.get()), nullptr);
+    EXPECT_EQ(mixed.tableBytesL1(), shortBytes);
+}
+
+TEST_F(QuantraComparisonTest, WarmStartBootstrap_MatchesColdBootstrap) {
+    std::cout << "\n--- Test: Warm-started re-bootstrap vs cold bootstrap ---\n";
+    const std::vector<std::pair<std::string, int>> deposits = {
+        {"DEP_3M", 3}, {"DEP_6M", 6}, {"DEP_9M", 9}, {"DEP_12M", 12}};
+
+    flatbuffers::grpc::MessageBuilder b;
+    std::vector<flatbuffers::Offset<quantra::PointsWrapper>> points;
+    for (const auto& d : deposits) {
+        auto tenor = buildPeriod(b, d.second, quantra::enums::TimeUnit_Months);
+        auto qid = b.CreateString(d.first);
+        quantra::DepositHelperBuilder dep(b);
+        dep.add_quote_id(qid);
+        dep.add_tenor(tenor);
+        dep.add_fixing_days(2);
+        dep.add_calendar(quantra::enums::Calendar_TARGET);
+        dep.add_business_day_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+        dep.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+        auto depOff = dep.Finish();
+        quantra::PointsWrapperBuilder pw(b);
+        pw.add_point_type(quantra::Point_DepositHelper);
+        pw.add_point(depOff.Union());
+        points.push_back(pw.Finish());
+    }
+    auto pointsVec = b.CreateVector(points);
+    auto cid = b.CreateString("discount");
+    auto ref = b.CreateString("2025-01-15");
+    quantra::TermStructureBuilder tsb(b);
+    tsb.add_id(cid);
+    tsb.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+    tsb.add_interpolator(quantra::enums::Interpolator_LogLinear);
+    tsb.add_bootstrap_trait(quantra::enums::BootstrapTrait_Discount);
+    tsb.add_reference_date(ref);
+    tsb.add_points(pointsVec);
+    b.Finish(tsb.Finish());
+    auto ts = flatbuffers::GetRoot<quantra::TermStructure>(b.GetBufferPointer());
+
+    QuoteRegistry before, after;
+    for (const auto& d : deposits) {
+        before.upsert(d.first, flatRate_);
+        after.upsert(d.first, d.first == "DEP_9M" ? flatRate_ + 0.0025 : flatRate_);
+    }
+
+    // First solve records its nodes
+    TermStructureParser parser;
+    auto sink = std::make_shared<BootstrapSeed>();
+    parser.setWarmStart(nullptr, sink);
+    auto first = parser.parse(ts, &before, nullptr, nullptr);
+    first->maxDate();
+    ASSERT_EQ(sink->dates.size(), deposits.size() + 1);
+    auto seed = std::make_shared<const BootstrapSeed>(*sink);
+
+    // 9M quote ticks: warm re-bootstrap vs a bootstrap from scratch
+    parser.setWarmStart(seed, nullptr);
+    auto warm = parser.parse(ts, &after, nullptr, nullptr);
+    parser.setWarmStart(nullptr, nullptr);
+    auto cold = parser.parse(ts, &after, nullptr, nullptr);
+
+    for (size_t i = 1; i < seed->dates.size(); i++) {
+        const auto& d = seed->dates[i];
+        std::cout << d << " warm: " << warm->discount(d) << " | cold: " << cold->discount(d) << std::endl;
+        EXPECT_NEAR(warm->discount(d), cold->discount(d), 1e-12);
+    }
+    // Pillars before the changed quote are reused as-is
+    EXPECT_EQ(warm->discount(seed->dates[1]), seed->data[1]);
+    EXPECT_EQ(warm->discount(seed->dates[2]), seed->data[2]);
+    EXPECT_NE(warm->discount(seed->dates[3]), seed->data[3]);
+}
+
+/// Deposit helper whose every solver evaluation takes a couple of milliseconds.
+class SlowDepositHelper : public QuantLib::DepositRateHelper {
+public:
+    using QuantLib::DepositRateHelper::DepositRateHelper;
+
+    QuantLib::Real impliedQuote() const override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return QuantLib::DepositRateHelper::impliedQuote();
+    }
+};
+
+TEST_F(QuantraComparisonTest, WarmStartBootstrap_ColdFallbackHitsDeadline) {
+    std::cout << "\n--- Test: Deadline inside the cold fallback bootstrap ---\n";
+    std::vector<std::shared_ptr<QuantLib::RateHelper>> instruments;
+    for (int months : {1, 2, 3, 4, 6, 9, 12}) {
+        instruments.push_back(std::make_shared<SlowDepositHelper>(
+            flatRate_, months * QuantLib::Months, 2, QuantLib::TARGET(),
+            QuantLib::ModifiedFollowing, true, QuantLib::Actual365Fixed()));
+    }
+
+    // Seed of another structure: the warm solve gives up and falls back
+    auto seed = std::make_shared<BootstrapSeed>();
+    seed->dates = {evaluationDate_, evaluationDate_ + 1 * QuantLib::Years};
+    seed->data = {1.0, 0.97};
+    seed->quotes = {flatRate_};
+
+    auto deadline = std::make_shared<const BootstrapDeadline>(BootstrapDeadline{
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(20)});
+    using Curve = WarmStartCurve<QuantLib::Discount, QuantLib::LogLinear>;
+    auto curve = std::make_shared<Curve>(
+        evaluationDate_, instruments, QuantLib::Actual365Fixed(), QuantLib::LogLinear(),
+        Curve::bootstrap_type(seed, nullptr, 1.0e-12, QuantLib::MAX_FUNCTION_EVALUATIONS, deadline));
+
+    EXPECT_THROW(curve->maxDate(), BootstrapTimeout);
+
+    // Only the first calculation is bounded
+    EXPECT_NO_THROW(curve->maxDate());
+    EXPECT_GT(curve->discount(evaluationDate_ + 1 * QuantLib::Years), 0.0);
+}
+
+TEST_F(QuantraComparisonTest, BootstrapBudget_OverrunFailsFast) {
+    std::cout << "\n--- Test: Bootstrap budget overrun ---\n";
+    flatbuffers::grpc::MessageBuilder b;
+    std::vector<flatbuffers::Offset<quantra::PointsWrapper>> points;
+    for (int months : {3, 6, 12}) {
+        auto tenor = buildPeriod(b, months, quantra::enums::TimeUnit_Months);
+        quantra::DepositHelperBuilder dep(b);
+        dep.add_rate(flatRate_);
+        dep.add_tenor(tenor);
+        dep.add_fixing_days(2);
+        dep.add_calendar(quantra::enums::Calendar_TARGET);
+        dep.add_business_day_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+        dep.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+        auto depOff = dep.Finish();
+        quantra::PointsWrapperBuilder pw(b);
+        pw.add_point_type(quantra::Point_DepositHelper);
+        pw.add_point(depOff.Union());
+        points.push_back(pw.Finish());
+    }
+    auto pointsVec = b.CreateVector(points);
+    auto cid = b.CreateString("discount");
+    quantra::TermStructureBuilder tsb(b);
+    tsb.add_id(cid);
+    tsb.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+    tsb.add_interpolator(quantra::enums::Interpolator_LogLinear);
+    tsb.add_bootstrap_trait(quantra::enums::BootstrapTrait_Discount);
+    tsb.add_points(pointsVec);
+    auto tsOff = tsb.Finish();
+    auto curvesVec = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{tsOff});
+    auto asOf = b.CreateString("2025-01-15");
+    quantra::PricingBuilder pb(b);
+    pb.add_as_of_date(asOf);
+    pb.add_curves(curvesVec);
+    b.Finish(pb.Finish());
+    auto pricing = flatbuffers::GetRoot<quantra::Pricing>(b.GetBufferPointer());
+
+    CurveBootstrapper bootstrapper;
+
+    // Within budget: bootstrapped eagerly, nothing stale
+    auto budget = BootstrapBudget::start(60000, false);
+    auto booted = bootstrapper.bootstrapAll(
+        pricing->curves(), nullptr, nullptr, 0.0, nullptr, nullptr, &budget);
+    ASSERT_EQ(booted.handles.count("discount"), 1u);
+    EXPECT_GT(booted.handles.at("discount")->currentLink()->discount(1.0), 0.0);
+    EXPECT_TRUE(booted.stale.empty());
+
+    // Budget already spent, no previous solve to fall back on
+    BootstrapBudget spent;
+    spent.budgetMs = 1;
+    spent.staleFallback = true;
+    spent.deadline = std::make_shared<const BootstrapDeadline>(
+        BootstrapDeadline{std::chrono::steady_clock::now() - std::chrono::milliseconds(1)});
+    EXPECT_THROW(
+        bootstrapper.bootstrapAll(pricing->curves(), nullptr, nullptr, 0.0, nullptr, nullptr, &spent),
+        QuantraError);
+}
+
+TEST_F(QuantraComparisonTest, BootstrapCurves_UnqueriedCurveNotBootstrapped) {
+    std::cout << "\n--- Test: BootstrapCurves Unqueried Curve Not Bootstrapped ---\n";
+
+    flatbuffers::grpc::MessageBuilder b;
+
+    std::vector<flatbuffers::Offset<quantra::Period>> tenors;
+    tenors.push_back(buildPeriod(b, 5, quantra::enums::TimeUnit_Years));
+    auto tenors_vec = b.CreateVector(tenors);
+
+    quantra::TenorGridBuilder tgb(b);
+    tgb.add_tenors(tenors_vec);
+    auto tenor_grid = tgb.Finish();
+
+    quantra::DateGridSpecBuilder cgsb(b);
+    cgsb.add_grid_type(quantra::DateGrid_TenorGrid);
+    cgsb.add_grid(tenor_grid.Union());
+    auto grid_spec = cgsb.Finish();
+
+    std::vector<int8_t> measures_vec = {static_cast<int8_t>(quantra::CurveMeasure_DF)};
+    auto measures = b.CreateVector(measures_vec);
+
+    auto curve_id = b.CreateString("test_curve");
+    quantra::CurveQuerySpecBuilder cqb(b);
+    cqb.add_curve_id(curve_id);
+    cqb.add_measures(measures);
+    cqb.add_grid(grid_spec);
+    auto query = cqb.Finish();
+
+    std::vector<flatbuffers::Offset<quantra::CurveQuerySpec>> queries_vec;
+    queries_vec.push_back(query);
+    auto queries = b.CreateVector(queries_vec);
+
+    // The second curve has no points and would fail to bootstrap. Nothing
+    // references it, so it must never be built.
+    auto curve = buildCurve(b, "test_curve");
+    auto unused_id = b.CreateString("unused_curve");
+    quantra::TermStructureBuilder unused_tsb(b);
+    unused_tsb.add_id(unused_id);
+    auto unused_curve = unused_tsb.Finish();
+
+    std::vector<flatbuffers::Offset<quantra::TermStructure>> curves_vec;
+    curves_vec.push_back(curve);
+    curves_vec.push_back(unused_curve);
+    auto curves = b.CreateVector(curves_vec);
+
+    auto indices = buildIndicesVector(b);
+
+    auto as_of = b.CreateString("2025-01-15");
+    quantra::PricingBuilder pb(b);
+    pb.add_as_of_date(as_of);
+    pb.add_indices(indices);
+    pb.add_curves(curves);
+    auto pricing = pb.Finish();
+
+    quantra::BootstrapCurvesRequestBuilder reqb(b);
+    reqb.add_pricing(pricing);
+    reqb.add_queries(queries);
+    b.Finish(reqb.Finish());
+
+    auto request = flatbuffers::GetRoot<quantra::BootstrapCurvesRequest>(b.GetBufferPointer());
+    BootstrapCurvesRequestHandler handler;
+    auto response_builder = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+    auto response_offset = handler.request(response_builder, request);
+    response_builder->Finish(response_offset);
+
+    auto response = flatbuffers::GetRoot<quantra::BootstrapCurvesResponse>(response_builder->GetBufferPointer());
+
+    ASSERT_EQ(response->results()->size(), 1u);
+    auto result = response->results()->Get(0);
+    ASSERT_EQ(result->error(), nullptr);
+    ASSERT_EQ(result->series()->size(), 1u);
+
+    QuantLib::Date d5y = bootstrappedCurve_->referenceDate() + 5 * QuantLib::Years;
+    EXPECT_NEAR(result->series()->Get(0)->values()->Get(0), bootstrappedCurve_->discount(d5y), 1e-10);
+}
+
+TEST_F(QuantraComparisonTest, BootstrapCurves_StreamMatchesUnary) {
+    std::cout << "\n--- Test: BootstrapCurves stream vs unary ---\n";
+
+    flatbuffers::grpc::MessageBuilder b;
+
+    std::vector<flatbuffers::Offset<quantra::Period>> tenors;
+    tenors.push_back(buildPeriod(b, 2, quantra::enums::TimeUnit_Years));
+    tenors.push_back(buildPeriod(b, 5, quantra::enums::TimeUnit_Years));
+    auto tenors_vec = b.CreateVector(tenors);
+
+    quantra::TenorGridBuilder tgb(b);
+    tgb.add_tenors(tenors_vec);
+    auto tenor_grid = tgb.Finish();
+
+    quantra::DateGridSpecBuilder cgsb(b);
+    cgsb.add_grid_type(quantra::DateGrid_TenorGrid);
+    cgsb.add_grid(tenor_grid.Union());
+    auto grid_spec = cgsb.Finish();
+
+    std::vector<int8_t> measures_vec = {static_cast<int8_t>(quantra::CurveMeasure_DF)};
+    auto measures = b.CreateVector(measures_vec);
+
+    // The second query fails; its error must come back in its own message.
+    std::vector<flatbuffers::Offset<quantra::CurveQuerySpec>> queries_vec;
+    for (const char* id : {"test_curve", "missing_curve", "test_curve"}) {
+        auto curve_id = b.CreateString(id);
+        quantra::CurveQuerySpecBuilder cqb(b);
+        cqb.add_curve_id(curve_id);
+        cqb.add_measures(measures);
+        cqb.add_grid(grid_spec);
+        queries_vec.push_back(cqb.Finish());
+    }
+    auto queries = b.CreateVector(queries_vec);
+
+    std::vector<flatbuffers::Offset<quantra::TermStructure>> curves_vec;
+    curves_vec.push_back(buildCurve(b, "test_curve"));
+    auto curves = b.CreateVector(curves_vec);
+    auto indices = buildIndicesVector(b);
+
+    auto as_of = b.CreateString("2025-01-15");
+    quantra::PricingBuilder pb(b);
+    pb.add_as_of_date(as_of);
+    pb.add_indices(indices);
+    pb.add_curves(curves);
+    auto pricing = pb.Finish();
+
+    quantra::BootstrapCurvesRequestBuilder reqb(b);
+    reqb.add_pricing(pricing);
+    reqb.add_queries(queries);
+    b.Finish(reqb.Finish());
+
+    auto request = flatbuffers::GetRoot<quantra::BootstrapCurvesRequest>(b.GetBufferPointer());
+    BootstrapCurvesRequestHandler handler;
+    auto unary_builder = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+    unary_builder->Finish(handler.request(unary_builder, request));
+    auto unary = flatbuffers::GetRoot<quantra::BootstrapCurvesResponse>(unary_builder->GetBufferPointer());
+    ASSERT_EQ(unary->results()->size(), 3u);
+
+    BootstrapCurvesRequestHandler::Stream stream(request);
+    flatbuffers::uoffset_t n = 0;
+    while (!stream.done()) {
+        auto builder = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        builder->Finish(stream.next(builder));
+        auto message = flatbuffers::GetRoot<quantra::BootstrapCurvesResponse>(builder->GetBufferPointer());
+        ASSERT_EQ(message->results()->size(), 1u);
+        ASSERT_LT(n, unary->results()->size());
+
+        auto streamed = message->results()->Get(0);
+        auto expected = unary->results()->Get(n++);
+        EXPECT_EQ(streamed->id()->str(), expected->id()->str());
+        ASSERT_EQ(streamed->error() != nullptr, expected->error() != nullptr);
+        if (expected->error()) continue;
+        auto values = streamed->series()->Get(0)->values();
+        auto expectedValues = expected->series()->Get(0)->values();
+        ASSERT_EQ(values->size(), expectedValues->size());
+        for (flatbuffers::uoffset_t i = 0; i < values->size(); i++) {
+            EXPECT_EQ(values->Get(i), expectedValues->Get(i));
+        }
+    }
+    EXPECT_EQ(n, 3u);
+    EXPECT_NE(unary->results()->Get(1)->error(), nullptr);
+}
+
+// =============================================================================
+// ComputeCurveRisk Tests
+// =============================================================================
+
+TEST_F(QuantraComparisonTest, CurveRisk_BondBucketsMatchRebootstrap) {
+    std::cout << "\n--- Test: CurveRisk bucketed DV01 vs bump-and-rebootstrap ---\n";
+    double face = 100.0, coupon = 0.05;
+    QuantLib::Date issue(15, QuantLib::January, 2024), mat(15, QuantLib::January, 2029);
+
+    // QuantLib reference: same helpers as the fixture curve, on SimpleQuotes
+    std::vector<std::shared_ptr<QuantLib::SimpleQuote>> quotes;
+    for (int i = 0; i < 5; i++)
+        quotes.push_back(std::make_shared<QuantLib::SimpleQuote>(flatRate_));
+
+    std::vector<std::shared_ptr<QuantLib::RateHelper>> instruments;
+    QuantLib::Period depTenors[] = {3 * QuantLib::Months, 6 * QuantLib::Months, 1 * QuantLib::Years};
+    for (int i = 0; i < 3; i++)
+        instruments.push_back(std::make_shared<QuantLib::DepositRateHelper>(
+            QuantLib::Handle<QuantLib::Quote>(quotes[i]), depTenors[i], 2, QuantLib::TARGET(),
+            QuantLib::ModifiedFollowing, true, QuantLib::Actual365Fixed()));
+    auto euribor6m = std::make_shared<QuantLib::Euribor6M>();
+    QuantLib::Period swapTenors[] = {5 * QuantLib::Years, 10 * QuantLib::Years};
+    for (int i = 0; i < 2; i++)
+        instruments.push_back(std::make_shared<QuantLib::SwapRateHelper>(
+            QuantLib::Handle<QuantLib::Quote>(quotes[3 + i]), swapTenors[i], QuantLib::TARGET(),
+            QuantLib::Annual, QuantLib::ModifiedFollowing,
+            QuantLib::Thirty360(QuantLib::Thirty360::BondBasis), euribor6m));
+    auto qlCurve = std::make_shared<QuantLib::PiecewiseYieldCurve<QuantLib::Discount, QuantLib::LogLinear>>(
+        evaluationDate_, instruments, QuantLib::Actual365Fixed());
+
+    QuantLib::Schedule sch(issue, mat, QuantLib::Period(QuantLib::Annual), QuantLib::TARGET(),
+        QuantLib::Unadjusted, QuantLib::Unadjusted, QuantLib::DateGeneration::Backward, false);
+    QuantLib::FixedRateBond qlBond(2, face, sch,
+        std::vector<QuantLib::Rate>(1, coupon), QuantLib::ActualActual(QuantLib::ActualActual::ISDA));
+    qlBond.setPricingEngine(std::make_shared<QuantLib::DiscountingBondEngine>(
+        QuantLib::Handle<QuantLib::YieldTermStructure>(qlCurve)));
+
+    std::vector<double> qlDv01;
+    for (auto& q : quotes) {
+        q->setValue(flatRate_ + 1e-4);
+        double up = qlBond.NPV();
+        q->setValue(flatRate_ - 1e-4);
+        double down = qlBond.NPV();
+        q->setValue(flatRate_);
+        qlDv01.push_back((up - down) / 2.0);
+    }
+
+    // Quantra request: the fixture curve (inline quotes) and the same bond
+    flatbuffers::grpc::MessageBuilder b;
+    auto ts = buildCurve(b, "discount");
+    auto curves = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{ts});
+    auto indices = buildIndicesVector(b);
+    auto asof = b.CreateString("2025-01-15");
+    quantra::PricingBuilder pb(b);
+    pb.add_as_of_date(asof);
+    pb.add_settlement_date(asof);
+    pb.add_indices(indices);
+    pb.add_curves(curves);
+    auto pricing = pb.Finish();
+
+    auto eff = b.CreateString("2024-01-15");
+    auto term = b.CreateString("2029-01-15");
+    quantra::ScheduleBuilder sb(b);
+    sb.add_effective_date(eff);
+    sb.add_termination_date(term);
+    sb.add_calendar(quantra::enums::Calendar_TARGET);
+    sb.add_frequency(quantra::enums::Frequency_Annual);
+    sb.add_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+    sb.add_termination_date_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+    sb.add_date_generation_rule(quantra::enums::DateGenerationRule_Backward);
+    sb.add_end_of_month(false);
+    auto schedule = sb.Finish();
+
+    auto idate = b.CreateString("2024-01-15");
+    quantra::FixedRateBondBuilder bb(b);
+    bb.add_settlement_days(2);
+    bb.add_face_amount(face);
+    bb.add_schedule(schedule);
+    bb.add_rate(coupon);
+    bb.add_accrual_day_counter(quantra::enums::DayCounter_ActualActual);
+    bb.add_issue_date(idate);
+    bb.add_redemption(100.0);
+    bb.add_payment_convention(quantra::enums::BusinessDayConvention_Unadjusted);
+    auto bond = bb.Finish();
+
+    auto dc = b.CreateString("discount");
+    quantra::PriceFixedRateBondBuilder pfb(b);
+    pfb.add_fixed_rate_bond(bond);
+    pfb.add_discounting_curve(dc);
+    auto bonds = b.CreateVector(std::vector<flatbuffers::Offset<quantra::PriceFixedRateBond>>{pfb.Finish()});
+
+    quantra::ComputeCurveRiskRequestBuilder rb(b);
+    rb.add_pricing(pricing);
+    rb.add_bonds(bonds);
+    b.Finish(rb.Finish());
+
+    CurveRiskRequestHandler handler;
+    auto respB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+    auto resp = handler.request(respB, flatbuffers::GetRoot<quantra::ComputeCurveRiskRequest>(b.GetBufferPointer()));
+    respB->Finish(resp);
+    auto response = flatbuffers::GetRoot<quantra::ComputeCurveRiskResponse>(respB->GetBufferPointer());
+
+    ASSERT_EQ(response->trades()->size(), 1u);
+    auto trade = response->trades()->Get(0);
+    ASSERT_EQ(trade->error(), nullptr);
+    EXPECT_NEAR(trade->npv(), qlBond.NPV(), 1e-6);
+    ASSERT_EQ(trade->buckets()->size(), 5u);
+
+    for (int i = 0; i < 5; i++) {
+        auto bucket = trade->buckets()->Get(i);
+        EXPECT_EQ(bucket->quote_id()->str(), "discount[" + std::to_string(i) + "]");
+        EXPECT_EQ(bucket->curve_id()->str(), "discount");
+        std::cout << bucket->quote_id()->str() << " QuantLib: " << qlDv01[i]
+                  << " | Quantra: " << bucket->dv01() << std::endl;
+        EXPECT_NEAR(bucket->dv01(), qlDv01[i], 1e-5);
+    }
+}
+
+TEST_F(QuantraComparisonTest, CurveRisk_BumpQuotesMatchesJacobian) {
+    std::cout << "\n--- Test: CurveRisk BumpQuotes vs Jacobian ---\n";
+    const std::vector<std::pair<std::string, int>> deposits = {
+        {"DEP_3M", 3}, {"DEP_6M", 6}, {"DEP_12M", 12}};
+
+    auto jacB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+    auto bumpB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+    auto jac = runDepositCurveRisk(deposits, quantra::CurveRiskMethod_Jacobian, jacB)->trades()->Get(0);
+    auto bump = runDepositCurveRisk(deposits, quantra::CurveRiskMethod_BumpQuotes, bumpB)->trades()->Get(0);
+
+    ASSERT_EQ(jac->error(), nullptr);
+    ASSERT_EQ(bump->error(), nullptr);
+    EXPECT_NEAR(bump->npv(), jac->npv(), 1e-10);
+    ASSERT_EQ(bump->buckets()->size(), deposits.size());
+    ASSERT_EQ(jac->buckets()->size(), deposits.size());
+
+    for (size_t i = 0; i < deposits.size(); i++) {
+        auto bb = bump->buckets()->Get(i);
+        auto jb = jac->buckets()->Get(i);
+        EXPECT_EQ(bb->quote_id()->str(), deposits[i].first);
+        EXPECT_EQ(bb->curve_id()->str(), "discount");
+        EXPECT_EQ(jb->quote_id()->str(), deposits[i].first);
+        std::cout << deposits[i].first << " Jacobian: " << jb->dv01()
+                  << " | BumpQuotes: " << bb->dv01() << std::endl;
+        EXPECT_NEAR(bb->dv01(), jb->dv01(), 1e-5);
+    }
+}
+
+TEST_F(QuantraComparisonTest, CurveRisk_JacobianFollowsCurveTraitAndInterpolator) {
+    std::cout << "\n--- Test: CurveRisk Jacobian beyond Discount/LogLinear curves ---\n";
+    const std::vector<std::pair<std::string, int>> deposits = {
+        {"DEP_3M", 3}, {"DEP_6M", 6}, {"DEP_12M", 12}};
+    const std::vector<std::pair<quantra::enums::BootstrapTrait, quantra::enums::Interpolator>> specs = {
+        {quantra::enums::BootstrapTrait_ZeroRate, quantra::enums::Interpolator_Linear},
+        {quantra::enums::BootstrapTrait_FwdRate, quantra::enums::Interpolator_BackwardFlat},
+        {quantra::enums::BootstrapTrait_Discount, quantra::enums::Interpolator_ForwardFlat}};
+
+    for (const auto& spec : specs) {
+        auto jacB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        auto bumpB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        auto jac = runDepositCurveRisk(deposits, quantra::CurveRiskMethod_Jacobian, jacB,
+                                       spec.first, spec.second)->trades()->Get(0);
+        auto bump = runDepositCurveRisk(deposits, quantra::CurveRiskMethod_BumpQuotes, bumpB,
+                                        spec.first, spec.second)->trades()->Get(0);
+
+        ASSERT_EQ(jac->error(), nullptr);
+        ASSERT_EQ(bump->error(), nullptr);
+        // Node curves interpolate like the bootstrapped curve
+        EXPECT_NEAR(bump->npv(), jac->npv(), 1e-10);
+        ASSERT_EQ(jac->buckets()->size(), deposits.size());
+        for (size_t i = 0; i < deposits.size(); i++) {
+            std::cout << spec.first << "/" << spec.second << " " << deposits[i].first
+                      << " Jacobian: " << jac->buckets()->Get(i)->dv01()
+                      << " | BumpQuotes: " << bump->buckets()->Get(i)->dv01() << std::endl;
+            EXPECT_NEAR(bump->buckets()->Get(i)->dv01(), jac->buckets()->Get(i)->dv01(), 1e-5);
+        }
+    }
+}
+
+TEST_F(QuantraComparisonTest, CurveRisk_SameSwapOnTwoCurvesWithInstrumentCache) {
+    std::cout << "\n--- Test: CurveRisk keeps identical trades on their own curves ---\n";
+
+    // One swap priced on curve_a and on curve_b; with the instrument cache on,
+    // both entries have the same key
+    auto run = [&](quantra::CurveRiskMethod method,
+                   std::shared_ptr<flatbuffers::grpc::MessageBuilder> respB) {
+        flatbuffers::grpc::MessageBuilder b;
+        std::vector<flatbuffers::Offset<quantra::QuoteSpec>> quoteVec;
+        auto depositCurve = [&](const std::string& id, const std::string& prefix, double rate) {
+            std::vector<flatbuffers::Offset<quantra::PointsWrapper>> points;
+            for (int months : {3, 6, 12, 18}) {
+                const std::string quoteId = prefix + std::to_string(months) + "M";
+                auto qid = b.CreateString(quoteId);
+                quantra::QuoteSpecBuilder qb(b);
+                qb.add_id(qid);
+                qb.add_kind(quantra::QuoteKind_Rate);
+                qb.add_value(rate);
+                qb.add_quote_type(quantra::QuoteType_Curve);
+                quoteVec.push_back(qb.Finish());
+
+                auto tenor = buildPeriod(b, months, quantra::enums::TimeUnit_Months);
+                auto ref = b.CreateString(quoteId);
+                quantra::DepositHelperBuilder dep(b);
+                dep.add_quote_id(ref);
+                dep.add_tenor(tenor);
+                dep.add_fixing_days(2);
+                dep.add_calendar(quantra::enums::Calendar_TARGET);
+                dep.add_business_day_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+                dep.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+                auto depOff = dep.Finish();
+                quantra::PointsWrapperBuilder pw(b);
+                pw.add_point_type(quantra::Point_DepositHelper);
+                pw.add_point(depOff.Union());
+                points.push_back(pw.Finish());
+            }
+            auto pointsVec = b.CreateVector(points);
+            auto cid = b.CreateString(id);
+            auto ref = b.CreateString("2025-01-15");
+            quantra::TermStructureBuilder tsb(b);
+            tsb.add_id(cid);
+            tsb.add_day_counter(quantra::enums::DayCounter_Actual365Fixed);
+            tsb.add_interpolator(quantra::enums::Interpolator_LogLinear);
+            tsb.add_bootstrap_trait(quantra::enums::BootstrapTrait_Discount);
+            tsb.add_reference_date(ref);
+            tsb.add_points(pointsVec);
+            return tsb.Finish();
+        };
+        auto curveA = depositCurve("curve_a", "A_", 0.03);
+        auto curveB = depositCurve("curve_b", "B_", 0.045);
+        auto curves = b.CreateVector(std::vector<flatbuffers::Offset<quantra::TermStructure>>{curveA, curveB});
+        auto quotes = b.CreateVector(quoteVec);
+        auto indices = buildIndicesVector(b);
+        auto asof = b.CreateString("2025-01-15");
+        quantra::PricingBuilder pb(b);
+        pb.add_as_of_date(asof);
+        pb.add_settlement_date(asof);
+        pb.add_indices(indices);
+        pb.add_curves(curves);
+        pb.add_quotes(quotes);
+        auto pricing = pb.Finish();
+
+        auto schedule = [&](quantra::enums::Frequency frequency) {
+            auto eff = b.CreateString("2025-01-17");
+            auto term = b.CreateString("2026-01-19");
+            quantra::ScheduleBuilder sb(b);
+            sb.add_effective_date(eff);
+            sb.add_termination_date(term);
+            sb.add_calendar(quantra::enums::Calendar_TARGET);
+            sb.add_frequency(frequency);
+            sb.add_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            sb.add_termination_date_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            sb.add_date_generation_rule(quantra::enums::DateGenerationRule_Forward);
+            return sb.Finish();
+        };
+        std::vector<flatbuffers::Offset<quantra::PriceVanillaSwap>> entries;
+        for (const char* curveId : {"curve_a", "curve_b"}) {
+            auto fixedSch = schedule(quantra::enums::Frequency_Annual);
+            quantra::SwapFixedLegBuilder flb(b);
+            flb.add_notional(1.0e6);
+            flb.add_schedule(fixedSch);
+            flb.add_rate(0.035);
+            flb.add_day_counter(quantra::enums::DayCounter_Thirty360);
+            flb.add_payment_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            auto fixedLeg = flb.Finish();
+            auto floatSch = schedule(quantra::enums::Frequency_Semiannual);
+            auto idx6m = buildIndexRef(b, "EUR_6M");
+            quantra::SwapFloatingLegBuilder flgb(b);
+            flgb.add_notional(1.0e6);
+            flgb.add_schedule(floatSch);
+            flgb.add_index(idx6m);
+            flgb.add_day_counter(quantra::enums::DayCounter_Actual360);
+            flgb.add_payment_convention(quantra::enums::BusinessDayConvention_ModifiedFollowing);
+            auto floatLeg = flgb.Finish();
+            quantra::VanillaSwapBuilder vsb(b);
+            vsb.add_swap_type(quantra::enums::SwapType_Payer);
+            vsb.add_fixed_leg(fixedLeg);
+            vsb.add_floating_leg(floatLeg);
+            auto swap = vsb.Finish();
+
+            auto cid = b.CreateString(curveId);
+            quantra::PriceVanillaSwapBuilder pvsb(b);
+            pvsb.add_vanilla_swap(swap);
+            pvsb.add_discounting_curve(cid);
+            pvsb.add_forwarding_curve(cid);
+            entries.push_back(pvsb.Finish());
+        }
+        auto swaps = b.CreateVector(entries);
+
+        quantra::ComputeCurveRiskRequestBuilder rb(b);
+        rb.add_pricing(pricing);
+        rb.add_swaps(swaps);
+        rb.add_method(method);
+        b.Finish(rb.Finish());
+
+        CurveRiskRequestHandler handler;
+        respB->Finish(handler.request(respB, flatbuffers::GetRoot<quantra::ComputeCurveRiskRequest>(b.GetBufferPointer())));
+        return flatbuffers::GetRoot<quantra::ComputeCurveRiskResponse>(respB->GetBufferPointer());
+    };
+
+    InstrumentCache& cache = InstrumentCache::instance();
+    const bool wasEnabled = cache.enabled();
+    for (auto method : {quantra::CurveRiskMethod_Jacobian, quantra::CurveRiskMethod_BumpQuotes}) {
+        auto freshB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        auto cachedB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+        cache.clear();
+        cache.setEnabled(false);
+        auto fresh = run(method, freshB);
+        cache.setEnabled(true);
+        run(method, std::make_shared<flatbuffers::grpc::MessageBuilder>());   // warm the cache
+        auto cached = run(method, cachedB);
+
+        ASSERT_EQ(fresh->trades()->size(), 2u);
+        ASSERT_EQ(cached->trades()->size(), 2u);
+        for (flatbuffers::uoffset_t t = 0; t < 2; t++) {
+            auto f = fresh->trades()->Get(t);
+            auto c = cached->trades()->Get(t);
+            ASSERT_EQ(f->error(), nullptr);
+            ASSERT_EQ(c->error(), nullptr);
+            EXPECT_NEAR(c->npv(), f->npv(), 1e-8);
+            ASSERT_EQ(c->buckets()->size(), f->buckets()->size());
+            for (flatbuffers::uoffset_t i = 0; i < f->buckets()->size(); i++) {
+                auto fb = f->buckets()->Get(i);
+                EXPECT_EQ(c->buckets()->Get(i)->quote_id()->str(), fb->quote_id()->str());
+                EXPECT_NEAR(c->buckets()->Get(i)->dv01(), fb->dv01(), 1e-8) << fb->quote_id()->str();
+                // Each swap only moves with the quotes of its own curve
+                const char* other = (t == 0) ? "B_" : "A_";
+                if (fb->quote_id()->str().rfind(other, 0) == 0)
+                    EXPECT_NEAR(c->buckets()->Get(i)->dv01(), 0.0, 1e-10) << fb->quote_id()->str();
+            }
+        }
+        EXPECT_NE(cached->trades()->Get(0)->npv(), cached->trades()->Get(1)->npv());
+    }
+    cache.clear();
+    cache.setEnabled(wasEnabled);
+}
+
+TEST_F(QuantraComparisonTest, CurveRisk_ResolvesStoredTrades) {
+    std::cout << "\n--- Test: CurveRisk of stored trades by id and book ---\n";
+    TradeStore& store = TradeStore::instance();
+    store.clear();
+    {
+        flatbuffers::FlatBufferBuilder b;
+        auto bond = buildDepositRiskBond(b);
+        auto id = b.CreateString("RISK-BOND");
+        auto book = b.CreateString("RISK-BOOK");
+        quantra::StoredTradeBuilder tb(b);
+        tb.add_id(id);
+        tb.add_book_id(book);
+        tb.add_fixed_rate_bond(bond);
+        b.Finish(tb.Finish());
+        store.upsert(flatbuffers::GetRoot<quantra::StoredTrade>(b.GetBufferPointer()));
+    }
+
+    // The inline bond, then the stored copy by trade id and by book, then an
+    // unknown trade and an unknown book
+    auto addStored = [](flatbuffers::grpc::MessageBuilder& b,
+                        std::vector<flatbuffers::Offset<quantra::PriceFixedRateBond>>& entries) {
+        const std::vector<std::pair<bool, std::string>> refs = {
+            {false, "RISK-BOND"}, {true, "RISK-BOOK"}, {false, "MISSING-BOND"}, {true, "MISSING-BOOK"}};
+        for (const auto& ref : refs) {
+            auto id = b.CreateString(ref.second);
+            auto dc = b.CreateString("discount");
+            quantra::PriceFixedRateBondBuilder pfb(b);
+            if (ref.first) pfb.add_book_id(id);
+            else pfb.add_trade_id(id);
+            pfb.add_discounting_curve(dc);
+            entries.push_back(pfb.Finish());
+        }
+    };
+    const std::vector<std::pair<std::string, int>> deposits = {{"DEP_3M", 3}, {"DEP_6M", 6}, {"DEP_12M", 12}};
+    auto respB = std::make_shared<flatbuffers::grpc::MessageBuilder>();
+    auto trades = runDepositCurveRisk(deposits, quantra::CurveRiskMethod_Jacobian, respB,
+                                      quantra::enums::BootstrapTrait_Discount,
+                                      quantra::enums::Interpolator_LogLinear, addStored)->trades();
+
+    ASSERT_EQ(trades->size(), 5u);
+    auto inlineBond = trades->Get(0);
+    ASSERT_EQ(inlineBond->error(), nullptr);
+    EXPECT_EQ(inlineBond->trade_id(), nullptr);
+    for (flatbuffers::uoffset_t t = 1; t <= 2; t++) {
+        auto stored = trades->Get(t);
+        ASSERT_EQ(stored->error(), nullptr);
+        EXPECT_EQ(stored->index(), static_cast<int>(t));
+        EXPECT_EQ(stored->trade_id()->str(), "RISK-BOND");
+        EXPECT_NEAR(stored->npv(), inlineBond->npv(), 1e-12);
+        ASSERT_EQ(stored->buckets()->size(), inlineBond->buckets()->size());
+        for (flatbuffers::uoffset_t i = 0; i < inlineBond->buckets()->size(); i++)
+            EXPECT_NEAR(stored->buckets()->Get(i)->dv01(), inlineBond->buckets()->Get(i)->dv01(), 1e-12);
+    }
+    ASSERT_NE(trades->Get(3)->error(), nullptr);
+    EXPECT_EQ(trades->Get(3)->index(), 3);
+    EXPECT_EQ(trades->Get(3)->trade_id()->str(), "MISSING-BOND");
+    EXPECT_NE(trades->Get(3)->error()->error_message()->str().find("MISSING-BOND"), std::string::npos);
+    ASSERT_NE(trades->Get(4)->error(), nullptr);
+    EXPECT_EQ(trades->Get(4)->index(), 4);
+    EXPECT_NE(trades->Get(4)->error()->error_message()->str().find("MISSING-BOOK"), std::string::npos);
+    store.clear();
+}
+
 // =============================================================================
 // SampleVolSurfaces Tests
 // =============================================================================